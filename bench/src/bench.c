@@ -0,0 +1,74 @@
+#include "bench.h"
+
+#include <core/logger.h>
+#include <core/string.h>
+#include <platform/thread.h>
+#include <platform/time.h>
+
+#include <stdio.h>
+
+// Запущена ли система задач набором измерений.
+static bool job_system_started = false;
+
+bool bench_systems_start(const memory_system_config* memory_config, const job_system_config* job_config)
+{
+    if(!memory_system_initialize(memory_config))
+    {
+        LOG_ERROR("Failed to initialize memory system.");
+        return false;
+    }
+
+    if(job_config && !job_system_initialize(job_config))
+    {
+        LOG_ERROR("Failed to initialize job system.");
+        memory_system_shutdown();
+        return false;
+    }
+
+    job_system_started = job_config != nullptr;
+    return true;
+}
+
+void bench_systems_stop()
+{
+    if(job_system_started)
+    {
+        job_system_shutdown();
+        job_system_started = false;
+    }
+
+    memory_system_shutdown();
+}
+
+f64 bench_time()
+{
+    return platform_time_uptime();
+}
+
+void bench_print(const char* format, ...)
+{
+    char buffer[1024];
+
+    __builtin_va_list args;
+    __builtin_va_start(args, format);
+    string_format_va(buffer, sizeof(buffer), format, args);
+    __builtin_va_end(args);
+
+    // NOTE: Вывод идет напрямую в stdout без цветов, чтобы результаты можно было перенаправить в файл.
+    fputs(buffer, stdout);
+    fflush(stdout);
+}
+
+u32 bench_thread_counts(u32* out_counts)
+{
+    u32 processors = MIN(platform_processor_count(), (u32)BENCH_MAX_THREADS);
+    u32 count = 0;
+
+    for(u32 threads = 1; threads <= 8 && threads < processors; threads *= 2)
+    {
+        out_counts[count++] = threads;
+    }
+
+    out_counts[count++] = processors;
+    return count;
+}
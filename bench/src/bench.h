@@ -0,0 +1,91 @@
+/*
+    @file bench.h
+    @brief Общие функции программы измерения производительности систем движка.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Запуск и остановку систем движка с нужной конфигурацией для каждого набора измерений
+            - Замер времени и вывод результатов в консоль
+            - Объявления наборов измерений (каждый набор находится в отдельном файле)
+
+    @note Особенности реализации:
+            - Платформенные подсистемы инициализируются один раз в main(), система памяти и система задач -
+              каждым набором отдельно, т.к. наборы сравнивают разные конфигурации
+            - Результаты выводятся в stdout без оформления (консоль может не быть терминалом) только из основного потока
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/memory.h>
+#include <core/job.h>
+
+// @brief Максимальное количество потоков в измерениях масштабирования.
+#define BENCH_MAX_THREADS 64
+
+// @brief Функция набора измерений.
+typedef void (*bench_suite_fn)();
+
+/*
+    @brief Запускает систему памяти и систему задач.
+    @param memory_config Конфигурация системы памяти (nullptr - конфигурация по умолчанию).
+    @param job_config Конфигурация системы задач (nullptr - система задач не запускается).
+    @return true - системы запущены, false - произошла ошибка.
+*/
+bool bench_systems_start(const memory_system_config* memory_config, const job_system_config* job_config);
+
+/*
+    @brief Останавливает системы, запущенные bench_systems_start().
+*/
+void bench_systems_stop();
+
+/*
+    @brief Возвращает монотонное время в секундах.
+    @return Время в секундах.
+*/
+f64 bench_time();
+
+/*
+    @brief Выводит форматируемую строку в стандартный поток вывода.
+    @param format Строка формата (см. string_format()).
+    @param ... Аргументы строки формата.
+*/
+void bench_print(const char* format, ...);
+
+/*
+    @brief Возвращает количество потоков для измерений масштабирования: 1, 2, 4, 8 и все процессоры.
+    @note Количество потоков не превышает BENCH_MAX_THREADS.
+    @param out_counts Массив для записи количества потоков (не меньше 5 элементов).
+    @return Количество записанных значений.
+*/
+u32 bench_thread_counts(u32* out_counts);
+
+/*
+    @brief Предотвращает удаление компилятором вычислений, результат которых не используется.
+    @param value Результат вычислений.
+*/
+INLINE void bench_keep(u64 value)
+{
+    __asm__ volatile("" : : "r"(value) : "memory");
+}
+
+// Наборы измерений.
+void bench_memory();
+void bench_allocator();
+void bench_hashmap();
+void bench_queue();
+void bench_thread();
+void bench_parallel();
+void bench_sort();
+void bench_lru();
+void bench_string();
@@ -0,0 +1,98 @@
+#include "bench.h"
+
+#include <core/containers/hashmap.h>
+#include <math/random.h>
+#include <platform/memory.h>
+
+// Общее количество сравнений ключей при линейном поиске (ограничивает время замера для больших таблиц).
+#define HASHMAP_BENCH_LINEAR_BUDGET (64ULL * 1024 * 1024)
+// Количество поисков в хеш-таблице.
+#define HASHMAP_BENCH_LOOKUPS (1024 * 1024)
+
+// Пара ключ-значение для линейного поиска.
+typedef struct hashmap_bench_pair {
+    u64 key;
+    u64 value;
+} hashmap_bench_pair;
+
+static const u64* hashmap_bench_linear_find(const hashmap_bench_pair* pairs, u64 count, u64 key)
+{
+    for(u64 i = 0; i < count; ++i)
+    {
+        if(pairs[i].key == key)
+        {
+            return &pairs[i].value;
+        }
+    }
+    return nullptr;
+}
+
+// Замеряет время поиска в наносекундах: половина ключей присутствует, половина отсутствует.
+static void hashmap_bench_size(u64 count, math_random_generator* random)
+{
+    hashmap_bench_pair* pairs = platform_memory_allocate(sizeof(hashmap_bench_pair) * count);
+    u64* queries = platform_memory_allocate(sizeof(u64) * HASHMAP_BENCH_LOOKUPS);
+
+    hash_map map;
+    hashmap_create(map, u64, u64);
+
+    for(u64 i = 0; i < count; ++i)
+    {
+        // Нечетные ключи присутствуют в таблице, четные - нет.
+        pairs[i].key = math_random_u64(random) | 1;
+        pairs[i].value = i;
+        hashmap_insert(map, pairs[i].key, pairs[i].value);
+    }
+
+    for(u64 i = 0; i < HASHMAP_BENCH_LOOKUPS; ++i)
+    {
+        u64 key = pairs[math_random_u64_range(random, 0, count)].key;
+        queries[i] = (i & 1) ? key : key & ~1ULL;
+    }
+
+    u64 linear_lookups = MAX(MIN(HASHMAP_BENCH_LINEAR_BUDGET / count, (u64)HASHMAP_BENCH_LOOKUPS), 1ULL);
+    u64 found = 0;
+
+    f64 start = bench_time();
+    for(u64 i = 0; i < linear_lookups; ++i)
+    {
+        found += hashmap_bench_linear_find(pairs, count, queries[i]) != nullptr;
+    }
+    f64 linear_ns = (bench_time() - start) * 1e9 / (f64)linear_lookups;
+
+    start = bench_time();
+    for(u64 i = 0; i < HASHMAP_BENCH_LOOKUPS; ++i)
+    {
+        found += hash_map_get(&map, &queries[i]) != nullptr;
+    }
+    f64 map_ns = (bench_time() - start) * 1e9 / (f64)HASHMAP_BENCH_LOOKUPS;
+
+    bench_keep(found);
+    bench_print("  %8llu %12.1f %12.1f %9.1fx\n", count, linear_ns, map_ns, linear_ns / map_ns);
+
+    hashmap_destroy(map);
+    platform_memory_free(queries);
+    platform_memory_free(pairs);
+}
+
+void bench_hashmap()
+{
+    if(!bench_systems_start(nullptr, nullptr))
+    {
+        return;
+    }
+
+    math_random_generator random;
+    math_random_generator_init(&random, MATH_RANDOM_GENERATOR_TYPE_WYRAND, 11);
+
+    static const u64 counts[] = { 16, 256, 64 * 1024 };
+
+    bench_print("u64 -> u64 lookups (half hits, half misses), ns per lookup:\n");
+    bench_print("  %8s %12s %12s %10s\n", "entries", "linear", "hash_map", "speedup");
+    for(u32 i = 0; i < ARRAY_SIZE(counts); ++i)
+    {
+        hashmap_bench_size(counts[i], &random);
+    }
+
+    bench_systems_stop();
+}
@@ -0,0 +1,151 @@
+#include "bench.h"
+
+#include <core/containers/hashmap.h>
+#include <core/containers/lru_cache.h>
+#include <math/random.h>
+#include <platform/memory.h>
+
+// Емкость кеша.
+#define LRU_BENCH_CAPACITY 4096
+// Количество запросов в одном измерении.
+#define LRU_BENCH_REQUESTS (4 * 1024 * 1024)
+
+// Значение кеша (например, описание загруженного ресурса).
+typedef struct lru_bench_value {
+    u64 data[8];
+} lru_bench_value;
+
+// Создает значение для ключа при промахе.
+static lru_bench_value lru_bench_make_value(u64 key)
+{
+    lru_bench_value value;
+    for(u32 i = 0; i < ARRAY_SIZE(value.data); ++i)
+    {
+        value.data[i] = key + i;
+    }
+    return value;
+}
+
+static void lru_bench_evict(const void* key, void* value, void* user)
+{
+    (void)key;
+    (void)value;
+    (*(u64*)user)++;
+}
+
+// Запрашивает ключи у кеша, вставляя отсутствующие; возвращает время на запрос в наносекундах.
+static f64 lru_bench_cache(const u64* keys, u64* out_hits, u64* out_evictions)
+{
+    u64 evictions = 0;
+    u64 hits = 0;
+    u64 sum = 0;
+
+    lru_cache cache;
+    if(!lrucache_create(cache, u64, lru_bench_value, LRU_BENCH_CAPACITY, lru_bench_evict, &evictions))
+    {
+        return 0.0;
+    }
+
+    f64 start = bench_time();
+    for(u64 i = 0; i < LRU_BENCH_REQUESTS; ++i)
+    {
+        lru_bench_value* value = lrucache_get(cache, keys[i]);
+        if(value)
+        {
+            hits++;
+        }
+        else
+        {
+            // При ошибке вставки кеш не изменяется, запрос обслуживается без кеширования.
+            value = lrucache_put(cache, keys[i], lru_bench_make_value(keys[i]));
+            if(!value)
+            {
+                continue;
+            }
+        }
+        sum += value->data[0];
+    }
+    f64 elapsed = bench_time() - start;
+
+    // Оставшиеся пары не считаются вытесненными.
+    u64 evicted = evictions;
+    lrucache_destroy(cache);
+
+    bench_keep(sum);
+    *out_hits = hits;
+    *out_evictions = evicted;
+    return elapsed * 1e9 / LRU_BENCH_REQUESTS;
+}
+
+// Те же запросы к хеш-таблице без ограничения емкости: стоимость поиска без учета порядка использования.
+static f64 lru_bench_hashmap(const u64* keys)
+{
+    u64 sum = 0;
+
+    hash_map map;
+    hashmap_create(map, u64, lru_bench_value);
+
+    f64 start = bench_time();
+    for(u64 i = 0; i < LRU_BENCH_REQUESTS; ++i)
+    {
+        lru_bench_value* value = hashmap_get(map, keys[i]);
+        if(value)
+        {
+            sum += value->data[0];
+            continue;
+        }
+
+        lru_bench_value created = lru_bench_make_value(keys[i]);
+        if(hashmap_insert(map, keys[i], created))
+        {
+            sum += created.data[0];
+        }
+    }
+    f64 elapsed = bench_time() - start;
+
+    hashmap_destroy(map);
+    bench_keep(sum);
+    return elapsed * 1e9 / LRU_BENCH_REQUESTS;
+}
+
+void bench_lru()
+{
+    if(!bench_systems_start(nullptr, nullptr))
+    {
+        return;
+    }
+
+    u64* keys = platform_memory_allocate(sizeof(u64) * LRU_BENCH_REQUESTS);
+
+    math_random_generator random;
+    math_random_generator_init(&random, MATH_RANDOM_GENERATOR_TYPE_WYRAND, 20);
+
+    // Количество различных ключей относительно емкости кеша.
+    static const u64 key_spaces[] = {
+        LRU_BENCH_CAPACITY / 2, LRU_BENCH_CAPACITY, LRU_BENCH_CAPACITY * 2, LRU_BENCH_CAPACITY * 8
+    };
+
+    bench_print("Get-or-put of %u uniformly random u64 keys, 64-byte values, capacity %u, ns per request:\n",
+        LRU_BENCH_REQUESTS, LRU_BENCH_CAPACITY
+    );
+    bench_print("  %8s %10s %10s %12s %10s\n", "keys", "hit rate", "lru_cache", "evictions", "hash_map");
+    for(u32 i = 0; i < ARRAY_SIZE(key_spaces); ++i)
+    {
+        for(u64 r = 0; r < LRU_BENCH_REQUESTS; ++r)
+        {
+            keys[r] = math_random_u64_range(&random, 0, key_spaces[i]);
+        }
+
+        u64 hits = 0;
+        u64 evictions = 0;
+        f64 cache_ns = lru_bench_cache(keys, &hits, &evictions);
+        f64 map_ns = lru_bench_hashmap(keys);
+
+        bench_print("  %8llu %9.1f%% %10.1f %12llu %10.1f\n", key_spaces[i], (f64)hits * 100.0 / LRU_BENCH_REQUESTS,
+            cache_ns, evictions, map_ns
+        );
+    }
+
+    platform_memory_free(keys);
+    bench_systems_stop();
+}
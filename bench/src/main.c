@@ -0,0 +1,95 @@
+#include "bench.h"
+
+#include <core/logger.h>
+#include <core/string.h>
+#include <platform/console.h>
+#include <platform/memory.h>
+#include <platform/thread.h>
+#include <platform/time.h>
+
+typedef struct bench_suite {
+    // Имя набора (аргумент командной строки).
+    const char* name;
+    // Описание набора.
+    const char* description;
+    // Функция набора.
+    bench_suite_fn run;
+} bench_suite;
+
+static const bench_suite suites[] = {
+    { "memory",    "memory_allocate() with size class pools and 32/64-byte alignment vs platform allocation", bench_memory },
+    { "allocator", "allocation latency of platform and TLSF general purpose backends", bench_allocator },
+    { "hashmap",   "hash_map lookups vs linear search at 16, 256 and 64K entries", bench_hashmap },
+    { "queue",     "spsc and mpmc queue throughput and contention from 1 to N threads", bench_queue },
+    { "thread",    "mutex, condition and semaphore contention and wake-up latency", bench_thread },
+    { "parallel",  "parallel_for transform of 1M vertices by a mat4 from 1 to N threads", bench_parallel },
+    { "sort",      "qsort vs radix_sort_u32 vs radix_sort_u32_parallel at 1K, 64K and 1M keys", bench_sort },
+    { "lru",       "lru_cache get-or-put at hit rates from 100% down to 12%", bench_lru },
+    { "string",    "string_builder formatting vs snprintf for log lines, integers, floats and strings", bench_string },
+};
+
+static void print_usage()
+{
+    bench_print("Usage: bench [suite...]\nSuites:\n");
+    for(u32 i = 0; i < ARRAY_SIZE(suites); ++i)
+    {
+        bench_print("  %-10s %s\n", suites[i].name, suites[i].description);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    platform_console_initialize();
+
+    if(!platform_memory_initialize() || !platform_time_initialize() || !platform_thread_initialize())
+    {
+        LOG_ERROR("Failed to initialize platform subsystems.");
+        return 1;
+    }
+
+    // Сообщения систем при запуске и остановке не смешиваются с результатами.
+    log_set_level(LOG_LEVEL_WARN);
+
+    // Без аргументов выполняются все наборы.
+    bool selected[ARRAY_SIZE(suites)] = { 0 };
+    for(u32 i = 0; i < ARRAY_SIZE(suites); ++i)
+    {
+        selected[i] = argc < 2;
+    }
+
+    for(i32 a = 1; a < argc; ++a)
+    {
+        bool found = false;
+        for(u32 i = 0; i < ARRAY_SIZE(suites); ++i)
+        {
+            if(string_equal(argv[a], suites[i].name))
+            {
+                selected[i] = true;
+                found = true;
+            }
+        }
+
+        if(!found)
+        {
+            bench_print("Unknown suite '%s'.\n", argv[a]);
+            print_usage();
+            return 1;
+        }
+    }
+
+    for(u32 i = 0; i < ARRAY_SIZE(suites); ++i)
+    {
+        if(selected[i])
+        {
+            bench_print("== %s: %s ==\n", suites[i].name, suites[i].description);
+            suites[i].run();
+            bench_print("\n");
+        }
+    }
+
+    platform_thread_shutdown();
+    platform_time_shutdown();
+    platform_memory_shutdown();
+    platform_console_shutdown();
+    return 0;
+}
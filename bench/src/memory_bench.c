@@ -0,0 +1,310 @@
+#include "bench.h"
+
+#include <math/random.h>
+#include <platform/memory.h>
+#include <platform/thread.h>
+
+#include <stdlib.h>
+
+// Количество блоков, одновременно удерживаемых в одном раунде.
+#define MEMORY_BENCH_BLOCKS 4096
+// Количество раундов выделения и освобождения для каждого размера.
+#define MEMORY_BENCH_ROUNDS 256
+// Количество пар выделение-освобождение на поток в многопоточном измерении.
+#define MEMORY_BENCH_THREAD_OPS (1024 * 1024)
+
+// Количество одновременно живых блоков в измерении задержек распределителей общего назначения.
+#define MEMORY_BENCH_LIVE_BLOCKS 4096
+// Количество замеряемых выделений для каждого распределителя.
+#define MEMORY_BENCH_LATENCY_SAMPLES (256 * 1024)
+// Диапазон размеров блоков: больше блоков пулов и меньше больших блоков, выделяемых у платформы.
+#define MEMORY_BENCH_LATENCY_MIN_SIZE (2 * 1024 + 1)
+#define MEMORY_BENCH_LATENCY_MAX_SIZE (256 * 1024)
+
+// Способ выделения памяти.
+typedef enum memory_bench_path {
+    // Прежний путь memory_allocate(): каждый блок запрашивается у платформы.
+    MEMORY_BENCH_PATH_PLATFORM,
+    // Прежний способ получить выровненный блок: блок запрашивается у платформы с запасом на выравнивание,
+    // указатель смещается до границы, а адрес исходного блока сохраняется перед ним.
+    MEMORY_BENCH_PATH_OFFSET,
+    // Текущий путь memory_allocate(): небольшие блоки выделяются из пулов размерных классов.
+    MEMORY_BENCH_PATH_MEMORY
+} memory_bench_path;
+
+typedef struct memory_bench_thread {
+    memory_bench_path path;
+    u64 size;
+} memory_bench_thread;
+
+static void* memory_bench_allocate(memory_bench_path path, u64 size, u16 alignment)
+{
+    if(path == MEMORY_BENCH_PATH_PLATFORM)
+    {
+        return platform_memory_allocate(size);
+    }
+
+    if(path == MEMORY_BENCH_PATH_OFFSET)
+    {
+        u8* raw = platform_memory_allocate(size + alignment - 1 + sizeof(void*));
+        u8* block = (u8*)(((usize)raw + sizeof(void*) + alignment - 1) & ~((usize)alignment - 1));
+        ((void**)block)[-1] = raw;
+        return block;
+    }
+
+    return memory_allocate(size, alignment, MEMORY_TAG_UNKNOWN);
+}
+
+static void memory_bench_free(memory_bench_path path, void* block, u64 size)
+{
+    if(path == MEMORY_BENCH_PATH_PLATFORM)
+    {
+        platform_memory_free(block);
+    }
+    else if(path == MEMORY_BENCH_PATH_OFFSET)
+    {
+        platform_memory_free(((void**)block)[-1]);
+    }
+    else
+    {
+        memory_free(block, size, MEMORY_TAG_UNKNOWN);
+    }
+}
+
+// Выделяет блоки раунда и освобождает их в перемешанном порядке, возвращает время на пару операций в наносекундах.
+static f64 memory_bench_rounds(memory_bench_path path, u64 size, u16 alignment, void** blocks, const u32* order)
+{
+    f64 start = bench_time();
+    for(u32 round = 0; round < MEMORY_BENCH_ROUNDS; ++round)
+    {
+        for(u32 i = 0; i < MEMORY_BENCH_BLOCKS; ++i)
+        {
+            blocks[i] = memory_bench_allocate(path, size, alignment);
+            *(u8*)blocks[i] = (u8)i;
+        }
+
+        for(u32 i = 0; i < MEMORY_BENCH_BLOCKS; ++i)
+        {
+            memory_bench_free(path, blocks[order[i]], size);
+        }
+    }
+
+    return (bench_time() - start) * 1e9 / ((f64)MEMORY_BENCH_ROUNDS * MEMORY_BENCH_BLOCKS);
+}
+
+static u32 memory_bench_thread_run(void* data)
+{
+    memory_bench_thread* thread = data;
+    void* blocks[64];
+
+    for(u32 i = 0; i < MEMORY_BENCH_THREAD_OPS / ARRAY_SIZE(blocks); ++i)
+    {
+        for(u32 b = 0; b < ARRAY_SIZE(blocks); ++b)
+        {
+            blocks[b] = memory_bench_allocate(thread->path, thread->size, 16);
+        }
+
+        for(u32 b = 0; b < ARRAY_SIZE(blocks); ++b)
+        {
+            memory_bench_free(thread->path, blocks[b], thread->size);
+        }
+    }
+
+    return 0;
+}
+
+// Выполняет выделения одновременно в нескольких потоках, возвращает суммарную пропускную способность в млн пар/с.
+static f64 memory_bench_threads(memory_bench_path path, u64 size, u32 thread_count)
+{
+    platform_thread threads[BENCH_MAX_THREADS];
+    memory_bench_thread data[BENCH_MAX_THREADS];
+
+    f64 start = bench_time();
+    for(u32 i = 0; i < thread_count; ++i)
+    {
+        data[i] = (memory_bench_thread){ .path = path, .size = size };
+        platform_thread_create(memory_bench_thread_run, &data[i], "bench", &threads[i]);
+    }
+
+    for(u32 i = 0; i < thread_count; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+
+    return (f64)thread_count * MEMORY_BENCH_THREAD_OPS / (bench_time() - start) / 1e6;
+}
+
+void bench_memory()
+{
+    if(!bench_systems_start(nullptr, nullptr))
+    {
+        return;
+    }
+
+    void** blocks = platform_memory_allocate(sizeof(void*) * MEMORY_BENCH_BLOCKS);
+    u32* order = platform_memory_allocate(sizeof(u32) * MEMORY_BENCH_BLOCKS);
+
+    // Перемешанный порядок освобождения (Фишер-Йетс).
+    math_random_generator random;
+    math_random_generator_init(&random, MATH_RANDOM_GENERATOR_TYPE_WYRAND, 1);
+    for(u32 i = 0; i < MEMORY_BENCH_BLOCKS; ++i)
+    {
+        order[i] = i;
+    }
+    for(u32 i = MEMORY_BENCH_BLOCKS - 1; i > 0; --i)
+    {
+        u32 j = math_random_u32_range(&random, 0, i + 1);
+        u32 temp = order[i];
+        order[i] = order[j];
+        order[j] = temp;
+    }
+
+    static const u64 sizes[] = { 16, 64, 256, 1024, 2000, 4096 };
+
+    bench_print("%u blocks per round, freed in random order, ns per allocate+free pair:\n", MEMORY_BENCH_BLOCKS);
+    bench_print("  %8s %12s %12s %9s\n", "size", "platform", "memory", "speedup");
+    for(u32 i = 0; i < ARRAY_SIZE(sizes); ++i)
+    {
+        // Прогрев: страницы пулов и кучи платформы выделяются до замера.
+        memory_bench_rounds(MEMORY_BENCH_PATH_PLATFORM, sizes[i], 16, blocks, order);
+        memory_bench_rounds(MEMORY_BENCH_PATH_MEMORY, sizes[i], 16, blocks, order);
+
+        f64 platform_ns = memory_bench_rounds(MEMORY_BENCH_PATH_PLATFORM, sizes[i], 16, blocks, order);
+        f64 memory_ns = memory_bench_rounds(MEMORY_BENCH_PATH_MEMORY, sizes[i], 16, blocks, order);
+        bench_print("  %8llu %12.1f %12.1f %8.2fx\n", sizes[i], platform_ns, memory_ns, platform_ns / memory_ns);
+    }
+
+    static const u64 aligned_sizes[] = { 16, 64, 256, 1024, 4096 };
+    static const u16 alignments[] = { 32, 64 };
+
+    bench_print("\n%u aligned blocks per round, freed in random order, ns per allocate+free pair:\n", MEMORY_BENCH_BLOCKS);
+    bench_print("  %8s %6s %12s %12s %9s\n", "size", "align", "offset", "memory", "speedup");
+    for(u32 a = 0; a < ARRAY_SIZE(alignments); ++a)
+    {
+        for(u32 i = 0; i < ARRAY_SIZE(aligned_sizes); ++i)
+        {
+            u64 size = aligned_sizes[i];
+            u16 alignment = alignments[a];
+
+            // Прогрев.
+            memory_bench_rounds(MEMORY_BENCH_PATH_OFFSET, size, alignment, blocks, order);
+            memory_bench_rounds(MEMORY_BENCH_PATH_MEMORY, size, alignment, blocks, order);
+
+            f64 offset_ns = memory_bench_rounds(MEMORY_BENCH_PATH_OFFSET, size, alignment, blocks, order);
+            f64 memory_ns = memory_bench_rounds(MEMORY_BENCH_PATH_MEMORY, size, alignment, blocks, order);
+            bench_print("  %8llu %6u %12.1f %12.1f %8.2fx\n", size, alignment, offset_ns, memory_ns, offset_ns / memory_ns);
+        }
+    }
+
+    u32 counts[8];
+    u32 count = bench_thread_counts(counts);
+
+    bench_print("\n64-byte blocks from several threads, million allocate+free pairs per second:\n");
+    bench_print("  %8s %12s %12s\n", "threads", "platform", "memory");
+    for(u32 i = 0; i < count; ++i)
+    {
+        f64 platform_rate = memory_bench_threads(MEMORY_BENCH_PATH_PLATFORM, 64, counts[i]);
+        f64 memory_rate = memory_bench_threads(MEMORY_BENCH_PATH_MEMORY, 64, counts[i]);
+        bench_print("  %8u %12.2f %12.2f\n", counts[i], platform_rate, memory_rate);
+    }
+
+    platform_memory_free(order);
+    platform_memory_free(blocks);
+    bench_systems_stop();
+}
+
+static int memory_bench_compare_u32(const void* lhs, const void* rhs)
+{
+    u32 l = *(const u32*)lhs;
+    u32 r = *(const u32*)rhs;
+    return (l > r) - (l < r);
+}
+
+// Возвращает задержку с заданной долей выборки (отсортированной по возрастанию) в наносекундах.
+static u32 memory_bench_percentile(const u32* samples, u64 count, f64 fraction)
+{
+    u64 index = (u64)(fraction * (f64)(count - 1));
+    return samples[index];
+}
+
+// Замеряет задержку выделений при случайной замене блоков рабочего набора случайного размера.
+static void memory_bench_latency(memory_backend backend, const char* name, u32* samples)
+{
+    memory_system_config config = { .backend = backend };
+    if(!bench_systems_start(&config, nullptr))
+    {
+        return;
+    }
+
+    void* blocks[MEMORY_BENCH_LIVE_BLOCKS] = { 0 };
+    u64 sizes[MEMORY_BENCH_LIVE_BLOCKS] = { 0 };
+
+    math_random_generator random;
+    math_random_generator_init(&random, MATH_RANDOM_GENERATOR_TYPE_WYRAND, 7);
+
+    // Прогрев: рабочий набор заполняется и несколько раз обновляется до замера.
+    u64 total = MEMORY_BENCH_LIVE_BLOCKS * 4 + MEMORY_BENCH_LATENCY_SAMPLES;
+    u64 sample_count = 0;
+
+    for(u64 step = 0; step < total; ++step)
+    {
+        u32 slot = math_random_u32_range(&random, 0, MEMORY_BENCH_LIVE_BLOCKS);
+        if(blocks[slot])
+        {
+            memory_free(blocks[slot], sizes[slot], MEMORY_TAG_UNKNOWN);
+        }
+
+        u64 size = math_random_u32_range(&random, MEMORY_BENCH_LATENCY_MIN_SIZE, MEMORY_BENCH_LATENCY_MAX_SIZE + 1);
+
+        f64 start = bench_time();
+        blocks[slot] = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+        f64 elapsed = bench_time() - start;
+
+        sizes[slot] = size;
+        *(u8*)blocks[slot] = (u8)step;
+
+        if(step >= total - MEMORY_BENCH_LATENCY_SAMPLES)
+        {
+            samples[sample_count++] = (u32)MIN(elapsed * 1e9, (f64)U32_MAX);
+        }
+    }
+
+    for(u32 i = 0; i < MEMORY_BENCH_LIVE_BLOCKS; ++i)
+    {
+        if(blocks[i])
+        {
+            memory_free(blocks[i], sizes[i], MEMORY_TAG_UNKNOWN);
+        }
+    }
+
+    bench_systems_stop();
+
+    qsort(samples, sample_count, sizeof(u32), memory_bench_compare_u32);
+    bench_print("  %-10s %10u %10u %10u %10u\n", name,
+        memory_bench_percentile(samples, sample_count, 0.5), memory_bench_percentile(samples, sample_count, 0.99),
+        memory_bench_percentile(samples, sample_count, 0.999), samples[sample_count - 1]
+    );
+}
+
+void bench_allocator()
+{
+    u32* samples = platform_memory_allocate(sizeof(u32) * MEMORY_BENCH_LATENCY_SAMPLES);
+
+    // Накладные расходы замера времени входят в каждую задержку.
+    f64 overhead = 1.0;
+    for(u32 i = 0; i < 1024; ++i)
+    {
+        f64 start = bench_time();
+        overhead = MIN(overhead, bench_time() - start);
+    }
+
+    bench_print("%u live blocks of %u..%u bytes replaced at random, allocation latency in ns (timer overhead %.0f ns):\n",
+        MEMORY_BENCH_LIVE_BLOCKS, MEMORY_BENCH_LATENCY_MIN_SIZE, MEMORY_BENCH_LATENCY_MAX_SIZE, overhead * 1e9
+    );
+    bench_print("  %-10s %10s %10s %10s %10s\n", "backend", "p50", "p99", "p99.9", "max");
+
+    memory_bench_latency(MEMORY_BACKEND_PLATFORM, "platform", samples);
+    memory_bench_latency(MEMORY_BACKEND_TLSF, "tlsf", samples);
+
+    platform_memory_free(samples);
+}
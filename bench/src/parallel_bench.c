@@ -0,0 +1,122 @@
+#include "bench.h"
+
+#include <core/parallel.h>
+#include <math/matrix.h>
+#include <math/types.h>
+#include <platform/memory.h>
+
+// Количество преобразуемых вершин.
+#define PARALLEL_BENCH_VERTICES (1024 * 1024)
+// Минимальный размер пакета вершин.
+#define PARALLEL_BENCH_MIN_BATCH 1024
+// Количество повторов преобразования (выбирается лучшее время).
+#define PARALLEL_BENCH_REPEATS 10
+
+typedef struct parallel_bench_context {
+    const vertex3d* source;
+    vertex3d* target;
+    mat4 matrix;
+} parallel_bench_context;
+
+static void parallel_bench_transform(u64 begin, u64 end, void* user)
+{
+    parallel_bench_context* context = user;
+
+    for(u64 i = begin; i < end; ++i)
+    {
+        context->target[i].position = mat4_mul_vec3(context->matrix, context->source[i].position);
+        context->target[i].color = context->source[i].color;
+    }
+}
+
+// Проверяет, что результат совпадает с результатом однопоточного преобразования.
+static bool parallel_bench_verify(const vertex3d* reference, const vertex3d* target)
+{
+    for(u64 i = 0; i < PARALLEL_BENCH_VERTICES; ++i)
+    {
+        vec3 a = reference[i].position;
+        vec3 b = target[i].position;
+        if(a.x != b.x || a.y != b.y || a.z != b.z)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Возвращает лучшее время преобразования всех вершин в секундах.
+static f64 parallel_bench_run(parallel_bench_context* context)
+{
+    f64 best = 0.0;
+
+    for(u32 i = 0; i < PARALLEL_BENCH_REPEATS; ++i)
+    {
+        f64 start = bench_time();
+        parallel_for(PARALLEL_BENCH_VERTICES, PARALLEL_BENCH_MIN_BATCH, parallel_bench_transform, context);
+        f64 elapsed = bench_time() - start;
+
+        best = i == 0 ? elapsed : MIN(best, elapsed);
+    }
+
+    return best;
+}
+
+void bench_parallel()
+{
+    u64 size = sizeof(vertex3d) * PARALLEL_BENCH_VERTICES;
+    vertex3d* source = platform_memory_allocate(size);
+    vertex3d* target = platform_memory_allocate(size);
+    vertex3d* reference = platform_memory_allocate(size);
+
+    for(u64 i = 0; i < PARALLEL_BENCH_VERTICES; ++i)
+    {
+        source[i].position = (vec3){{ (f32)(i % 1000), (f32)(i % 7), (f32)(i % 13) }};
+        source[i].color = (vec4){{ 1.0f, 1.0f, 1.0f, 1.0f }};
+    }
+
+    parallel_bench_context context = {
+        .source = source, .target = target,
+        .matrix = mat4_mul(mat4_rotation_y(0.5f), mat4_translation((vec3){{ 1.0f, 2.0f, 3.0f }}))
+    };
+
+    u32 counts[8];
+    u32 count = bench_thread_counts(counts);
+    f64 single = 0.0;
+
+    bench_print("%u vertex3d positions transformed by a mat4 with parallel_for, best of %u runs:\n",
+        PARALLEL_BENCH_VERTICES, PARALLEL_BENCH_REPEATS
+    );
+    bench_print("  %8s %12s %12s %12s %s\n", "threads", "ms", "speedup", "efficiency", "check");
+
+    for(u32 i = 0; i < count; ++i)
+    {
+        // Один поток - без системы задач (parallel_for выполняет все пакеты в вызывающем потоке),
+        // иначе основной поток и threads-1 рабочих.
+        job_system_config job_config = { .worker_count = counts[i] - 1 };
+        if(!bench_systems_start(nullptr, counts[i] > 1 ? &job_config : nullptr))
+        {
+            break;
+        }
+
+        u32 threads = counts[i] > 1 ? job_system_worker_count() + 1 : 1;
+        f64 elapsed = parallel_bench_run(&context);
+        bench_systems_stop();
+
+        if(i == 0)
+        {
+            single = elapsed;
+            platform_memory_copy(reference, target, size);
+        }
+
+        f64 speedup = single / elapsed;
+        bool valid = parallel_bench_verify(reference, target);
+        bench_print("  %8u %12.3f %12.2f %11.0f%% %s\n", threads, elapsed * 1e3, speedup, speedup / threads * 100.0,
+            valid ? "ok" : "MISMATCH"
+        );
+    }
+
+    platform_memory_free(reference);
+    platform_memory_free(target);
+    platform_memory_free(source);
+}
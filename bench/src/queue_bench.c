@@ -0,0 +1,198 @@
+#include "bench.h"
+
+#include <core/containers/mpmc_queue.h>
+#include <core/containers/spsc_queue.h>
+#include <platform/thread.h>
+
+// Количество элементов, проходящих через очередь в одном измерении.
+#define QUEUE_BENCH_ITEMS (4 * 1024 * 1024)
+// Емкость очередей.
+#define QUEUE_BENCH_CAPACITY 1024
+
+typedef struct queue_bench_context {
+    spsc_queue spsc;
+    mpmc_queue mpmc;
+    // Количество элементов на каждого производителя.
+    u64 items_per_producer;
+    // Общее количество элементов.
+    u64 total_items;
+    // Количество элементов, зарезервированных потребителями.
+    PLATFORM_CACHE_ALIGNED u64 claimed;
+    // Сумма извлеченных значений (проверка, что ни один элемент не потерян).
+    PLATFORM_CACHE_ALIGNED u64 checksum;
+    // Количество неудачных попыток (очередь была полна или пуста).
+    PLATFORM_CACHE_ALIGNED u64 retries;
+} queue_bench_context;
+
+static u32 queue_bench_spsc_producer(void* data)
+{
+    queue_bench_context* context = data;
+    u64 retries = 0;
+
+    for(u64 i = 1; i <= context->items_per_producer; ++i)
+    {
+        while(!spsc_queue_push(&context->spsc, &i))
+        {
+            retries++;
+            platform_thread_yield();
+        }
+    }
+
+    platform_atomic_fetch_add_u64(&context->retries, retries, PLATFORM_MEMORY_ORDER_RELAXED);
+    return 0;
+}
+
+static u32 queue_bench_mpmc_producer(void* data)
+{
+    queue_bench_context* context = data;
+    u64 retries = 0;
+
+    for(u64 i = 1; i <= context->items_per_producer; ++i)
+    {
+        while(!mpmc_queue_push(&context->mpmc, &i))
+        {
+            retries++;
+            platform_thread_yield();
+        }
+    }
+
+    platform_atomic_fetch_add_u64(&context->retries, retries, PLATFORM_MEMORY_ORDER_RELAXED);
+    return 0;
+}
+
+static u32 queue_bench_mpmc_consumer(void* data)
+{
+    queue_bench_context* context = data;
+    u64 checksum = 0;
+    u64 retries = 0;
+
+    // Потребитель резервирует элемент до извлечения, поэтому потребители не ждут элементов, которых не будет.
+    while(platform_atomic_fetch_add_u64(&context->claimed, 1, PLATFORM_MEMORY_ORDER_RELAXED) < context->total_items)
+    {
+        u64 value;
+        while(!mpmc_queue_pop(&context->mpmc, &value))
+        {
+            retries++;
+            platform_thread_yield();
+        }
+        checksum += value;
+    }
+
+    platform_atomic_fetch_add_u64(&context->checksum, checksum, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_fetch_add_u64(&context->retries, retries, PLATFORM_MEMORY_ORDER_RELAXED);
+    return 0;
+}
+
+// Выводит пропускную способность и проверяет сумму извлеченных значений.
+static void queue_bench_report(const char* name, u32 producers, u32 consumers, const queue_bench_context* context, f64 seconds)
+{
+    u64 expected = producers * (context->items_per_producer * (context->items_per_producer + 1) / 2);
+    u64 items = producers * context->items_per_producer;
+
+    bench_print("  %-6s %9u %9u %12.2f %12.3f %s\n", name, producers, consumers, (f64)items / seconds / 1e6,
+        (f64)context->retries / (f64)items, context->checksum == expected ? "ok" : "LOST ITEMS"
+    );
+}
+
+static void queue_bench_spsc(queue_bench_context* context)
+{
+    spscqueue_create(context->spsc, u64, QUEUE_BENCH_CAPACITY);
+    context->items_per_producer = QUEUE_BENCH_ITEMS;
+    context->checksum = 0;
+    context->retries = 0;
+
+    platform_thread producer;
+    f64 start = bench_time();
+    platform_thread_create(queue_bench_spsc_producer, context, "producer", &producer);
+
+    // Основной поток - единственный потребитель.
+    u64 checksum = 0;
+    u64 retries = 0;
+    for(u64 i = 0; i < QUEUE_BENCH_ITEMS; ++i)
+    {
+        u64 value;
+        while(!spsc_queue_pop(&context->spsc, &value))
+        {
+            retries++;
+            platform_thread_yield();
+        }
+        checksum += value;
+    }
+
+    platform_thread_join(&producer, nullptr);
+    f64 seconds = bench_time() - start;
+
+    context->checksum = checksum;
+    context->retries += retries;
+    queue_bench_report("spsc", 1, 1, context, seconds);
+    spscqueue_destroy(context->spsc);
+}
+
+static void queue_bench_mpmc(queue_bench_context* context, u32 producers, u32 consumers)
+{
+    mpmcqueue_create(context->mpmc, u64, QUEUE_BENCH_CAPACITY);
+    context->items_per_producer = QUEUE_BENCH_ITEMS / producers;
+    context->total_items = context->items_per_producer * producers;
+    context->claimed = 0;
+    context->checksum = 0;
+    context->retries = 0;
+
+    platform_thread threads[BENCH_MAX_THREADS * 2];
+
+    f64 start = bench_time();
+    for(u32 i = 0; i < producers; ++i)
+    {
+        platform_thread_create(queue_bench_mpmc_producer, context, "producer", &threads[i]);
+    }
+    for(u32 i = 0; i < consumers; ++i)
+    {
+        platform_thread_create(queue_bench_mpmc_consumer, context, "consumer", &threads[producers + i]);
+    }
+    for(u32 i = 0; i < producers + consumers; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+    f64 seconds = bench_time() - start;
+
+    queue_bench_report("mpmc", producers, consumers, context, seconds);
+    mpmcqueue_destroy(context->mpmc);
+}
+
+void bench_queue()
+{
+    if(!bench_systems_start(nullptr, nullptr))
+    {
+        return;
+    }
+
+    queue_bench_context* context = memory_allocate(sizeof(queue_bench_context), PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_UNKNOWN);
+    mzero(context, sizeof(queue_bench_context));
+
+    u32 counts[8];
+    u32 count = bench_thread_counts(counts);
+
+    bench_print("%u u64 items through a %u-slot queue, million items per second and retries per item:\n",
+        QUEUE_BENCH_ITEMS, QUEUE_BENCH_CAPACITY
+    );
+    bench_print("  %-6s %9s %9s %12s %12s %s\n", "queue", "producers", "consumers", "Mitems/s", "retries", "check");
+
+    queue_bench_spsc(context);
+
+    // Конкуренция с одной стороны: несколько производителей на одного потребителя и наоборот.
+    for(u32 i = 0; i < count; ++i)
+    {
+        queue_bench_mpmc(context, counts[i], 1);
+    }
+    for(u32 i = 1; i < count; ++i)
+    {
+        queue_bench_mpmc(context, 1, counts[i]);
+    }
+    // Конкуренция с обеих сторон.
+    for(u32 i = 1; i < count; ++i)
+    {
+        queue_bench_mpmc(context, counts[i], counts[i]);
+    }
+
+    memory_free(context, sizeof(queue_bench_context), MEMORY_TAG_UNKNOWN);
+    bench_systems_stop();
+}
@@ -0,0 +1,125 @@
+#include "bench.h"
+
+#include <core/sort.h>
+#include <math/random.h>
+#include <platform/memory.h>
+
+#include <stdlib.h>
+
+// Наибольшее количество сортируемых пар.
+#define SORT_BENCH_MAX_COUNT (1024 * 1024)
+// Количество элементов, сортируемых в одном измерении (небольшие массивы сортируются многократно).
+#define SORT_BENCH_MIN_TOTAL (4 * 1024 * 1024)
+
+// Способ сортировки.
+typedef enum sort_bench_method {
+    SORT_BENCH_METHOD_QSORT,
+    SORT_BENCH_METHOD_RADIX,
+    SORT_BENCH_METHOD_RADIX_PARALLEL
+} sort_bench_method;
+
+static int sort_bench_compare(const void* a, const void* b)
+{
+    const sort_key32* left = a;
+    const sort_key32* right = b;
+
+    // Индексы уникальны, поэтому результат совпадает с устойчивой поразрядной сортировкой.
+    if(left->key != right->key)
+    {
+        return left->key < right->key ? -1 : 1;
+    }
+    return left->index < right->index ? -1 : (left->index > right->index);
+}
+
+// Проверяет, что результат совпадает с результатом qsort().
+static bool sort_bench_verify(const sort_key32* items, const sort_key32* reference, u64 count)
+{
+    for(u64 i = 0; i < count; ++i)
+    {
+        if(items[i].key != reference[i].key || items[i].index != reference[i].index)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Сортирует копию исходных пар, возвращает время на один элемент в наносекундах.
+static f64 sort_bench_run(
+    sort_bench_method method, const sort_key32* source, sort_key32* items, sort_key32* scratch, u64 count
+)
+{
+    u64 repeats = MAX(SORT_BENCH_MIN_TOTAL / count, 1ULL);
+    f64 elapsed = 0.0;
+
+    for(u64 r = 0; r < repeats; ++r)
+    {
+        platform_memory_copy(items, source, count * sizeof(sort_key32));
+
+        f64 start = bench_time();
+        switch(method)
+        {
+            case SORT_BENCH_METHOD_QSORT:
+                qsort(items, count, sizeof(sort_key32), sort_bench_compare);
+                break;
+            case SORT_BENCH_METHOD_RADIX:
+                radix_sort_u32(items, count, scratch);
+                break;
+            case SORT_BENCH_METHOD_RADIX_PARALLEL:
+                radix_sort_u32_parallel(items, count, scratch);
+                break;
+        }
+        elapsed += bench_time() - start;
+    }
+
+    return elapsed * 1e9 / ((f64)repeats * (f64)count);
+}
+
+void bench_sort()
+{
+    // Система задач с рабочими потоками по количеству процессоров.
+    job_system_config job_config = { 0 };
+    if(!bench_systems_start(nullptr, &job_config))
+    {
+        return;
+    }
+
+    sort_key32* source = platform_memory_allocate(sizeof(sort_key32) * SORT_BENCH_MAX_COUNT);
+    sort_key32* items = platform_memory_allocate(sizeof(sort_key32) * SORT_BENCH_MAX_COUNT);
+    sort_key32* reference = platform_memory_allocate(sizeof(sort_key32) * SORT_BENCH_MAX_COUNT);
+    sort_key32* scratch = platform_memory_allocate(sizeof(sort_key32) * SORT_BENCH_MAX_COUNT);
+
+    math_random_generator random;
+    math_random_generator_init(&random, MATH_RANDOM_GENERATOR_TYPE_WYRAND, 17);
+
+    static const u64 counts[] = { 1024, 64 * 1024, 1024 * 1024 };
+
+    bench_print("Random u32 keys with indices (sort_key32), %u threads, ns per element:\n", job_system_worker_count() + 1);
+    bench_print("  %8s %10s %10s %10s %10s %10s %s\n", "count", "qsort", "radix", "parallel", "x radix", "x parallel", "check");
+    for(u32 i = 0; i < ARRAY_SIZE(counts); ++i)
+    {
+        u64 count = counts[i];
+        for(u64 e = 0; e < count; ++e)
+        {
+            source[e].key = math_random_u32(&random);
+            source[e].index = (u32)e;
+        }
+
+        f64 qsort_ns = sort_bench_run(SORT_BENCH_METHOD_QSORT, source, reference, scratch, count);
+        f64 radix_ns = sort_bench_run(SORT_BENCH_METHOD_RADIX, source, items, scratch, count);
+        bool valid = sort_bench_verify(items, reference, count);
+        f64 parallel_ns = sort_bench_run(SORT_BENCH_METHOD_RADIX_PARALLEL, source, items, scratch, count);
+        valid = valid && sort_bench_verify(items, reference, count);
+
+        bench_print("  %8llu %10.2f %10.2f %10.2f %9.1fx %9.1fx %s\n", count, qsort_ns, radix_ns, parallel_ns,
+            qsort_ns / radix_ns, qsort_ns / parallel_ns, valid ? "ok" : "MISMATCH"
+        );
+    }
+
+    platform_memory_free(scratch);
+    platform_memory_free(reference);
+    platform_memory_free(items);
+    platform_memory_free(source);
+    bench_systems_stop();
+}
@@ -0,0 +1,129 @@
+#include "bench.h"
+
+#include <core/string.h>
+#include <core/string_builder.h>
+
+#include <stdio.h>
+
+// Количество форматирований в одном измерении.
+#define STRING_BENCH_ITERATIONS (1024 * 1024)
+// Размер буфера строки.
+#define STRING_BENCH_BUFFER_SIZE 256
+
+// Вид форматируемой строки.
+typedef enum string_bench_case {
+    // Строка сообщения лога: время, уровень, файл, строка и текст.
+    STRING_BENCH_CASE_LOG,
+    // Целые числа со знаком, без знака и шестнадцатеричные.
+    STRING_BENCH_CASE_INTEGERS,
+    // Числа с плавающей точкой с точностью 3 и 6 знаков.
+    STRING_BENCH_CASE_FLOATS,
+    // Строки с шириной и точностью.
+    STRING_BENCH_CASE_STRINGS,
+    STRING_BENCH_CASE_COUNT
+} string_bench_case;
+
+static const char* case_names[STRING_BENCH_CASE_COUNT] = {
+    [STRING_BENCH_CASE_LOG]      = "log line",
+    [STRING_BENCH_CASE_INTEGERS] = "%d %u %x",
+    [STRING_BENCH_CASE_FLOATS]   = "%.3f %f",
+    [STRING_BENCH_CASE_STRINGS]  = "%-12s %.4s",
+};
+
+// Форматирует строку выбранного вида построителем; возвращает длину строки.
+static u64 string_bench_builder(string_bench_case type, char* buffer, u64 i)
+{
+    string_builder builder;
+    string_builder_create_buffer(buffer, STRING_BENCH_BUFFER_SIZE, &builder);
+
+    switch(type)
+    {
+        case STRING_BENCH_CASE_LOG:
+            string_builder_append_format(&builder, "%02hhu:%02hhu:%02hhu %s (%s:%-3u): %.*s\n", (u8)(i % 24),
+                (u8)(i % 60), (u8)(i % 59), "INFOR", "core/memory.c", (u32)(i % 1000), 24, "Memory system started."
+            );
+            break;
+        case STRING_BENCH_CASE_INTEGERS:
+            string_builder_append_format(&builder, "%d %u %x %lld", (i32)i - 500000, (u32)(i * 2654435761u),
+                (u32)i, (long long)(i * 1000003)
+            );
+            break;
+        case STRING_BENCH_CASE_FLOATS:
+            string_builder_append_format(&builder, "%.3f %f %8.2f", (f64)i * 0.001, 1.0 / (f64)(i + 1), (f64)i * -3.5);
+            break;
+        default:
+            string_builder_append_format(&builder, "%-12s %.4s %8s", "texture", "diffuse.png", "ok");
+            break;
+    }
+
+    return builder.length;
+}
+
+// Форматирует ту же строку функцией snprintf; возвращает длину строки.
+static u64 string_bench_snprintf(string_bench_case type, char* buffer, u64 i)
+{
+    i32 length = 0;
+
+    switch(type)
+    {
+        case STRING_BENCH_CASE_LOG:
+            length = snprintf(buffer, STRING_BENCH_BUFFER_SIZE, "%02hhu:%02hhu:%02hhu %s (%s:%-3u): %.*s\n",
+                (u8)(i % 24), (u8)(i % 60), (u8)(i % 59), "INFOR", "core/memory.c", (u32)(i % 1000), 24,
+                "Memory system started."
+            );
+            break;
+        case STRING_BENCH_CASE_INTEGERS:
+            length = snprintf(buffer, STRING_BENCH_BUFFER_SIZE, "%d %u %x %lld", (i32)i - 500000,
+                (u32)(i * 2654435761u), (u32)i, (long long)(i * 1000003)
+            );
+            break;
+        case STRING_BENCH_CASE_FLOATS:
+            length = snprintf(buffer, STRING_BENCH_BUFFER_SIZE, "%.3f %f %8.2f", (f64)i * 0.001, 1.0 / (f64)(i + 1),
+                (f64)i * -3.5
+            );
+            break;
+        default:
+            length = snprintf(buffer, STRING_BENCH_BUFFER_SIZE, "%-12s %.4s %8s", "texture", "diffuse.png", "ok");
+            break;
+    }
+
+    return (u64)length;
+}
+
+void bench_string()
+{
+    char buffer[STRING_BENCH_BUFFER_SIZE];
+    char check[STRING_BENCH_BUFFER_SIZE];
+
+    bench_print("Formatting into a %u-byte stack buffer, %u calls, ns per call:\n", STRING_BENCH_BUFFER_SIZE,
+        STRING_BENCH_ITERATIONS
+    );
+    bench_print("  %-12s %10s %10s %8s %6s\n", "format", "builder", "snprintf", "speedup", "equal");
+
+    for(u32 c = 0; c < STRING_BENCH_CASE_COUNT; ++c)
+    {
+        u64 sum = 0;
+        f64 start = bench_time();
+        for(u64 i = 0; i < STRING_BENCH_ITERATIONS; ++i)
+        {
+            sum += string_bench_builder(c, buffer, i);
+        }
+        f64 builder_ns = (bench_time() - start) * 1e9 / STRING_BENCH_ITERATIONS;
+
+        start = bench_time();
+        for(u64 i = 0; i < STRING_BENCH_ITERATIONS; ++i)
+        {
+            sum += string_bench_snprintf(c, buffer, i);
+        }
+        f64 snprintf_ns = (bench_time() - start) * 1e9 / STRING_BENCH_ITERATIONS;
+
+        // Результаты сравниваются на одном значении, чтобы измерение не сравнивало разные строки.
+        string_bench_builder(c, check, 12345);
+        string_bench_snprintf(c, buffer, 12345);
+
+        bench_keep(sum);
+        bench_print("  %-12s %10.1f %10.1f %7.2fx %6s\n", case_names[c], builder_ns, snprintf_ns,
+            snprintf_ns / builder_ns, string_equal(check, buffer) ? "yes" : "no"
+        );
+    }
+}
@@ -0,0 +1,308 @@
+#include "bench.h"
+
+#include <platform/thread.h>
+
+#if PLATFORM_LINUX_FLAG
+    #include <pthread.h>
+#elif PLATFORM_WINDOWS_FLAG
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#endif
+
+// Общее количество пар захват-освобождение (делится между потоками).
+#define THREAD_BENCH_LOCK_OPS (4 * 1024 * 1024)
+// Количество обменов в измерениях задержки пробуждения.
+#define THREAD_BENCH_PING_PONG_ROUNDS (64 * 1024)
+// Количество поколений в измерении пробуждения всех ожидающих потоков.
+#define THREAD_BENCH_BROADCAST_ROUNDS (16 * 1024)
+
+// Способ захвата в измерении конкуренции.
+typedef enum thread_bench_lock {
+    // Мьютекс платформы движка.
+    THREAD_BENCH_LOCK_MUTEX,
+    // Мьютекс операционной системы (pthread_mutex_t или SRWLOCK) для сравнения.
+    THREAD_BENCH_LOCK_OS_MUTEX,
+    // Семафор движка с начальным значением 1.
+    THREAD_BENCH_LOCK_SEMAPHORE
+} thread_bench_lock;
+
+typedef struct thread_bench_context {
+    thread_bench_lock lock;
+    u32 ops_per_thread;
+    platform_mutex mutex;
+    platform_semaphore semaphore;
+#if PLATFORM_LINUX_FLAG
+    pthread_mutex_t os_mutex;
+#elif PLATFORM_WINDOWS_FLAG
+    SRWLOCK os_mutex;
+#endif
+    // Счетчик, защищенный захватом (проверка взаимного исключения).
+    PLATFORM_CACHE_ALIGNED u64 counter;
+
+    // Обмен между двумя потоками.
+    platform_condition condition;
+    platform_semaphore ping;
+    platform_semaphore pong;
+    // Чей ход при обмене через условную переменную (0 - основной поток, 1 - второй поток).
+    u32 turn;
+
+    // Пробуждение всех ожидающих потоков.
+    platform_condition generation_changed;
+    platform_condition all_acknowledged;
+    u32 generation;
+    u32 acknowledged;
+} thread_bench_context;
+
+static u32 thread_bench_lock_run(void* data)
+{
+    thread_bench_context* context = data;
+
+    for(u32 i = 0; i < context->ops_per_thread; ++i)
+    {
+        switch(context->lock)
+        {
+            case THREAD_BENCH_LOCK_MUTEX:
+                platform_mutex_lock(&context->mutex);
+                context->counter++;
+                platform_mutex_unlock(&context->mutex);
+                break;
+            case THREAD_BENCH_LOCK_OS_MUTEX:
+#if PLATFORM_LINUX_FLAG
+                pthread_mutex_lock(&context->os_mutex);
+                context->counter++;
+                pthread_mutex_unlock(&context->os_mutex);
+#elif PLATFORM_WINDOWS_FLAG
+                AcquireSRWLockExclusive(&context->os_mutex);
+                context->counter++;
+                ReleaseSRWLockExclusive(&context->os_mutex);
+#endif
+                break;
+            case THREAD_BENCH_LOCK_SEMAPHORE:
+                platform_semaphore_wait(&context->semaphore, PLATFORM_WAIT_INFINITE);
+                context->counter++;
+                platform_semaphore_post(&context->semaphore, 1);
+                break;
+        }
+    }
+
+    return 0;
+}
+
+// Выполняет захваты одновременно в нескольких потоках, возвращает время на пару захват-освобождение в наносекундах.
+static f64 thread_bench_lock_threads(thread_bench_context* context, thread_bench_lock lock, u32 thread_count, bool* out_valid)
+{
+    platform_thread threads[BENCH_MAX_THREADS];
+
+    context->lock = lock;
+    context->ops_per_thread = THREAD_BENCH_LOCK_OPS / thread_count;
+    context->counter = 0;
+
+    f64 start = bench_time();
+    for(u32 i = 0; i < thread_count; ++i)
+    {
+        platform_thread_create(thread_bench_lock_run, context, "lock", &threads[i]);
+    }
+    for(u32 i = 0; i < thread_count; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+    f64 elapsed = bench_time() - start;
+
+    u64 total = (u64)context->ops_per_thread * thread_count;
+    *out_valid = *out_valid && context->counter == total;
+    return elapsed * 1e9 / (f64)total;
+}
+
+static u32 thread_bench_condition_pong(void* data)
+{
+    thread_bench_context* context = data;
+
+    platform_mutex_lock(&context->mutex);
+    for(u32 i = 0; i < THREAD_BENCH_PING_PONG_ROUNDS; ++i)
+    {
+        while(context->turn != 1)
+        {
+            platform_condition_wait(&context->condition, &context->mutex, PLATFORM_WAIT_INFINITE);
+        }
+        context->turn = 0;
+        platform_condition_signal(&context->condition);
+    }
+    platform_mutex_unlock(&context->mutex);
+
+    return 0;
+}
+
+// Возвращает время передачи хода через условную переменную туда и обратно в наносекундах.
+static f64 thread_bench_condition_ping_pong(thread_bench_context* context)
+{
+    context->turn = 0;
+
+    platform_thread thread;
+    f64 start = bench_time();
+    platform_thread_create(thread_bench_condition_pong, context, "pong", &thread);
+
+    platform_mutex_lock(&context->mutex);
+    for(u32 i = 0; i < THREAD_BENCH_PING_PONG_ROUNDS; ++i)
+    {
+        context->turn = 1;
+        platform_condition_signal(&context->condition);
+        while(context->turn != 0)
+        {
+            platform_condition_wait(&context->condition, &context->mutex, PLATFORM_WAIT_INFINITE);
+        }
+    }
+    platform_mutex_unlock(&context->mutex);
+
+    platform_thread_join(&thread, nullptr);
+    return (bench_time() - start) * 1e9 / THREAD_BENCH_PING_PONG_ROUNDS;
+}
+
+static u32 thread_bench_semaphore_pong(void* data)
+{
+    thread_bench_context* context = data;
+
+    for(u32 i = 0; i < THREAD_BENCH_PING_PONG_ROUNDS; ++i)
+    {
+        platform_semaphore_wait(&context->ping, PLATFORM_WAIT_INFINITE);
+        platform_semaphore_post(&context->pong, 1);
+    }
+
+    return 0;
+}
+
+// Возвращает время передачи хода через пару семафоров туда и обратно в наносекундах.
+static f64 thread_bench_semaphore_ping_pong(thread_bench_context* context)
+{
+    platform_semaphore_create(&context->ping, 0);
+    platform_semaphore_create(&context->pong, 0);
+
+    platform_thread thread;
+    f64 start = bench_time();
+    platform_thread_create(thread_bench_semaphore_pong, context, "pong", &thread);
+
+    for(u32 i = 0; i < THREAD_BENCH_PING_PONG_ROUNDS; ++i)
+    {
+        platform_semaphore_post(&context->ping, 1);
+        platform_semaphore_wait(&context->pong, PLATFORM_WAIT_INFINITE);
+    }
+
+    platform_thread_join(&thread, nullptr);
+    return (bench_time() - start) * 1e9 / THREAD_BENCH_PING_PONG_ROUNDS;
+}
+
+static u32 thread_bench_broadcast_waiter(void* data)
+{
+    thread_bench_context* context = data;
+    u32 seen = 0;
+
+    platform_mutex_lock(&context->mutex);
+    while(seen < THREAD_BENCH_BROADCAST_ROUNDS)
+    {
+        while(context->generation == seen)
+        {
+            platform_condition_wait(&context->generation_changed, &context->mutex, PLATFORM_WAIT_INFINITE);
+        }
+        seen = context->generation;
+        context->acknowledged++;
+        platform_condition_signal(&context->all_acknowledged);
+    }
+    platform_mutex_unlock(&context->mutex);
+
+    return 0;
+}
+
+// Возвращает время пробуждения всех ожидающих потоков и получения их подтверждений в наносекундах.
+static f64 thread_bench_broadcast(thread_bench_context* context, u32 waiter_count)
+{
+    platform_thread threads[BENCH_MAX_THREADS];
+
+    context->generation = 0;
+    context->acknowledged = 0;
+
+    for(u32 i = 0; i < waiter_count; ++i)
+    {
+        platform_thread_create(thread_bench_broadcast_waiter, context, "waiter", &threads[i]);
+    }
+
+    f64 start = bench_time();
+    platform_mutex_lock(&context->mutex);
+    for(u32 i = 1; i <= THREAD_BENCH_BROADCAST_ROUNDS; ++i)
+    {
+        context->generation = i;
+        context->acknowledged = 0;
+        platform_condition_broadcast(&context->generation_changed);
+        while(context->acknowledged < waiter_count)
+        {
+            platform_condition_wait(&context->all_acknowledged, &context->mutex, PLATFORM_WAIT_INFINITE);
+        }
+    }
+    platform_mutex_unlock(&context->mutex);
+    f64 elapsed = bench_time() - start;
+
+    for(u32 i = 0; i < waiter_count; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+
+    return elapsed * 1e9 / THREAD_BENCH_BROADCAST_ROUNDS;
+}
+
+void bench_thread()
+{
+    if(!bench_systems_start(nullptr, nullptr))
+    {
+        return;
+    }
+
+    thread_bench_context* context = memory_allocate(sizeof(thread_bench_context), PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_UNKNOWN);
+    mzero(context, sizeof(thread_bench_context));
+
+    platform_mutex_create(&context->mutex);
+    platform_condition_create(&context->condition);
+    platform_condition_create(&context->generation_changed);
+    platform_condition_create(&context->all_acknowledged);
+#if PLATFORM_LINUX_FLAG
+    pthread_mutex_init(&context->os_mutex, nullptr);
+#elif PLATFORM_WINDOWS_FLAG
+    InitializeSRWLock(&context->os_mutex);
+#endif
+
+    u32 counts[8];
+    u32 count = bench_thread_counts(counts);
+    bool valid = true;
+
+    bench_print("%u lock+increment+unlock pairs split between threads, ns per pair:\n", THREAD_BENCH_LOCK_OPS);
+    bench_print("  %8s %12s %12s %12s\n", "threads", "mutex", "os mutex", "semaphore");
+    for(u32 i = 0; i < count; ++i)
+    {
+        f64 mutex_ns = thread_bench_lock_threads(context, THREAD_BENCH_LOCK_MUTEX, counts[i], &valid);
+        f64 os_mutex_ns = thread_bench_lock_threads(context, THREAD_BENCH_LOCK_OS_MUTEX, counts[i], &valid);
+
+        platform_semaphore_create(&context->semaphore, 1);
+        f64 semaphore_ns = thread_bench_lock_threads(context, THREAD_BENCH_LOCK_SEMAPHORE, counts[i], &valid);
+
+        bench_print("  %8u %12.1f %12.1f %12.1f\n", counts[i], mutex_ns, os_mutex_ns, semaphore_ns);
+    }
+
+    if(!valid)
+    {
+        bench_print("  MUTUAL EXCLUSION VIOLATED: counter does not match the number of pairs\n");
+    }
+
+    bench_print("\nWake-up latency between two threads, ns per round trip:\n");
+    bench_print("  %-10s %12.1f\n", "condition", thread_bench_condition_ping_pong(context));
+    bench_print("  %-10s %12.1f\n", "semaphore", thread_bench_semaphore_ping_pong(context));
+
+    bench_print("\nCondition broadcast to all waiters and wait for acknowledgements, ns per generation:\n");
+    bench_print("  %8s %12s\n", "waiters", "broadcast");
+    for(u32 i = 0; i < count; ++i)
+    {
+        bench_print("  %8u %12.1f\n", counts[i], thread_bench_broadcast(context, counts[i]));
+    }
+
+#if PLATFORM_LINUX_FLAG
+    pthread_mutex_destroy(&context->os_mutex);
+#endif
+    memory_free(context, sizeof(thread_bench_context), MEMORY_TAG_UNKNOWN);
+    bench_systems_stop();
+}
@@ -83,6 +83,12 @@ def build(build_type: str = "debug"):
     print("Building testapp...")
     run_script("testapp/build.py", build_type)
 
+    print("Building bench...")
+    run_script("bench/build.py", build_type)
+
+    print("Building tests...")
+    run_script("tests/build.py", build_type)
+
     print("Building shaders...")
     run_script("assets/build.py", build_type)
 
@@ -162,7 +162,7 @@ def windows_compile_source_files():
     compile_source_files(
         common_flags  = "-fdeclspec",
         object_flags  = "-g -Wall -Wextra -Werror -Wvla -Wreturn-type",
-        linker_flags  = "-shared -luser32 -lgdi32 -lwinmm -lvulkan-1",
+        linker_flags  = "-shared -luser32 -lgdi32 -lwinmm -lsynchronization -lvulkan-1",
         define_flags  = "-DMAKE_LIB_FLAG -DDEBUG_FLAG -DDEBUG_PLATFORM_FLAG",
         include_flags = f"-I{SRC_DIR}",
         output_file   = f"{BIN_DIR}{TARGET}.dll"
@@ -3,6 +3,8 @@
 #include "core/logger.h"
 #include "core/timer.h"
 #include "core/memory.h"
+#include "core/string_id.h"
+#include "core/job.h"
 #include "core/input.h"
 #include "core/event.h"
 
@@ -146,7 +148,23 @@ bool application_initialize(const application_config* config)
     }
     LOG_INFO("Thread subsystem initialized successfully.");
 
-    if(!memory_system_initialize())
+    memory_system_config memorycfg = {
+        .frame_allocator_capacity = config->performance.frame_allocator_capacity,
+        .level_allocator_capacity = config->performance.level_allocator_capacity,
+        .backend = config->performance.memory_backend,
+        .tlsf_region_size = config->performance.memory_region_size,
+        .profile_allocations = config->performance.memory_profiling,
+        .strict_budgets = config->performance.memory_strict_budgets,
+        .on_budget_overrun = config->performance.memory_budget_overrun,
+        .budget_user_data = config->performance.memory_budget_user_data
+    };
+
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        memorycfg.tag_budgets[i] = config->performance.memory_budgets[i];
+    }
+
+    if(!memory_system_initialize(&memorycfg))
     {
         LOG_ERROR("Failed to initialize memory system. Unable to continue.");
         application_terminate();
@@ -154,6 +172,29 @@ bool application_initialize(const application_config* config)
     }
     LOG_INFO("Memory system initialized successfully.");
 
+    if(!string_id_system_initialize())
+    {
+        LOG_ERROR("Failed to initialize string id system. Unable to continue.");
+        application_terminate();
+        return false;
+    }
+    LOG_INFO("String id system initialized successfully.");
+
+    job_system_config jobcfg = {
+        .worker_count = config->performance.job_worker_count,
+        .fiber_count = config->performance.job_fiber_count,
+        .fiber_stack_size = config->performance.job_fiber_stack_size,
+        .pin_threads = config->performance.job_pin_threads
+    };
+
+    if(!job_system_initialize(&jobcfg))
+    {
+        LOG_ERROR("Failed to initialize job system. Unable to continue.");
+        application_terminate();
+        return false;
+    }
+    LOG_INFO("Job system initialized successfully.");
+
     if(!input_system_initialize())
     {
         LOG_ERROR("Failed to initialize input system. Unable to continue.");
@@ -311,6 +352,9 @@ bool application_run()
             }
         }
 
+        // Выполнение задач, которые допустимо выполнять только в основном потоке (вызовы рендерера и окна).
+        job_system_main_update();
+
         // Время от начала кадра: обработки обновления логики приложения.
         frame_stats.update_time = timer_delta(&stats_timer);
 
@@ -361,6 +405,12 @@ bool application_run()
 
         // Обновление состояния системы ввода.
         input_system_update();
+
+        // Освобождение временной памяти кадра.
+        memory_system_frame_end();
+
+        // Использование памяти по тегам за завершенный кадр.
+        memory_system_tag_usage(context->frame_stats.memory);
     }
 
     application_terminate();
@@ -430,6 +480,20 @@ void application_terminate()
         LOG_INFO("Input system shutdown complete.");
     }
 
+    // Завершение системы задач.
+    if(job_system_is_initialized())
+    {
+        job_system_shutdown();
+        LOG_INFO("Job system shutdown complete.");
+    }
+
+    // Завершение системы интернированных строк.
+    if(string_id_system_is_initialized())
+    {
+        string_id_system_shutdown();
+        LOG_INFO("String id system shutdown complete.");
+    }
+
     // Завершение системы памяти.
     if(memory_system_is_initialized())
     {
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <core/defines.h>
+#include <core/memory.h>
 #include <platform/window.h>
 #include <renderer/renderer.h>
 
@@ -86,6 +87,8 @@ typedef struct application_frame_stats {
     u16 fps_min;
     // TODO: Максимальное количество кадров в секунду за период измерения.
     u16 fps_max;
+    // @brief Использование памяти по тегам за кадр (текущее, пиковое и бюджет).
+    memory_tag_usage memory[MEMORY_TAG_COUNT];
 } application_frame_stats;
 
 // @brief Конфигурация для создания и настройки приложения.
@@ -106,6 +109,32 @@ typedef struct application_config {
     struct {
         // @brief Целевое количество кадров в секунду (0 для неограниченного).
         u16 target_fps;
+        // @brief Количество рабочих потоков системы задач (0 - по количеству логических процессоров без основного).
+        u32 job_worker_count;
+        // @brief Количество волокон системы задач (0 - режим волокон выключен, см. job_system_config).
+        u32 job_fiber_count;
+        // @brief Размер стека волокна системы задач в байтах (0 - размер по умолчанию).
+        u64 job_fiber_stack_size;
+        // @brief Привязать основной поток и рабочие потоки системы задач к процессорам по топологии процессора.
+        bool job_pin_threads;
+        // @brief Размер покадрового распределителя памяти в байтах (0 - размер по умолчанию).
+        u64 frame_allocator_capacity;
+        // @brief Размер распределителя памяти уровня в байтах (0 - размер по умолчанию).
+        u64 level_allocator_capacity;
+        // @brief Распределитель памяти общего назначения.
+        memory_backend memory_backend;
+        // @brief Минимальный размер региона распределителя TLSF в байтах (0 - размер по умолчанию).
+        u64 memory_region_size;
+        // @brief Включить профилирование выделений памяти по местам вызова (см. memory_system_profile_str()).
+        bool memory_profiling;
+        // @brief Бюджеты памяти по тегам в байтах (0 - без ограничения).
+        u64 memory_budgets[MEMORY_TAG_COUNT];
+        // @brief Отказывать в выделениях, превышающих бюджет тега (иначе только уведомлять).
+        bool memory_strict_budgets;
+        // @brief Callback-функция уведомления о превышении бюджета памяти (nullptr - предупреждение в журнал).
+        memory_budget_callback memory_budget_overrun;
+        // @brief Пользовательские данные для memory_budget_overrun.
+        void* memory_budget_user_data;
     } performance;
 
     // @brief Callback-функция, вызываемая при инициализации приложения.
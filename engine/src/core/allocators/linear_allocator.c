@@ -0,0 +1,78 @@
+#include "core/allocators/linear_allocator.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+void linear_allocator_create(u64 capacity, void* memory, linear_allocator* out_allocator)
+{
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(memory != nullptr, "Memory pointer must be non-null.");
+    ASSERT(out_allocator != nullptr, "Allocator pointer must be non-null.");
+
+    out_allocator->capacity = capacity;
+    out_allocator->offset = 0;
+    out_allocator->peak = 0;
+    out_allocator->memory = memory;
+}
+
+void linear_allocator_destroy(linear_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    mzero(allocator, sizeof(linear_allocator));
+}
+
+void* linear_allocator_allocate(linear_allocator* allocator, u64 size, u16 alignment)
+{
+    ASSERT(allocator != nullptr && allocator->memory != nullptr, "Allocator must be initialized.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+    // Выравнивание адреса, а не смещения, т.к. сам блок может быть выровнен слабее чем требуется.
+    usize base = (usize)allocator->memory;
+    usize aligned = (usize)POINTER_ALIGN_UP(base + allocator->offset, alignment);
+    u64 new_offset = (aligned - base) + size;
+
+    if(size > allocator->capacity || new_offset > allocator->capacity)
+    {
+        return nullptr;
+    }
+
+    allocator->offset = new_offset;
+
+    if(allocator->peak < new_offset)
+    {
+        allocator->peak = new_offset;
+    }
+
+    return (void*)aligned;
+}
+
+bool linear_allocator_extend(linear_allocator* allocator, void* block, u64 size, u64 new_size)
+{
+    ASSERT(allocator != nullptr && allocator->memory != nullptr, "Allocator must be initialized.");
+    ASSERT(block != nullptr, "Block pointer must be non-null.");
+    ASSERT(new_size >= size, "New size must be greater than or equal to current size.");
+
+    // Участок должен заканчиваться на текущем смещении распределителя.
+    u64 offset = (usize)block - (usize)allocator->memory;
+    if(offset + size != allocator->offset || new_size > allocator->capacity - offset)
+    {
+        return false;
+    }
+
+    allocator->offset = offset + new_size;
+
+    if(allocator->peak < allocator->offset)
+    {
+        allocator->peak = allocator->offset;
+    }
+
+    return true;
+}
+
+void linear_allocator_reset(linear_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    allocator->offset = 0;
+}
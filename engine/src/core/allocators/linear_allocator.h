@@ -0,0 +1,84 @@
+/*
+    @file linear_allocator.h
+    @brief Интерфейс линейного распределителя памяти.
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Выделение памяти смещением указателя внутри заранее выделенного блока
+            - Освобождение всех выделений разом (сброс смещения)
+            - Увеличение последнего выделения на месте (для растущих буферов)
+            - Отслеживание пикового использования памяти (high-water mark)
+
+    @note Особенности реализации:
+            - Распределитель не владеет памятью, блок предоставляется вызывающей стороной
+            - Отдельные выделения не освобождаются, только сбросом всего распределителя
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Контекст линейного распределителя.
+typedef struct linear_allocator {
+    // @brief Размер блока памяти в байтах.
+    u64 capacity;
+    // @brief Текущее смещение от начала блока (используемая память) в байтах.
+    u64 offset;
+    // @brief Пиковое смещение от начала блока за все время работы в байтах.
+    u64 peak;
+    // @brief Указатель на блок памяти.
+    void* memory;
+} linear_allocator;
+
+/*
+    @brief Инициализирует линейный распределитель над предоставленным блоком памяти.
+    @note Блок памяти должен оставаться действительным до уничтожения распределителя.
+    @param capacity Размер блока памяти в байтах.
+    @param memory Указатель на блок памяти.
+    @param out_allocator Указатель на распределитель для инициализации.
+*/
+CORE_API void linear_allocator_create(u64 capacity, void* memory, linear_allocator* out_allocator);
+
+/*
+    @brief Уничтожает линейный распределитель.
+    @note Блок памяти не освобождается, за это отвечает вызывающая сторона.
+    @param allocator Указатель на распределитель.
+*/
+CORE_API void linear_allocator_destroy(linear_allocator* allocator);
+
+/*
+    @brief Выделяет участок памяти из линейного распределителя.
+    @param allocator Указатель на распределитель.
+    @param size Размер выделяемой памяти в байтах.
+    @param alignment Требуемое выравнивание (степень двойки).
+    @return Указатель на выделенную память или nullptr, если в блоке недостаточно места.
+*/
+CORE_API void* linear_allocator_allocate(linear_allocator* allocator, u64 size, u16 alignment);
+
+/*
+    @brief Увеличивает размер участка памяти на месте.
+    @note Увеличение возможно только для последнего выделения распределителя.
+    @param allocator Указатель на распределитель.
+    @param block Указатель на участок памяти, полученный из этого распределителя.
+    @param size Текущий размер участка в байтах.
+    @param new_size Новый размер участка в байтах (не меньше текущего).
+    @return true - участок увеличен, false - участок не последний или в блоке недостаточно места.
+*/
+CORE_API bool linear_allocator_extend(linear_allocator* allocator, void* block, u64 size, u64 new_size);
+
+/*
+    @brief Освобождает все выделения линейного распределителя (сбрасывает смещение в 0).
+    @note Использование ранее выделенных указателей после сброса приведет к непредсказуемому поведению!
+    @param allocator Указатель на распределитель.
+*/
+CORE_API void linear_allocator_reset(linear_allocator* allocator);
@@ -0,0 +1,171 @@
+#include "core/allocators/pool_allocator.h"
+#include "core/logger.h"
+#include "debug/assert.h"
+#include "platform/memory.h"
+
+// Заголовок страницы пула, блоки располагаются сразу за ним.
+typedef struct pool_page {
+    // Следующая страница пула.
+    struct pool_page* next;
+    // Выравнивание блоков страницы по 16 байтам.
+    u64 padding;
+} pool_page;
+
+// Свободный блок пула (указатель хранится в памяти самого блока).
+typedef struct pool_free_block {
+    // Следующий свободный блок.
+    struct pool_free_block* next;
+} pool_free_block;
+
+STATIC_ASSERT(sizeof(pool_page) == 16, "Pool page header must be 16 bytes.");
+
+static bool pool_page_add(pool_allocator* allocator)
+{
+    pool_page* page = platform_memory_allocate_aligned(allocator->page_size, sizeof(pool_page));
+    if(!page)
+    {
+        LOG_ERROR("Failed to allocate page for pool with block size %llu.", allocator->block_size);
+        return false;
+    }
+
+    page->next = allocator->pages;
+    allocator->pages = page;
+    allocator->page_count++;
+
+    // Добавление блоков страницы в список свободных в обратном порядке, чтобы выдавать их по возрастанию адресов.
+    u8* blocks = (u8*)(page + 1);
+    for(u64 i = allocator->blocks_per_page; i > 0; --i)
+    {
+        pool_free_block* block = (pool_free_block*)(blocks + (i - 1) * allocator->block_size);
+        block->next = allocator->free_list;
+        allocator->free_list = block;
+    }
+
+    return true;
+}
+
+void pool_allocator_create(u64 block_size, u64 page_size, pool_allocator* out_allocator)
+{
+    ASSERT(block_size >= POOL_ALLOCATOR_MIN_BLOCK_SIZE, "Block size must be at least POOL_ALLOCATOR_MIN_BLOCK_SIZE.");
+    ASSERT(block_size % 16 == 0, "Block size must be a multiple of 16.");
+    ASSERT(page_size >= sizeof(pool_page) + block_size, "Page size must fit at least one block.");
+    ASSERT(out_allocator != nullptr, "Allocator pointer must be non-null.");
+
+    out_allocator->block_size = block_size;
+    out_allocator->page_size = page_size;
+    out_allocator->blocks_per_page = (page_size - sizeof(pool_page)) / block_size;
+    out_allocator->free_list = nullptr;
+    out_allocator->pages = nullptr;
+    out_allocator->page_count = 0;
+    out_allocator->used_count = 0;
+    out_allocator->peak_used_count = 0;
+}
+
+void pool_allocator_destroy(pool_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    pool_page* page = allocator->pages;
+    while(page)
+    {
+        pool_page* next = page->next;
+        platform_memory_free_aligned(page);
+        page = next;
+    }
+
+    allocator->free_list = nullptr;
+    allocator->pages = nullptr;
+    allocator->page_count = 0;
+    allocator->used_count = 0;
+}
+
+void* pool_allocator_allocate(pool_allocator* allocator)
+{
+    ASSERT(allocator != nullptr && allocator->block_size > 0, "Allocator must be initialized.");
+
+    if(UNLIKELY(allocator->free_list == nullptr) && !pool_page_add(allocator))
+    {
+        return nullptr;
+    }
+
+    pool_free_block* block = allocator->free_list;
+    allocator->free_list = block->next;
+    allocator->used_count++;
+
+    if(allocator->peak_used_count < allocator->used_count)
+    {
+        allocator->peak_used_count = allocator->used_count;
+    }
+
+    return block;
+}
+
+void pool_allocator_free(pool_allocator* allocator, void* block)
+{
+    ASSERT(allocator != nullptr && allocator->block_size > 0, "Allocator must be initialized.");
+    ASSERT(block != nullptr, "Block pointer must be non-null.");
+    ASSERT(allocator->used_count > 0, "Pool has no allocated blocks to free.");
+
+    pool_free_block* free_block = block;
+    free_block->next = allocator->free_list;
+    allocator->free_list = free_block;
+    allocator->used_count--;
+}
+
+u64 pool_allocator_allocate_list(pool_allocator* allocator, u64 count, void** out_first)
+{
+    ASSERT(allocator != nullptr && allocator->block_size > 0, "Allocator must be initialized.");
+    ASSERT(count > 0, "Count must be greater than zero.");
+    ASSERT(out_first != nullptr, "Output pointer must be non-null.");
+
+    // Блоки уже связаны в списке свободных, поэтому цепочка отрезается от его начала без перестановки.
+    pool_free_block* first = nullptr;
+    pool_free_block* last = nullptr;
+    u64 taken = 0;
+
+    while(taken < count)
+    {
+        if(UNLIKELY(allocator->free_list == nullptr) && !pool_page_add(allocator))
+        {
+            break;
+        }
+
+        // После добавления страницы цепочка продолжается ее блоками.
+        if(last)
+        {
+            last->next = allocator->free_list;
+        }
+        else
+        {
+            first = allocator->free_list;
+        }
+
+        pool_free_block* block = allocator->free_list;
+        taken++;
+        while(taken < count && block->next)
+        {
+            block = block->next;
+            taken++;
+        }
+
+        allocator->free_list = block->next;
+        block->next = nullptr;
+        last = block;
+    }
+
+    allocator->used_count += taken;
+    if(allocator->peak_used_count < allocator->used_count)
+    {
+        allocator->peak_used_count = allocator->used_count;
+    }
+
+    *out_first = first;
+    return taken;
+}
+
+u64 pool_allocator_capacity(const pool_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    return allocator->page_count * allocator->blocks_per_page;
+}
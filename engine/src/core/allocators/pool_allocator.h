@@ -0,0 +1,106 @@
+/*
+    @file pool_allocator.h
+    @brief Интерфейс пулового распределителя блоков фиксированного размера.
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Выделение и освобождение блоков фиксированного размера за O(1)
+            - Автоматическое расширение пула страницами при исчерпании свободных блоков
+            - Выделение цепочек блоков для кэшей потоков
+            - Статистику использования блоков и страниц
+
+    @note Особенности реализации:
+            - Свободные блоки объединены в интрузивный односвязный список (указатель хранится в самом блоке)
+            - Страницы запрашиваются непосредственно у платформы и освобождаются только при уничтожении пула
+            - Блоки выровнены по 16 байтам
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Минимальный размер блока пула в байтах.
+#define POOL_ALLOCATOR_MIN_BLOCK_SIZE 16
+
+// @brief Размер страницы пула по умолчанию в байтах.
+#define POOL_ALLOCATOR_DEFAULT_PAGE_SIZE KIBIBYTES(64)
+
+// @brief Контекст пулового распределителя.
+typedef struct pool_allocator {
+    // @brief Размер одного блока в байтах.
+    u64 block_size;
+    // @brief Размер одной страницы в байтах.
+    u64 page_size;
+    // @brief Количество блоков на одной странице.
+    u64 blocks_per_page;
+    // @brief Список свободных блоков.
+    void* free_list;
+    // @brief Список выделенных страниц.
+    void* pages;
+    // @brief Количество выделенных страниц.
+    u64 page_count;
+    // @brief Количество используемых блоков в данный момент.
+    u64 used_count;
+    // @brief Пиковое количество используемых блоков.
+    u64 peak_used_count;
+} pool_allocator;
+
+/*
+    @brief Инициализирует пуловый распределитель.
+    @note Страницы не выделяются до первого запроса блока.
+    @param block_size Размер блока в байтах (кратный 16, не меньше POOL_ALLOCATOR_MIN_BLOCK_SIZE).
+    @param page_size Размер страницы в байтах (должна вмещать хотя бы один блок).
+    @param out_allocator Указатель на распределитель для инициализации.
+*/
+CORE_API void pool_allocator_create(u64 block_size, u64 page_size, pool_allocator* out_allocator);
+
+/*
+    @brief Уничтожает пуловый распределитель и освобождает все его страницы.
+    @note Все выделенные из пула блоки становятся недействительными.
+    @param allocator Указатель на распределитель.
+*/
+CORE_API void pool_allocator_destroy(pool_allocator* allocator);
+
+/*
+    @brief Выделяет блок из пула.
+    @note При отсутствии свободных блоков пул расширяется новой страницей.
+    @param allocator Указатель на распределитель.
+    @return Указатель на блок размером block_size или nullptr при ошибке выделения страницы.
+*/
+CORE_API void* pool_allocator_allocate(pool_allocator* allocator);
+
+/*
+    @brief Возвращает блок в пул.
+    @note Использование указателя после освобождения приведет к непредсказуемому поведению!
+    @param allocator Указатель на распределитель.
+    @param block Указатель на блок, ранее выделенный из этого пула.
+*/
+CORE_API void pool_allocator_free(pool_allocator* allocator, void* block);
+
+/*
+    @brief Выделяет из пула цепочку блоков, связанных так же, как в списке свободных.
+    @note Первое слово каждого блока указывает на следующий блок цепочки, у последнего - nullptr.
+          При отсутствии свободных блоков пул расширяется новыми страницами.
+    @param allocator Указатель на распределитель.
+    @param count Требуемое количество блоков (больше нуля).
+    @param out_first Указатель для записи первого блока цепочки (nullptr, если не выделено ни одного).
+    @return Количество выделенных блоков (меньше count только при ошибке выделения страницы).
+*/
+CORE_API u64 pool_allocator_allocate_list(pool_allocator* allocator, u64 count, void** out_first);
+
+/*
+    @brief Возвращает общее количество блоков во всех страницах пула.
+    @param allocator Указатель на распределитель.
+    @return Количество блоков.
+*/
+CORE_API u64 pool_allocator_capacity(const pool_allocator* allocator);
@@ -0,0 +1,121 @@
+#include "core/allocators/stack_allocator.h"
+#include "core/logger.h"
+#include "debug/assert.h"
+#include "platform/memory.h"
+
+bool stack_allocator_create(u64 capacity, stack_allocator* out_allocator)
+{
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(out_allocator != nullptr, "Allocator pointer must be non-null.");
+
+    void* memory = platform_memory_allocate(capacity);
+    if(!memory)
+    {
+        LOG_ERROR("Failed to allocate memory for stack allocator with capacity %llu.", capacity);
+        return false;
+    }
+
+    out_allocator->capacity = capacity;
+    out_allocator->bottom = 0;
+    out_allocator->top = capacity;
+    out_allocator->peak = 0;
+    out_allocator->memory = memory;
+    return true;
+}
+
+void stack_allocator_destroy(stack_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    if(allocator->memory)
+    {
+        platform_memory_free(allocator->memory);
+    }
+
+    platform_memory_zero(allocator, sizeof(stack_allocator));
+}
+
+void* stack_allocator_allocate(stack_allocator* allocator, stack_allocator_side side, u64 size, u16 alignment)
+{
+    ASSERT(allocator != nullptr && allocator->memory != nullptr, "Allocator must be initialized.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+    // Выравнивание адреса, а не смещения, т.к. сам блок может быть выровнен слабее чем требуется.
+    usize base = (usize)allocator->memory;
+    usize aligned = 0;
+
+    if(side == STACK_ALLOCATOR_SIDE_BOTTOM)
+    {
+        aligned = (usize)POINTER_ALIGN_UP(base + allocator->bottom, alignment);
+        u64 new_bottom = (aligned - base) + size;
+
+        if(size > allocator->top || new_bottom > allocator->top)
+        {
+            return nullptr;
+        }
+
+        allocator->bottom = new_bottom;
+    }
+    else
+    {
+        // Верхний стек растет вниз, поэтому адрес выравнивается вниз от его вершины.
+        if(size > allocator->top)
+        {
+            return nullptr;
+        }
+
+        aligned = (usize)POINTER_ALIGN_DOWN(base + allocator->top - size, alignment);
+        if(aligned < base + allocator->bottom)
+        {
+            return nullptr;
+        }
+
+        allocator->top = aligned - base;
+    }
+
+    u64 used = allocator->bottom + (allocator->capacity - allocator->top);
+    if(allocator->peak < used)
+    {
+        allocator->peak = used;
+    }
+
+    return (void*)aligned;
+}
+
+stack_allocator_marker stack_allocator_get_marker(const stack_allocator* allocator, stack_allocator_side side)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    return side == STACK_ALLOCATOR_SIDE_BOTTOM ? allocator->bottom : allocator->top;
+}
+
+void stack_allocator_rollback(stack_allocator* allocator, stack_allocator_side side, stack_allocator_marker marker)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    if(side == STACK_ALLOCATOR_SIDE_BOTTOM)
+    {
+        ASSERT(marker <= allocator->bottom, "Marker must not be above the bottom stack top.");
+        allocator->bottom = marker;
+    }
+    else
+    {
+        ASSERT(marker >= allocator->top && marker <= allocator->capacity, "Marker must not be below the top stack top.");
+        allocator->top = marker;
+    }
+}
+
+void stack_allocator_reset(stack_allocator* allocator, stack_allocator_side side)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    if(side == STACK_ALLOCATOR_SIDE_BOTTOM)
+    {
+        allocator->bottom = 0;
+    }
+    else
+    {
+        allocator->top = allocator->capacity;
+    }
+}
@@ -0,0 +1,105 @@
+/*
+    @file stack_allocator.h
+    @brief Интерфейс двустороннего стекового распределителя памяти.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Выделение памяти смещением указателя с обоих концов одного блока (нижний и верхний стеки)
+            - Откат каждого стека к ранее полученному маркеру
+            - Отслеживание пикового использования памяти обоими стеками (high-water mark)
+
+    @note Особенности реализации:
+            - Распределитель владеет одним блоком памяти, выделенным у платформы при создании
+            - Нижний стек растет вверх, верхний - вниз; память исчерпана, когда стеки встречаются
+            - Отдельные выделения не освобождаются, только откатом стека к маркеру или сбросом
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Сторона двустороннего стекового распределителя.
+typedef enum stack_allocator_side {
+    // @brief Нижний стек (растет от начала блока, например, для долгоживущих данных).
+    STACK_ALLOCATOR_SIDE_BOTTOM,
+    // @brief Верхний стек (растет от конца блока, например, для временных данных).
+    STACK_ALLOCATOR_SIDE_TOP
+} stack_allocator_side;
+
+// @brief Маркер положения стека для последующего отката.
+typedef u64 stack_allocator_marker;
+
+// @brief Контекст двустороннего стекового распределителя.
+typedef struct stack_allocator {
+    // @brief Размер блока памяти в байтах.
+    u64 capacity;
+    // @brief Смещение вершины нижнего стека от начала блока в байтах.
+    u64 bottom;
+    // @brief Смещение вершины верхнего стека от начала блока в байтах (capacity - стек пуст).
+    u64 top;
+    // @brief Пиковое суммарное использование памяти обоими стеками в байтах.
+    u64 peak;
+    // @brief Указатель на блок памяти.
+    void* memory;
+} stack_allocator;
+
+/*
+    @brief Инициализирует двусторонний стековый распределитель и выделяет его блок памяти.
+    @note Память блока выделяется у платформы и не учитывается системой памяти.
+    @param capacity Размер блока памяти в байтах.
+    @param out_allocator Указатель на распределитель для инициализации.
+    @return true - инициализация успешна, false - не удалось выделить блок памяти.
+*/
+CORE_API bool stack_allocator_create(u64 capacity, stack_allocator* out_allocator);
+
+/*
+    @brief Уничтожает двусторонний стековый распределитель и освобождает его блок памяти.
+    @note Все выделения распределителя становятся недействительными.
+    @param allocator Указатель на распределитель.
+*/
+CORE_API void stack_allocator_destroy(stack_allocator* allocator);
+
+/*
+    @brief Выделяет участок памяти с указанной стороны распределителя.
+    @param allocator Указатель на распределитель.
+    @param side Сторона распределителя.
+    @param size Размер выделяемой памяти в байтах.
+    @param alignment Требуемое выравнивание (степень двойки).
+    @return Указатель на выделенную память или nullptr, если между стеками недостаточно места.
+*/
+CORE_API void* stack_allocator_allocate(stack_allocator* allocator, stack_allocator_side side, u64 size, u16 alignment);
+
+/*
+    @brief Возвращает маркер текущего положения стека указанной стороны.
+    @param allocator Указатель на распределитель.
+    @param side Сторона распределителя.
+    @return Маркер для передачи в stack_allocator_rollback().
+*/
+CORE_API stack_allocator_marker stack_allocator_get_marker(const stack_allocator* allocator, stack_allocator_side side);
+
+/*
+    @brief Освобождает все выделения стека указанной стороны, сделанные после получения маркера.
+    @note Использование освобожденных указателей приведет к непредсказуемому поведению!
+    @param allocator Указатель на распределитель.
+    @param side Сторона распределителя (должна совпадать со стороной маркера).
+    @param marker Маркер, полученный stack_allocator_get_marker().
+*/
+CORE_API void stack_allocator_rollback(stack_allocator* allocator, stack_allocator_side side, stack_allocator_marker marker);
+
+/*
+    @brief Освобождает все выделения стека указанной стороны.
+    @note Использование освобожденных указателей приведет к непредсказуемому поведению!
+    @param allocator Указатель на распределитель.
+    @param side Сторона распределителя.
+*/
+CORE_API void stack_allocator_reset(stack_allocator* allocator, stack_allocator_side side);
@@ -0,0 +1,336 @@
+#include "core/allocators/tlsf_allocator.h"
+#include "core/logger.h"
+#include "debug/assert.h"
+#include "platform/memory.h"
+
+// Логарифм количества списков второго уровня.
+#define TLSF_SL_INDEX_COUNT_LOG2 5
+// Логарифм выравнивания блоков.
+#define TLSF_ALIGNMENT_LOG2      4
+// Сдвиг первого уровня: блоки меньше TLSF_SMALL_BLOCK_SIZE попадают в список первого уровня 0.
+#define TLSF_FL_INDEX_SHIFT      (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGNMENT_LOG2)
+// Размер, до которого блоки распределяются линейно по спискам второго уровня с шагом выравнивания.
+#define TLSF_SMALL_BLOCK_SIZE    (1ULL << TLSF_FL_INDEX_SHIFT)
+// Максимальный размер блока (не включительно).
+#define TLSF_MAX_BLOCK_SIZE      (1ULL << (TLSF_FL_INDEX_COUNT + TLSF_FL_INDEX_SHIFT - 1))
+
+// Флаг свободного блока в младшем бите размера.
+#define TLSF_BLOCK_FREE_BIT      1ULL
+
+STATIC_ASSERT(TLSF_SL_INDEX_COUNT == (1 << TLSF_SL_INDEX_COUNT_LOG2), "Second level count mismatch.");
+STATIC_ASSERT(TLSF_ALLOCATOR_ALIGNMENT == (1 << TLSF_ALIGNMENT_LOG2), "Alignment mismatch.");
+
+// Блок распределителя. Поля next_free/prev_free действительны только для свободных блоков и
+// располагаются в памяти пользователя.
+typedef struct tlsf_block {
+    // Размер блока с учетом заголовка и флагами в младших битах.
+    u64 size;
+    // Предыдущий блок в физической памяти (nullptr для первого блока региона).
+    struct tlsf_block* prev_phys;
+    // Следующий блок в списке свободных.
+    struct tlsf_block* next_free;
+    // Предыдущий блок в списке свободных.
+    struct tlsf_block* prev_free;
+} tlsf_block;
+
+// Заголовок региона, за ним следует первый блок, в конце региона - блок-ограничитель.
+typedef struct tlsf_region {
+    // Следующий регион.
+    struct tlsf_region* next;
+    // Размер региона в байтах.
+    u64 size;
+} tlsf_region;
+
+// Накладные расходы на заголовок занятого блока.
+#define TLSF_BLOCK_OVERHEAD      (sizeof(u64) + sizeof(tlsf_block*))
+// Минимальный размер блока (заголовок и указатели списка свободных).
+#define TLSF_BLOCK_MIN_SIZE      sizeof(tlsf_block)
+
+STATIC_ASSERT(TLSF_BLOCK_OVERHEAD == TLSF_ALLOCATOR_ALIGNMENT, "Block overhead must keep payload aligned.");
+STATIC_ASSERT(sizeof(tlsf_region) == TLSF_ALLOCATOR_ALIGNMENT, "Region header must keep blocks aligned.");
+
+INLINE u64 tlsf_block_size(const tlsf_block* block)
+{
+    return block->size & ~TLSF_BLOCK_FREE_BIT;
+}
+
+INLINE bool tlsf_block_is_free(const tlsf_block* block)
+{
+    return (block->size & TLSF_BLOCK_FREE_BIT) != 0;
+}
+
+INLINE tlsf_block* tlsf_block_next_phys(const tlsf_block* block)
+{
+    return POINTER_ADD_OFFSET(block, tlsf_block_size(block));
+}
+
+INLINE u32 tlsf_fls(u64 value)
+{
+    return 63 - (u32)__builtin_clzll(value);
+}
+
+INLINE u32 tlsf_ffs(u32 value)
+{
+    return (u32)__builtin_ctz(value);
+}
+
+// Вычисляет индексы списков, в который помещается свободный блок указанного размера.
+INLINE void tlsf_mapping_insert(u64 size, u32* out_fl, u32* out_sl)
+{
+    if(size < TLSF_SMALL_BLOCK_SIZE)
+    {
+        *out_fl = 0;
+        *out_sl = (u32)(size / (TLSF_SMALL_BLOCK_SIZE / TLSF_SL_INDEX_COUNT));
+    }
+    else
+    {
+        u32 fl = tlsf_fls(size);
+        *out_sl = (u32)(size >> (fl - TLSF_SL_INDEX_COUNT_LOG2)) ^ TLSF_SL_INDEX_COUNT;
+        *out_fl = fl - (TLSF_FL_INDEX_SHIFT - 1);
+    }
+}
+
+// Округляет размер вверх до границы списка второго уровня, любой блок которого вмещает запрос.
+INLINE u64 tlsf_round_size(u64 size)
+{
+    if(size >= TLSF_SMALL_BLOCK_SIZE)
+    {
+        size += (1ULL << (tlsf_fls(size) - TLSF_SL_INDEX_COUNT_LOG2)) - 1;
+    }
+    return size;
+}
+
+static void tlsf_free_list_insert(tlsf_allocator* allocator, tlsf_block* block)
+{
+    u32 fl, sl;
+    tlsf_mapping_insert(tlsf_block_size(block), &fl, &sl);
+
+    tlsf_block* head = allocator->blocks[fl][sl];
+    block->next_free = head;
+    block->prev_free = nullptr;
+    if(head)
+    {
+        head->prev_free = block;
+    }
+
+    allocator->blocks[fl][sl] = block;
+    allocator->fl_bitmap |= 1U << fl;
+    allocator->sl_bitmap[fl] |= 1U << sl;
+}
+
+static void tlsf_free_list_remove(tlsf_allocator* allocator, tlsf_block* block)
+{
+    u32 fl, sl;
+    tlsf_mapping_insert(tlsf_block_size(block), &fl, &sl);
+
+    if(block->prev_free)
+    {
+        block->prev_free->next_free = block->next_free;
+    }
+    else
+    {
+        allocator->blocks[fl][sl] = block->next_free;
+    }
+
+    if(block->next_free)
+    {
+        block->next_free->prev_free = block->prev_free;
+    }
+
+    // Сброс битов опустевшего списка.
+    if(allocator->blocks[fl][sl] == nullptr)
+    {
+        allocator->sl_bitmap[fl] &= ~(1U << sl);
+        if(allocator->sl_bitmap[fl] == 0)
+        {
+            allocator->fl_bitmap &= ~(1U << fl);
+        }
+    }
+}
+
+// Находит непустой список с блоками не меньше запрошенного размера (размер уже округлен).
+static tlsf_block* tlsf_find_suitable(tlsf_allocator* allocator, u64 size)
+{
+    u32 fl, sl;
+    tlsf_mapping_insert(size, &fl, &sl);
+
+    if(fl >= TLSF_FL_INDEX_COUNT)
+    {
+        return nullptr;
+    }
+
+    u32 sl_map = allocator->sl_bitmap[fl] & (~0U << sl);
+    if(!sl_map)
+    {
+        // Поиск в следующих списках первого уровня.
+        u32 fl_map = fl + 1 < TLSF_FL_INDEX_COUNT ? allocator->fl_bitmap & (~0U << (fl + 1)) : 0;
+        if(!fl_map)
+        {
+            return nullptr;
+        }
+
+        fl = tlsf_ffs(fl_map);
+        sl_map = allocator->sl_bitmap[fl];
+    }
+
+    return allocator->blocks[fl][tlsf_ffs(sl_map)];
+}
+
+static bool tlsf_region_add(tlsf_allocator* allocator, u64 min_block_size)
+{
+    u64 page_size = platform_memory_page_size();
+    u64 size = MAX(allocator->region_size, min_block_size + sizeof(tlsf_region) + TLSF_BLOCK_OVERHEAD);
+    size = (size + page_size - 1) & ~(page_size - 1);
+
+    tlsf_region* region = platform_memory_reserve(size);
+    if(!region)
+    {
+        return false;
+    }
+
+    if(!platform_memory_commit(region, size))
+    {
+        platform_memory_release(region, size);
+        return false;
+    }
+
+    region->next = allocator->regions;
+    region->size = size;
+    allocator->regions = region;
+    allocator->region_count++;
+    allocator->reserved_size += size;
+
+    // Один свободный блок на весь регион и занятый блок-ограничитель нулевого размера в конце,
+    // предотвращающий слияние за границу региона.
+    tlsf_block* block = (tlsf_block*)(region + 1);
+    block->size = (size - sizeof(tlsf_region) - TLSF_BLOCK_OVERHEAD) | TLSF_BLOCK_FREE_BIT;
+    block->prev_phys = nullptr;
+
+    tlsf_block* sentinel = tlsf_block_next_phys(block);
+    sentinel->size = 0;
+    sentinel->prev_phys = block;
+
+    tlsf_free_list_insert(allocator, block);
+    return true;
+}
+
+bool tlsf_allocator_create(u64 region_size, tlsf_allocator* out_allocator)
+{
+    ASSERT(out_allocator != nullptr, "Allocator pointer must be non-null.");
+    ASSERT(region_size < TLSF_MAX_BLOCK_SIZE, "Region size exceeds maximum block size.");
+
+    platform_memory_zero(out_allocator, sizeof(tlsf_allocator));
+    out_allocator->region_size = region_size > 0 ? region_size : TLSF_ALLOCATOR_DEFAULT_REGION_SIZE;
+
+    if(!tlsf_region_add(out_allocator, 0))
+    {
+        LOG_ERROR("Failed to reserve initial TLSF region.");
+        return false;
+    }
+
+    return true;
+}
+
+void tlsf_allocator_destroy(tlsf_allocator* allocator)
+{
+    ASSERT(allocator != nullptr, "Allocator pointer must be non-null.");
+
+    tlsf_region* region = allocator->regions;
+    while(region)
+    {
+        tlsf_region* next = region->next;
+        platform_memory_release(region, region->size);
+        region = next;
+    }
+
+    platform_memory_zero(allocator, sizeof(tlsf_allocator));
+}
+
+void* tlsf_allocator_allocate(tlsf_allocator* allocator, u64 size)
+{
+    ASSERT(allocator != nullptr && allocator->regions != nullptr, "Allocator must be initialized.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+
+    // Размер блока с заголовком, выровненный и не меньше минимального.
+    u64 block_size = (size + TLSF_BLOCK_OVERHEAD + TLSF_ALLOCATOR_ALIGNMENT - 1) & ~(u64)(TLSF_ALLOCATOR_ALIGNMENT - 1);
+    block_size = MAX(block_size, (u64)TLSF_BLOCK_MIN_SIZE);
+
+    if(block_size >= TLSF_MAX_BLOCK_SIZE)
+    {
+        LOG_ERROR("TLSF allocation of %llu bytes exceeds maximum block size.", size);
+        return nullptr;
+    }
+
+    u64 search_size = tlsf_round_size(block_size);
+    tlsf_block* block = tlsf_find_suitable(allocator, search_size);
+
+    if(UNLIKELY(!block))
+    {
+        // Регион размером не меньше округленного запроса гарантирует попадание в нужный список.
+        if(!tlsf_region_add(allocator, search_size))
+        {
+            LOG_ERROR("Failed to reserve TLSF region for %llu bytes.", size);
+            return nullptr;
+        }
+
+        block = tlsf_find_suitable(allocator, search_size);
+        ASSERT(block != nullptr, "New TLSF region must satisfy the request.");
+    }
+
+    tlsf_free_list_remove(allocator, block);
+
+    // Отделение остатка блока, если он вмещает минимальный блок.
+    u64 available = tlsf_block_size(block);
+    if(available - block_size >= TLSF_BLOCK_MIN_SIZE)
+    {
+        tlsf_block* remainder = POINTER_ADD_OFFSET(block, block_size);
+        remainder->size = (available - block_size) | TLSF_BLOCK_FREE_BIT;
+        remainder->prev_phys = block;
+        tlsf_block_next_phys(remainder)->prev_phys = remainder;
+        tlsf_free_list_insert(allocator, remainder);
+
+        available = block_size;
+    }
+
+    block->size = available;
+
+    allocator->used_size += available;
+    if(allocator->peak_used_size < allocator->used_size)
+    {
+        allocator->peak_used_size = allocator->used_size;
+    }
+
+    return POINTER_ADD_OFFSET(block, TLSF_BLOCK_OVERHEAD);
+}
+
+void tlsf_allocator_free(tlsf_allocator* allocator, void* ptr)
+{
+    ASSERT(allocator != nullptr && allocator->regions != nullptr, "Allocator must be initialized.");
+    ASSERT(ptr != nullptr, "Block pointer must be non-null.");
+
+    tlsf_block* block = POINTER_SUB_OFFSET(ptr, TLSF_BLOCK_OVERHEAD);
+    ASSERT(!tlsf_block_is_free(block), "TLSF block %p is already free.", ptr);
+
+    allocator->used_size -= tlsf_block_size(block);
+
+    // Слияние с предыдущим свободным блоком.
+    tlsf_block* prev = block->prev_phys;
+    if(prev && tlsf_block_is_free(prev))
+    {
+        tlsf_free_list_remove(allocator, prev);
+        prev->size = tlsf_block_size(prev) + tlsf_block_size(block);
+        block = prev;
+    }
+
+    // Слияние со следующим свободным блоком (блок-ограничитель всегда занят).
+    tlsf_block* next = tlsf_block_next_phys(block);
+    if(tlsf_block_is_free(next))
+    {
+        tlsf_free_list_remove(allocator, next);
+        block->size = tlsf_block_size(block) + tlsf_block_size(next);
+    }
+
+    block->size |= TLSF_BLOCK_FREE_BIT;
+    tlsf_block_next_phys(block)->prev_phys = block;
+    tlsf_free_list_insert(allocator, block);
+}
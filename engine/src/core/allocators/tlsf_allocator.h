@@ -0,0 +1,97 @@
+/*
+    @file tlsf_allocator.h
+    @brief Интерфейс распределителя памяти TLSF (Two-Level Segregated Fit).
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Выделение и освобождение блоков произвольного размера за ограниченное время O(1)
+            - Слияние соседних свободных блоков при освобождении
+            - Расширение распределителя новыми регионами виртуальной памяти
+
+    @note Особенности реализации:
+            - Свободные блоки распределены по спискам двухуровневой сегрегации (степень двойки и 32 поддиапазона),
+              поиск подходящего списка выполняется по битовым картам
+            - Регионы резервируются у платформы и освобождаются только при уничтожении распределителя
+            - Блоки выровнены по 16 байтам, накладные расходы - 16 байт на блок
+            - Время выделения ограничено, пока не требуется новый регион (обращение к системе)
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Выравнивание блоков распределителя в байтах.
+#define TLSF_ALLOCATOR_ALIGNMENT 16
+
+// @brief Размер региона распределителя по умолчанию в байтах.
+#define TLSF_ALLOCATOR_DEFAULT_REGION_SIZE MEBIBYTES(64)
+
+// @brief Количество списков первого уровня (классы степеней двойки).
+#define TLSF_FL_INDEX_COUNT 32
+
+// @brief Количество списков второго уровня на один список первого уровня.
+#define TLSF_SL_INDEX_COUNT 32
+
+// @brief Контекст распределителя TLSF.
+typedef struct tlsf_allocator {
+    // @brief Битовая карта непустых списков первого уровня.
+    u32 fl_bitmap;
+    // @brief Битовые карты непустых списков второго уровня.
+    u32 sl_bitmap[TLSF_FL_INDEX_COUNT];
+    // @brief Списки свободных блоков.
+    void* blocks[TLSF_FL_INDEX_COUNT][TLSF_SL_INDEX_COUNT];
+    // @brief Минимальный размер нового региона в байтах.
+    u64 region_size;
+    // @brief Список регионов распределителя.
+    void* regions;
+    // @brief Количество регионов.
+    u64 region_count;
+    // @brief Общий размер регионов в байтах.
+    u64 reserved_size;
+    // @brief Размер используемых блоков (с учетом заголовков) в данный момент в байтах.
+    u64 used_size;
+    // @brief Пиковый размер используемых блоков в байтах.
+    u64 peak_used_size;
+} tlsf_allocator;
+
+/*
+    @brief Инициализирует распределитель TLSF и резервирует первый регион.
+    @param region_size Минимальный размер региона в байтах (0 - размер по умолчанию).
+    @param out_allocator Указатель на распределитель для инициализации.
+    @return true - инициализация успешна, false - не удалось зарезервировать регион.
+*/
+CORE_API bool tlsf_allocator_create(u64 region_size, tlsf_allocator* out_allocator);
+
+/*
+    @brief Уничтожает распределитель TLSF и освобождает все его регионы.
+    @note Все выделенные блоки становятся недействительными.
+    @param allocator Указатель на распределитель.
+*/
+CORE_API void tlsf_allocator_destroy(tlsf_allocator* allocator);
+
+/*
+    @brief Выделяет блок памяти.
+    @note Если подходящего свободного блока нет, распределитель резервирует новый регион.
+    @param allocator Указатель на распределитель.
+    @param size Размер блока в байтах.
+    @return Указатель на блок (выровнен по TLSF_ALLOCATOR_ALIGNMENT) или nullptr при ошибке.
+*/
+CORE_API void* tlsf_allocator_allocate(tlsf_allocator* allocator, u64 size);
+
+/*
+    @brief Освобождает блок памяти, выделенный этим распределителем.
+    @note Использование указателя после освобождения приведет к непредсказуемому поведению!
+    @param allocator Указатель на распределитель.
+    @param block Указатель на блок памяти.
+*/
+CORE_API void tlsf_allocator_free(tlsf_allocator* allocator, void* block);
@@ -0,0 +1,107 @@
+#include "core/containers/bitset.h"
+#include "debug/assert.h"
+
+u32 bit_set_popcount(const u64* words, u32 word_count)
+{
+    ASSERT(words != nullptr, "Words pointer must be non-null.");
+
+    u32 count = 0;
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        count += (u32)__builtin_popcountll(words[i]);
+    }
+    return count;
+}
+
+bool bit_set_any(const u64* words, u32 word_count)
+{
+    ASSERT(words != nullptr, "Words pointer must be non-null.");
+
+    // Объединение слов без ветвлений (векторизуется компилятором).
+    u64 accumulator = 0;
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        accumulator |= words[i];
+    }
+    return accumulator != 0;
+}
+
+u32 bit_set_find_next(const u64* words, u32 word_count, u32 from)
+{
+    ASSERT(words != nullptr, "Words pointer must be non-null.");
+
+    u32 word_index = from / BITSET_WORD_BITS;
+    if(word_index >= word_count)
+    {
+        return BITSET_NOT_FOUND;
+    }
+
+    // В первом слове отбрасываются биты до начальной позиции.
+    u64 word = words[word_index] & (~0ULL << (from % BITSET_WORD_BITS));
+
+    for(;;)
+    {
+        if(word)
+        {
+            return word_index * BITSET_WORD_BITS + (u32)__builtin_ctzll(word);
+        }
+
+        if(++word_index >= word_count)
+        {
+            return BITSET_NOT_FOUND;
+        }
+
+        word = words[word_index];
+    }
+}
+
+u32 bit_set_collect(const u64* words, u32 word_count, u32* out_indices, u32 max_count)
+{
+    ASSERT(words != nullptr, "Words pointer must be non-null.");
+    ASSERT(out_indices != nullptr || max_count == 0, "Indices pointer must be non-null.");
+
+    u32 count = 0;
+    for(u32 i = 0; i < word_count && count < max_count; ++i)
+    {
+        // Извлечение младшего установленного бита и его сброс до опустошения слова.
+        u64 word = words[i];
+        while(word && count < max_count)
+        {
+            out_indices[count++] = i * BITSET_WORD_BITS + (u32)__builtin_ctzll(word);
+            word &= word - 1;
+        }
+    }
+    return count;
+}
+
+void bit_set_and(u64* dst, const u64* a, const u64* b, u32 word_count)
+{
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        dst[i] = a[i] & b[i];
+    }
+}
+
+void bit_set_or(u64* dst, const u64* a, const u64* b, u32 word_count)
+{
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        dst[i] = a[i] | b[i];
+    }
+}
+
+void bit_set_xor(u64* dst, const u64* a, const u64* b, u32 word_count)
+{
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        dst[i] = a[i] ^ b[i];
+    }
+}
+
+void bit_set_and_not(u64* dst, const u64* a, const u64* b, u32 word_count)
+{
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        dst[i] = a[i] & ~b[i];
+    }
+}
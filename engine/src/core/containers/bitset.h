@@ -0,0 +1,280 @@
+/*
+    @file bitset.h
+    @brief Интерфейс битового множества фиксированного размера.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Установку, сброс и проверку отдельных битов за O(1)
+            - Подсчет установленных битов, поиск первого и следующего установленного бита
+            - Обход и сбор индексов установленных битов
+            - Поэлементные операции над множествами (AND, OR, XOR, AND NOT)
+
+    @note Особенности реализации:
+            - Тип множества объявляется макросом BITSET(bits) и не требует выделения памяти
+            - Биты хранятся в 64-битных словах, поэтому сканирование пропускает 64 нулевых бита за одну проверку,
+              а поэлементные операции обрабатывают слова циклом, который компилятор векторизует
+            - Подсчет и поиск используют инструкции процессора (popcnt, tzcnt) через встроенные функции компилятора
+            - Обнуленное множество является пустым
+            - Для работы с множеством используются макросы (bitset_*), функции bit_set_* принимают массив слов
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Количество бит в слове множества.
+#define BITSET_WORD_BITS 64
+
+// @brief Количество слов, необходимое для хранения указанного количества бит.
+#define BITSET_WORD_COUNT(bits) (((bits) + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS)
+
+// @brief Признак отсутствия установленного бита при поиске.
+#define BITSET_NOT_FOUND U32_MAX
+
+/*
+    @brief Объявляет тип битового множества.
+    @param bits Количество бит множества.
+*/
+#define BITSET(bits)                        \
+    struct {                                \
+        u64 words[BITSET_WORD_COUNT(bits)]; \
+    }
+
+/*
+    @brief Устанавливает бит.
+    @param words Массив слов множества.
+    @param index Индекс бита.
+*/
+INLINE void bit_set_set(u64* words, u32 index)
+{
+    words[index / BITSET_WORD_BITS] |= 1ULL << (index % BITSET_WORD_BITS);
+}
+
+/*
+    @brief Сбрасывает бит.
+    @param words Массив слов множества.
+    @param index Индекс бита.
+*/
+INLINE void bit_set_reset(u64* words, u32 index)
+{
+    words[index / BITSET_WORD_BITS] &= ~(1ULL << (index % BITSET_WORD_BITS));
+}
+
+/*
+    @brief Устанавливает или сбрасывает бит.
+    @param words Массив слов множества.
+    @param index Индекс бита.
+    @param value Новое значение бита.
+*/
+INLINE void bit_set_assign(u64* words, u32 index, bool value)
+{
+    u64 mask = 1ULL << (index % BITSET_WORD_BITS);
+    u64* word = &words[index / BITSET_WORD_BITS];
+    *word = (*word & ~mask) | (value ? mask : 0);
+}
+
+/*
+    @brief Проверяет бит.
+    @param words Массив слов множества.
+    @param index Индекс бита.
+    @return true - бит установлен, false - бит сброшен.
+*/
+INLINE bool bit_set_test(const u64* words, u32 index)
+{
+    return (words[index / BITSET_WORD_BITS] >> (index % BITSET_WORD_BITS)) & 1;
+}
+
+/*
+    @brief Сбрасывает все биты.
+    @param words Массив слов множества.
+    @param word_count Количество слов.
+*/
+INLINE void bit_set_clear(u64* words, u32 word_count)
+{
+    for(u32 i = 0; i < word_count; ++i)
+    {
+        words[i] = 0;
+    }
+}
+
+/*
+    @brief Возвращает количество установленных битов.
+    @param words Массив слов множества.
+    @param word_count Количество слов.
+    @return Количество установленных битов.
+*/
+CORE_API u32 bit_set_popcount(const u64* words, u32 word_count);
+
+/*
+    @brief Проверяет наличие хотя бы одного установленного бита.
+    @param words Массив слов множества.
+    @param word_count Количество слов.
+    @return true - есть установленные биты, false - множество пусто.
+*/
+CORE_API bool bit_set_any(const u64* words, u32 word_count);
+
+/*
+    @brief Находит установленный бит, начиная с указанного индекса.
+    @param words Массив слов множества.
+    @param word_count Количество слов.
+    @param from Индекс бита, с которого начинается поиск (включительно).
+    @return Индекс найденного бита или BITSET_NOT_FOUND.
+*/
+CORE_API u32 bit_set_find_next(const u64* words, u32 word_count, u32 from);
+
+/*
+    @brief Записывает индексы установленных битов по возрастанию.
+    @param words Массив слов множества.
+    @param word_count Количество слов.
+    @param out_indices Массив для записи индексов.
+    @param max_count Размер массива индексов.
+    @return Количество записанных индексов (не больше max_count).
+*/
+CORE_API u32 bit_set_collect(const u64* words, u32 word_count, u32* out_indices, u32 max_count);
+
+/*
+    @brief Выполняет поэлементную операцию dst = a & b.
+    @param dst Массив слов результата (может совпадать с a или b).
+    @param a Массив слов первого множества.
+    @param b Массив слов второго множества.
+    @param word_count Количество слов.
+*/
+CORE_API void bit_set_and(u64* dst, const u64* a, const u64* b, u32 word_count);
+
+/*
+    @brief Выполняет поэлементную операцию dst = a | b.
+    @param dst Массив слов результата (может совпадать с a или b).
+    @param a Массив слов первого множества.
+    @param b Массив слов второго множества.
+    @param word_count Количество слов.
+*/
+CORE_API void bit_set_or(u64* dst, const u64* a, const u64* b, u32 word_count);
+
+/*
+    @brief Выполняет поэлементную операцию dst = a ^ b.
+    @param dst Массив слов результата (может совпадать с a или b).
+    @param a Массив слов первого множества.
+    @param b Массив слов второго множества.
+    @param word_count Количество слов.
+*/
+CORE_API void bit_set_xor(u64* dst, const u64* a, const u64* b, u32 word_count);
+
+/*
+    @brief Выполняет поэлементную операцию dst = a & ~b.
+    @param dst Массив слов результата (может совпадать с a или b).
+    @param a Массив слов первого множества.
+    @param b Массив слов второго множества.
+    @param word_count Количество слов.
+*/
+CORE_API void bit_set_and_not(u64* dst, const u64* a, const u64* b, u32 word_count);
+
+/*
+    @brief Возвращает количество бит, которое может хранить множество.
+    @param set Битовое множество (не указатель).
+*/
+#define bitset_capacity(set) ((u32)(ARRAY_SIZE((set).words) * BITSET_WORD_BITS))
+
+/*
+    @brief Устанавливает бит.
+    @param set Битовое множество (не указатель).
+    @param index Индекс бита.
+*/
+#define bitset_set(set, index) bit_set_set((set).words, index)
+
+/*
+    @brief Сбрасывает бит.
+    @param set Битовое множество (не указатель).
+    @param index Индекс бита.
+*/
+#define bitset_reset(set, index) bit_set_reset((set).words, index)
+
+/*
+    @brief Устанавливает или сбрасывает бит.
+    @param set Битовое множество (не указатель).
+    @param index Индекс бита.
+    @param value Новое значение бита.
+*/
+#define bitset_assign(set, index, value) bit_set_assign((set).words, index, value)
+
+/*
+    @brief Проверяет бит.
+    @param set Битовое множество (не указатель).
+    @param index Индекс бита.
+    @return true - бит установлен, false - бит сброшен.
+*/
+#define bitset_test(set, index) bit_set_test((set).words, index)
+
+/*
+    @brief Сбрасывает все биты.
+    @param set Битовое множество (не указатель).
+*/
+#define bitset_clear(set) bit_set_clear((set).words, ARRAY_SIZE((set).words))
+
+/*
+    @brief Возвращает количество установленных битов.
+    @param set Битовое множество (не указатель).
+    @return Количество установленных битов.
+*/
+#define bitset_popcount(set) bit_set_popcount((set).words, ARRAY_SIZE((set).words))
+
+/*
+    @brief Проверяет наличие хотя бы одного установленного бита.
+    @param set Битовое множество (не указатель).
+    @return true - есть установленные биты, false - множество пусто.
+*/
+#define bitset_any(set) bit_set_any((set).words, ARRAY_SIZE((set).words))
+
+/*
+    @brief Находит первый установленный бит.
+    @param set Битовое множество (не указатель).
+    @return Индекс найденного бита или BITSET_NOT_FOUND.
+*/
+#define bitset_find_first(set) bit_set_find_next((set).words, ARRAY_SIZE((set).words), 0)
+
+/*
+    @brief Находит установленный бит, начиная с указанного индекса.
+    @param set Битовое множество (не указатель).
+    @param from Индекс бита, с которого начинается поиск (включительно).
+    @return Индекс найденного бита или BITSET_NOT_FOUND.
+*/
+#define bitset_find_next(set, from) bit_set_find_next((set).words, ARRAY_SIZE((set).words), from)
+
+/*
+    @brief Записывает индексы установленных битов по возрастанию.
+    @param set Битовое множество (не указатель).
+    @param out_indices Массив для записи индексов.
+    @param max_count Размер массива индексов.
+    @return Количество записанных индексов.
+*/
+#define bitset_collect(set, out_indices, max_count) bit_set_collect((set).words, ARRAY_SIZE((set).words), out_indices, max_count)
+
+/*
+    @brief Выполняет поэлементные операции над множествами одного размера.
+    @param dst Множество результата (не указатель).
+    @param a Первое множество (не указатель).
+    @param b Второе множество (не указатель).
+*/
+#define bitset_and(dst, a, b)     bit_set_and((dst).words, (a).words, (b).words, ARRAY_SIZE((dst).words))
+#define bitset_or(dst, a, b)      bit_set_or((dst).words, (a).words, (b).words, ARRAY_SIZE((dst).words))
+#define bitset_xor(dst, a, b)     bit_set_xor((dst).words, (a).words, (b).words, ARRAY_SIZE((dst).words))
+#define bitset_and_not(dst, a, b) bit_set_and_not((dst).words, (a).words, (b).words, ARRAY_SIZE((dst).words))
+
+/*
+    @brief Обходит индексы установленных битов по возрастанию.
+    @note Изменение множества внутри цикла допустимо только для уже пройденных битов.
+    @param set Битовое множество (не указатель).
+    @param index Имя переменной (u32) для индекса текущего бита.
+*/
+#define bitset_foreach(set, index)                                     \
+    for(u32 index = bitset_find_first(set); index != BITSET_NOT_FOUND; \
+        index = bitset_find_next(set, index + 1))
@@ -3,6 +3,67 @@
 #include "core/memory.h"
 #include "debug/assert.h"
 
+// Служебные данные виртуального массива, располагаются в начале зарезервированного диапазона перед заголовком.
+typedef struct dynamic_array_virtual {
+    // Размер зарезервированного диапазона в байтах.
+    u64 reserved_size;
+    // Размер зафиксированных страниц в байтах.
+    u64 committed_size;
+} dynamic_array_virtual;
+
+// Тег памяти хранится в заголовке одним байтом.
+STATIC_ASSERT(MEMORY_TAG_COUNT <= U8_MAX, "Memory tag must fit in dynamic array header.");
+
+// Размер служебных данных виртуального массива перед элементами.
+#define DARRAY_VIRTUAL_OVERHEAD (sizeof(dynamic_array_virtual) + sizeof(dynamic_array_header))
+
+static u64 array_page_align(u64 size)
+{
+    u64 page_size = platform_memory_page_size();
+    return (size + page_size - 1) & ~(page_size - 1);
+}
+
+// Возвращает максимальную емкость виртуального массива (весь зарезервированный диапазон).
+static u64 array_virtual_max_capacity(const dynamic_array_header* header)
+{
+    const dynamic_array_virtual* range = (const dynamic_array_virtual*)header - 1;
+    return (range->reserved_size - DARRAY_VIRTUAL_OVERHEAD) / header->stride;
+}
+
+static dynamic_array_header* array_grow_virtual(dynamic_array_header* header, u64 new_capacity)
+{
+    dynamic_array_virtual* range = (dynamic_array_virtual*)header - 1;
+    u64 max_capacity = array_virtual_max_capacity(header);
+
+    // Уменьшение и сохранение емкости не требуют фиксации страниц (зафиксированные страницы не возвращаются).
+    if(new_capacity <= header->capacity)
+    {
+        return header;
+    }
+
+    if(new_capacity > max_capacity)
+    {
+        LOG_ERROR("Virtual array reached its maximum capacity (%llu), requested %llu.", max_capacity, new_capacity);
+        return nullptr;
+    }
+
+    // Фиксация недостающих страниц сразу за уже зафиксированными, данные остаются на месте.
+    u64 required_size = array_page_align(DARRAY_VIRTUAL_OVERHEAD + header->stride * new_capacity);
+    if(required_size > range->committed_size)
+    {
+        if(!memory_commit((u8*)range + range->committed_size, required_size - range->committed_size, header->tag))
+        {
+            LOG_ERROR("Failed to commit memory for virtual array to grow.");
+            return nullptr;
+        }
+        range->committed_size = required_size;
+    }
+
+    // Емкость учитывает весь остаток последней страницы.
+    header->capacity = MIN((range->committed_size - DARRAY_VIRTUAL_OVERHEAD) / header->stride, max_capacity);
+    return header;
+}
+
 static dynamic_array_header* array_resize(dynamic_array_header* old_header, u64 new_capacity)
 {
     // Проверка на переполнение.
@@ -18,8 +79,13 @@ static dynamic_array_header* array_resize(dynamic_array_header* old_header, u64
         return nullptr;
     }
 
+    if(old_header->flags & DYNAMIC_ARRAY_FLAG_VIRTUAL)
+    {
+        return array_grow_virtual(old_header, new_capacity);
+    }
+
     u64 new_total_size = sizeof(dynamic_array_header) + old_header->stride * new_capacity;
-    dynamic_array_header* new_header = mallocate(new_total_size, MEMORY_TAG_DARRAY);
+    dynamic_array_header* new_header = mallocate(new_total_size, old_header->tag);
     if(!new_header)
     {
         LOG_ERROR("Failed to allocate memory for array to resize.");
@@ -35,14 +101,40 @@ static dynamic_array_header* array_resize(dynamic_array_header* old_header, u64
 
     // Освобождение старой памяти.
     u64 old_total_size = sizeof(dynamic_array_header) + old_header->stride * old_header->capacity;
-    mfree(old_header, old_total_size, MEMORY_TAG_DARRAY);
+    mfree(old_header, old_total_size, old_header->tag);
 
     return new_header;
 }
 
+// Увеличивает емкость массива не меньше чем до required с учетом множителя роста массива.
+static dynamic_array_header* array_grow(dynamic_array_header* header, u64 required)
+{
+    if(required <= header->capacity)
+    {
+        return header;
+    }
+
+    u64 grown = header->capacity > U64_MAX / header->resize_factor ? required : header->capacity * header->resize_factor / 100;
+    grown = MAX(grown, header->capacity + 1);
+
+    // NOTE: Рост виртуального массива по множителю ограничивается зарезервированным диапазоном,
+    //       ошибкой считается только требуемая емкость больше максимальной.
+    if(header->flags & DYNAMIC_ARRAY_FLAG_VIRTUAL)
+    {
+        grown = MIN(grown, array_virtual_max_capacity(header));
+    }
+
+    return array_resize(header, MAX(required, grown));
+}
+
 void* dynamic_array_create(u64 stride, u64 capacity)
 {
-    ASSERT(stride > 0, "Stride must be greater than zero.");
+    return dynamic_array_create_tagged(stride, capacity, MEMORY_TAG_DARRAY);
+}
+
+void* dynamic_array_create_tagged(u64 stride, u64 capacity, memory_tag tag)
+{
+    ASSERT(stride > 0 && stride <= U32_MAX, "Stride must be greater than zero and fit in 32 bits.");
     ASSERT(capacity > 0, "Capacity must be greater than zero.");
 
     // Проверка на переполнение.
@@ -53,7 +145,7 @@ void* dynamic_array_create(u64 stride, u64 capacity)
     }
 
     u64 total_size = sizeof(dynamic_array_header) + stride * capacity;
-    dynamic_array_header* header = mallocate(total_size, MEMORY_TAG_DARRAY);
+    dynamic_array_header* header = mallocate(total_size, tag);
     if(!header)
     {
         LOG_ERROR("Failed to allocate memory for array to create.");
@@ -61,13 +153,61 @@ void* dynamic_array_create(u64 stride, u64 capacity)
     }
     mzero(header, total_size);
 
-    header->stride = stride;
+    header->stride = (u32)stride;
+    header->flags = 0;
+    header->tag = (u8)tag;
+    header->resize_factor = DARRAY_DEFAULT_RESIZE_FACTOR;
     header->capacity = capacity;
     header->length = 0;
 
     return header->internal_data;
 }
 
+void* dynamic_array_create_virtual(u64 stride, u64 max_capacity)
+{
+    ASSERT(stride > 0 && stride <= U32_MAX, "Stride must be greater than zero and fit in 32 bits.");
+    ASSERT(max_capacity > 0, "Capacity must be greater than zero.");
+
+    // Проверка на переполнение.
+    if(max_capacity > (U64_MAX - DARRAY_VIRTUAL_OVERHEAD) / stride)
+    {
+        LOG_ERROR("Requested capacity too large: %llu.", max_capacity);
+        return nullptr;
+    }
+
+    u64 reserved_size = array_page_align(DARRAY_VIRTUAL_OVERHEAD + stride * max_capacity);
+    dynamic_array_virtual* range = memory_reserve(reserved_size);
+    if(!range)
+    {
+        LOG_ERROR("Failed to reserve memory for virtual array to create.");
+        return nullptr;
+    }
+
+    // Фиксация страниц под заголовок и хотя бы один элемент (зафиксированные страницы заполнены нулями).
+    u64 committed_size = array_page_align(DARRAY_VIRTUAL_OVERHEAD + stride);
+    if(!memory_commit(range, committed_size, MEMORY_TAG_DARRAY))
+    {
+        LOG_ERROR("Failed to commit memory for virtual array to create.");
+        memory_release(range, reserved_size);
+        return nullptr;
+    }
+
+    range->reserved_size = reserved_size;
+    range->committed_size = committed_size;
+
+    dynamic_array_header* header = (dynamic_array_header*)(range + 1);
+    header->stride = (u32)stride;
+    header->flags = DYNAMIC_ARRAY_FLAG_VIRTUAL;
+    header->tag = MEMORY_TAG_DARRAY;
+    header->resize_factor = DARRAY_DEFAULT_RESIZE_FACTOR;
+    // NOTE: Емкость учитывает весь остаток зафиксированных страниц, поэтому максимальная емкость определяется
+    //       размером диапазона, округленным до страницы, и может превышать запрошенную.
+    header->capacity = (committed_size - DARRAY_VIRTUAL_OVERHEAD) / stride;
+    header->length = 0;
+
+    return header->internal_data;
+}
+
 void dynamic_array_destroy(void* array)
 {
     ASSERT(array != nullptr, "Array pointer must be non-null.");
@@ -75,17 +215,73 @@ void dynamic_array_destroy(void* array)
     // Получение указателя на заголовок.
     dynamic_array_header* header = (dynamic_array_header*)array - 1;
 
+    if(header->flags & DYNAMIC_ARRAY_FLAG_VIRTUAL)
+    {
+        dynamic_array_virtual* range = (dynamic_array_virtual*)header - 1;
+        u64 reserved_size = range->reserved_size;
+        memory_decommit(range, range->committed_size, header->tag);
+        memory_release(range, reserved_size);
+        return;
+    }
+
     u64 size = sizeof(dynamic_array_header) + header->stride * header->capacity;
-    mfree(header, size, MEMORY_TAG_DARRAY);
+    mfree(header, size, header->tag);
+}
+
+bool dynamic_array_is_virtual(void* array)
+{
+    ASSERT(array != nullptr, "Array pointer must be non-null.");
+
+    dynamic_array_header* header = (dynamic_array_header*)array - 1;
+    return (header->flags & DYNAMIC_ARRAY_FLAG_VIRTUAL) != 0;
 }
 
-bool dynamic_array_resize(void** array, u32 new_capacity)
+bool dynamic_array_resize(void** array, u64 new_capacity)
 {
+    ASSERT(array != nullptr && *array != nullptr, "Array pointer must be non-null.");
+
     dynamic_array_header* old_header = (dynamic_array_header*)(*array) - 1;
-    *array = array_resize(old_header, new_capacity)->internal_data;
+    dynamic_array_header* new_header = array_resize(old_header, new_capacity);
+    if(!new_header)
+    {
+        return false;
+    }
+
+    *array = new_header->internal_data;
+    return true;
+}
+
+bool dynamic_array_reserve(void** array, u64 capacity)
+{
+    ASSERT(array != nullptr && *array != nullptr, "Array pointer must be non-null.");
+
+    dynamic_array_header* header = (dynamic_array_header*)(*array) - 1;
+    if(capacity <= header->capacity)
+    {
+        return true;
+    }
+
+    // Резервирование выделяет ровно запрошенную емкость, множитель роста не применяется.
+    header = array_resize(header, capacity);
+    if(!header || header->capacity < capacity)
+    {
+        LOG_ERROR("Failed to reserve array capacity %llu.", capacity);
+        return false;
+    }
+
+    *array = header->internal_data;
     return true;
 }
 
+void dynamic_array_set_resize_factor(void* array, u16 resize_factor)
+{
+    ASSERT(array != nullptr, "Array pointer must be non-null.");
+    ASSERT(resize_factor >= DARRAY_MIN_RESIZE_FACTOR, "Resize factor must be at least DARRAY_MIN_RESIZE_FACTOR.");
+
+    dynamic_array_header* header = (dynamic_array_header*)array - 1;
+    header->resize_factor = resize_factor;
+}
+
 u64 dynamic_array_stride(void* array)
 {
     ASSERT(array != nullptr, "Array pointer must be non-null.");
@@ -118,8 +314,7 @@ void dynamic_array_push(void** array, const void* data)
     dynamic_array_header* header = (dynamic_array_header*)(*array) - 1;
     if(header->length >= header->capacity)
     {
-        u64 new_capacity = header->capacity * DARRAY_DEFAULT_RESIZE_FACTOR;
-        header = array_resize(header, new_capacity);
+        header = array_grow(header, header->length + 1);
         if(!header)
         {
             LOG_ERROR("Failed to resize array during push operation.");
@@ -134,6 +329,43 @@ void dynamic_array_push(void** array, const void* data)
     *array = header->internal_data;
 }
 
+void dynamic_array_push_n(void** array, const void* data, u64 count)
+{
+    ASSERT(array != nullptr && *array != nullptr, "Array pointer must be non-null.");
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    dynamic_array_header* header = (dynamic_array_header*)(*array) - 1;
+    if(count > U64_MAX - header->length)
+    {
+        LOG_ERROR("Requested length too large: %llu + %llu.", header->length, count);
+        return;
+    }
+
+    header = array_grow(header, header->length + count);
+    if(!header)
+    {
+        LOG_ERROR("Failed to resize array during push operation.");
+        return;
+    }
+
+    void* addr = header->internal_data + header->stride * header->length;
+    if(data)
+    {
+        mcopy(addr, data, header->stride * count);
+    }
+    else
+    {
+        mzero(addr, header->stride * count);
+    }
+
+    header->length += count;
+    *array = header->internal_data;
+}
+
 void dynamic_array_pop(void* array, void* out_data)
 {
     ASSERT(array != nullptr, "Array pointer must be non-null.");
@@ -168,8 +400,7 @@ void dynamic_array_insert(void** array, u64 index, const void* data)
 
     if(header->length >= header->capacity)
     {
-        u64 new_capacity = header->capacity * DARRAY_DEFAULT_RESIZE_FACTOR;
-        header = array_resize(header, new_capacity);
+        header = array_grow(header, header->length + 1);
         if(!header)
         {
             LOG_ERROR("Failed to resize array during insert operation.");
@@ -191,6 +422,50 @@ void dynamic_array_insert(void** array, u64 index, const void* data)
     *array = header->internal_data;
 }
 
+void dynamic_array_insert_range(void** array, u64 index, const void* data, u64 count)
+{
+    ASSERT(array != nullptr && *array != nullptr, "Array pointer must be non-null.");
+    ASSERT(data != nullptr, "Data pointer must be non-null.");
+
+    dynamic_array_header* header = (dynamic_array_header*)(*array) - 1;
+    if(index > header->length)
+    {
+        LOG_ERROR("Index out of bounds: %llu (length: %llu).", index, header->length);
+        return;
+    }
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    if(count > U64_MAX - header->length)
+    {
+        LOG_ERROR("Requested length too large: %llu + %llu.", header->length, count);
+        return;
+    }
+
+    header = array_grow(header, header->length + count);
+    if(!header)
+    {
+        LOG_ERROR("Failed to resize array during insert operation.");
+        return;
+    }
+
+    u8* addr = header->internal_data + header->stride * index;
+
+    // Сдвиг элементов только, если вставка не в конец массива.
+    if(index < header->length)
+    {
+        mmove(addr + header->stride * count, addr, header->stride * (header->length - index));
+    }
+
+    mcopy(addr, data, header->stride * count);
+
+    header->length += count;
+    *array = header->internal_data;
+}
+
 void dynamic_array_remove(void* array, u64 index, void* out_data)
 {
     ASSERT(array != nullptr, "Array pointer must be non-null.");
@@ -223,6 +498,33 @@ void dynamic_array_remove(void* array, u64 index, void* out_data)
     }
 }
 
+void dynamic_array_remove_swap(void* array, u64 index, void* out_data)
+{
+    ASSERT(array != nullptr, "Array pointer must be non-null.");
+
+    dynamic_array_header* header = (dynamic_array_header*)array - 1;
+    if(index >= header->length)
+    {
+        LOG_ERROR("Index out of bounds: %llu (length: %llu).", index, header->length);
+        return;
+    }
+
+    header->length--;
+
+    u8* addr = header->internal_data + header->stride * index;
+
+    if(out_data)
+    {
+        mcopy(out_data, addr, header->stride);
+    }
+
+    // Перемещение последнего элемента на место удаляемого.
+    if(index < header->length)
+    {
+        mcopy(addr, header->internal_data + header->stride * header->length, header->stride);
+    }
+}
+
 void dynamic_array_clear(void* array, bool zero_memory)
 {
     ASSERT(array != nullptr, "Array pointer must be non-null.");
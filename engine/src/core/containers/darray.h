@@ -2,8 +2,8 @@
     @file darray.h
     @brief Интерфейс динамического массива.
     @author Дмитрий Скляр.
-    @version 1.0
-    @date 14-09-2025
+    @version 1.3
+    @date 16-10-2026
 
     @license Лицензия Apache, версия 2.0 («Лицензия»);
           Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
@@ -16,19 +16,26 @@
     @note Предоставляет:
             - Автоматическое управление памятью с реаллокацией
             - Добавление/удаление элементов в начало, конец и середину
+            - Пакетное добавление и вставку диапазонов элементов, удаление без сохранения порядка за O(1)
+            - Резервирование емкости без изменения длины
             - Работу с любыми типами данных через type-agnostic интерфейс
             - Безопасный доступ к элементам с проверкой границ (в debug-режиме)
-            - Эффективное использование памяти с настраиваемым множителем емкости
+            - Эффективное использование памяти с настраиваемым для каждого массива множителем емкости
+            - Массивы в зарезервированной виртуальной памяти, растущие на месте без копирования
+            - Учет памяти массива по указанному тегу (по умолчанию MEMORY_TAG_DARRAY)
 
     @note Особенности реализации:
             - Данные хранятся в одном непрерывном блоке памяти с заголовком
             - Заголовок содержит метаинформацию и находится перед данными массива
             - Для работы с массивом используются макросы (darray_*) для type safety
+            - Виртуальный массив резервирует диапазон адресов под максимальную емкость и фиксирует страницы
+              по мере роста, поэтому адреса элементов не меняются, а память учитывается по зафиксированным страницам
 */
 
 #pragma once
 
 #include <core/defines.h>
+#include <core/memory.h>
 
 // @brief Заголовок динамического массива, хранящий метаданные.
 typedef struct dynamic_array_header {
@@ -37,16 +44,31 @@ typedef struct dynamic_array_header {
     // @brief Текущее количество элементов.
     u64 length;
     // @brief Размер одного элемента в байтах.
-    u64 stride;
+    u32 stride;
+    // @brief Флаги массива (см. dynamic_array_flag).
+    u8 flags;
+    // @brief Тег памяти, по которому учитывается массив (см. memory_tag).
+    u8 tag;
+    // @brief Множитель увеличения емкости в процентах (например, 150 - рост в 1.5 раза).
+    u16 resize_factor;
     // @brief Гибкий массив для данных.
     u8 internal_data[];
 } dynamic_array_header;
 
+// @brief Флаги динамического массива.
+typedef enum dynamic_array_flag {
+    // @brief Массив размещен в зарезервированной виртуальной памяти и растет на месте.
+    DYNAMIC_ARRAY_FLAG_VIRTUAL = 1 << 0,
+} dynamic_array_flag;
+
 // @brief Стандартная начальная емкость массива.
 #define DARRAY_DEFAULT_CAPACITY      1
 
-// @brief Стандартный множитель для увеличения емкости.
-#define DARRAY_DEFAULT_RESIZE_FACTOR 2
+// @brief Стандартный множитель для увеличения емкости в процентах (удвоение).
+#define DARRAY_DEFAULT_RESIZE_FACTOR 200
+
+// @brief Минимальный множитель для увеличения емкости в процентах.
+#define DARRAY_MIN_RESIZE_FACTOR     110
 
 /*
     @brief Создает новый динамический массив.
@@ -57,20 +79,65 @@ typedef struct dynamic_array_header {
 */
 CORE_API void* dynamic_array_create(u64 stride, u64 capacity);
 
+/*
+    @brief Создает новый динамический массив с учетом памяти по указанному тегу.
+    @note Выделенная память инициализируется нулевыми байтами.
+    @param stride Размер одного элемента в байтах.
+    @param capacity Начальная емкость массива.
+    @param tag Тег памяти массива (используется при всех перевыделениях).
+    @return Указатель на массив или nullptr при ошибке выделения памяти.
+*/
+CORE_API void* dynamic_array_create_tagged(u64 stride, u64 capacity, memory_tag tag);
+
+/*
+    @brief Создает динамический массив в зарезервированной виртуальной памяти.
+    @note Диапазон адресов резервируется под max_capacity элементов, физические страницы фиксируются по мере
+          роста массива. Рост выполняется на месте: указатель на массив и адреса элементов не меняются.
+    @note Зафиксированная память учитывается по тегу MEMORY_TAG_DARRAY.
+    @param stride Размер одного элемента в байтах.
+    @param max_capacity Максимальная емкость массива.
+    @return Указатель на массив или nullptr при ошибке резервирования.
+*/
+CORE_API void* dynamic_array_create_virtual(u64 stride, u64 max_capacity);
+
 /*
     @brief Уничтожает динамический массив и освобождает память.
     @param array Указатель на массив.
 */
 CORE_API void dynamic_array_destroy(void* array);
 
+/*
+    @brief Проверяет, размещен ли массив в зарезервированной виртуальной памяти.
+    @param array Указатель на массив.
+    @return true - массив виртуальный, false - массив размещен в куче.
+*/
+CORE_API bool dynamic_array_is_virtual(void* array);
+
 /*
     @brief Изменяет размер динамического массива с сохранением существующих данных.
     @note Старый массив автоматически освобождается.
+    @note Виртуальный массив растет на месте, запрос емкости больше максимальной завершается ошибкой.
     @param array Указатель на указатель массива (может измениться при реаллокации).
     @param new_capacity Новая емкость массива.
     @return true - массив успешно изменен, false - ошибка (память не перевыделена, исходный массив остается неизменным).
 */
-CORE_API bool dynamic_array_resize(void** array, u32 new_capacity);
+CORE_API bool dynamic_array_resize(void** array, u64 new_capacity);
+
+/*
+    @brief Резервирует емкость массива не меньше указанной без изменения длины.
+    @note Если текущая емкость достаточна, массив не изменяется.
+    @param array Указатель на указатель массива (может измениться при реаллокации).
+    @param capacity Требуемая емкость массива.
+    @return true - емкость достаточна, false - ошибка (исходный массив остается неизменным).
+*/
+CORE_API bool dynamic_array_reserve(void** array, u64 capacity);
+
+/*
+    @brief Устанавливает множитель увеличения емкости массива.
+    @param array Указатель на массив.
+    @param resize_factor Множитель в процентах (не меньше DARRAY_MIN_RESIZE_FACTOR).
+*/
+CORE_API void dynamic_array_set_resize_factor(void* array, u16 resize_factor);
 
 /*
     @brief Возвращает размер элемента массива в байтах.
@@ -100,6 +167,15 @@ CORE_API u64 dynamic_array_capacity(void* array);
 */
 CORE_API void dynamic_array_push(void** array, const void* data);
 
+/*
+    @brief Добавляет несколько элементов в конец массива.
+    @note Емкость увеличивается не более одного раза за вызов.
+    @param array Указатель на указатель массива (может измениться при реаллокации).
+    @param data Указатель на добавляемые элементы (nullptr - элементы обнуляются).
+    @param count Количество элементов.
+*/
+CORE_API void dynamic_array_push_n(void** array, const void* data, u64 count);
+
 /*
     @brief Удаляет последний элемент массива.
     @param array Указатель на массив.
@@ -115,6 +191,15 @@ CORE_API void dynamic_array_pop(void* array, void* out_data);
 */
 CORE_API void dynamic_array_insert(void** array, u64 index, const void* data);
 
+/*
+    @brief Вставляет несколько элементов начиная с указанной позиции.
+    @param array Указатель на указатель массива (может измениться при реаллокации).
+    @param index Позиция для вставки.
+    @param data Указатель на вставляемые элементы (не должен указывать внутрь массива).
+    @param count Количество элементов.
+*/
+CORE_API void dynamic_array_insert_range(void** array, u64 index, const void* data, u64 count);
+
 /*
     @brief Удаляет элемент из указанной позиции.
     @param array Указатель на массив.
@@ -123,6 +208,15 @@ CORE_API void dynamic_array_insert(void** array, u64 index, const void* data);
 */
 CORE_API void dynamic_array_remove(void* array, u64 index, void* out_data);
 
+/*
+    @brief Удаляет элемент из указанной позиции, перемещая на его место последний элемент.
+    @note Выполняется за O(1), но не сохраняет порядок элементов.
+    @param array Указатель на массив.
+    @param index Позиция для удаления.
+    @param out_data Указатель для копирования удаляемого элемента (может быть nullptr).
+*/
+CORE_API void dynamic_array_remove_swap(void* array, u64 index, void* out_data);
+
 /*
     @brief Очищает массив (устанавливает длину в 0, но сохраняет емкость).
     @param array Указатель на массив.
@@ -152,6 +246,24 @@ CORE_API void dynamic_array_set_length(void* array, u64 length);
 */
 #define darray_create_custom(type, capacity) (type*)dynamic_array_create(sizeof(type), capacity)
 
+/*
+    @brief Создает динамический массив для указанного типа и емкости с учетом памяти по тегу.
+    @param type Тип элементов массива.
+    @param capacity Начальная емкость массива.
+    @param tag Тег памяти массива.
+    @return Указатель на созданный массив или nullptr.
+*/
+#define darray_create_tagged(type, capacity, tag) (type*)dynamic_array_create_tagged(sizeof(type), capacity, tag)
+
+/*
+    @brief Создает динамический массив для указанного типа в зарезервированной виртуальной памяти.
+    @note Массив растет на месте без копирования, указатель на массив не меняется.
+    @param type Тип элементов массива.
+    @param max_capacity Максимальная емкость массива.
+    @return Указатель на созданный массив или nullptr.
+*/
+#define darray_create_virtual(type, max_capacity) (type*)dynamic_array_create_virtual(sizeof(type), max_capacity)
+
 /*
     @brief Уничтожает динамический массив и освобождает память.
     @param array Указатель на массив.
@@ -167,6 +279,21 @@ CORE_API void dynamic_array_set_length(void* array, u64 length);
 */
 #define darray_resize(array, new_capacity) dynamic_array_resize((void**)&(array), new_capacity)
 
+/*
+    @brief Резервирует емкость массива не меньше указанной без изменения длины.
+    @param array Указатель на массив (может измениться при реаллокации).
+    @param capacity Требуемая емкость массива.
+    @return true - емкость достаточна, false - ошибка (исходный массив остается неизменным).
+*/
+#define darray_reserve(array, capacity) dynamic_array_reserve((void**)&(array), capacity)
+
+/*
+    @brief Устанавливает множитель увеличения емкости массива.
+    @param array Указатель на массив.
+    @param resize_factor Множитель в процентах (например, 150 - рост в 1.5 раза).
+*/
+#define darray_set_resize_factor(array, resize_factor) dynamic_array_set_resize_factor((void*)array, resize_factor)
+
 /*
     @brief Возвращает размер элемента массива в байтах.
     @param array Указатель на массив.
@@ -199,6 +326,14 @@ CORE_API void dynamic_array_set_length(void* array, u64 length);
         dynamic_array_push((void**)&(array), &__temp); \
     } while(false)
 
+/*
+    @brief Добавляет несколько элементов в конец массива.
+    @param array Указатель на массив (может измениться при реаллокации).
+    @param data Указатель на добавляемые элементы (nullptr - элементы обнуляются).
+    @param count Количество элементов.
+*/
+#define darray_push_n(array, data, count) dynamic_array_push_n((void**)&(array), data, count)
+
 /*
     @brief Удаляет последний элемент массива.
     @param array Указатель на массив.
@@ -218,6 +353,15 @@ CORE_API void dynamic_array_set_length(void* array, u64 length);
         dynamic_array_insert((void**)&(array), index, &__temp); \
     } while(false)
 
+/*
+    @brief Вставляет несколько элементов начиная с указанной позиции.
+    @param array Указатель на массив (может измениться при реаллокации).
+    @param index Позиция для вставки.
+    @param data Указатель на вставляемые элементы.
+    @param count Количество элементов.
+*/
+#define darray_insert_range(array, index, data, count) dynamic_array_insert_range((void**)&(array), index, data, count)
+
 /*
     @brief Удаляет элемент из указанной позиции.
     @param array Указатель на массив.
@@ -226,6 +370,14 @@ CORE_API void dynamic_array_set_length(void* array, u64 length);
 */
 #define darray_remove(array, index, out_value) dynamic_array_remove((void*)array, index, out_value)
 
+/*
+    @brief Удаляет элемент из указанной позиции за O(1), перемещая на его место последний элемент.
+    @param array Указатель на массив.
+    @param index Позиция для удаления.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+*/
+#define darray_remove_swap(array, index, out_value) dynamic_array_remove_swap((void*)array, index, out_value)
+
 /*
     @brief Сбрасывает массив (устанавливает длину в 0 без обнуления памяти).
     @note Быстрее чем darray_clear(), но не обеспечивает безопасность данных.
@@ -0,0 +1,513 @@
+#include "core/containers/hashmap.h"
+#include "core/hash.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "core/string.h"
+#include "debug/assert.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+// Управляющий байт пустой ячейки.
+#define HASHMAP_CONTROL_EMPTY   ((u8)0x80)
+// Управляющий байт удаленной ячейки (не прерывает поиск).
+#define HASHMAP_CONTROL_DELETED ((u8)0xFE)
+
+// Выравнивание блока таблицы.
+#define HASHMAP_ALIGNMENT 16
+
+STATIC_ASSERT(IS_POWER_OF_TWO(HASHMAP_GROUP_WIDTH), "Hash map group width must be a power of two.");
+STATIC_ASSERT(IS_POWER_OF_TWO(HASHMAP_DEFAULT_CAPACITY), "Hash map default capacity must be a power of two.");
+
+// Старшие 57 бит хеша определяют начальную группу поиска.
+INLINE u64 hash_map_h1(u64 hash)
+{
+    return hash >> 7;
+}
+
+// Младшие 7 бит хеша хранятся в управляющем байте занятой ячейки.
+INLINE u8 hash_map_h2(u64 hash)
+{
+    return (u8)(hash & 0x7F);
+}
+
+// Битовая маска ячеек группы, управляющий байт которых равен value.
+INLINE u32 hash_map_group_match(const u8* group, u8 value)
+{
+#if defined(__SSE2__)
+    __m128i control = _mm_loadu_si128((const __m128i*)group);
+    return (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)value)));
+#else
+    u32 mask = 0;
+    for(u32 i = 0; i < HASHMAP_GROUP_WIDTH; ++i)
+    {
+        mask |= (u32)(group[i] == value) << i;
+    }
+    return mask;
+#endif
+}
+
+// Битовая маска пустых и удаленных ячеек группы (у занятых ячеек старший бит сброшен).
+INLINE u32 hash_map_group_match_free(const u8* group)
+{
+#if defined(__SSE2__)
+    return (u32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    u32 mask = 0;
+    for(u32 i = 0; i < HASHMAP_GROUP_WIDTH; ++i)
+    {
+        mask |= (u32)(group[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+// Максимальное количество пар для заданного количества ячеек (заполнение 7/8).
+INLINE u64 hash_map_max_length(u64 capacity)
+{
+    return capacity - capacity / 8;
+}
+
+// Размер блока таблицы: ячейки и управляющие байты с повтором первой группы в конце.
+INLINE u64 hash_map_block_size(u64 capacity, u32 entry_stride)
+{
+    return capacity * entry_stride + capacity + HASHMAP_GROUP_WIDTH;
+}
+
+// Выравнивание поля заданного размера (наибольшая степень двойки, делящая размер, но не больше 16).
+INLINE u32 hash_map_field_alignment(u64 size)
+{
+    return size == 0 ? 1 : (u32)MIN(size & (~size + 1), (u64)HASHMAP_ALIGNMENT);
+}
+
+INLINE u64 hash_map_align_up(u64 size, u32 alignment)
+{
+    return (size + alignment - 1) & ~((u64)alignment - 1);
+}
+
+INLINE u8* hash_map_entry(const hash_map* map, u64 index)
+{
+    return map->entries + index * map->entry_stride;
+}
+
+// Записывает управляющий байт ячейки и его копию в конце массива для ячеек первой группы.
+INLINE void hash_map_set_control(hash_map* map, u64 index, u8 value)
+{
+    map->control[index] = value;
+    map->control[((index - HASHMAP_GROUP_WIDTH) & (map->capacity - 1)) + HASHMAP_GROUP_WIDTH] = value;
+}
+
+static u64 hash_map_find(const hash_map* map, const void* key, u64 hash)
+{
+    if(map->capacity == 0)
+    {
+        return U64_MAX;
+    }
+
+    u64 mask = map->capacity - 1;
+    u64 position = hash_map_h1(hash) & mask;
+    u8 h2 = hash_map_h2(hash);
+
+    // Квадратичное пробирование по группам: при степени двойки групп обходит все группы.
+    // NOTE: Поиск всегда завершается, т.к. заполнение не превышает 7/8 и в таблице есть пустые ячейки.
+    for(u64 step = HASHMAP_GROUP_WIDTH;; step += HASHMAP_GROUP_WIDTH)
+    {
+        const u8* group = map->control + position;
+
+        u32 matches = hash_map_group_match(group, h2);
+        while(matches)
+        {
+            u64 index = (position + (u32)__builtin_ctz(matches)) & mask;
+            if(map->equal(key, hash_map_entry(map, index), map->key_size))
+            {
+                return index;
+            }
+            matches &= matches - 1;
+        }
+
+        if(hash_map_group_match(group, HASHMAP_CONTROL_EMPTY))
+        {
+            return U64_MAX;
+        }
+
+        position = (position + step) & mask;
+    }
+}
+
+static u64 hash_map_find_free(const hash_map* map, u64 hash)
+{
+    u64 mask = map->capacity - 1;
+    u64 position = hash_map_h1(hash) & mask;
+
+    for(u64 step = HASHMAP_GROUP_WIDTH;; step += HASHMAP_GROUP_WIDTH)
+    {
+        u32 free = hash_map_group_match_free(map->control + position);
+        if(free)
+        {
+            return (position + (u32)__builtin_ctz(free)) & mask;
+        }
+
+        position = (position + step) & mask;
+    }
+}
+
+static bool hash_map_rehash(hash_map* map, u64 new_capacity)
+{
+    ASSERT(IS_POWER_OF_TWO(new_capacity) && new_capacity >= HASHMAP_GROUP_WIDTH, "Capacity must be a power of two.");
+    ASSERT(hash_map_max_length(new_capacity) >= map->length, "Capacity must fit all entries.");
+
+    u64 new_size = hash_map_block_size(new_capacity, map->entry_stride);
+    u8* block = memory_allocate(new_size, HASHMAP_ALIGNMENT, MEMORY_TAG_HASHMAP);
+    if(!block)
+    {
+        LOG_ERROR("Failed to allocate memory for hash map with capacity %llu.", new_capacity);
+        return false;
+    }
+
+    hash_map old_map = *map;
+
+    map->capacity = new_capacity;
+    map->entries = block;
+    map->control = block + new_capacity * map->entry_stride;
+    map->growth_left = hash_map_max_length(new_capacity) - map->length;
+    mset(map->control, new_capacity + HASHMAP_GROUP_WIDTH, HASHMAP_CONTROL_EMPTY);
+
+    // Перенос занятых ячеек без сравнения ключей (все ключи уникальны).
+    for(u64 i = 0; i < old_map.capacity; ++i)
+    {
+        if(old_map.control[i] & 0x80)
+        {
+            continue;
+        }
+
+        const u8* entry = hash_map_entry(&old_map, i);
+        u64 hash = map->hash(entry, map->key_size);
+        u64 index = hash_map_find_free(map, hash);
+
+        hash_map_set_control(map, index, hash_map_h2(hash));
+        mcopy(hash_map_entry(map, index), entry, map->entry_stride);
+    }
+
+    if(old_map.capacity > 0)
+    {
+        memory_free(old_map.entries, hash_map_block_size(old_map.capacity, old_map.entry_stride), MEMORY_TAG_HASHMAP);
+    }
+
+    return true;
+}
+
+// Обменивает содержимое двух ячеек частями через буфер на стеке.
+static void hash_map_swap_entries(u8* a, u8* b, u32 size)
+{
+    u8 buffer[64];
+    for(u32 offset = 0; offset < size; offset += sizeof(buffer))
+    {
+        u32 length = MIN(size - offset, (u32)sizeof(buffer));
+        mcopy(buffer, a + offset, length);
+        mcopy(a + offset, b + offset, length);
+        mcopy(b + offset, buffer, length);
+    }
+}
+
+// Перестраивает таблицу с прежней емкостью без выделения памяти: удаленные ячейки становятся пустыми.
+// NOTE: Сначала все удаленные ячейки отмечаются пустыми, а занятые - удаленными (еще не размещенными), затем
+//       каждая неразмещенная пара переносится в первую свободную ячейку своей последовательности поиска.
+//       Если эта ячейка занята другой неразмещенной парой, пары обмениваются и обработка ячейки повторяется.
+static void hash_map_drop_deleted(hash_map* map)
+{
+    u64 mask = map->capacity - 1;
+
+    for(u64 i = 0; i < map->capacity; ++i)
+    {
+        map->control[i] = (map->control[i] & 0x80) ? HASHMAP_CONTROL_EMPTY : HASHMAP_CONTROL_DELETED;
+    }
+    mcopy(map->control + map->capacity, map->control, HASHMAP_GROUP_WIDTH);
+
+    for(u64 i = 0; i < map->capacity; ++i)
+    {
+        while(map->control[i] == HASHMAP_CONTROL_DELETED)
+        {
+            u8* entry = hash_map_entry(map, i);
+            u64 hash = map->hash(entry, map->key_size);
+            u64 start = hash_map_h1(hash) & mask;
+            u64 index = hash_map_find_free(map, hash);
+
+            // Пара уже находится в первой группе со свободной ячейкой - остается на месте.
+            if(((index - start) & mask) / HASHMAP_GROUP_WIDTH == ((i - start) & mask) / HASHMAP_GROUP_WIDTH)
+            {
+                hash_map_set_control(map, i, hash_map_h2(hash));
+                break;
+            }
+
+            u8* target = hash_map_entry(map, index);
+            if(map->control[index] == HASHMAP_CONTROL_EMPTY)
+            {
+                hash_map_set_control(map, index, hash_map_h2(hash));
+                mcopy(target, entry, map->entry_stride);
+                hash_map_set_control(map, i, HASHMAP_CONTROL_EMPTY);
+                break;
+            }
+
+            hash_map_set_control(map, index, hash_map_h2(hash));
+            hash_map_swap_entries(entry, target, map->entry_stride);
+        }
+    }
+
+    map->growth_left = hash_map_max_length(map->capacity) - map->length;
+}
+
+static bool hash_map_default_equal(const void* a, const void* b, u64 key_size)
+{
+    switch(key_size)
+    {
+        case 4: return *(const u32*)a == *(const u32*)b;
+        case 8: return *(const u64*)a == *(const u64*)b;
+        default: return __builtin_memcmp(a, b, key_size) == 0;
+    }
+}
+
+bool hash_map_create(u64 key_size, u64 value_size, u64 capacity, hash_map_hash_fn hash, hash_map_equal_fn equal, hash_map* out_map)
+{
+    ASSERT(key_size > 0 && key_size <= U32_MAX, "Key size must be greater than zero and fit in 32 bits.");
+    ASSERT(value_size <= U32_MAX, "Value size must fit in 32 bits.");
+    ASSERT(out_map != nullptr, "Hash map pointer must be non-null.");
+
+    // Ключ располагается в начале ячейки, значение - после него с выравниванием.
+    u32 key_alignment = hash_map_field_alignment(key_size);
+    u32 value_alignment = hash_map_field_alignment(value_size);
+
+    mzero(out_map, sizeof(hash_map));
+    out_map->key_size = (u32)key_size;
+    out_map->value_size = (u32)value_size;
+    out_map->value_offset = (u32)hash_map_align_up(key_size, value_alignment);
+    out_map->entry_stride = (u32)hash_map_align_up(out_map->value_offset + value_size, MAX(key_alignment, value_alignment));
+    out_map->hash = hash ? hash : hash_map_hash_bytes;
+    out_map->equal = equal ? equal : hash_map_default_equal;
+
+    return capacity == 0 || hash_map_reserve(out_map, capacity);
+}
+
+void hash_map_destroy(hash_map* map)
+{
+    ASSERT(map != nullptr, "Hash map pointer must be non-null.");
+
+    if(map->capacity > 0)
+    {
+        memory_free(map->entries, hash_map_block_size(map->capacity, map->entry_stride), MEMORY_TAG_HASHMAP);
+    }
+
+    mzero(map, sizeof(hash_map));
+}
+
+bool hash_map_reserve(hash_map* map, u64 capacity)
+{
+    ASSERT(map != nullptr && map->key_size > 0, "Hash map must be initialized.");
+
+    u64 new_capacity = MAX(map->capacity, (u64)HASHMAP_GROUP_WIDTH);
+    while(hash_map_max_length(new_capacity) < capacity)
+    {
+        new_capacity *= 2;
+    }
+
+    if(new_capacity == map->capacity)
+    {
+        return true;
+    }
+
+    return hash_map_rehash(map, new_capacity);
+}
+
+void hash_map_clear(hash_map* map)
+{
+    ASSERT(map != nullptr && map->key_size > 0, "Hash map must be initialized.");
+
+    if(map->capacity == 0)
+    {
+        return;
+    }
+
+    mset(map->control, map->capacity + HASHMAP_GROUP_WIDTH, HASHMAP_CONTROL_EMPTY);
+    map->length = 0;
+    map->growth_left = hash_map_max_length(map->capacity);
+}
+
+void* hash_map_emplace(hash_map* map, const void* key, bool* out_inserted)
+{
+    ASSERT(map != nullptr && map->key_size > 0, "Hash map must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u64 hash = map->hash(key, map->key_size);
+    u64 index = hash_map_find(map, key, hash);
+
+    if(index != U64_MAX)
+    {
+        if(out_inserted)
+        {
+            *out_inserted = false;
+        }
+        return hash_map_entry(map, index) + map->value_offset;
+    }
+
+    // Пустая ячейка расходует запас роста, удаленная - нет. При исчерпании запаса таблица увеличивается,
+    // а если большая часть запаса занята удаленными ячейками - перестраивается на месте с прежней емкостью.
+    if(map->capacity > 0)
+    {
+        index = hash_map_find_free(map, hash);
+    }
+
+    if(map->capacity > 0 && map->growth_left == 0 && map->control[index] == HASHMAP_CONTROL_EMPTY &&
+       map->length < hash_map_max_length(map->capacity) / 2)
+    {
+        hash_map_drop_deleted(map);
+        index = hash_map_find_free(map, hash);
+    }
+    else if(map->capacity == 0 || (map->growth_left == 0 && map->control[index] == HASHMAP_CONTROL_EMPTY))
+    {
+        if(!hash_map_rehash(map, map->capacity > 0 ? map->capacity * 2 : HASHMAP_GROUP_WIDTH))
+        {
+            return nullptr;
+        }
+
+        index = hash_map_find_free(map, hash);
+    }
+
+    if(map->control[index] == HASHMAP_CONTROL_EMPTY)
+    {
+        map->growth_left--;
+    }
+
+    hash_map_set_control(map, index, hash_map_h2(hash));
+    map->length++;
+
+    u8* entry = hash_map_entry(map, index);
+    mcopy(entry, key, map->key_size);
+    if(map->value_size > 0)
+    {
+        mzero(entry + map->value_offset, map->value_size);
+    }
+
+    if(out_inserted)
+    {
+        *out_inserted = true;
+    }
+    return entry + map->value_offset;
+}
+
+bool hash_map_insert(hash_map* map, const void* key, const void* value)
+{
+    void* slot = hash_map_emplace(map, key, nullptr);
+    if(!slot)
+    {
+        return false;
+    }
+
+    if(value && map->value_size > 0)
+    {
+        mcopy(slot, value, map->value_size);
+    }
+
+    return true;
+}
+
+void* hash_map_get(const hash_map* map, const void* key)
+{
+    ASSERT(map != nullptr && map->key_size > 0, "Hash map must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u64 index = hash_map_find(map, key, map->hash(key, map->key_size));
+    if(index == U64_MAX)
+    {
+        return nullptr;
+    }
+
+    return hash_map_entry(map, index) + map->value_offset;
+}
+
+bool hash_map_remove(hash_map* map, const void* key, void* out_value)
+{
+    ASSERT(map != nullptr && map->key_size > 0, "Hash map must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u64 index = hash_map_find(map, key, map->hash(key, map->key_size));
+    if(index == U64_MAX)
+    {
+        return false;
+    }
+
+    if(out_value && map->value_size > 0)
+    {
+        mcopy(out_value, hash_map_entry(map, index) + map->value_offset, map->value_size);
+    }
+
+    // Ячейка может стать пустой, если ни одна последовательность поиска не проходила через нее к следующей группе:
+    // для этого окно из HASHMAP_GROUP_WIDTH ячеек вокруг нее не должно быть полностью занято.
+    u64 mask = map->capacity - 1;
+    u32 empty_after = hash_map_group_match(map->control + index, HASHMAP_CONTROL_EMPTY);
+    u32 empty_before = hash_map_group_match(map->control + ((index - HASHMAP_GROUP_WIDTH) & mask), HASHMAP_CONTROL_EMPTY);
+    u32 free_after = empty_after ? (u32)__builtin_ctz(empty_after) : HASHMAP_GROUP_WIDTH;
+    u32 free_before = empty_before ? (u32)__builtin_clz(empty_before) - (32 - HASHMAP_GROUP_WIDTH) : HASHMAP_GROUP_WIDTH;
+
+    if(free_after + free_before < HASHMAP_GROUP_WIDTH)
+    {
+        hash_map_set_control(map, index, HASHMAP_CONTROL_EMPTY);
+        map->growth_left++;
+    }
+    else
+    {
+        hash_map_set_control(map, index, HASHMAP_CONTROL_DELETED);
+    }
+
+    map->length--;
+    return true;
+}
+
+bool hash_map_next(const hash_map* map, u64* iterator, void** out_key, void** out_value)
+{
+    ASSERT(map != nullptr, "Hash map pointer must be non-null.");
+    ASSERT(iterator != nullptr, "Iterator pointer must be non-null.");
+
+    for(u64 i = *iterator; i < map->capacity; ++i)
+    {
+        if(map->control[i] & 0x80)
+        {
+            continue;
+        }
+
+        u8* entry = hash_map_entry(map, i);
+        if(out_key)
+        {
+            *out_key = entry;
+        }
+        if(out_value)
+        {
+            *out_value = entry + map->value_offset;
+        }
+
+        *iterator = i + 1;
+        return true;
+    }
+
+    *iterator = map->capacity;
+    return false;
+}
+
+u64 hash_map_hash_bytes(const void* key, u64 key_size)
+{
+    return hash_bytes(key, key_size);
+}
+
+u64 hash_map_hash_string(const void* key, u64 key_size)
+{
+    UNUSED(key_size);
+
+    const char* str = *(const char* const*)key;
+    return hash_map_hash_bytes(str, string_length(str));
+}
+
+bool hash_map_equal_string(const void* a, const void* b, u64 key_size)
+{
+    UNUSED(key_size);
+
+    return string_equal(*(const char* const*)a, *(const char* const*)b);
+}
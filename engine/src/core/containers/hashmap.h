@@ -0,0 +1,299 @@
+/*
+    @file hashmap.h
+    @brief Интерфейс хеш-таблицы с открытой адресацией.
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Вставку, поиск и удаление пар ключ-значение за O(1) в среднем
+            - Работу с любыми типами ключей и значений через type-agnostic интерфейс
+            - Пользовательские функции хеширования и сравнения ключей (например, для строк)
+            - Резервирование емкости и очистку без освобождения памяти
+            - Обход всех пар таблицы
+
+    @note Особенности реализации:
+            - Открытая адресация в стиле SwissTable: для каждой ячейки хранится управляющий байт
+              (пустая, удаленная или 7 бит хеша занятой ячейки)
+            - Поиск сравнивает управляющие байты группами по 16 за одну SIMD-инструкцию (SSE2, при ее отсутствии
+              используется скалярный вариант), ключи сравниваются только при совпадении 7 бит хеша
+            - Ключи и значения хранятся в одном блоке памяти с управляющими байтами
+            - Таблица растет при заполнении на 7/8, указатели на значения недействительны после вставки
+            - Удаленные ячейки не прерывают поиск; когда они исчерпывают запас роста, таблица, заполненная
+              меньше чем наполовину, перестраивается на месте без выделения памяти, иначе увеличивается
+            - Для работы с таблицей используются макросы (hashmap_*) для type safety
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+/*
+    @brief Функция хеширования ключа.
+    @param key Указатель на ключ.
+    @param key_size Размер ключа в байтах.
+    @return 64-битный хеш ключа.
+*/
+typedef u64 (*hash_map_hash_fn)(const void* key, u64 key_size);
+
+/*
+    @brief Функция сравнения ключей.
+    @param a Указатель на первый ключ.
+    @param b Указатель на второй ключ.
+    @param key_size Размер ключа в байтах.
+    @return true - ключи равны, false - ключи различаются.
+*/
+typedef bool (*hash_map_equal_fn)(const void* a, const void* b, u64 key_size);
+
+// @brief Контекст хеш-таблицы.
+typedef struct hash_map {
+    // @brief Количество ячеек (степень двойки, не меньше HASHMAP_GROUP_WIDTH или 0 до первой вставки).
+    u64 capacity;
+    // @brief Количество пар в таблице.
+    u64 length;
+    // @brief Количество вставок до увеличения таблицы.
+    u64 growth_left;
+    // @brief Размер ключа в байтах.
+    u32 key_size;
+    // @brief Размер значения в байтах.
+    u32 value_size;
+    // @brief Смещение значения от начала ячейки в байтах.
+    u32 value_offset;
+    // @brief Размер ячейки (ключ и значение с выравниванием) в байтах.
+    u32 entry_stride;
+    // @brief Функция хеширования ключа.
+    hash_map_hash_fn hash;
+    // @brief Функция сравнения ключей.
+    hash_map_equal_fn equal;
+    // @brief Управляющие байты ячеек (capacity + HASHMAP_GROUP_WIDTH, последние повторяют первые).
+    u8* control;
+    // @brief Ячейки таблицы.
+    u8* entries;
+} hash_map;
+
+// @brief Количество управляющих байтов, проверяемых за одну операцию.
+#define HASHMAP_GROUP_WIDTH      16
+
+// @brief Стандартная начальная емкость таблицы.
+#define HASHMAP_DEFAULT_CAPACITY 16
+
+/*
+    @brief Инициализирует хеш-таблицу.
+    @note При нулевой емкости память выделяется при первой вставке.
+    @param key_size Размер ключа в байтах.
+    @param value_size Размер значения в байтах (может быть 0 для множества ключей).
+    @param capacity Начальное количество пар, вставляемых без увеличения таблицы.
+    @param hash Функция хеширования ключа (nullptr - хеширование байтов ключа).
+    @param equal Функция сравнения ключей (nullptr - побайтовое сравнение).
+    @param out_map Указатель на таблицу для инициализации.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+CORE_API bool hash_map_create(u64 key_size, u64 value_size, u64 capacity, hash_map_hash_fn hash, hash_map_equal_fn equal, hash_map* out_map);
+
+/*
+    @brief Уничтожает хеш-таблицу и освобождает память.
+    @param map Указатель на таблицу.
+*/
+CORE_API void hash_map_destroy(hash_map* map);
+
+/*
+    @brief Резервирует место для указанного количества пар без увеличения таблицы.
+    @param map Указатель на таблицу.
+    @param capacity Количество пар.
+    @return true - место зарезервировано, false - ошибка выделения памяти (таблица остается неизменной).
+*/
+CORE_API bool hash_map_reserve(hash_map* map, u64 capacity);
+
+/*
+    @brief Удаляет все пары таблицы без освобождения памяти.
+    @param map Указатель на таблицу.
+*/
+CORE_API void hash_map_clear(hash_map* map);
+
+/*
+    @brief Вставляет пару или заменяет значение существующего ключа.
+    @param map Указатель на таблицу.
+    @param key Указатель на ключ.
+    @param value Указатель на значение (может быть nullptr, тогда значение новой пары обнуляется).
+    @return true - пара вставлена или обновлена, false - ошибка выделения памяти.
+*/
+CORE_API bool hash_map_insert(hash_map* map, const void* key, const void* value);
+
+/*
+    @brief Находит значение по ключу или вставляет пару с обнуленным значением.
+    @note Указатель действителен до следующей вставки или удаления.
+    @param map Указатель на таблицу.
+    @param key Указатель на ключ.
+    @param out_inserted Указатель для записи признака вставки новой пары (может быть nullptr).
+    @return Указатель на значение или nullptr при ошибке выделения памяти.
+*/
+CORE_API void* hash_map_emplace(hash_map* map, const void* key, bool* out_inserted);
+
+/*
+    @brief Находит значение по ключу.
+    @note Указатель действителен до следующей вставки или удаления.
+    @param map Указатель на таблицу.
+    @param key Указатель на ключ.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+CORE_API void* hash_map_get(const hash_map* map, const void* key);
+
+/*
+    @brief Удаляет пару по ключу.
+    @param map Указатель на таблицу.
+    @param key Указатель на ключ.
+    @param out_value Указатель для копирования удаляемого значения (может быть nullptr).
+    @return true - пара удалена, false - ключ не найден.
+*/
+CORE_API bool hash_map_remove(hash_map* map, const void* key, void* out_value);
+
+/*
+    @brief Переходит к следующей паре таблицы при обходе.
+    @note Порядок обхода не определен. Изменение таблицы во время обхода недопустимо.
+    @param map Указатель на таблицу.
+    @param iterator Указатель на состояние обхода (перед началом обхода должно быть равно 0).
+    @param out_key Указатель для записи указателя на ключ (может быть nullptr).
+    @param out_value Указатель для записи указателя на значение (может быть nullptr).
+    @return true - пара найдена, false - обход завершен.
+*/
+CORE_API bool hash_map_next(const hash_map* map, u64* iterator, void** out_key, void** out_value);
+
+/*
+    @brief Хеширует байты ключа (функция хеширования по умолчанию).
+    @param key Указатель на ключ.
+    @param key_size Размер ключа в байтах.
+    @return 64-битный хеш ключа.
+*/
+CORE_API u64 hash_map_hash_bytes(const void* key, u64 key_size);
+
+/*
+    @brief Хеширует строку, указатель на которую является ключом (ключ типа const char*).
+    @param key Указатель на ключ (указатель на строку).
+    @param key_size Размер ключа в байтах (игнорируется).
+    @return 64-битный хеш строки.
+*/
+CORE_API u64 hash_map_hash_string(const void* key, u64 key_size);
+
+/*
+    @brief Сравнивает строки, указатели на которые являются ключами (ключ типа const char*).
+    @param a Указатель на первый ключ (указатель на строку).
+    @param b Указатель на второй ключ (указатель на строку).
+    @param key_size Размер ключа в байтах (игнорируется).
+    @return true - строки равны, false - строки различаются.
+*/
+CORE_API bool hash_map_equal_string(const void* a, const void* b, u64 key_size);
+
+/*
+    @brief Инициализирует хеш-таблицу для указанных типов ключа и значения.
+    @param map Хеш-таблица (не указатель).
+    @param key_type Тип ключа.
+    @param value_type Тип значения.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define hashmap_create(map, key_type, value_type) \
+    hash_map_create(sizeof(key_type), sizeof(value_type), HASHMAP_DEFAULT_CAPACITY, nullptr, nullptr, &(map))
+
+/*
+    @brief Инициализирует хеш-таблицу с указанной емкостью и функциями хеширования и сравнения.
+    @param map Хеш-таблица (не указатель).
+    @param key_type Тип ключа.
+    @param value_type Тип значения.
+    @param capacity Начальное количество пар, вставляемых без увеличения таблицы.
+    @param hash Функция хеширования ключа (nullptr - по умолчанию).
+    @param equal Функция сравнения ключей (nullptr - по умолчанию).
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define hashmap_create_custom(map, key_type, value_type, capacity, hash, equal) \
+    hash_map_create(sizeof(key_type), sizeof(value_type), capacity, hash, equal, &(map))
+
+/*
+    @brief Уничтожает хеш-таблицу и освобождает память.
+    @param map Хеш-таблица (не указатель).
+*/
+#define hashmap_destroy(map) hash_map_destroy(&(map))
+
+/*
+    @brief Резервирует место для указанного количества пар.
+    @param map Хеш-таблица (не указатель).
+    @param capacity Количество пар.
+    @return true - место зарезервировано, false - ошибка выделения памяти.
+*/
+#define hashmap_reserve(map, capacity) hash_map_reserve(&(map), capacity)
+
+/*
+    @brief Удаляет все пары таблицы без освобождения памяти.
+    @param map Хеш-таблица (не указатель).
+*/
+#define hashmap_clear(map) hash_map_clear(&(map))
+
+/*
+    @brief Возвращает количество пар в таблице.
+    @param map Хеш-таблица (не указатель).
+    @return Количество пар.
+*/
+#define hashmap_length(map) ((map).length)
+
+/*
+    @brief Вставляет пару или заменяет значение существующего ключа.
+    @param map Хеш-таблица (не указатель).
+    @param key Значение ключа.
+    @param value Значение.
+    @return true - пара вставлена или обновлена, false - ошибка выделения памяти.
+*/
+#define hashmap_insert(map, key, value)                       \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        typeof(value) __value = value;                        \
+        hash_map_insert(&(map), &__key, &__value);            \
+    })
+
+/*
+    @brief Находит значение по ключу.
+    @param map Хеш-таблица (не указатель).
+    @param key Значение ключа.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+#define hashmap_get(map, key)                                 \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        hash_map_get(&(map), &__key);                         \
+    })
+
+/*
+    @brief Проверяет наличие ключа в таблице.
+    @param map Хеш-таблица (не указатель).
+    @param key Значение ключа.
+    @return true - ключ найден, false - ключ не найден.
+*/
+#define hashmap_contains(map, key) (hashmap_get(map, key) != nullptr)
+
+/*
+    @brief Удаляет пару по ключу.
+    @param map Хеш-таблица (не указатель).
+    @param key Значение ключа.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+    @return true - пара удалена, false - ключ не найден.
+*/
+#define hashmap_remove(map, key, out_value)                   \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        hash_map_remove(&(map), &__key, out_value);           \
+    })
+
+/*
+    @brief Обходит все пары таблицы.
+    @note Изменение таблицы во время обхода недопустимо.
+    @param map Хеш-таблица (не указатель).
+    @param key_ptr Имя переменной-указателя на ключ (объявляется вызывающей стороной).
+    @param value_ptr Имя переменной-указателя на значение (объявляется вызывающей стороной).
+*/
+#define hashmap_foreach(map, key_ptr, value_ptr) \
+    for(u64 __it = 0; hash_map_next(&(map), &__it, (void**)&(key_ptr), (void**)&(value_ptr));)
@@ -0,0 +1,97 @@
+#include "core/containers/inline_array.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+void inline_array_destroy(inline_array* array, u64 stride)
+{
+    ASSERT(array != nullptr, "Array pointer must be non-null.");
+
+    if(array->heap)
+    {
+        mfree(array->heap, array->capacity * stride, MEMORY_TAG_DARRAY);
+    }
+
+    mzero(array, sizeof(inline_array));
+}
+
+bool inline_array_push(inline_array* array, void* inline_data, u32 inline_capacity, u64 stride, const void* value)
+{
+    ASSERT(array != nullptr && inline_data != nullptr, "Array pointers must be non-null.");
+    ASSERT(value != nullptr, "Value pointer must be non-null.");
+
+    u32 capacity = array->heap ? array->capacity : inline_capacity;
+
+    // Перенос в кучу (или увеличение блока в куче) с удвоением емкости.
+    if(array->length >= capacity)
+    {
+        if(capacity > U32_MAX / 2)
+        {
+            LOG_ERROR("Inline array is too large to grow.");
+            return false;
+        }
+
+        u32 new_capacity = MAX(capacity * 2, 4U);
+        void* block = mallocate(new_capacity * stride, MEMORY_TAG_DARRAY);
+        if(!block)
+        {
+            LOG_ERROR("Failed to allocate memory for inline array with capacity %u.", new_capacity);
+            return false;
+        }
+
+        void* data = inline_array_data(array, inline_data);
+        mcopy(block, data, array->length * stride);
+
+        if(array->heap)
+        {
+            mfree(array->heap, array->capacity * stride, MEMORY_TAG_DARRAY);
+        }
+
+        array->heap = block;
+        array->capacity = new_capacity;
+    }
+
+    u8* data = inline_array_data(array, inline_data);
+    mcopy(data + array->length * stride, value, stride);
+    array->length++;
+    return true;
+}
+
+void inline_array_remove(inline_array* array, void* inline_data, u64 stride, u32 index, void* out_value)
+{
+    ASSERT(array != nullptr && inline_data != nullptr, "Array pointers must be non-null.");
+    ASSERT(index < array->length, "Index out of bounds.");
+
+    u8* addr = (u8*)inline_array_data(array, inline_data) + index * stride;
+
+    if(out_value)
+    {
+        mcopy(out_value, addr, stride);
+    }
+
+    array->length--;
+    if(index < array->length)
+    {
+        mmove(addr, addr + stride, (array->length - index) * stride);
+    }
+}
+
+void inline_array_remove_swap(inline_array* array, void* inline_data, u64 stride, u32 index, void* out_value)
+{
+    ASSERT(array != nullptr && inline_data != nullptr, "Array pointers must be non-null.");
+    ASSERT(index < array->length, "Index out of bounds.");
+
+    u8* data = inline_array_data(array, inline_data);
+    u8* addr = data + index * stride;
+
+    if(out_value)
+    {
+        mcopy(out_value, addr, stride);
+    }
+
+    array->length--;
+    if(index < array->length)
+    {
+        mcopy(addr, data + array->length * stride, stride);
+    }
+}
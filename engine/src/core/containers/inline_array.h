@@ -0,0 +1,157 @@
+/*
+    @file inline_array.h
+    @brief Интерфейс массива со встроенным буфером (small buffer optimization).
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Хранение первых N элементов внутри структуры-владельца без выделения памяти
+            - Автоматический перенос элементов в кучу при превышении встроенной емкости
+            - Добавление, удаление с сохранением порядка и без него
+            - Работу с любыми типами данных через макросы (iarray_*)
+
+    @note Особенности реализации:
+            - Тип массива объявляется макросом INLINE_ARRAY(type, capacity) прямо в структуре-владельце
+            - Обнуленный массив является пустым и готов к использованию (отдельное создание не требуется)
+            - Заголовок занимает 16 байт, элементы встроенного буфера следуют сразу за ним,
+              поэтому обход небольшого массива не требует перехода по указателю
+            - После переноса в кучу массив не возвращается во встроенный буфер до вызова iarray_destroy()
+            - Указатели на элементы недействительны после добавления элемента
+            - Память в куче учитывается под тегом MEMORY_TAG_DARRAY
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Заголовок массива со встроенным буфером.
+typedef struct inline_array {
+    // @brief Текущее количество элементов.
+    u32 length;
+    // @brief Емкость блока в куче (0 - элементы во встроенном буфере).
+    u32 capacity;
+    // @brief Блок элементов в куче (nullptr - элементы во встроенном буфере).
+    void* heap;
+} inline_array;
+
+/*
+    @brief Объявляет тип массива со встроенным буфером.
+    @param type Тип элементов.
+    @param inline_capacity Количество элементов во встроенном буфере.
+*/
+#define INLINE_ARRAY(type, inline_capacity) \
+    struct {                                \
+        inline_array header;                \
+        type items[inline_capacity];        \
+    }
+
+/*
+    @brief Возвращает указатель на первый элемент массива.
+    @param array Указатель на заголовок массива.
+    @param inline_data Указатель на встроенный буфер.
+    @return Указатель на первый элемент.
+*/
+INLINE void* inline_array_data(const inline_array* array, const void* inline_data)
+{
+    return array->heap ? array->heap : (void*)inline_data;
+}
+
+/*
+    @brief Освобождает память в куче и очищает массив.
+    @param array Указатель на заголовок массива.
+    @param stride Размер одного элемента в байтах.
+*/
+CORE_API void inline_array_destroy(inline_array* array, u64 stride);
+
+/*
+    @brief Добавляет элемент в конец массива.
+    @param array Указатель на заголовок массива.
+    @param inline_data Указатель на встроенный буфер.
+    @param inline_capacity Количество элементов во встроенном буфере.
+    @param stride Размер одного элемента в байтах.
+    @param value Указатель на данные элемента.
+    @return true - элемент добавлен, false - ошибка выделения памяти.
+*/
+CORE_API bool inline_array_push(inline_array* array, void* inline_data, u32 inline_capacity, u64 stride, const void* value);
+
+/*
+    @brief Удаляет элемент из указанной позиции, сохраняя порядок остальных.
+    @param array Указатель на заголовок массива.
+    @param inline_data Указатель на встроенный буфер.
+    @param stride Размер одного элемента в байтах.
+    @param index Позиция для удаления.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+*/
+CORE_API void inline_array_remove(inline_array* array, void* inline_data, u64 stride, u32 index, void* out_value);
+
+/*
+    @brief Удаляет элемент из указанной позиции за O(1), перемещая на его место последний элемент.
+    @param array Указатель на заголовок массива.
+    @param inline_data Указатель на встроенный буфер.
+    @param stride Размер одного элемента в байтах.
+    @param index Позиция для удаления.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+*/
+CORE_API void inline_array_remove_swap(inline_array* array, void* inline_data, u64 stride, u32 index, void* out_value);
+
+/*
+    @brief Освобождает память в куче и очищает массив.
+    @param array Массив (не указатель).
+*/
+#define iarray_destroy(array) inline_array_destroy(&(array).header, sizeof((array).items[0]))
+
+/*
+    @brief Возвращает указатель на первый элемент массива.
+    @param array Массив (не указатель).
+    @return Типизированный указатель на первый элемент.
+*/
+#define iarray_data(array) ((typeof(&(array).items[0]))inline_array_data(&(array).header, (array).items))
+
+/*
+    @brief Возвращает количество элементов в массиве.
+    @param array Массив (не указатель).
+    @return Количество элементов.
+*/
+#define iarray_length(array) ((array).header.length)
+
+/*
+    @brief Добавляет элемент в конец массива.
+    @param array Массив (не указатель).
+    @param value Значение элемента.
+    @return true - элемент добавлен, false - ошибка выделения памяти.
+*/
+#define iarray_push(array, value)                                      \
+    ({                                                                 \
+        typeof((array).items[0]) __temp = value;                       \
+        inline_array_push(                                             \
+            &(array).header, (array).items, ARRAY_SIZE((array).items), \
+            sizeof(__temp), &__temp                                    \
+        );                                                             \
+    })
+
+/*
+    @brief Удаляет элемент из указанной позиции, сохраняя порядок остальных.
+    @param array Массив (не указатель).
+    @param index Позиция для удаления.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+*/
+#define iarray_remove(array, index, out_value) \
+    inline_array_remove(&(array).header, (array).items, sizeof((array).items[0]), index, out_value)
+
+/*
+    @brief Удаляет элемент из указанной позиции за O(1), перемещая на его место последний элемент.
+    @param array Массив (не указатель).
+    @param index Позиция для удаления.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+*/
+#define iarray_remove_swap(array, index, out_value) \
+    inline_array_remove_swap(&(array).header, (array).items, sizeof((array).items[0]), index, out_value)
@@ -0,0 +1,271 @@
+/*
+    @file list.h
+    @brief Интерфейс интрузивного двусвязного списка.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Добавление в начало и конец, вставку рядом с узлом и удаление узла за O(1)
+            - Перемещение узла в начало или конец списка (например, для LRU)
+            - Получение структуры-владельца по указателю на узел (list_entry)
+            - Обход списка в прямом и обратном порядке, в том числе с удалением текущего узла
+
+    @note Особенности реализации:
+            - Узел (list_node) встраивается в структуру-владельца, список не выделяет память
+            - Список кольцевой с узлом-заголовком, поэтому операции не содержат проверок на nullptr
+            - Элемент может одновременно состоять в нескольких списках через разные узлы
+            - Удаленный узел указывает сам на себя, поэтому повторное удаление безопасно
+            - Не thread-safe
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Узел интрузивного списка (также используется как заголовок списка).
+typedef struct list_node {
+    // @brief Предыдущий узел (для заголовка - последний узел списка).
+    struct list_node* prev;
+    // @brief Следующий узел (для заголовка - первый узел списка).
+    struct list_node* next;
+} list_node;
+
+/*
+    @brief Инициализирует заголовок пустого списка или отдельный узел.
+    @param node Указатель на заголовок или узел.
+*/
+INLINE void list_init(list_node* node)
+{
+    node->prev = node;
+    node->next = node;
+}
+
+/*
+    @brief Проверяет, пуст ли список.
+    @param head Указатель на заголовок списка.
+    @return true - список пуст, false - список содержит узлы.
+*/
+INLINE bool list_empty(const list_node* head)
+{
+    return head->next == head;
+}
+
+/*
+    @brief Проверяет, состоит ли узел в каком-либо списке.
+    @note Узел должен быть инициализирован list_init() или удален list_remove().
+    @param node Указатель на узел.
+    @return true - узел состоит в списке, false - узел отсоединен.
+*/
+INLINE bool list_linked(const list_node* node)
+{
+    return node->next != node;
+}
+
+/*
+    @brief Вставляет узел между двумя соседними узлами.
+    @param node Указатель на вставляемый узел.
+    @param prev Указатель на предыдущий узел.
+    @param next Указатель на следующий узел.
+*/
+INLINE void list_insert_between(list_node* node, list_node* prev, list_node* next)
+{
+    node->prev = prev;
+    node->next = next;
+    prev->next = node;
+    next->prev = node;
+}
+
+/*
+    @brief Вставляет узел после указанного узла.
+    @param position Указатель на узел, после которого выполняется вставка.
+    @param node Указатель на вставляемый узел.
+*/
+INLINE void list_insert_after(list_node* position, list_node* node)
+{
+    list_insert_between(node, position, position->next);
+}
+
+/*
+    @brief Вставляет узел перед указанным узлом.
+    @param position Указатель на узел, перед которым выполняется вставка.
+    @param node Указатель на вставляемый узел.
+*/
+INLINE void list_insert_before(list_node* position, list_node* node)
+{
+    list_insert_between(node, position->prev, position);
+}
+
+/*
+    @brief Добавляет узел в начало списка.
+    @param head Указатель на заголовок списка.
+    @param node Указатель на добавляемый узел.
+*/
+INLINE void list_push_front(list_node* head, list_node* node)
+{
+    list_insert_between(node, head, head->next);
+}
+
+/*
+    @brief Добавляет узел в конец списка.
+    @param head Указатель на заголовок списка.
+    @param node Указатель на добавляемый узел.
+*/
+INLINE void list_push_back(list_node* head, list_node* node)
+{
+    list_insert_between(node, head->prev, head);
+}
+
+/*
+    @brief Удаляет узел из списка.
+    @note После удаления узел указывает сам на себя.
+    @param node Указатель на удаляемый узел.
+*/
+INLINE void list_remove(list_node* node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    list_init(node);
+}
+
+/*
+    @brief Перемещает узел в начало списка.
+    @param head Указатель на заголовок списка.
+    @param node Указатель на узел (из этого или другого списка).
+*/
+INLINE void list_move_front(list_node* head, list_node* node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    list_insert_between(node, head, head->next);
+}
+
+/*
+    @brief Перемещает узел в конец списка.
+    @param head Указатель на заголовок списка.
+    @param node Указатель на узел (из этого или другого списка).
+*/
+INLINE void list_move_back(list_node* head, list_node* node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    list_insert_between(node, head->prev, head);
+}
+
+/*
+    @brief Возвращает первый узел списка.
+    @param head Указатель на заголовок списка.
+    @return Указатель на первый узел или nullptr, если список пуст.
+*/
+INLINE list_node* list_front(const list_node* head)
+{
+    return head->next != head ? head->next : nullptr;
+}
+
+/*
+    @brief Возвращает последний узел списка.
+    @param head Указатель на заголовок списка.
+    @return Указатель на последний узел или nullptr, если список пуст.
+*/
+INLINE list_node* list_back(const list_node* head)
+{
+    return head->prev != head ? head->prev : nullptr;
+}
+
+/*
+    @brief Удаляет и возвращает первый узел списка.
+    @param head Указатель на заголовок списка.
+    @return Указатель на удаленный узел или nullptr, если список пуст.
+*/
+INLINE list_node* list_pop_front(list_node* head)
+{
+    list_node* node = list_front(head);
+    if(node)
+    {
+        list_remove(node);
+    }
+    return node;
+}
+
+/*
+    @brief Удаляет и возвращает последний узел списка.
+    @param head Указатель на заголовок списка.
+    @return Указатель на удаленный узел или nullptr, если список пуст.
+*/
+INLINE list_node* list_pop_back(list_node* head)
+{
+    list_node* node = list_back(head);
+    if(node)
+    {
+        list_remove(node);
+    }
+    return node;
+}
+
+/*
+    @brief Переносит все узлы списка source в конец списка head.
+    @note После переноса список source пуст.
+    @param head Указатель на заголовок списка-получателя.
+    @param source Указатель на заголовок списка-источника.
+*/
+INLINE void list_splice_back(list_node* head, list_node* source)
+{
+    if(list_empty(source))
+    {
+        return;
+    }
+
+    list_node* first = source->next;
+    list_node* last = source->prev;
+
+    first->prev = head->prev;
+    head->prev->next = first;
+    last->next = head;
+    head->prev = last;
+
+    list_init(source);
+}
+
+/*
+    @brief Возвращает указатель на структуру-владельца узла.
+    @param node Указатель на узел.
+    @param type Тип структуры-владельца.
+    @param member Имя поля узла в структуре-владельце.
+    @return Указатель на структуру-владельца.
+*/
+#define list_entry(node, type, member) ((type*)POINTER_SUB_OFFSET(node, OFFSET_OF(type, member)))
+
+/*
+    @brief Обходит узлы списка от первого к последнему.
+    @note Удаление текущего узла во время обхода недопустимо (см. list_foreach_safe).
+    @param head Указатель на заголовок списка.
+    @param node Имя переменной-указателя на текущий узел (объявляется макросом).
+*/
+#define list_foreach(head, node) \
+    for(list_node* node = (head)->next; node != (head); node = node->next)
+
+/*
+    @brief Обходит узлы списка от последнего к первому.
+    @note Удаление текущего узла во время обхода недопустимо.
+    @param head Указатель на заголовок списка.
+    @param node Имя переменной-указателя на текущий узел (объявляется макросом).
+*/
+#define list_foreach_reverse(head, node) \
+    for(list_node* node = (head)->prev; node != (head); node = node->prev)
+
+/*
+    @brief Обходит узлы списка от первого к последнему с возможностью удалить текущий узел.
+    @param head Указатель на заголовок списка.
+    @param node Имя переменной-указателя на текущий узел (объявляется макросом).
+*/
+#define list_foreach_safe(head, node)                                                           \
+    for(list_node* node = (head)->next, *__next_##node = node->next; node != (head);            \
+        node = __next_##node, __next_##node = node->next)
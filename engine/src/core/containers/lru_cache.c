@@ -0,0 +1,258 @@
+#include "core/containers/lru_cache.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+// Запись начинается с узла списка, за ним следует ключ (смещение 16 выравнивает ключ любого размера).
+#define LRU_CACHE_KEY_OFFSET   sizeof(list_node)
+
+// Максимальное выравнивание ключа и значения в записи.
+#define LRU_CACHE_ALIGNMENT    16
+
+// Выравнивание поля заданного размера (наибольшая степень двойки, делящая размер, но не больше 16).
+INLINE u32 lru_cache_field_alignment(u64 size)
+{
+    return size == 0 ? 1 : (u32)MIN(size & (~size + 1), (u64)LRU_CACHE_ALIGNMENT);
+}
+
+INLINE u64 lru_cache_align_up(u64 size, u32 alignment)
+{
+    return (size + alignment - 1) & ~((u64)alignment - 1);
+}
+
+INLINE u8* lru_cache_entry_key(u8* entry)
+{
+    return entry + LRU_CACHE_KEY_OFFSET;
+}
+
+INLINE u8* lru_cache_entry_value(const lru_cache* cache, u8* entry)
+{
+    return entry + cache->value_offset;
+}
+
+// Находит запись по ключу.
+INLINE u8* lru_cache_find(const lru_cache* cache, const void* key)
+{
+    u8** entry = hash_map_get(&cache->map, key);
+    return entry ? *entry : nullptr;
+}
+
+// Возвращает запись в список свободных.
+INLINE void lru_cache_release(lru_cache* cache, u8* entry)
+{
+    list_node* node = (list_node*)entry;
+    list_remove(node);
+    list_push_front(&cache->free_list, node);
+}
+
+bool lru_cache_create(
+    u64 key_size, u64 value_size, u64 capacity, hash_map_hash_fn hash, hash_map_equal_fn equal,
+    lru_cache_evict_fn evict, void* user, lru_cache* out_cache
+)
+{
+    ASSERT(key_size > 0 && key_size <= U32_MAX, "Key size must be greater than zero and fit in 32 bits.");
+    ASSERT(value_size <= U32_MAX, "Value size must fit in 32 bits.");
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(out_cache != nullptr, "Cache pointer must be non-null.");
+
+    mzero(out_cache, sizeof(lru_cache));
+    list_init(&out_cache->order);
+    list_init(&out_cache->free_list);
+
+    u32 key_alignment = lru_cache_field_alignment(key_size);
+    u32 value_alignment = lru_cache_field_alignment(value_size);
+    u32 entry_alignment = MAX(MAX(key_alignment, value_alignment), (u32)sizeof(void*));
+
+    out_cache->capacity = capacity;
+    out_cache->key_size = (u32)key_size;
+    out_cache->value_size = (u32)value_size;
+    out_cache->value_offset = (u32)lru_cache_align_up(LRU_CACHE_KEY_OFFSET + key_size, value_alignment);
+    out_cache->entry_stride = (u32)lru_cache_align_up(out_cache->value_offset + value_size, entry_alignment);
+    out_cache->evict = evict;
+    out_cache->user = user;
+
+    // NOTE: В заполненный кеш новый ключ вставляется до удаления вытесняемого (capacity + 1 пар). Запас вдвое
+    //       держит заполнение таблицы меньше половины: удаленные ячейки убираются перестроением на месте,
+    //       и таблица никогда не увеличивается.
+    if(!hash_map_create(key_size, sizeof(u8*), (capacity + 1) * 2, hash, equal, &out_cache->map))
+    {
+        LOG_ERROR("Failed to create key table for lru cache with capacity %llu.", capacity);
+        return false;
+    }
+
+    out_cache->entries = memory_allocate(capacity * out_cache->entry_stride, LRU_CACHE_ALIGNMENT, MEMORY_TAG_HASHMAP);
+    if(!out_cache->entries)
+    {
+        LOG_ERROR("Failed to allocate memory for lru cache with capacity %llu.", capacity);
+        hash_map_destroy(&out_cache->map);
+        return false;
+    }
+
+    // Записи добавляются в обратном порядке, чтобы выдаваться по возрастанию адресов.
+    for(u64 i = capacity; i > 0; --i)
+    {
+        list_push_front(&out_cache->free_list, (list_node*)(out_cache->entries + (i - 1) * out_cache->entry_stride));
+    }
+
+    return true;
+}
+
+void lru_cache_destroy(lru_cache* cache)
+{
+    ASSERT(cache != nullptr, "Cache pointer must be non-null.");
+
+    if(cache->entries)
+    {
+        lru_cache_clear(cache);
+        memory_free(cache->entries, cache->capacity * cache->entry_stride, MEMORY_TAG_HASHMAP);
+        hash_map_destroy(&cache->map);
+    }
+
+    mzero(cache, sizeof(lru_cache));
+}
+
+void lru_cache_clear(lru_cache* cache)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+
+    if(cache->evict)
+    {
+        list_foreach(&cache->order, node)
+        {
+            u8* entry = (u8*)node;
+            cache->evict(lru_cache_entry_key(entry), lru_cache_entry_value(cache, entry), cache->user);
+        }
+    }
+
+    list_splice_back(&cache->free_list, &cache->order);
+    hash_map_clear(&cache->map);
+}
+
+void* lru_cache_put(lru_cache* cache, const void* key, const void* value)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u8* entry = lru_cache_find(cache, key);
+    if(entry)
+    {
+        // Замена значения существующего ключа.
+        if(cache->evict)
+        {
+            cache->evict(lru_cache_entry_key(entry), lru_cache_entry_value(cache, entry), cache->user);
+        }
+    }
+    else
+    {
+        // Свободная запись или давно неиспользуемая пара для вытеснения.
+        list_node* node = list_front(&cache->free_list);
+        bool evicting = node == nullptr;
+        if(evicting)
+        {
+            node = list_back(&cache->order);
+        }
+
+        // Ключ вставляется до вытеснения, чтобы при ошибке кеш остался прежним.
+        entry = (u8*)node;
+        if(!hash_map_insert(&cache->map, key, &entry))
+        {
+            LOG_ERROR("Failed to insert key into lru cache.");
+            return nullptr;
+        }
+
+        if(evicting)
+        {
+            hash_map_remove(&cache->map, lru_cache_entry_key(entry), nullptr);
+            if(cache->evict)
+            {
+                cache->evict(lru_cache_entry_key(entry), lru_cache_entry_value(cache, entry), cache->user);
+            }
+        }
+
+        list_remove(node);
+        mcopy(lru_cache_entry_key(entry), key, cache->key_size);
+    }
+
+    void* entry_value = lru_cache_entry_value(cache, entry);
+    if(cache->value_size > 0)
+    {
+        if(value)
+        {
+            mcopy(entry_value, value, cache->value_size);
+        }
+        else
+        {
+            mzero(entry_value, cache->value_size);
+        }
+    }
+
+    list_move_front(&cache->order, (list_node*)entry);
+    return entry_value;
+}
+
+void* lru_cache_get(lru_cache* cache, const void* key)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u8* entry = lru_cache_find(cache, key);
+    if(!entry)
+    {
+        return nullptr;
+    }
+
+    list_move_front(&cache->order, (list_node*)entry);
+    return lru_cache_entry_value(cache, entry);
+}
+
+void* lru_cache_peek(const lru_cache* cache, const void* key)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u8* entry = lru_cache_find(cache, key);
+    return entry ? lru_cache_entry_value(cache, entry) : nullptr;
+}
+
+bool lru_cache_remove(lru_cache* cache, const void* key, void* out_value)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+    ASSERT(key != nullptr, "Key pointer must be non-null.");
+
+    u8* entry = nullptr;
+    if(!hash_map_remove(&cache->map, key, &entry))
+    {
+        return false;
+    }
+
+    if(out_value && cache->value_size > 0)
+    {
+        mcopy(out_value, lru_cache_entry_value(cache, entry), cache->value_size);
+    }
+
+    lru_cache_release(cache, entry);
+    return true;
+}
+
+bool lru_cache_oldest(const lru_cache* cache, void** out_key, void** out_value)
+{
+    ASSERT(cache != nullptr && cache->entries != nullptr, "Cache must be initialized.");
+
+    u8* entry = (u8*)list_back(&cache->order);
+    if(!entry)
+    {
+        return false;
+    }
+
+    if(out_key)
+    {
+        *out_key = lru_cache_entry_key(entry);
+    }
+
+    if(out_value)
+    {
+        *out_value = lru_cache_entry_value(cache, entry);
+    }
+
+    return true;
+}
@@ -0,0 +1,233 @@
+/*
+    @file lru_cache.h
+    @brief Интерфейс кеша фиксированной емкости с вытеснением давно неиспользуемых элементов (LRU).
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Поиск, вставку и удаление пар ключ-значение за O(1) в среднем
+            - Автоматическое вытеснение давно неиспользуемой пары при заполнении кеша
+            - Функцию обратного вызова для освобождения ресурсов вытесняемых значений
+            - Работу с любыми типами ключей и значений через type-agnostic интерфейс
+
+    @note Особенности реализации:
+            - Хеш-таблица (hash_map) связывает ключ с записью, записи упорядочены интрузивным
+              списком (list_node) от недавно использованной к давно неиспользуемой
+            - Все записи выделяются одним блоком при создании, свободные записи объединены в список
+            - Таблица ключей создается с емкостью не меньше удвоенной емкости кеша: заполнение остается меньше
+              половины, поэтому накопленные удаленные ячейки убираются перестроением на месте, и после создания
+              вставка и вытеснение не выделяют память
+            - Новый ключ вставляется в таблицу до вытеснения, поэтому при ошибке вставки кеш не изменяется
+            - Указатели на значения действительны до удаления или вытеснения пары
+            - Для работы с кешем используются макросы (lrucache_*) для type safety
+            - Не thread-safe
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/containers/hashmap.h>
+#include <core/containers/list.h>
+
+/*
+    @brief Функция обратного вызова для вытесняемой пары.
+    @param key Указатель на ключ.
+    @param value Указатель на значение.
+    @param user Пользовательские данные, переданные при создании кеша.
+*/
+typedef void (*lru_cache_evict_fn)(const void* key, void* value, void* user);
+
+// @brief Контекст LRU-кеша.
+typedef struct lru_cache {
+    // @brief Таблица ключей (ключ -> указатель на запись).
+    hash_map map;
+    // @brief Список используемых записей (первая - недавно использованная, последняя - давно неиспользуемая).
+    list_node order;
+    // @brief Список свободных записей.
+    list_node free_list;
+    // @brief Блок записей.
+    u8* entries;
+    // @brief Максимальное количество пар.
+    u64 capacity;
+    // @brief Размер ключа в байтах.
+    u32 key_size;
+    // @brief Размер значения в байтах.
+    u32 value_size;
+    // @brief Смещение значения от начала записи в байтах.
+    u32 value_offset;
+    // @brief Размер записи (узел списка, ключ и значение с выравниванием) в байтах.
+    u32 entry_stride;
+    // @brief Функция обратного вызова для вытесняемой пары (может быть nullptr).
+    lru_cache_evict_fn evict;
+    // @brief Пользовательские данные для функции обратного вызова.
+    void* user;
+} lru_cache;
+
+/*
+    @brief Инициализирует LRU-кеш.
+    @param key_size Размер ключа в байтах.
+    @param value_size Размер значения в байтах.
+    @param capacity Максимальное количество пар в кеше.
+    @param hash Функция хеширования ключа (nullptr - хеширование байтов ключа).
+    @param equal Функция сравнения ключей (nullptr - побайтовое сравнение).
+    @param evict Функция обратного вызова для вытесняемой пары (может быть nullptr).
+    @param user Пользовательские данные для функции обратного вызова (может быть nullptr).
+    @param out_cache Указатель на кеш для инициализации.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+CORE_API bool lru_cache_create(
+    u64 key_size, u64 value_size, u64 capacity, hash_map_hash_fn hash, hash_map_equal_fn equal,
+    lru_cache_evict_fn evict, void* user, lru_cache* out_cache
+);
+
+/*
+    @brief Уничтожает кеш и освобождает память.
+    @note Для каждой оставшейся пары вызывается функция обратного вызова.
+    @param cache Указатель на кеш.
+*/
+CORE_API void lru_cache_destroy(lru_cache* cache);
+
+/*
+    @brief Удаляет все пары кеша без освобождения памяти.
+    @note Для каждой пары вызывается функция обратного вызова.
+    @param cache Указатель на кеш.
+*/
+CORE_API void lru_cache_clear(lru_cache* cache);
+
+/*
+    @brief Вставляет пару или заменяет значение существующего ключа и отмечает пару как недавно использованную.
+    @note При заполненном кеше вытесняется давно неиспользуемая пара. Для заменяемого значения
+          существующего ключа также вызывается функция обратного вызова.
+    @param cache Указатель на кеш.
+    @param key Указатель на ключ.
+    @param value Указатель на значение (может быть nullptr, тогда значение обнуляется).
+    @return Указатель на значение в кеше или nullptr при ошибке вставки ключа (кеш и вытесняемая пара не изменяются).
+*/
+CORE_API void* lru_cache_put(lru_cache* cache, const void* key, const void* value);
+
+/*
+    @brief Находит значение по ключу и отмечает пару как недавно использованную.
+    @param cache Указатель на кеш.
+    @param key Указатель на ключ.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+CORE_API void* lru_cache_get(lru_cache* cache, const void* key);
+
+/*
+    @brief Находит значение по ключу без изменения порядка вытеснения.
+    @param cache Указатель на кеш.
+    @param key Указатель на ключ.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+CORE_API void* lru_cache_peek(const lru_cache* cache, const void* key);
+
+/*
+    @brief Удаляет пару по ключу.
+    @note Функция обратного вызова не вызывается.
+    @param cache Указатель на кеш.
+    @param key Указатель на ключ.
+    @param out_value Указатель для копирования удаляемого значения (может быть nullptr).
+    @return true - пара удалена, false - ключ не найден.
+*/
+CORE_API bool lru_cache_remove(lru_cache* cache, const void* key, void* out_value);
+
+/*
+    @brief Возвращает ключ и значение давно неиспользуемой пары (следующей на вытеснение).
+    @param cache Указатель на кеш.
+    @param out_key Указатель для записи указателя на ключ (может быть nullptr).
+    @param out_value Указатель для записи указателя на значение (может быть nullptr).
+    @return true - пара найдена, false - кеш пуст.
+*/
+CORE_API bool lru_cache_oldest(const lru_cache* cache, void** out_key, void** out_value);
+
+/*
+    @brief Инициализирует LRU-кеш для указанных типов ключа и значения.
+    @param cache LRU-кеш (не указатель).
+    @param key_type Тип ключа.
+    @param value_type Тип значения.
+    @param capacity Максимальное количество пар в кеше.
+    @param evict Функция обратного вызова для вытесняемой пары (может быть nullptr).
+    @param user Пользовательские данные для функции обратного вызова (может быть nullptr).
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define lrucache_create(cache, key_type, value_type, capacity, evict, user) \
+    lru_cache_create(sizeof(key_type), sizeof(value_type), capacity, nullptr, nullptr, evict, user, &(cache))
+
+/*
+    @brief Уничтожает кеш и освобождает память.
+    @param cache LRU-кеш (не указатель).
+*/
+#define lrucache_destroy(cache) lru_cache_destroy(&(cache))
+
+/*
+    @brief Удаляет все пары кеша без освобождения памяти.
+    @param cache LRU-кеш (не указатель).
+*/
+#define lrucache_clear(cache) lru_cache_clear(&(cache))
+
+/*
+    @brief Возвращает количество пар в кеше.
+    @param cache LRU-кеш (не указатель).
+    @return Количество пар.
+*/
+#define lrucache_length(cache) hashmap_length((cache).map)
+
+/*
+    @brief Вставляет пару или заменяет значение существующего ключа.
+    @param cache LRU-кеш (не указатель).
+    @param key Значение ключа.
+    @param value Значение.
+    @return Указатель на значение в кеше или nullptr при ошибке вставки ключа (кеш не изменяется).
+*/
+#define lrucache_put(cache, key, value)                       \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        typeof(value) __value = value;                        \
+        lru_cache_put(&(cache), &__key, &__value);            \
+    })
+
+/*
+    @brief Находит значение по ключу и отмечает пару как недавно использованную.
+    @param cache LRU-кеш (не указатель).
+    @param key Значение ключа.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+#define lrucache_get(cache, key)                              \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        lru_cache_get(&(cache), &__key);                      \
+    })
+
+/*
+    @brief Находит значение по ключу без изменения порядка вытеснения.
+    @param cache LRU-кеш (не указатель).
+    @param key Значение ключа.
+    @return Указатель на значение или nullptr, если ключ не найден.
+*/
+#define lrucache_peek(cache, key)                             \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        lru_cache_peek(&(cache), &__key);                     \
+    })
+
+/*
+    @brief Удаляет пару по ключу без вызова функции обратного вызова.
+    @param cache LRU-кеш (не указатель).
+    @param key Значение ключа.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+    @return true - пара удалена, false - ключ не найден.
+*/
+#define lrucache_remove(cache, key, out_value)                \
+    ({                                                        \
+        typeof(key) __key = key;                              \
+        lru_cache_remove(&(cache), &__key, out_value);        \
+    })
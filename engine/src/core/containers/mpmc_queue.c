@@ -0,0 +1,151 @@
+#include "core/containers/mpmc_queue.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+// Ячейка начинается с номера последовательности, за ним следует элемент.
+#define MPMC_QUEUE_DATA_OFFSET sizeof(u64)
+
+INLINE u64* mpmc_queue_sequence(const mpmc_queue* queue, u64 position)
+{
+    return (u64*)(queue->cells + (position & queue->mask) * queue->cell_stride);
+}
+
+bool mpmc_queue_create(u64 stride, u64 capacity, mpmc_queue* out_queue)
+{
+    ASSERT(stride > 0, "Stride must be greater than zero.");
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(out_queue != nullptr, "Queue pointer must be non-null.");
+
+    mzero(out_queue, sizeof(mpmc_queue));
+
+    capacity = MAX(NEXT_POWER_OF_TWO(capacity), 2ULL);
+    u64 cell_stride = (MPMC_QUEUE_DATA_OFFSET + stride + sizeof(u64) - 1) & ~(sizeof(u64) - 1);
+
+    out_queue->cells = memory_allocate(capacity * cell_stride, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_QUEUE);
+    if(!out_queue->cells)
+    {
+        LOG_ERROR("Failed to allocate memory for mpmc queue with capacity %llu.", capacity);
+        return false;
+    }
+
+    out_queue->mask = capacity - 1;
+    out_queue->stride = stride;
+    out_queue->cell_stride = cell_stride;
+
+    // Номер последовательности свободной ячейки равен позиции, на которой в нее будет выполнена запись.
+    for(u64 i = 0; i < capacity; ++i)
+    {
+        *mpmc_queue_sequence(out_queue, i) = i;
+    }
+
+    return true;
+}
+
+void mpmc_queue_destroy(mpmc_queue* queue)
+{
+    ASSERT(queue != nullptr, "Queue pointer must be non-null.");
+
+    if(queue->cells)
+    {
+        memory_free(queue->cells, (queue->mask + 1) * queue->cell_stride, MEMORY_TAG_QUEUE);
+    }
+
+    mzero(queue, sizeof(mpmc_queue));
+}
+
+bool mpmc_queue_push(mpmc_queue* queue, const void* data)
+{
+    ASSERT(queue != nullptr && queue->cells != nullptr, "Queue must be initialized.");
+    ASSERT(data != nullptr, "Data pointer must be non-null.");
+
+    u64* sequence;
+    u64 position = platform_atomic_load_u64(&queue->enqueue_position, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    for(;;)
+    {
+        sequence = mpmc_queue_sequence(queue, position);
+        i64 diff = (i64)(platform_atomic_load_u64(sequence, PLATFORM_MEMORY_ORDER_ACQUIRE) - position);
+
+        // Ячейка свободна: попытка захватить позицию (при неудаче position обновляется текущей).
+        if(diff == 0)
+        {
+            if(platform_atomic_compare_exchange_weak_u64(&queue->enqueue_position, &position, position + 1, PLATFORM_MEMORY_ORDER_RELAXED))
+            {
+                break;
+            }
+        }
+        // Ячейка еще не прочитана потребителем с предыдущего круга: очередь заполнена.
+        else if(diff < 0)
+        {
+            return false;
+        }
+        // Позицию уже захватил другой производитель.
+        else
+        {
+            position = platform_atomic_load_u64(&queue->enqueue_position, PLATFORM_MEMORY_ORDER_RELAXED);
+        }
+    }
+
+    mcopy((u8*)sequence + MPMC_QUEUE_DATA_OFFSET, data, queue->stride);
+    platform_atomic_store_u64(sequence, position + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+bool mpmc_queue_pop(mpmc_queue* queue, void* out_data)
+{
+    ASSERT(queue != nullptr && queue->cells != nullptr, "Queue must be initialized.");
+
+    u64* sequence;
+    u64 position = platform_atomic_load_u64(&queue->dequeue_position, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    for(;;)
+    {
+        sequence = mpmc_queue_sequence(queue, position);
+        i64 diff = (i64)(platform_atomic_load_u64(sequence, PLATFORM_MEMORY_ORDER_ACQUIRE) - (position + 1));
+
+        // Ячейка заполнена: попытка захватить позицию.
+        if(diff == 0)
+        {
+            if(platform_atomic_compare_exchange_weak_u64(&queue->dequeue_position, &position, position + 1, PLATFORM_MEMORY_ORDER_RELAXED))
+            {
+                break;
+            }
+        }
+        // Производитель еще не записал ячейку: очередь пуста.
+        else if(diff < 0)
+        {
+            return false;
+        }
+        // Позицию уже захватил другой потребитель.
+        else
+        {
+            position = platform_atomic_load_u64(&queue->dequeue_position, PLATFORM_MEMORY_ORDER_RELAXED);
+        }
+    }
+
+    if(out_data)
+    {
+        mcopy(out_data, (u8*)sequence + MPMC_QUEUE_DATA_OFFSET, queue->stride);
+    }
+
+    // Ячейка становится свободной для записи на следующем круге.
+    platform_atomic_store_u64(sequence, position + queue->mask + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+u64 mpmc_queue_length(const mpmc_queue* queue)
+{
+    ASSERT(queue != nullptr && queue->cells != nullptr, "Queue must be initialized.");
+
+    u64 dequeue = platform_atomic_load_u64(&queue->dequeue_position, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    u64 enqueue = platform_atomic_load_u64(&queue->enqueue_position, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    return enqueue >= dequeue ? MIN(enqueue - dequeue, queue->mask + 1) : 0;
+}
+
+u64 mpmc_queue_capacity(const mpmc_queue* queue)
+{
+    ASSERT(queue != nullptr && queue->cells != nullptr, "Queue must be initialized.");
+
+    return queue->mask + 1;
+}
@@ -0,0 +1,139 @@
+/*
+    @file mpmc_queue.h
+    @brief Интерфейс ограниченной lock-free очереди для нескольких производителей и потребителей.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Добавление и извлечение элементов любым количеством потоков без блокировок
+            - Фиксированную емкость без выделения памяти после создания
+            - Работу с любыми типами данных через type-agnostic интерфейс
+
+    @note Особенности реализации:
+            - Алгоритм Дмитрия Вьюкова: кольцевой буфер ячеек, каждая ячейка хранит номер последовательности,
+              по которому поток определяет, свободна ли ячейка для записи или готова для чтения
+            - Позиция ячейки захватывается одной операцией compare-exchange, данные копируются вне нее
+            - Позиции записи и чтения находятся на разных линиях кэша
+            - Емкость округляется до степени двойки
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <platform/thread.h>
+
+// @brief Контекст очереди нескольких производителей и потребителей.
+typedef struct mpmc_queue {
+    // @brief Позиция следующей записи (общая для производителей).
+    PLATFORM_CACHE_ALIGNED u64 enqueue_position;
+    // @brief Позиция следующего чтения (общая для потребителей).
+    PLATFORM_CACHE_ALIGNED u64 dequeue_position;
+    // @brief Маска индекса ячейки (емкость - 1).
+    PLATFORM_CACHE_ALIGNED u64 mask;
+    // @brief Размер одного элемента в байтах.
+    u64 stride;
+    // @brief Размер ячейки (номер последовательности и элемент) в байтах.
+    u64 cell_stride;
+    // @brief Буфер ячеек.
+    u8* cells;
+} mpmc_queue;
+
+/*
+    @brief Инициализирует очередь.
+    @param stride Размер одного элемента в байтах.
+    @param capacity Минимальная емкость очереди (округляется до степени двойки).
+    @param out_queue Указатель на очередь для инициализации.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+CORE_API bool mpmc_queue_create(u64 stride, u64 capacity, mpmc_queue* out_queue);
+
+/*
+    @brief Уничтожает очередь и освобождает память.
+    @warning Не thread-safe. Все потоки должны завершить работу с очередью.
+    @param queue Указатель на очередь.
+*/
+CORE_API void mpmc_queue_destroy(mpmc_queue* queue);
+
+/*
+    @brief Добавляет элемент в конец очереди.
+    @note Thread-safe, может вызываться любым потоком.
+    @param queue Указатель на очередь.
+    @param data Указатель на данные элемента.
+    @return true - элемент добавлен, false - очередь заполнена.
+*/
+CORE_API bool mpmc_queue_push(mpmc_queue* queue, const void* data);
+
+/*
+    @brief Извлекает элемент из начала очереди.
+    @note Thread-safe, может вызываться любым потоком.
+    @param queue Указатель на очередь.
+    @param out_data Указатель для копирования элемента (может быть nullptr).
+    @return true - элемент извлечен, false - очередь пуста.
+*/
+CORE_API bool mpmc_queue_pop(mpmc_queue* queue, void* out_data);
+
+/*
+    @brief Возвращает количество элементов в очереди.
+    @note При одновременной работе потоков значение приблизительное.
+    @param queue Указатель на очередь.
+    @return Количество элементов.
+*/
+CORE_API u64 mpmc_queue_length(const mpmc_queue* queue);
+
+/*
+    @brief Возвращает емкость очереди.
+    @param queue Указатель на очередь.
+    @return Емкость очереди.
+*/
+CORE_API u64 mpmc_queue_capacity(const mpmc_queue* queue);
+
+/*
+    @brief Инициализирует очередь для указанного типа.
+    @param queue Очередь (не указатель).
+    @param type Тип элементов.
+    @param capacity Минимальная емкость очереди.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define mpmcqueue_create(queue, type, capacity) mpmc_queue_create(sizeof(type), capacity, &(queue))
+
+/*
+    @brief Уничтожает очередь и освобождает память.
+    @param queue Очередь (не указатель).
+*/
+#define mpmcqueue_destroy(queue) mpmc_queue_destroy(&(queue))
+
+/*
+    @brief Добавляет элемент в конец очереди.
+    @param queue Очередь (не указатель).
+    @param value Значение элемента.
+    @return true - элемент добавлен, false - очередь заполнена.
+*/
+#define mpmcqueue_push(queue, value)                          \
+    ({                                                        \
+        typeof(value) __temp = value;                         \
+        mpmc_queue_push(&(queue), &__temp);                   \
+    })
+
+/*
+    @brief Извлекает элемент из начала очереди.
+    @param queue Очередь (не указатель).
+    @param out_value Указатель для сохранения значения (может быть nullptr).
+    @return true - элемент извлечен, false - очередь пуста.
+*/
+#define mpmcqueue_pop(queue, out_value) mpmc_queue_pop(&(queue), out_value)
+
+/*
+    @brief Возвращает количество элементов в очереди.
+    @param queue Очередь (не указатель).
+    @return Количество элементов.
+*/
+#define mpmcqueue_length(queue) mpmc_queue_length(&(queue))
@@ -0,0 +1,194 @@
+#include "core/containers/slotmap.h"
+#include "core/containers/darray.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+// Признак отсутствия свободных слотов.
+#define SLOT_MAP_NO_FREE_SLOT U32_MAX
+
+INLINE slot_handle slot_map_make_handle(u32 index, u32 generation)
+{
+    return ((u64)generation << 32) | index;
+}
+
+bool slot_map_create(u64 stride, u64 capacity, memory_tag tag, slot_map* out_map)
+{
+    ASSERT(stride > 0, "Stride must be greater than zero.");
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(out_map != nullptr, "Slot map pointer must be non-null.");
+
+    mzero(out_map, sizeof(slot_map));
+    out_map->free_slot = SLOT_MAP_NO_FREE_SLOT;
+
+    out_map->data = dynamic_array_create_tagged(stride, capacity, tag);
+    out_map->dense_slots = darray_create_tagged(u32, capacity, tag);
+    out_map->slots = darray_create_tagged(slot_map_slot, capacity, tag);
+
+    if(!out_map->data || !out_map->dense_slots || !out_map->slots)
+    {
+        LOG_ERROR("Failed to allocate memory for slot map.");
+        slot_map_destroy(out_map);
+        return false;
+    }
+
+    return true;
+}
+
+void slot_map_destroy(slot_map* map)
+{
+    ASSERT(map != nullptr, "Slot map pointer must be non-null.");
+
+    if(map->data)
+    {
+        darray_destroy(map->data);
+    }
+
+    if(map->dense_slots)
+    {
+        darray_destroy(map->dense_slots);
+    }
+
+    if(map->slots)
+    {
+        darray_destroy(map->slots);
+    }
+
+    mzero(map, sizeof(slot_map));
+}
+
+slot_handle slot_map_insert(slot_map* map, const void* data, void** out_element)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+
+    u64 dense_index = darray_length(map->data);
+    if(dense_index >= U32_MAX)
+    {
+        LOG_ERROR("Slot map is full.");
+        return SLOT_HANDLE_INVALID;
+    }
+
+    // Добавление элемента и индекса его слота в плотные массивы.
+    dynamic_array_push_n(&map->data, data, 1);
+    if(darray_length(map->data) == dense_index)
+    {
+        LOG_ERROR("Failed to add element to slot map.");
+        return SLOT_HANDLE_INVALID;
+    }
+
+    // Выбор свободного слота или добавление нового (поколение нового слота начинается с 1).
+    u32 slot_index = map->free_slot;
+    if(slot_index == SLOT_MAP_NO_FREE_SLOT)
+    {
+        slot_index = (u32)darray_length(map->slots);
+        darray_push(map->slots, ((slot_map_slot){ .generation = 1, .index = SLOT_MAP_NO_FREE_SLOT }));
+
+        if(darray_length(map->slots) == slot_index)
+        {
+            LOG_ERROR("Failed to add slot to slot map.");
+            darray_pop(map->data, nullptr);
+            return SLOT_HANDLE_INVALID;
+        }
+
+        // Новый слот включается в список свободных, чтобы при ошибке ниже не потеряться.
+        map->free_slot = slot_index;
+    }
+
+    darray_push(map->dense_slots, slot_index);
+    if(darray_length(map->dense_slots) == dense_index)
+    {
+        LOG_ERROR("Failed to add element to slot map.");
+        darray_pop(map->data, nullptr);
+        return SLOT_HANDLE_INVALID;
+    }
+
+    slot_map_slot* slot = &map->slots[slot_index];
+    map->free_slot = slot->index;
+    slot->index = (u32)dense_index;
+
+    if(out_element)
+    {
+        *out_element = (u8*)map->data + dense_index * darray_stride(map->data);
+    }
+
+    return slot_map_make_handle(slot_index, slot->generation);
+}
+
+bool slot_map_remove(slot_map* map, slot_handle handle, void* out_data)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+
+    u32 slot_index = slot_handle_index(handle);
+    if(slot_index >= darray_length(map->slots) || map->slots[slot_index].generation != slot_handle_generation(handle))
+    {
+        return false;
+    }
+
+    // Перемещение последнего элемента на место удаляемого и обновление его слота.
+    slot_map_slot* slot = &map->slots[slot_index];
+    u32 dense_index = slot->index;
+    u64 last_index = darray_length(map->data) - 1;
+
+    darray_remove_swap(map->data, dense_index, out_data);
+    darray_remove_swap(map->dense_slots, dense_index, nullptr);
+
+    if(dense_index < last_index)
+    {
+        map->slots[map->dense_slots[dense_index]].index = dense_index;
+    }
+
+    // Новое поколение делает недействительными все копии дескриптора (поколение 0 пропускается).
+    slot->generation = slot->generation == U32_MAX ? 1 : slot->generation + 1;
+    slot->index = map->free_slot;
+    map->free_slot = slot_index;
+
+    return true;
+}
+
+void* slot_map_get(const slot_map* map, slot_handle handle)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+
+    u32 slot_index = slot_handle_index(handle);
+    if(slot_index >= darray_length(map->slots) || map->slots[slot_index].generation != slot_handle_generation(handle))
+    {
+        return nullptr;
+    }
+
+    return (u8*)map->data + (u64)map->slots[slot_index].index * darray_stride(map->data);
+}
+
+void slot_map_clear(slot_map* map)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+
+    // Все занятые слоты получают новое поколение и возвращаются в список свободных.
+    for(u64 i = 0; i < darray_length(map->dense_slots); ++i)
+    {
+        u32 slot_index = map->dense_slots[i];
+        slot_map_slot* slot = &map->slots[slot_index];
+
+        slot->generation = slot->generation == U32_MAX ? 1 : slot->generation + 1;
+        slot->index = map->free_slot;
+        map->free_slot = slot_index;
+    }
+
+    darray_reset(map->data);
+    darray_reset(map->dense_slots);
+}
+
+u64 slot_map_length(const slot_map* map)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+
+    return darray_length(map->data);
+}
+
+slot_handle slot_map_handle_at(const slot_map* map, u64 index)
+{
+    ASSERT(map != nullptr && map->data != nullptr, "Slot map must be initialized.");
+    ASSERT(index < darray_length(map->data), "Index out of bounds.");
+
+    u32 slot_index = map->dense_slots[index];
+    return slot_map_make_handle(slot_index, map->slots[slot_index].generation);
+}
@@ -0,0 +1,216 @@
+/*
+    @file slotmap.h
+    @brief Интерфейс карты слотов с поколениями (generational slot map).
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Добавление, удаление и доступ к элементам по дескриптору за O(1)
+            - Обнаружение устаревших дескрипторов (использование элемента после удаления)
+            - Плотное хранение элементов для быстрого обхода
+            - Работу с любыми типами данных через type-agnostic интерфейс
+
+    @note Особенности реализации:
+            - Дескриптор содержит 32-битный индекс слота и 32-битное поколение слота
+            - Поколение слота увеличивается при удалении элемента, поэтому старые дескрипторы становятся недействительными
+            - Освобожденные слоты объединены в список и используются повторно
+            - Элементы хранятся плотно в динамическом массиве, при удалении на место элемента перемещается последний,
+              поэтому указатели на элементы недействительны после удаления или добавления
+            - Память элементов и слотов учитывается по тегу, указанному при создании карты
+            - Для работы с картой используются макросы (slotmap_*) для type safety
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/memory.h>
+
+// @brief Дескриптор элемента карты слотов (младшие 32 бита - индекс слота, старшие - поколение).
+typedef u64 slot_handle;
+
+// @brief Недействительный дескриптор (поколение 0 никогда не выдается).
+#define SLOT_HANDLE_INVALID 0
+
+// @brief Слот карты.
+typedef struct slot_map_slot {
+    // @brief Поколение слота.
+    u32 generation;
+    // @brief Индекс элемента в плотном массиве (для свободного слота - индекс следующего свободного слота).
+    u32 index;
+} slot_map_slot;
+
+// @brief Контекст карты слотов.
+typedef struct slot_map {
+    // @brief Плотный динамический массив элементов.
+    void* data;
+    // @brief Индексы слотов элементов плотного массива (динамический массив).
+    u32* dense_slots;
+    // @brief Слоты карты (динамический массив).
+    slot_map_slot* slots;
+    // @brief Индекс первого свободного слота (U32_MAX - свободных слотов нет).
+    u32 free_slot;
+} slot_map;
+
+/*
+    @brief Возвращает индекс слота дескриптора.
+    @param handle Дескриптор элемента.
+    @return Индекс слота.
+*/
+INLINE u32 slot_handle_index(slot_handle handle)
+{
+    return (u32)handle;
+}
+
+/*
+    @brief Возвращает поколение слота дескриптора.
+    @param handle Дескриптор элемента.
+    @return Поколение слота.
+*/
+INLINE u32 slot_handle_generation(slot_handle handle)
+{
+    return (u32)(handle >> 32);
+}
+
+/*
+    @brief Инициализирует карту слотов.
+    @param stride Размер одного элемента в байтах.
+    @param capacity Начальная емкость карты.
+    @param tag Тег памяти элементов и слотов карты.
+    @param out_map Указатель на карту для инициализации.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+CORE_API bool slot_map_create(u64 stride, u64 capacity, memory_tag tag, slot_map* out_map);
+
+/*
+    @brief Уничтожает карту слотов и освобождает память.
+    @param map Указатель на карту.
+*/
+CORE_API void slot_map_destroy(slot_map* map);
+
+/*
+    @brief Добавляет элемент в карту.
+    @param map Указатель на карту.
+    @param data Указатель на данные элемента (nullptr - элемент обнуляется).
+    @param out_element Указатель для записи указателя на элемент (может быть nullptr).
+    @return Дескриптор элемента или SLOT_HANDLE_INVALID при ошибке выделения памяти.
+*/
+CORE_API slot_handle slot_map_insert(slot_map* map, const void* data, void** out_element);
+
+/*
+    @brief Удаляет элемент из карты.
+    @note Дескриптор и все его копии становятся недействительными.
+    @param map Указатель на карту.
+    @param handle Дескриптор элемента.
+    @param out_data Указатель для копирования удаляемого элемента (может быть nullptr).
+    @return true - элемент удален, false - дескриптор недействителен.
+*/
+CORE_API bool slot_map_remove(slot_map* map, slot_handle handle, void* out_data);
+
+/*
+    @brief Возвращает указатель на элемент по дескриптору.
+    @note Указатель действителен до следующего добавления или удаления.
+    @param map Указатель на карту.
+    @param handle Дескриптор элемента.
+    @return Указатель на элемент или nullptr, если дескриптор недействителен (элемент удален).
+*/
+CORE_API void* slot_map_get(const slot_map* map, slot_handle handle);
+
+/*
+    @brief Удаляет все элементы карты без освобождения памяти.
+    @note Все выданные дескрипторы становятся недействительными.
+    @param map Указатель на карту.
+*/
+CORE_API void slot_map_clear(slot_map* map);
+
+/*
+    @brief Возвращает количество элементов в карте.
+    @param map Указатель на карту.
+    @return Количество элементов.
+*/
+CORE_API u64 slot_map_length(const slot_map* map);
+
+/*
+    @brief Возвращает дескриптор элемента плотного массива.
+    @param map Указатель на карту.
+    @param index Индекс элемента в плотном массиве (меньше slot_map_length()).
+    @return Дескриптор элемента.
+*/
+CORE_API slot_handle slot_map_handle_at(const slot_map* map, u64 index);
+
+/*
+    @brief Инициализирует карту слотов для указанного типа.
+    @param map Карта слотов (не указатель).
+    @param type Тип элементов.
+    @param tag Тег памяти карты.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define slotmap_create(map, type, tag) slot_map_create(sizeof(type), 1, tag, &(map))
+
+/*
+    @brief Инициализирует карту слотов для указанного типа и емкости.
+    @param map Карта слотов (не указатель).
+    @param type Тип элементов.
+    @param capacity Начальная емкость карты.
+    @param tag Тег памяти карты.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define slotmap_create_custom(map, type, capacity, tag) slot_map_create(sizeof(type), capacity, tag, &(map))
+
+/*
+    @brief Уничтожает карту слотов и освобождает память.
+    @param map Карта слотов (не указатель).
+*/
+#define slotmap_destroy(map) slot_map_destroy(&(map))
+
+/*
+    @brief Добавляет элемент в карту.
+    @param map Карта слотов (не указатель).
+    @param value Значение элемента.
+    @return Дескриптор элемента или SLOT_HANDLE_INVALID при ошибке.
+*/
+#define slotmap_insert(map, value)                            \
+    ({                                                        \
+        typeof(value) __temp = value;                         \
+        slot_map_insert(&(map), &__temp, nullptr);            \
+    })
+
+/*
+    @brief Удаляет элемент из карты.
+    @param map Карта слотов (не указатель).
+    @param handle Дескриптор элемента.
+    @param out_value Указатель для сохранения удаляемого значения (может быть nullptr).
+    @return true - элемент удален, false - дескриптор недействителен.
+*/
+#define slotmap_remove(map, handle, out_value) slot_map_remove(&(map), handle, out_value)
+
+/*
+    @brief Возвращает указатель на элемент по дескриптору.
+    @param map Карта слотов (не указатель).
+    @param handle Дескриптор элемента.
+    @return Указатель на элемент или nullptr, если дескриптор недействителен.
+*/
+#define slotmap_get(map, handle) slot_map_get(&(map), handle)
+
+/*
+    @brief Возвращает количество элементов в карте.
+    @param map Карта слотов (не указатель).
+    @return Количество элементов.
+*/
+#define slotmap_length(map) slot_map_length(&(map))
+
+/*
+    @brief Возвращает плотный массив элементов для обхода (длина - slotmap_length()).
+    @param map Карта слотов (не указатель).
+    @param type Тип элементов.
+    @return Указатель на первый элемент.
+*/
+#define slotmap_data(map, type) ((type*)(map).data)
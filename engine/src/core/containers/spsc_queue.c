@@ -0,0 +1,102 @@
+#include "core/containers/spsc_queue.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+
+bool spsc_queue_create(u64 stride, u64 capacity, spsc_queue* out_queue)
+{
+    ASSERT(stride > 0, "Stride must be greater than zero.");
+    ASSERT(capacity > 0, "Capacity must be greater than zero.");
+    ASSERT(out_queue != nullptr, "Queue pointer must be non-null.");
+
+    mzero(out_queue, sizeof(spsc_queue));
+
+    capacity = MAX(NEXT_POWER_OF_TWO(capacity), 2ULL);
+    out_queue->buffer = memory_allocate(capacity * stride, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_QUEUE);
+    if(!out_queue->buffer)
+    {
+        LOG_ERROR("Failed to allocate memory for spsc queue with capacity %llu.", capacity);
+        return false;
+    }
+
+    out_queue->mask = capacity - 1;
+    out_queue->stride = stride;
+    return true;
+}
+
+void spsc_queue_destroy(spsc_queue* queue)
+{
+    ASSERT(queue != nullptr, "Queue pointer must be non-null.");
+
+    if(queue->buffer)
+    {
+        memory_free(queue->buffer, (queue->mask + 1) * queue->stride, MEMORY_TAG_QUEUE);
+    }
+
+    mzero(queue, sizeof(spsc_queue));
+}
+
+bool spsc_queue_push(spsc_queue* queue, const void* data)
+{
+    ASSERT(queue != nullptr && queue->buffer != nullptr, "Queue must be initialized.");
+    ASSERT(data != nullptr, "Data pointer must be non-null.");
+
+    // Собственный индекс читается без упорядочивания, т.к. изменяется только этим потоком.
+    u64 head = platform_atomic_load_u64(&queue->head, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    if(head - queue->cached_tail > queue->mask)
+    {
+        queue->cached_tail = platform_atomic_load_u64(&queue->tail, PLATFORM_MEMORY_ORDER_ACQUIRE);
+        if(head - queue->cached_tail > queue->mask)
+        {
+            return false;
+        }
+    }
+
+    mcopy(queue->buffer + (head & queue->mask) * queue->stride, data, queue->stride);
+
+    // Публикация элемента: запись данных становится видимой потребителю до нового индекса.
+    platform_atomic_store_u64(&queue->head, head + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue* queue, void* out_data)
+{
+    ASSERT(queue != nullptr && queue->buffer != nullptr, "Queue must be initialized.");
+
+    u64 tail = platform_atomic_load_u64(&queue->tail, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    if(tail == queue->cached_head)
+    {
+        queue->cached_head = platform_atomic_load_u64(&queue->head, PLATFORM_MEMORY_ORDER_ACQUIRE);
+        if(tail == queue->cached_head)
+        {
+            return false;
+        }
+    }
+
+    if(out_data)
+    {
+        mcopy(out_data, queue->buffer + (tail & queue->mask) * queue->stride, queue->stride);
+    }
+
+    // Освобождение ячейки: чтение данных завершается до того, как производитель увидит новый индекс.
+    platform_atomic_store_u64(&queue->tail, tail + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+u64 spsc_queue_length(const spsc_queue* queue)
+{
+    ASSERT(queue != nullptr && queue->buffer != nullptr, "Queue must be initialized.");
+
+    u64 tail = platform_atomic_load_u64(&queue->tail, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    u64 head = platform_atomic_load_u64(&queue->head, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    return head >= tail ? head - tail : 0;
+}
+
+u64 spsc_queue_capacity(const spsc_queue* queue)
+{
+    ASSERT(queue != nullptr && queue->buffer != nullptr, "Queue must be initialized.");
+
+    return queue->mask + 1;
+}
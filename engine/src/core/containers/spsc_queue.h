@@ -0,0 +1,142 @@
+/*
+    @file spsc_queue.h
+    @brief Интерфейс ограниченной lock-free очереди для одного производителя и одного потребителя.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Передачу элементов между двумя потоками без блокировок и системных вызовов
+            - Фиксированную емкость без выделения памяти после создания
+            - Работу с любыми типами данных через type-agnostic интерфейс
+
+    @note Особенности реализации:
+            - Кольцевой буфер с емкостью, округленной до степени двойки
+            - Индексы производителя и потребителя монотонно растут и находятся на разных линиях кэша
+            - Каждая сторона кэширует последний прочитанный индекс другой стороны и обращается
+              к чужой линии кэша только когда очередь кажется полной (пустой)
+            - Добавление выполняет только производитель, извлечение - только потребитель;
+              при нескольких производителях или потребителях используйте mpmc_queue
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <platform/thread.h>
+
+// @brief Контекст очереди одного производителя и одного потребителя.
+typedef struct spsc_queue {
+    // @brief Индекс следующей записи (изменяет только производитель).
+    PLATFORM_CACHE_ALIGNED u64 head;
+    // @brief Последний прочитанный производителем индекс потребителя.
+    u64 cached_tail;
+    // @brief Индекс следующего чтения (изменяет только потребитель).
+    PLATFORM_CACHE_ALIGNED u64 tail;
+    // @brief Последний прочитанный потребителем индекс производителя.
+    u64 cached_head;
+    // @brief Маска индекса элемента (емкость - 1).
+    PLATFORM_CACHE_ALIGNED u64 mask;
+    // @brief Размер одного элемента в байтах.
+    u64 stride;
+    // @brief Буфер элементов.
+    u8* buffer;
+} spsc_queue;
+
+/*
+    @brief Инициализирует очередь.
+    @param stride Размер одного элемента в байтах.
+    @param capacity Минимальная емкость очереди (округляется до степени двойки).
+    @param out_queue Указатель на очередь для инициализации.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+CORE_API bool spsc_queue_create(u64 stride, u64 capacity, spsc_queue* out_queue);
+
+/*
+    @brief Уничтожает очередь и освобождает память.
+    @warning Не thread-safe. Оба потока должны завершить работу с очередью.
+    @param queue Указатель на очередь.
+*/
+CORE_API void spsc_queue_destroy(spsc_queue* queue);
+
+/*
+    @brief Добавляет элемент в конец очереди.
+    @warning Вызывается только потоком-производителем.
+    @param queue Указатель на очередь.
+    @param data Указатель на данные элемента.
+    @return true - элемент добавлен, false - очередь заполнена.
+*/
+CORE_API bool spsc_queue_push(spsc_queue* queue, const void* data);
+
+/*
+    @brief Извлекает элемент из начала очереди.
+    @warning Вызывается только потоком-потребителем.
+    @param queue Указатель на очередь.
+    @param out_data Указатель для копирования элемента (может быть nullptr).
+    @return true - элемент извлечен, false - очередь пуста.
+*/
+CORE_API bool spsc_queue_pop(spsc_queue* queue, void* out_data);
+
+/*
+    @brief Возвращает количество элементов в очереди.
+    @note При одновременной работе потоков значение приблизительное.
+    @param queue Указатель на очередь.
+    @return Количество элементов.
+*/
+CORE_API u64 spsc_queue_length(const spsc_queue* queue);
+
+/*
+    @brief Возвращает емкость очереди.
+    @param queue Указатель на очередь.
+    @return Емкость очереди.
+*/
+CORE_API u64 spsc_queue_capacity(const spsc_queue* queue);
+
+/*
+    @brief Инициализирует очередь для указанного типа.
+    @param queue Очередь (не указатель).
+    @param type Тип элементов.
+    @param capacity Минимальная емкость очереди.
+    @return true - инициализация успешна, false - ошибка выделения памяти.
+*/
+#define spscqueue_create(queue, type, capacity) spsc_queue_create(sizeof(type), capacity, &(queue))
+
+/*
+    @brief Уничтожает очередь и освобождает память.
+    @param queue Очередь (не указатель).
+*/
+#define spscqueue_destroy(queue) spsc_queue_destroy(&(queue))
+
+/*
+    @brief Добавляет элемент в конец очереди.
+    @param queue Очередь (не указатель).
+    @param value Значение элемента.
+    @return true - элемент добавлен, false - очередь заполнена.
+*/
+#define spscqueue_push(queue, value)                          \
+    ({                                                        \
+        typeof(value) __temp = value;                         \
+        spsc_queue_push(&(queue), &__temp);                   \
+    })
+
+/*
+    @brief Извлекает элемент из начала очереди.
+    @param queue Очередь (не указатель).
+    @param out_value Указатель для сохранения значения (может быть nullptr).
+    @return true - элемент извлечен, false - очередь пуста.
+*/
+#define spscqueue_pop(queue, out_value) spsc_queue_pop(&(queue), out_value)
+
+/*
+    @brief Возвращает количество элементов в очереди.
+    @param queue Очередь (не указатель).
+    @return Количество элементов.
+*/
+#define spscqueue_length(queue) spsc_queue_length(&(queue))
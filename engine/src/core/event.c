@@ -1,8 +1,9 @@
 #include "core/event.h"
 #include "core/logger.h"
 #include "core/memory.h"
-#include "core/containers/darray.h"
+#include "core/containers/inline_array.h"
 #include "debug/assert.h"
+#include "platform/thread.h"
 
 typedef struct event_listener {
     // Указатель на объект слушатель.
@@ -11,23 +12,43 @@ typedef struct event_listener {
     on_event_callback handler;
 } event_listener;
 
+// Количество слушателей, хранимых внутри события без выделения памяти.
+// NOTE: Заголовок (16 байт) и 3 слушателя занимают одну линию кэша (64 байта).
+#define EVENT_INLINE_LISTENER_COUNT 3
+
+// Начальное количество событий в хранилище (встроенные коды событий).
+#define EVENT_INITIAL_CAPACITY (EVENT_CODE_MOUSE_WHEEL + 1)
+
 typedef struct event {
-    // Слушатели события (используется darray).
-    event_listener* listeners;
+    // Слушатели события (первые EVENT_INLINE_LISTENER_COUNT хранятся внутри события).
+    PLATFORM_CACHE_ALIGNED INLINE_ARRAY(event_listener, EVENT_INLINE_LISTENER_COUNT) listeners;
 } event;
 
+STATIC_ASSERT(sizeof(event) == PLATFORM_CACHE_LINE_SIZE, "Event must occupy exactly one cache line.");
+
+// NOTE: События хранятся только для кодов, на которые хотя бы раз подписывались, поэтому контекст
+//       не растет вместе с пространством кодов: на код приходится 2 байта номера события вместо линии кэша.
 typedef struct event_system_context {
-    event events[EVENT_CODE_COUNT];
+    // Номера событий в хранилище по кодам (номер + 1, 0 - на код не подписывались).
+    u16 slots[EVENT_CODE_COUNT];
+    // Хранилище событий (выровнено по линии кэша).
+    event* events;
+    // Количество событий в хранилище.
+    u32 event_count;
+    // Емкость хранилища событий.
+    u32 event_capacity;
     bool is_running;
 } event_system_context;
 
+STATIC_ASSERT(EVENT_CODE_COUNT <= U16_MAX, "Event slot must fit into u16.");
+
 static event_system_context* context = nullptr;
 
 bool event_system_initialize()
 {
     ASSERT(context == nullptr, "Event system is already initialized.");
 
-    context = mallocate(sizeof(event_system_context), MEMORY_TAG_SYSTEM);
+    context = memory_allocate(sizeof(event_system_context), PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_SYSTEM);
     if(!context)
     {
         LOG_ERROR("Failed to allocate memory for event system to initialize.");
@@ -35,6 +56,16 @@ bool event_system_initialize()
     }
     mzero(context, sizeof(event_system_context));
 
+    context->events = memory_allocate(sizeof(event) * EVENT_INITIAL_CAPACITY, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_SYSTEM);
+    if(!context->events)
+    {
+        LOG_ERROR("Failed to allocate memory for events.");
+        memory_free(context, sizeof(event_system_context), MEMORY_TAG_SYSTEM);
+        context = nullptr;
+        return false;
+    }
+    context->event_capacity = EVENT_INITIAL_CAPACITY;
+
     context->is_running = true;
     return true;
 }
@@ -47,16 +78,13 @@ void event_system_shutdown()
     context->is_running = false;
 
     // Освобождение выделенных ресурсов.
-    for(u32 i = 0; i < EVENT_CODE_COUNT; ++i)
+    for(u32 i = 0; i < context->event_count; ++i)
     {
-        if(context->events[i].listeners != nullptr)
-        {
-            darray_destroy(context->events[i].listeners);
-            context->events[i].listeners = nullptr;
-        }
+        iarray_destroy(context->events[i].listeners);
     }
 
-    mfree(context, sizeof(event_system_context), MEMORY_TAG_SYSTEM);
+    memory_free(context->events, sizeof(event) * context->event_capacity, MEMORY_TAG_SYSTEM);
+    memory_free(context, sizeof(event_system_context), MEMORY_TAG_SYSTEM);
     context = nullptr;
 }
 
@@ -65,6 +93,38 @@ bool event_system_is_initialized()
     return context != nullptr && context->is_running;
 }
 
+// Возвращает событие кода, добавляя его в хранилище при первой подписке (nullptr при ошибке выделения памяти).
+static event* event_acquire(event_code code)
+{
+    u16 slot = context->slots[code];
+    if(slot > 0)
+    {
+        return &context->events[slot - 1];
+    }
+
+    if(context->event_count == context->event_capacity)
+    {
+        // NOTE: Перемещение событий копированием корректно: встроенные элементы адресуются относительно
+        //       самого события, а блок в куче принадлежит событию по указателю.
+        u32 capacity = context->event_capacity * 2;
+        event* events = memory_allocate(sizeof(event) * capacity, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_SYSTEM);
+        if(!events)
+        {
+            return nullptr;
+        }
+
+        mcopy(events, context->events, sizeof(event) * context->event_count);
+        memory_free(context->events, sizeof(event) * context->event_capacity, MEMORY_TAG_SYSTEM);
+        context->events = events;
+        context->event_capacity = capacity;
+    }
+
+    event* entry = &context->events[context->event_count++];
+    mzero(entry, sizeof(event));
+    context->slots[code] = (u16)context->event_count;
+    return entry;
+}
+
 bool event_register(event_code code, void* listener, on_event_callback handler)
 {
     ASSERT(context != nullptr, "Event system not initialized. Call event_system_initialize() first.");
@@ -77,20 +137,27 @@ bool event_register(event_code code, void* listener, on_event_callback handler)
         return false;
     }
 
-    // Создание списка слушателей, если его нет.
-    if(context->events[code].listeners == nullptr)
+    if((u32)code >= EVENT_CODE_COUNT)
+    {
+        LOG_ERROR("Event code %d is out of range. Cannot register event handler.", code);
+        return false;
+    }
+
+    event* entry_event = event_acquire(code);
+    if(!entry_event)
     {
-        context->events[code].listeners = darray_create(event_listener);
-        LOG_TRACE("Created new listener array for event code: %s (%d).", event_code_to_str(code), code);
+        LOG_ERROR("Failed to allocate event for event code: %s (%d).", event_code_to_str(code), code);
+        return false;
     }
 
     // Получение текущего количества слушателей.
-    u64 listener_count = darray_length(context->events[code].listeners);
+    u32 listener_count = iarray_length(entry_event->listeners);
+    event_listener* listeners = iarray_data(entry_event->listeners);
 
     // Проверка наличия слушателя в списке.
-    for(u64 i = 0; i < listener_count; ++i)
+    for(u32 i = 0; i < listener_count; ++i)
     {
-        event_listener* entry = &context->events[code].listeners[i];
+        event_listener* entry = &listeners[i];
         if(entry->instance == listener && entry->handler == handler)
         {
             LOG_WARN("Event is already registered with code: %s (%d).", event_code_to_str(code), code);
@@ -100,7 +167,12 @@ bool event_register(event_code code, void* listener, on_event_callback handler)
 
     // Регистрация нового слушателя.
     event_listener entry = {listener, handler};
-    darray_push(context->events[code].listeners, entry);
+    if(!iarray_push(entry_event->listeners, entry))
+    {
+        LOG_ERROR("Failed to register event handler for event code: %s (%d).", event_code_to_str(code), code);
+        return false;
+    }
+
     LOG_TRACE("Registered event handler for event code: %s (%d), listener: %p.", event_code_to_str(code), code, listener);
     return true;
 }
@@ -117,21 +189,30 @@ bool event_unregister(event_code code, void* listener, on_event_callback handler
         return false;
     }
 
-    if(context->events[code].listeners == nullptr)
+    u16 slot = (u32)code < EVENT_CODE_COUNT ? context->slots[code] : 0;
+    if(slot == 0)
     {
         LOG_WARN("Event code %s (%d) has no listeners to unregister from.", event_code_to_str(code), code);
         return false;
     }
 
     // Получение текущего количества слушателей для удаления.
-    u64 listener_count = darray_length(context->events[code].listeners);
+    event* entry_event = &context->events[slot - 1];
+    u32 listener_count = iarray_length(entry_event->listeners);
+    event_listener* listeners = iarray_data(entry_event->listeners);
 
-    for(u64 i = 0; i < listener_count; ++i)
+    if(listener_count == 0)
     {
-        event_listener* entry = &context->events[code].listeners[i];
+        LOG_WARN("Event code %s (%d) has no listeners to unregister from.", event_code_to_str(code), code);
+        return false;
+    }
+
+    for(u32 i = 0; i < listener_count; ++i)
+    {
+        event_listener* entry = &listeners[i];
         if(entry->instance == listener && entry->handler == handler)
         {
-            darray_remove(context->events[code].listeners, i, nullptr);
+            iarray_remove(entry_event->listeners, i, nullptr);
             LOG_TRACE("Unregistered event handler for event code: %s (%d), listener: %p.", event_code_to_str(code), code, listener);
             return true;
         }
@@ -152,23 +233,33 @@ bool event_send(event_code code, void* sender, event_context* data)
         return false;
     }
 
-    if(context->events[code].listeners == nullptr)
+    // NOTE: Проверка диапазона сохраняется и без ASSERT: код может прийти извне (например, от пользователя).
+    u16 slot = (u32)code < EVENT_CODE_COUNT ? context->slots[code] : 0;
+    if(slot == 0)
+    {
+        return false;
+    }
+
+    // Получение текущего количества слушателей.
+    u32 listener_count = iarray_length(context->events[slot - 1].listeners);
+    if(listener_count == 0)
     {
         // LOG_TRACE("Event code %d has no listeners. Event not processed.", code);
         return false;
     }
 
-    // Получение текущего количества слушателей для удаления.
-    u64 listener_count = darray_length(context->events[code].listeners);
-    LOG_TRACE("Dispatching event code: %s (%d) to %llu listeners.", event_code_to_str(code), code, listener_count);
+    LOG_TRACE("Dispatching event code: %s (%d) to %u listeners.", event_code_to_str(code), code, listener_count);
 
     bool event_handled = false;
-    for(u64 i = 0; i < listener_count; ++i)
+    for(u32 i = 0; i < listener_count && i < iarray_length(context->events[slot - 1].listeners); ++i)
     {
-        event_listener* entry = &context->events[code].listeners[i];
-        if(entry->handler(code, sender, entry->instance, data))
+        // NOTE: Обработчик может зарегистрировать слушателя, и массив перейдет из события в кучу или будет
+        //       перевыделен, а хранилище событий - перемещено, поэтому слушатель копируется, а событие
+        //       и данные массива получаются заново на каждом шаге.
+        event_listener entry = iarray_data(context->events[slot - 1].listeners)[i];
+        if(entry.handler(code, sender, entry.instance, data))
         {
-            LOG_TRACE("Event code: %s (%d) handled by listener: %p and propagation stopped.", event_code_to_str(code), code, entry->instance);
+            LOG_TRACE("Event code: %s (%d) handled by listener: %p and propagation stopped.", event_code_to_str(code), code, entry.instance);
             event_handled = true;
             break;
         }
@@ -197,7 +288,7 @@ const char* event_code_to_str(event_code code)
 
     static const u32 code_count = ARRAY_SIZE(strings);
 
-    if((u32)code > code_count || strings[code] == nullptr)
+    if((u32)code >= code_count || strings[code] == nullptr)
     {
         return "UNKNOWN";
     }
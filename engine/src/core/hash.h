@@ -0,0 +1,131 @@
+/*
+    @file hash.h
+    @brief Интерфейс некриптографического 64-битного хеширования.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Хеширование произвольных байтов (ключи хеш-таблиц, идентификаторы строк)
+
+    @note Особенности реализации:
+            - Алгоритм wyhash (final v4): данные читаются словами по 8 байт, перемешивание выполняется
+              128-битным умножением
+            - Функция встраивается в место вызова, поэтому хеш постоянных данных может быть вычислен при компиляции
+            - Результат не зависит от выравнивания данных, но зависит от порядка байтов платформы
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// Константы wyhash (final v4).
+#define HASH_SECRET_0 0xA0761D6478BD642FULL
+#define HASH_SECRET_1 0xE7037ED1A0B428DBULL
+#define HASH_SECRET_2 0x8EBC6AF09C88C6E3ULL
+#define HASH_SECRET_3 0x589965CC75374CC3ULL
+
+// Умножение 64x64 -> 128 бит: младшая половина в a, старшая в b.
+INLINE void hash_multiply(u64* a, u64* b)
+{
+    __uint128_t result = (__uint128_t)*a * *b;
+    *a = (u64)result;
+    *b = (u64)(result >> 64);
+}
+
+// Перемешивание двух слов (xor половин 128-битного произведения).
+INLINE u64 hash_mix(u64 a, u64 b)
+{
+    hash_multiply(&a, &b);
+    return a ^ b;
+}
+
+// Невыровненное чтение слов из потока байтов.
+INLINE u64 hash_read64(const u8* p)
+{
+    u64 value;
+    __builtin_memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+INLINE u64 hash_read32(const u8* p)
+{
+    u32 value;
+    __builtin_memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+/*
+    @brief Хеширует последовательность байтов.
+    @note Для постоянных данных известной длины (например, строковых литералов) при включенной оптимизации
+          результат вычисляется компилятором.
+    @param key Указатель на данные.
+    @param key_size Размер данных в байтах.
+    @return 64-битный хеш данных.
+*/
+INLINE u64 hash_bytes(const void* key, u64 key_size)
+{
+    const u8* p = key;
+    u64 seed = hash_mix(HASH_SECRET_0, HASH_SECRET_1);
+    u64 a, b;
+
+    if(LIKELY(key_size <= 16))
+    {
+        if(LIKELY(key_size >= 4))
+        {
+            u64 shift = (key_size >> 3) << 2;
+            a = (hash_read32(p) << 32) | hash_read32(p + shift);
+            b = (hash_read32(p + key_size - 4) << 32) | hash_read32(p + key_size - 4 - shift);
+        }
+        else if(key_size > 0)
+        {
+            a = ((u64)p[0] << 16) | ((u64)p[key_size >> 1] << 8) | p[key_size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        u64 remaining = key_size;
+        if(UNLIKELY(remaining > 48))
+        {
+            u64 seed1 = seed, seed2 = seed;
+            do
+            {
+                seed = hash_mix(hash_read64(p) ^ HASH_SECRET_1, hash_read64(p + 8) ^ seed);
+                seed1 = hash_mix(hash_read64(p + 16) ^ HASH_SECRET_2, hash_read64(p + 24) ^ seed1);
+                seed2 = hash_mix(hash_read64(p + 32) ^ HASH_SECRET_3, hash_read64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            }
+            while(remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+
+        while(remaining > 16)
+        {
+            seed = hash_mix(hash_read64(p) ^ HASH_SECRET_1, hash_read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+
+        a = hash_read64(p + remaining - 16);
+        b = hash_read64(p + remaining - 8);
+    }
+
+    a ^= HASH_SECRET_1;
+    b ^= seed;
+    hash_multiply(&a, &b);
+    return hash_mix(a ^ HASH_SECRET_0 ^ key_size, b ^ HASH_SECRET_1);
+}
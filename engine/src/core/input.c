@@ -1,13 +1,14 @@
 #include "core/input.h"
 #include "core/memory.h"
 #include "core/logger.h"
+#include "core/containers/bitset.h"
 #include "debug/assert.h"
 
 typedef struct input_state {
-    // Состояние всех клавиш.
-    bool keys[KEY_COUNT];
-    // Состояние всех кнопок.
-    bool buttons[BUTTON_COUNT];
+    // Состояние всех клавиш (бит на клавишу).
+    BITSET(KEY_COUNT) keys;
+    // Состояние всех кнопок (бит на кнопку).
+    BITSET(BUTTON_COUNT) buttons;
 } input_state;
 
 typedef struct input_system_context {
@@ -69,7 +70,7 @@ void input_system_update()
     context->state.delta_y = 0;
     context->state.wheel_delta_v = 0.0f;
     context->state.wheel_delta_h = 0.0f;
-    mcopy(&context->state.previous, &context->state.current, sizeof(input_state));
+    context->state.previous = context->state.current;
 }
 
 void input_keyboard_key_update(keyboard_key key, bool state)
@@ -77,7 +78,7 @@ void input_keyboard_key_update(keyboard_key key, bool state)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(key > KEY_UNKNOWN && key < KEY_COUNT, "Key code must be between 0 and KEY_COUNT.");
 
-    context->state.current.keys[key] = state;
+    bitset_assign(context->state.current.keys, key, state);
 }
 
 void input_mouse_button_update(mouse_button button, bool state)
@@ -85,7 +86,7 @@ void input_mouse_button_update(mouse_button button, bool state)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(button > BUTTON_UNKNOWN && button < BUTTON_COUNT, "Button code must be between 0 and BUTTON_COUNT.");
 
-    context->state.current.buttons[button] = state;
+    bitset_assign(context->state.current.buttons, button, state);
 }
 
 void input_mouse_position_update(i32 x, i32 y)
@@ -117,7 +118,7 @@ bool input_key_down(keyboard_key key)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(key > KEY_UNKNOWN && key < KEY_COUNT, "Key code must be between 0 and KEY_COUNT.");
 
-    return context->state.current.keys[key] && !context->state.previous.keys[key];
+    return bitset_test(context->state.current.keys, key) && !bitset_test(context->state.previous.keys, key);
 }
 
 bool input_key_up(keyboard_key key)
@@ -125,7 +126,7 @@ bool input_key_up(keyboard_key key)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(key > KEY_UNKNOWN && key < KEY_COUNT, "Key code must be between 0 and KEY_COUNT.");
 
-    return !context->state.current.keys[key] && context->state.previous.keys[key];
+    return !bitset_test(context->state.current.keys, key) && bitset_test(context->state.previous.keys, key);
 }
 
 bool input_key_held(keyboard_key key)
@@ -133,7 +134,42 @@ bool input_key_held(keyboard_key key)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(key > KEY_UNKNOWN && key < KEY_COUNT, "Key code must be between 0 and KEY_COUNT.");
 
-    return context->state.current.keys[key];
+    return bitset_test(context->state.current.keys, key);
+}
+
+// Записывает клавиши, состояние которых изменилось: установлены в from и сброшены в without.
+static u32 input_keys_transition(const u64* from, const u64* without, keyboard_key* out_keys, u32 max_count)
+{
+    BITSET(KEY_COUNT) changed;
+    bit_set_and_not(changed.words, from, without, ARRAY_SIZE(changed.words));
+
+    u32 count = 0;
+    bitset_foreach(changed, key)
+    {
+        if(count >= max_count)
+        {
+            break;
+        }
+        out_keys[count++] = (keyboard_key)key;
+    }
+
+    return count;
+}
+
+u32 input_keys_pressed(keyboard_key* out_keys, u32 max_count)
+{
+    ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
+    ASSERT(out_keys != nullptr || max_count == 0, "Keys pointer must be non-null.");
+
+    return input_keys_transition(context->state.current.keys.words, context->state.previous.keys.words, out_keys, max_count);
+}
+
+u32 input_keys_released(keyboard_key* out_keys, u32 max_count)
+{
+    ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
+    ASSERT(out_keys != nullptr || max_count == 0, "Keys pointer must be non-null.");
+
+    return input_keys_transition(context->state.previous.keys.words, context->state.current.keys.words, out_keys, max_count);
 }
 
 const char* input_key_to_str(keyboard_key key)
@@ -195,7 +231,7 @@ bool input_mouse_down(mouse_button button)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(button < BUTTON_COUNT, "Button code must be between 0 and BUTTON_COUNT.");
 
-    return context->state.current.buttons[button] && !context->state.previous.buttons[button];
+    return bitset_test(context->state.current.buttons, button) && !bitset_test(context->state.previous.buttons, button);
 }
 
 bool input_mouse_up(mouse_button button)
@@ -203,7 +239,7 @@ bool input_mouse_up(mouse_button button)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(button < BUTTON_COUNT, "Button code must be between 0 and BUTTON_COUNT.");
 
-    return !context->state.current.buttons[button] && context->state.previous.buttons[button];
+    return !bitset_test(context->state.current.buttons, button) && bitset_test(context->state.previous.buttons, button);
 }
 
 bool input_mouse_held(mouse_button button)
@@ -211,7 +247,7 @@ bool input_mouse_held(mouse_button button)
     ASSERT(context != nullptr, "Input system not initialized. Call input_system_initialize() first.");
     ASSERT(button < BUTTON_COUNT, "Button code must be between 0 and BUTTON_COUNT.");
 
-    return context->state.current.buttons[button];
+    return bitset_test(context->state.current.buttons, button);
 }
 
 void input_mouse_position(i32* out_x, i32* out_y)
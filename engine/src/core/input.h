@@ -2,7 +2,7 @@
     @file input.h
     @brief Интерфейс системы ввода для обработки клавиатуры и мыши.
     @author Дмитрий Скляр.
-    @version 1.1
+    @version 1.2
     @date 05-02-2026
 
     @license Лицензия Apache, версия 2.0 («Лицензия»);
@@ -15,6 +15,7 @@
 
     @note Система предоставляет:
             - Обработку состояний клавиатуры (нажатие, отпускание, удержание)
+            - Получение списков клавиш, нажатых и отпущенных на текущем кадре
             - Обработку состояний мыши (нажатие, отпускание, удержание)
             - Отслеживание позиции и перемещения курсора
             - Обработку прокрутки колеса мыши
@@ -116,6 +117,22 @@ CORE_API bool input_key_up(keyboard_key key);
 */
 CORE_API bool input_key_held(keyboard_key key);
 
+/**
+    @brief Получает клавиши, нажатые на текущем кадре (0 -> 1), в порядке возрастания кодов.
+    @param out_keys Массив для записи кодов клавиш.
+    @param max_count Размер массива кодов.
+    @return Количество записанных кодов (не больше max_count).
+*/
+CORE_API u32 input_keys_pressed(keyboard_key* out_keys, u32 max_count);
+
+/**
+    @brief Получает клавиши, отпущенные на текущем кадре (1 -> 0), в порядке возрастания кодов.
+    @param out_keys Массив для записи кодов клавиш.
+    @param max_count Размер массива кодов.
+    @return Количество записанных кодов (не больше max_count).
+*/
+CORE_API u32 input_keys_released(keyboard_key* out_keys, u32 max_count);
+
 /**
     @brief Получает строковое представление кода клавиши клавиатуры.
     @note Возвращаемая строка является статической и не требует освобождения.
@@ -0,0 +1,1060 @@
+#include "core/job.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "core/string_builder.h"
+#include "core/containers/mpmc_queue.h"
+#include "platform/thread.h"
+#include "platform/fiber.h"
+#include "platform/cpu.h"
+#include "debug/assert.h"
+
+// Маска индекса ячейки деки.
+#define JOB_DEQUE_MASK (JOB_SYSTEM_QUEUE_CAPACITY - 1)
+
+// Количество повторных попыток найти задачу перед засыпанием потока.
+#define JOB_SPIN_COUNT 32
+
+STATIC_ASSERT(IS_POWER_OF_TWO(JOB_SYSTEM_QUEUE_CAPACITY), "Job queue capacity must be a power of two.");
+
+// Задача в деке или очереди.
+typedef struct job {
+    // Функция задачи.
+    job_fn func;
+    // Данные задачи.
+    void* data;
+    // Счетчик задачи (может быть nullptr).
+    job_counter* counter;
+} job;
+
+// Деква Chase-Lev фиксированной емкости.
+typedef struct job_deque {
+    // Позиция, с которой задачи забирают другие потоки.
+    PLATFORM_CACHE_ALIGNED u64 top;
+    // Позиция, с которой задачи добавляет и извлекает владелец.
+    PLATFORM_CACHE_ALIGNED u64 bottom;
+    // Ячейки задач (поля читаются и записываются атомарно).
+    PLATFORM_CACHE_ALIGNED job* jobs;
+} job_deque;
+
+// Волокно пула.
+typedef struct job_fiber {
+    // Платформенное волокно.
+    platform_fiber* fiber;
+    // Счетчик, обнуления которого ожидает приостановленное волокно.
+    job_counter* counter;
+} job_fiber;
+
+// Действие с волокном, с которого переключился поток (выполняется уже на новом волокне).
+typedef enum job_fiber_action {
+    // Волокно потока или продолжаемое позже: действий нет.
+    JOB_FIBER_ACTION_NONE,
+    // Волокно возвращается в пул свободных.
+    JOB_FIBER_ACTION_RELEASE,
+    // Волокно добавляется в список ожидающих счетчик.
+    JOB_FIBER_ACTION_WAIT
+} job_fiber_action;
+
+// Поток системы задач (основной или рабочий).
+typedef struct job_worker {
+    // Деква задач потока.
+    job_deque deque;
+    // Дескриптор рабочего потока (для основного не используется).
+    platform_thread thread;
+    // Индекс потока в системе (0 - основной).
+    u32 index;
+    // Состояние генератора случайных чисел для выбора потока, у которого забирается задача.
+    u32 random;
+    // Логический процессор, к которому привязан поток (U32_MAX - без привязки).
+    u32 cpu;
+    // Волокно потока (nullptr - поток не работает в режиме волокон).
+    platform_fiber* thread_fiber;
+    // Выполняемое волокно пула (nullptr - поток выполняется на собственном стеке).
+    job_fiber* fiber;
+    // Волокно, с которого выполнено последнее переключение.
+    job_fiber* previous_fiber;
+    // Действие с предыдущим волокном.
+    job_fiber_action previous_action;
+} job_worker;
+
+typedef struct job_system_context {
+    // Потоки системы: [0] - основной, [1..worker_count] - рабочие.
+    job_worker* workers;
+    // Количество рабочих потоков.
+    u32 worker_count;
+    // Количество потоков с деками (рабочие и основной).
+    u32 thread_count;
+    // Процессор, назначенный основному потоку (U32_MAX - не назначен).
+    u32 main_cpu;
+    // Признак привязки основного потока к процессору.
+    bool main_pinned;
+    // Общая очередь задач потоков вне системы.
+    mpmc_queue global_queue;
+    // Очередь задач основного потока.
+    mpmc_queue main_queue;
+    // Волокна пула (nullptr - режим волокон выключен).
+    job_fiber* fibers;
+    // Количество волокон пула.
+    u32 fiber_count;
+    // Свободные волокна пула (указатели на job_fiber).
+    mpmc_queue free_fibers;
+    // Блокировка списка приостановленных волокон.
+    platform_spinlock fiber_lock;
+    // Приостановленные волокна, ожидающие обнуления счетчика.
+    job_fiber** waiting_fibers;
+    // Количество приостановленных волокон.
+    u32 waiting_fiber_count;
+    // Признак работы рабочих потоков (0 - остановка).
+    PLATFORM_CACHE_ALIGNED u32 running;
+    // Количество спящих потоков (простаивающих и ожидающих счетчик).
+    PLATFORM_CACHE_ALIGNED u32 sleeping;
+    // Количество потоков, спящих в ожидании счетчика, и приостановленных волокон.
+    u32 waiting;
+    // Номер пробуждения, на котором засыпают потоки.
+    u32 wake_epoch;
+} job_system_context;
+
+static job_system_context* context = nullptr;
+static PLATFORM_THREAD_LOCAL job_worker* current_worker = nullptr;
+
+INLINE void job_slot_store(job* slot, const job* value)
+{
+    platform_atomic_store_ptr((void**)&slot->func, (void*)value->func, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_ptr(&slot->data, value->data, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_ptr((void**)&slot->counter, value->counter, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+INLINE void job_slot_load(job* slot, job* out_value)
+{
+    out_value->func = (job_fn)platform_atomic_load_ptr((void**)&slot->func, PLATFORM_MEMORY_ORDER_RELAXED);
+    out_value->data = platform_atomic_load_ptr(&slot->data, PLATFORM_MEMORY_ORDER_RELAXED);
+    out_value->counter = platform_atomic_load_ptr((void**)&slot->counter, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+// Добавляет задачу в деку (только владелец).
+static bool job_deque_push(job_deque* deque, const job* value)
+{
+    u64 bottom = platform_atomic_load_u64(&deque->bottom, PLATFORM_MEMORY_ORDER_RELAXED);
+    u64 top = platform_atomic_load_u64(&deque->top, PLATFORM_MEMORY_ORDER_ACQUIRE);
+
+    if(bottom - top >= JOB_SYSTEM_QUEUE_CAPACITY)
+    {
+        return false;
+    }
+
+    job_slot_store(&deque->jobs[bottom & JOB_DEQUE_MASK], value);
+    platform_atomic_store_u64(&deque->bottom, bottom + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+// Извлекает последнюю добавленную задачу (только владелец).
+static bool job_deque_pop(job_deque* deque, job* out_value)
+{
+    u64 bottom = platform_atomic_load_u64(&deque->bottom, PLATFORM_MEMORY_ORDER_RELAXED) - 1;
+    platform_atomic_store_u64(&deque->bottom, bottom, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_thread_fence(PLATFORM_MEMORY_ORDER_SEQ_CST);
+    u64 top = platform_atomic_load_u64(&deque->top, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    // Деква пуста.
+    if((i64)(bottom - top) < 0)
+    {
+        platform_atomic_store_u64(&deque->bottom, bottom + 1, PLATFORM_MEMORY_ORDER_RELAXED);
+        return false;
+    }
+
+    job_slot_load(&deque->jobs[bottom & JOB_DEQUE_MASK], out_value);
+    if(bottom != top)
+    {
+        return true;
+    }
+
+    // Последняя задача: владелец соревнуется с другими потоками через top.
+    bool taken = platform_atomic_compare_exchange_u64(&deque->top, &top, top + 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+    platform_atomic_store_u64(&deque->bottom, bottom + 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    return taken;
+}
+
+// Забирает самую старую задачу (любой поток).
+static bool job_deque_steal(job_deque* deque, job* out_value)
+{
+    u64 top = platform_atomic_load_u64(&deque->top, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    platform_atomic_thread_fence(PLATFORM_MEMORY_ORDER_SEQ_CST);
+    u64 bottom = platform_atomic_load_u64(&deque->bottom, PLATFORM_MEMORY_ORDER_ACQUIRE);
+
+    if((i64)(bottom - top) <= 0)
+    {
+        return false;
+    }
+
+    // NOTE: Ячейка читается до захвата: если владелец успел ее перезаписать, захват не удастся.
+    job_slot_load(&deque->jobs[top & JOB_DEQUE_MASK], out_value);
+    return platform_atomic_compare_exchange_u64(&deque->top, &top, top + 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+}
+
+INLINE bool job_deque_empty(job_deque* deque)
+{
+    u64 top = platform_atomic_load_u64(&deque->top, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    u64 bottom = platform_atomic_load_u64(&deque->bottom, PLATFORM_MEMORY_ORDER_ACQUIRE);
+    return (i64)(bottom - top) <= 0;
+}
+
+// Пробуждает спящие потоки.
+static void job_wake(u32 count)
+{
+    platform_atomic_fetch_add_u32(&context->wake_epoch, 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+    platform_address_wake(&context->wake_epoch, count);
+}
+
+// Пробуждает спящие потоки после добавления задач.
+static void job_notify(u32 count)
+{
+    // NOTE: Барьер упорядочивает добавление задач и чтение количества спящих (парный барьер в job_sleep).
+    platform_atomic_thread_fence(PLATFORM_MEMORY_ORDER_SEQ_CST);
+    if(platform_atomic_load_u32(&context->sleeping, PLATFORM_MEMORY_ORDER_RELAXED) > 0)
+    {
+        job_wake(count);
+    }
+}
+
+static void job_counter_release(job_counter* counter)
+{
+    // NOTE: После обнуления счетчик может быть уже уничтожен ожидающим потоком, поэтому
+    //       решение о пробуждении принимается только по состоянию системы.
+    if(platform_atomic_fetch_sub_u32(&counter->value, 1, PLATFORM_MEMORY_ORDER_SEQ_CST) == 1
+    && platform_atomic_load_u32(&context->waiting, PLATFORM_MEMORY_ORDER_SEQ_CST) > 0)
+    {
+        job_wake(U32_MAX);
+    }
+}
+
+INLINE void job_execute(const job* value)
+{
+    value->func(value->data);
+
+    if(value->counter)
+    {
+        job_counter_release(value->counter);
+    }
+}
+
+INLINE u32 job_random(job_worker* worker)
+{
+    // Xorshift32.
+    u32 x = worker->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    worker->random = x;
+    return x;
+}
+
+// Возвращает поток системы, выполняющий вызов.
+// NOTE: Волокно может продолжиться в другом потоке, поэтому после переключения thread-local переменная
+//       читается заново: вызов функции без встраивания не позволяет компилятору переиспользовать ее адрес.
+static NOINLINE job_worker* job_worker_current()
+{
+    return current_worker;
+}
+
+// Находит приостановленное волокно с обнуленным счетчиком и, если take - true, извлекает его из списка.
+static job_fiber* job_fiber_ready(bool take)
+{
+    if(platform_atomic_load_u32(&context->waiting_fiber_count, PLATFORM_MEMORY_ORDER_ACQUIRE) == 0)
+    {
+        return nullptr;
+    }
+
+    job_fiber* ready = nullptr;
+    platform_spinlock_lock(&context->fiber_lock);
+
+    for(u32 i = 0; i < context->waiting_fiber_count; ++i)
+    {
+        job_fiber* fiber = context->waiting_fibers[i];
+        if(platform_atomic_load_u32(&fiber->counter->value, PLATFORM_MEMORY_ORDER_ACQUIRE) == 0)
+        {
+            ready = fiber;
+            if(take)
+            {
+                u32 last = context->waiting_fiber_count - 1;
+                context->waiting_fibers[i] = context->waiting_fibers[last];
+                platform_atomic_store_u32(&context->waiting_fiber_count, last, PLATFORM_MEMORY_ORDER_RELAXED);
+            }
+            break;
+        }
+    }
+
+    platform_spinlock_unlock(&context->fiber_lock);
+
+    if(ready && take)
+    {
+        ready->counter = nullptr;
+        platform_atomic_fetch_sub_u32(&context->waiting, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+    return ready;
+}
+
+// Завершает переключение: выполняет действие с волокном, с которого переключился поток.
+// NOTE: Действие откладывается до переключения, иначе другой поток мог бы продолжить волокно,
+//       стек которого еще используется.
+static void job_fiber_resume()
+{
+    job_worker* worker = job_worker_current();
+    job_fiber* fiber = worker->previous_fiber;
+    worker->previous_fiber = nullptr;
+
+    if(!fiber)
+    {
+        return;
+    }
+
+    if(worker->previous_action == JOB_FIBER_ACTION_RELEASE)
+    {
+        bool pushed = mpmc_queue_push(&context->free_fibers, &fiber);
+        ASSERT(pushed, "Free fiber queue must have room for every fiber.");
+        UNUSED(pushed);
+    }
+    else if(worker->previous_action == JOB_FIBER_ACTION_WAIT)
+    {
+        platform_spinlock_lock(&context->fiber_lock);
+        context->waiting_fibers[context->waiting_fiber_count] = fiber;
+        platform_atomic_store_u32(&context->waiting_fiber_count, context->waiting_fiber_count + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+        platform_spinlock_unlock(&context->fiber_lock);
+
+        // NOTE: Парная операция к чтению в job_counter_release(): либо освобождающий поток увидит ожидающее
+        //       волокно и пробудит потоки, либо текущий поток увидит обнуленный счетчик перед засыпанием.
+        platform_atomic_fetch_add_u32(&context->waiting, 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+    }
+}
+
+// Переключает поток с текущего волокна на волокно to (nullptr - волокно потока).
+static void job_fiber_switch(job_worker* worker, job_fiber* to, job_fiber_action action)
+{
+    job_fiber* from = worker->fiber;
+    worker->previous_fiber = from;
+    worker->previous_action = action;
+    worker->fiber = to;
+
+    platform_fiber_switch(from ? from->fiber : worker->thread_fiber, to ? to->fiber : worker->thread_fiber);
+
+    // Управление вернулось: волокно могло быть продолжено в другом потоке.
+    job_fiber_resume();
+}
+
+// Извлекает свободное волокно пула (nullptr - свободных волокон нет).
+static job_fiber* job_fiber_acquire()
+{
+    job_fiber* fiber = nullptr;
+    return mpmc_queue_pop(&context->free_fibers, &fiber) ? fiber : nullptr;
+}
+
+// Проверяет наличие задач, доступных текущему потоку.
+static bool job_available(const job_worker* worker)
+{
+    if(mpmc_queue_length(&context->global_queue) > 0)
+    {
+        return true;
+    }
+
+    if(worker && worker->index == 0 && mpmc_queue_length(&context->main_queue) > 0)
+    {
+        return true;
+    }
+
+    for(u32 i = 0; i < context->thread_count; ++i)
+    {
+        if(!job_deque_empty(&context->workers[i].deque))
+        {
+            return true;
+        }
+    }
+
+    // Приостановленные волокна продолжаются только потоками в режиме волокон.
+    if(worker && worker->thread_fiber && job_fiber_ready(false))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+// Находит задачу для текущего потока: своя деква, общая очередь, деки других потоков.
+static bool job_next(job_worker* worker, job* out_value)
+{
+    if(worker && job_deque_pop(&worker->deque, out_value))
+    {
+        return true;
+    }
+
+    if(mpmc_queue_pop(&context->global_queue, out_value))
+    {
+        return true;
+    }
+
+    u32 count = context->thread_count;
+    u32 start = worker ? job_random(worker) % count : 0;
+
+    for(u32 i = 0; i < count; ++i)
+    {
+        job_worker* victim = &context->workers[(start + i) % count];
+        if(victim != worker && job_deque_steal(&victim->deque, out_value))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Находит задачу, повторяя попытки активным циклом перед засыпанием.
+static bool job_next_spin(job_worker* worker, job* out_value)
+{
+    for(u32 i = 0; i < JOB_SPIN_COUNT; ++i)
+    {
+        if(job_next(worker, out_value))
+        {
+            return true;
+        }
+        platform_cpu_pause();
+    }
+    return false;
+}
+
+// Усыпляет поток до добавления задач (или обнуления счетчика, если он указан).
+static void job_sleep(job_worker* worker, job_counter* counter)
+{
+    if(counter)
+    {
+        platform_atomic_fetch_add_u32(&context->waiting, 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+    }
+    platform_atomic_fetch_add_u32(&context->sleeping, 1, PLATFORM_MEMORY_ORDER_SEQ_CST);
+
+    u32 epoch = platform_atomic_load_u32(&context->wake_epoch, PLATFORM_MEMORY_ORDER_SEQ_CST);
+    bool sleep = platform_atomic_load_u32(&context->running, PLATFORM_MEMORY_ORDER_ACQUIRE)
+              && !job_available(worker)
+              && (!counter || platform_atomic_load_u32(&counter->value, PLATFORM_MEMORY_ORDER_SEQ_CST) != 0);
+
+    if(sleep)
+    {
+        platform_address_wait(&context->wake_epoch, epoch, PLATFORM_WAIT_INFINITE);
+    }
+
+    platform_atomic_fetch_sub_u32(&context->sleeping, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    if(counter)
+    {
+        platform_atomic_fetch_sub_u32(&context->waiting, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+// Исполнитель волокна пула: продолжает готовые приостановленные волокна и выполняет задачи.
+static void job_fiber_main(void* data)
+{
+    UNUSED(data);
+    job_fiber_resume();
+
+    job value;
+    while(platform_atomic_load_u32(&context->running, PLATFORM_MEMORY_ORDER_ACQUIRE))
+    {
+        job_worker* worker = job_worker_current();
+
+        // Текущее волокно возвращается в пул: приостановленное продолжит выполнение своей задачи.
+        job_fiber* ready = job_fiber_ready(true);
+        if(ready)
+        {
+            job_fiber_switch(worker, ready, JOB_FIBER_ACTION_RELEASE);
+        }
+        else if(job_next_spin(worker, &value))
+        {
+            job_execute(&value);
+        }
+        else
+        {
+            job_sleep(worker, nullptr);
+        }
+    }
+
+    // Возврат в поток, выполняющий волокно, для его завершения.
+    job_fiber_switch(job_worker_current(), nullptr, JOB_FIBER_ACTION_RELEASE);
+}
+
+// Ожидает счетчик в задаче, выполняемой на волокне пула.
+static void job_fiber_wait(job_counter* counter)
+{
+    job value;
+    while(platform_atomic_load_u32(&counter->value, PLATFORM_MEMORY_ORDER_ACQUIRE) != 0)
+    {
+        job_worker* worker = job_worker_current();
+
+        job_fiber* next = job_fiber_ready(true);
+        if(!next)
+        {
+            next = job_fiber_acquire();
+        }
+
+        if(next)
+        {
+            worker->fiber->counter = counter;
+            job_fiber_switch(worker, next, JOB_FIBER_ACTION_WAIT);
+        }
+        // Свободных волокон нет: ожидание с выполнением задач на текущем волокне.
+        else if(job_next_spin(worker, &value))
+        {
+            job_execute(&value);
+        }
+        else
+        {
+            job_sleep(worker, counter);
+        }
+    }
+}
+
+static u32 job_worker_main(void* data)
+{
+    job_worker* worker = data;
+    current_worker = worker;
+
+    if(worker->cpu != U32_MAX)
+    {
+        u16 cpu = (u16)worker->cpu;
+        if(!platform_thread_set_affinity(&cpu, 1))
+        {
+            LOG_WARN("Failed to pin job worker %u to CPU %u.", worker->index, worker->cpu);
+        }
+    }
+
+    // В режиме волокон поток переключается на волокно пула и возвращается при остановке системы.
+    if(context->fibers)
+    {
+        job_fiber* fiber = nullptr;
+        worker->thread_fiber = platform_fiber_convert_thread();
+
+        if(worker->thread_fiber && (fiber = job_fiber_acquire()) != nullptr)
+        {
+            job_fiber_switch(worker, fiber, JOB_FIBER_ACTION_NONE);
+            platform_fiber_convert_fiber(worker->thread_fiber);
+            worker->thread_fiber = nullptr;
+            current_worker = nullptr;
+            return 0;
+        }
+
+        LOG_WARN("Job worker %u failed to enter fiber mode, running jobs on thread stack.", worker->index);
+        if(worker->thread_fiber)
+        {
+            platform_fiber_convert_fiber(worker->thread_fiber);
+            worker->thread_fiber = nullptr;
+        }
+    }
+
+    job value;
+    while(platform_atomic_load_u32(&context->running, PLATFORM_MEMORY_ORDER_ACQUIRE))
+    {
+        if(job_next_spin(worker, &value))
+        {
+            job_execute(&value);
+        }
+        else
+        {
+            job_sleep(worker, nullptr);
+        }
+    }
+
+    current_worker = nullptr;
+    return 0;
+}
+
+// Добавляет задачу в очередь основного потока, ожидая освобождения места.
+static void job_main_queue_push(const job* value)
+{
+    while(!mpmc_queue_push(&context->main_queue, value))
+    {
+        // Основной поток может освободить очередь сам.
+        if(current_worker && current_worker->index == 0)
+        {
+            job_system_main_update();
+        }
+        else
+        {
+            platform_thread_yield();
+        }
+    }
+}
+
+// Порядок заполнения логических процессоров потоками: сначала первые потоки SMT (отдельные ядра),
+// производительные ядра раньше энергоэффективных, соседние потоки - на одном узле NUMA и сокете.
+static bool job_cpu_before(const platform_cpu_logical* a, const platform_cpu_logical* b)
+{
+    if(a->smt_index != b->smt_index)
+    {
+        return a->smt_index < b->smt_index;
+    }
+
+    bool a_efficiency = a->core_type == PLATFORM_CPU_CORE_TYPE_EFFICIENCY;
+    bool b_efficiency = b->core_type == PLATFORM_CPU_CORE_TYPE_EFFICIENCY;
+    if(a_efficiency != b_efficiency)
+    {
+        return b_efficiency;
+    }
+
+    if(a->numa_node != b->numa_node)
+    {
+        return a->numa_node < b->numa_node;
+    }
+
+    if(a->package != b->package)
+    {
+        return a->package < b->package;
+    }
+
+    return a->id < b->id;
+}
+
+// Назначает процессоры основному и рабочим потокам.
+// NOTE: Основной поток привязывается только после создания рабочих потоков (job_main_thread_pin),
+//       иначе рабочие потоки унаследуют его привязку и приоритет.
+static void job_threads_place()
+{
+    platform_cpu_info_t* info = mallocate(sizeof(platform_cpu_info_t), MEMORY_TAG_SYSTEM);
+    if(!info)
+    {
+        return;
+    }
+
+    if(!platform_cpu_info(info) || info->physical_count < 2)
+    {
+        LOG_TRACE("Job threads are not pinned: CPU topology is unavailable or has a single core.");
+        mfree(info, sizeof(platform_cpu_info_t), MEMORY_TAG_SYSTEM);
+        return;
+    }
+
+    // Сортировка вставками: логических процессоров немного, порядок детерминирован.
+    platform_cpu_logical* order = info->logical;
+    for(u32 i = 1; i < info->logical_count; ++i)
+    {
+        platform_cpu_logical value = order[i];
+        u32 j = i;
+        while(j > 0 && job_cpu_before(&value, &order[j - 1]))
+        {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = value;
+    }
+
+    // Основной поток (он же поток рендерера) занимает отдельное ядро, но не ядро процессора 0: на нем
+    // система по умолчанию обрабатывает большую часть прерываний и фоновых задач.
+    u16 noisy_cpu = U16_MAX;
+    u16 noisy_core = U16_MAX;
+    for(u32 i = 0; i < info->logical_count; ++i)
+    {
+        if(order[i].id < noisy_cpu)
+        {
+            noisy_cpu = order[i].id;
+            noisy_core = order[i].core;
+        }
+    }
+
+    const platform_cpu_logical* main_cpu = &order[0];
+    for(u32 i = 0; i < info->logical_count; ++i)
+    {
+        if(order[i].core != noisy_core)
+        {
+            main_cpu = &order[i];
+            break;
+        }
+    }
+
+    context->main_cpu = main_cpu->id;
+
+    // Рабочие потоки занимают остальные процессоры по порядку, кроме ядра основного потока (включая его
+    // потоки SMT). Лишние рабочие потоки не привязываются, чтобы не делить процессор с другим рабочим.
+    u32 worker = 1;
+    for(u32 i = 0; i < info->logical_count && worker < context->thread_count; ++i)
+    {
+        if(order[i].core != main_cpu->core)
+        {
+            context->workers[worker++].cpu = order[i].id;
+        }
+    }
+
+    LOG_TRACE("Job threads placed: main thread to CPU %u, %u of %u workers to separate CPUs.",
+        main_cpu->id, worker - 1, context->worker_count
+    );
+    mfree(info, sizeof(platform_cpu_info_t), MEMORY_TAG_SYSTEM);
+}
+
+// Привязывает основной поток к назначенному процессору и повышает его приоритет.
+static void job_main_thread_pin()
+{
+    u16 cpu = (u16)context->main_cpu;
+    if(!platform_thread_set_affinity(&cpu, 1))
+    {
+        LOG_WARN("Failed to pin main thread to CPU %u.", context->main_cpu);
+        return;
+    }
+
+    context->main_pinned = true;
+    context->workers[0].cpu = context->main_cpu;
+
+    if(!platform_thread_set_priority(PLATFORM_THREAD_PRIORITY_HIGH))
+    {
+        LOG_TRACE("Main thread priority is not raised: insufficient permissions.");
+    }
+}
+
+// Создает пул волокон.
+static bool job_fiber_pool_create(u32 fiber_count, u64 stack_size)
+{
+    context->fiber_count = fiber_count;
+    context->fibers = mallocate(sizeof(job_fiber) * fiber_count, MEMORY_TAG_SYSTEM);
+    context->waiting_fibers = mallocate(sizeof(job_fiber*) * fiber_count, MEMORY_TAG_SYSTEM);
+
+    if(!context->fibers || !context->waiting_fibers)
+    {
+        return false;
+    }
+    mzero(context->fibers, sizeof(job_fiber) * fiber_count);
+
+    if(!mpmc_queue_create(sizeof(job_fiber*), fiber_count, &context->free_fibers))
+    {
+        return false;
+    }
+
+    for(u32 i = 0; i < fiber_count; ++i)
+    {
+        job_fiber* fiber = &context->fibers[i];
+        fiber->fiber = platform_fiber_create(job_fiber_main, nullptr, stack_size);
+        if(!fiber->fiber)
+        {
+            return false;
+        }
+        mpmc_queue_push(&context->free_fibers, &fiber);
+    }
+
+    return true;
+}
+
+// Уничтожает пул волокон (в том числе частично созданный).
+static void job_fiber_pool_destroy()
+{
+    if(context->waiting_fiber_count > 0)
+    {
+        LOG_WARN("Job system shutdown with %u jobs waiting on fibers.", context->waiting_fiber_count);
+    }
+
+    if(context->fibers)
+    {
+        for(u32 i = 0; i < context->fiber_count; ++i)
+        {
+            if(context->fibers[i].fiber)
+            {
+                platform_fiber_destroy(context->fibers[i].fiber);
+            }
+        }
+        mfree(context->fibers, sizeof(job_fiber) * context->fiber_count, MEMORY_TAG_SYSTEM);
+        context->fibers = nullptr;
+    }
+
+    if(context->waiting_fibers)
+    {
+        mfree(context->waiting_fibers, sizeof(job_fiber*) * context->fiber_count, MEMORY_TAG_SYSTEM);
+        context->waiting_fibers = nullptr;
+    }
+
+    if(context->free_fibers.cells)
+    {
+        mpmc_queue_destroy(&context->free_fibers);
+    }
+}
+
+bool job_system_initialize(const job_system_config* config)
+{
+    ASSERT(context == nullptr, "Job system is already initialized.");
+
+    u32 worker_count = config ? config->worker_count : 0;
+    if(worker_count == 0)
+    {
+        worker_count = platform_processor_count() - 1;
+    }
+    worker_count = MIN(worker_count, (u32)JOB_SYSTEM_MAX_WORKERS);
+
+    context = memory_allocate(sizeof(job_system_context), PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_SYSTEM);
+    if(!context)
+    {
+        LOG_ERROR("Failed to allocate memory for job system to initialize.");
+        return false;
+    }
+    mzero(context, sizeof(job_system_context));
+
+    context->worker_count = worker_count;
+    context->thread_count = worker_count + 1;
+    context->main_cpu = U32_MAX;
+    context->running = 1;
+
+    context->workers = memory_allocate(sizeof(job_worker) * context->thread_count, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_SYSTEM);
+    if(!context->workers)
+    {
+        LOG_ERROR("Failed to allocate memory for job workers.");
+        memory_free(context, sizeof(job_system_context), MEMORY_TAG_SYSTEM);
+        context = nullptr;
+        return false;
+    }
+    mzero(context->workers, sizeof(job_worker) * context->thread_count);
+
+    bool success = mpmc_queue_create(sizeof(job), JOB_SYSTEM_QUEUE_CAPACITY, &context->global_queue)
+                && mpmc_queue_create(sizeof(job), JOB_SYSTEM_QUEUE_CAPACITY, &context->main_queue);
+
+    for(u32 i = 0; success && i < context->thread_count; ++i)
+    {
+        job_worker* worker = &context->workers[i];
+        worker->index = i;
+        worker->random = 0x9E3779B9U * (i + 1);
+        worker->cpu = U32_MAX;
+        worker->deque.jobs = memory_allocate(sizeof(job) * JOB_SYSTEM_QUEUE_CAPACITY, PLATFORM_CACHE_LINE_SIZE, MEMORY_TAG_QUEUE);
+        success = worker->deque.jobs != nullptr;
+    }
+
+    if(!success)
+    {
+        LOG_ERROR("Failed to allocate memory for job queues.");
+        job_system_shutdown();
+        return false;
+    }
+
+    // Режим волокон имеет смысл только при наличии рабочих потоков: каждому нужно волокно для выполнения
+    // задач и хотя бы одно свободное волокно для переключения при ожидании.
+    u32 fiber_count = config && worker_count > 0 ? config->fiber_count : 0;
+    if(fiber_count > 0)
+    {
+        fiber_count = MIN(MAX(fiber_count, worker_count + 1), (u32)JOB_SYSTEM_MAX_FIBERS);
+        if(!job_fiber_pool_create(fiber_count, config->fiber_stack_size))
+        {
+            LOG_ERROR("Failed to create job fiber pool.");
+            job_system_shutdown();
+            return false;
+        }
+    }
+
+    // Основной поток.
+    current_worker = &context->workers[0];
+
+    if(config && config->pin_threads)
+    {
+        job_threads_place();
+    }
+
+    for(u32 i = 1; i < context->thread_count; ++i)
+    {
+        char name[PLATFORM_THREAD_NAME_MAX + 1];
+        string_builder builder;
+        string_builder_create_buffer(name, sizeof(name), &builder);
+        string_builder_append(&builder, "job_worker_");
+        string_builder_append_u64(&builder, i);
+
+        if(!platform_thread_create(job_worker_main, &context->workers[i], name, &context->workers[i].thread))
+        {
+            LOG_ERROR("Failed to create job worker thread %u.", i);
+            job_system_shutdown();
+            return false;
+        }
+    }
+
+    if(context->main_cpu != U32_MAX)
+    {
+        job_main_thread_pin();
+    }
+
+    LOG_TRACE("Job system started with %u worker threads and %u fibers.", worker_count, context->fiber_count);
+    return true;
+}
+
+void job_system_shutdown()
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+
+    platform_atomic_store_u32(&context->running, 0, PLATFORM_MEMORY_ORDER_RELEASE);
+    job_wake(U32_MAX);
+
+    for(u32 i = 1; i < context->thread_count; ++i)
+    {
+        if(context->workers[i].thread.handle)
+        {
+            platform_thread_join(&context->workers[i].thread, nullptr);
+        }
+    }
+
+    // Выполнение оставшихся задач в основном потоке.
+    if(context->global_queue.cells && context->main_queue.cells)
+    {
+        job value;
+        while(job_next(current_worker, &value) || mpmc_queue_pop(&context->main_queue, &value))
+        {
+            job_execute(&value);
+        }
+    }
+
+    for(u32 i = 0; i < context->thread_count; ++i)
+    {
+        if(context->workers[i].deque.jobs)
+        {
+            memory_free(context->workers[i].deque.jobs, sizeof(job) * JOB_SYSTEM_QUEUE_CAPACITY, MEMORY_TAG_QUEUE);
+        }
+    }
+
+    if(context->global_queue.cells)
+    {
+        mpmc_queue_destroy(&context->global_queue);
+    }
+
+    if(context->main_queue.cells)
+    {
+        mpmc_queue_destroy(&context->main_queue);
+    }
+
+    if(context->fiber_count > 0)
+    {
+        job_fiber_pool_destroy();
+    }
+
+    if(context->main_pinned)
+    {
+        platform_thread_set_affinity(nullptr, 0);
+        platform_thread_set_priority(PLATFORM_THREAD_PRIORITY_NORMAL);
+    }
+
+    memory_free(context->workers, sizeof(job_worker) * context->thread_count, MEMORY_TAG_SYSTEM);
+    memory_free(context, sizeof(job_system_context), MEMORY_TAG_SYSTEM);
+    context = nullptr;
+    current_worker = nullptr;
+}
+
+bool job_system_is_initialized()
+{
+    return context != nullptr;
+}
+
+u32 job_system_worker_count()
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+    return context->worker_count;
+}
+
+u32 job_system_thread_index()
+{
+    return current_worker ? current_worker->index : U32_MAX;
+}
+
+void job_system_main_update()
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+    ASSERT(current_worker == &context->workers[0], "Main thread queue must be processed by the main thread.");
+
+    // NOTE: Выполняются только задачи, добавленные до вызова, чтобы повторно добавляющая себя задача
+    //       не блокировала кадр.
+    u64 count = mpmc_queue_length(&context->main_queue);
+    job value;
+
+    for(u64 i = 0; i < count && mpmc_queue_pop(&context->main_queue, &value); ++i)
+    {
+        job_execute(&value);
+    }
+}
+
+void job_run(const job_decl* jobs, u32 count, job_counter* counter)
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+    ASSERT(jobs != nullptr || count == 0, "Jobs pointer must be non-null.");
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    if(counter)
+    {
+        platform_atomic_fetch_add_u32(&counter->value, count, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    job_worker* worker = current_worker;
+    for(u32 i = 0; i < count; ++i)
+    {
+        ASSERT(jobs[i].func != nullptr, "Job function must be non-null.");
+
+        job value = { .func = jobs[i].func, .data = jobs[i].data, .counter = counter };
+        bool queued = false;
+
+        if(context->worker_count > 0)
+        {
+            queued = worker ? job_deque_push(&worker->deque, &value) : mpmc_queue_push(&context->global_queue, &value);
+        }
+
+        // Нет рабочих потоков или очередь заполнена: задача выполняется сразу.
+        if(!queued)
+        {
+            job_execute(&value);
+        }
+    }
+
+    if(context->worker_count > 0)
+    {
+        job_notify(count);
+    }
+}
+
+void job_run_single(job_fn func, void* data, job_counter* counter)
+{
+    job_decl decl = { .func = func, .data = data };
+    job_run(&decl, 1, counter);
+}
+
+void job_run_main(job_fn func, void* data, job_counter* counter)
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+    ASSERT(func != nullptr, "Job function must be non-null.");
+
+    if(counter)
+    {
+        platform_atomic_fetch_add_u32(&counter->value, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    job value = { .func = func, .data = data, .counter = counter };
+    job_main_queue_push(&value);
+
+    // Основной поток может спать в ожидании счетчика.
+    platform_atomic_thread_fence(PLATFORM_MEMORY_ORDER_SEQ_CST);
+    if(platform_atomic_load_u32(&context->waiting, PLATFORM_MEMORY_ORDER_RELAXED) > 0)
+    {
+        job_wake(U32_MAX);
+    }
+}
+
+void job_wait(job_counter* counter)
+{
+    ASSERT(context != nullptr, "Job system not initialized. Call job_system_initialize() first.");
+    ASSERT(counter != nullptr, "Counter pointer must be non-null.");
+
+    job_worker* worker = current_worker;
+    if(worker && worker->fiber)
+    {
+        job_fiber_wait(counter);
+        return;
+    }
+
+    bool main_thread = worker && worker->index == 0;
+    job value;
+
+    while(platform_atomic_load_u32(&counter->value, PLATFORM_MEMORY_ORDER_ACQUIRE) != 0)
+    {
+        if(job_next_spin(worker, &value) || (main_thread && mpmc_queue_pop(&context->main_queue, &value)))
+        {
+            job_execute(&value);
+        }
+        else
+        {
+            job_sleep(worker, counter);
+        }
+    }
+}
+
+bool job_counter_done(const job_counter* counter)
+{
+    ASSERT(counter != nullptr, "Counter pointer must be non-null.");
+    return platform_atomic_load_u32(&counter->value, PLATFORM_MEMORY_ORDER_ACQUIRE) == 0;
+}
@@ -0,0 +1,181 @@
+/*
+    @file job.h
+    @brief Интерфейс системы задач с распределением работы между потоками (work stealing).
+    @author Дмитрий Скляр.
+    @version 1.2
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Запуск пакетов задач на рабочих потоках (по одному на логический процессор)
+            - Счетчики задач для выражения зависимостей: ожидание счетчика (job_wait) выполняет
+              готовые задачи вместо простоя
+            - Очередь задач основного потока (например, для вызовов рендерера)
+            - Необязательный режим волокон: задача рабочего потока, ожидающая счетчик, приостанавливается
+              и освобождает поток для других задач
+
+    @note Особенности реализации:
+            - У каждого рабочего и основного потока собственная деква Chase-Lev: владелец добавляет
+              и извлекает задачи с одного конца без блокировок, свободные потоки забирают задачи
+              с другого конца дек других потоков
+            - Задачи из потоков, не принадлежащих системе, попадают в общую очередь (mpmc_queue)
+            - Задача хранится в деке по значению (функция, данные, счетчик), выделений памяти нет
+            - При переполнении деки или очереди задача выполняется сразу в вызывающем потоке
+            - Простаивающие рабочие потоки засыпают на ожидании по адресу и пробуждаются при добавлении задач
+            - Без рабочих потоков (один процессор) задачи выполняются сразу при запуске
+            - В режиме волокон рабочие потоки выполняют задачи на волокнах из пула (стеки с защитной страницей):
+              job_wait() переключает поток на свободное волокно, а ожидающее волокно продолжается любым рабочим
+              потоком после обнуления счетчика; основной поток и потоки вне системы ожидают как в обычном режиме
+            - Если свободных волокон нет, задача ожидает счетчик, выполняя другие задачи на своем волокне
+            - При привязке потоков основной поток (поток рендерера) получает отдельное ядро вне ядра процессора 0
+              и повышенный приоритет (если позволяют права), рабочие потоки занимают остальные процессоры:
+              сначала отдельные производительные ядра, затем энергоэффективные, затем потоки SMT
+
+    @warning В режиме волокон задача после job_wait() может продолжиться в другом рабочем потоке:
+             thread-local данные, полученные до ожидания, нельзя использовать после него.
+
+    @note Для корректной работы необходимо предварительно инициализировать (в указанном порядке):
+            - Подсистему консоли platform_console_initialize()
+            - Подсистему памяти platform_memory_initialize()
+            - Подсистему потоков platform_thread_initialize()
+            - Систему памяти memory_system_initialize()
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Максимальное количество рабочих потоков.
+#define JOB_SYSTEM_MAX_WORKERS     64
+
+// @brief Емкость деки задач одного потока и общей очереди задач.
+#define JOB_SYSTEM_QUEUE_CAPACITY  4096
+
+// @brief Максимальное количество волокон в режиме волокон.
+#define JOB_SYSTEM_MAX_FIBERS      1024
+
+/*
+    @brief Функция задачи.
+    @param data Данные задачи.
+*/
+typedef void (*job_fn)(void* data);
+
+// @brief Описание задачи.
+typedef struct job_decl {
+    // @brief Функция задачи.
+    job_fn func;
+    // @brief Данные задачи.
+    void* data;
+} job_decl;
+
+// @brief Счетчик незавершенных задач (обнуленный счетчик готов к использованию).
+typedef struct job_counter {
+    // @brief Количество незавершенных задач.
+    u32 value;
+} job_counter;
+
+// @brief Конфигурация системы задач.
+typedef struct job_system_config {
+    // @brief Количество рабочих потоков (0 - по количеству логических процессоров без основного потока).
+    u32 worker_count;
+    // @brief Количество волокон пула (0 - режим волокон выключен, иначе не меньше количества рабочих потоков + 1
+    //        и не больше JOB_SYSTEM_MAX_FIBERS; без рабочих потоков режим не используется).
+    u32 fiber_count;
+    // @brief Размер стека волокна в байтах (0 - PLATFORM_FIBER_DEFAULT_STACK_SIZE).
+    u64 fiber_stack_size;
+    // @brief Привязать основной и рабочие потоки к логическим процессорам по топологии процессора.
+    bool pin_threads;
+} job_system_config;
+
+/*
+    @brief Инициализирует систему задач и запускает рабочие потоки.
+    @note Поток, вызвавший инициализацию, считается основным.
+    @warning Не thread-safe. Должна вызываться из основного потока.
+    @param config Указатель на конфигурацию системы (может быть nullptr для настроек по умолчанию).
+    @return true - инициализация успешна, false - произошла ошибка.
+*/
+bool job_system_initialize(const job_system_config* config);
+
+/*
+    @brief Завершает работу системы задач: выполняет оставшиеся задачи и останавливает рабочие потоки.
+    @warning Не thread-safe. Должна вызываться из основного потока.
+*/
+void job_system_shutdown();
+
+/*
+    @brief Проверяет, была ли инициализирована система задач.
+    @return true - система инициализирована и готова к работе, false - система не инициализирована.
+*/
+CORE_API bool job_system_is_initialized();
+
+/*
+    @brief Возвращает количество рабочих потоков (без основного).
+    @return Количество рабочих потоков.
+*/
+CORE_API u32 job_system_worker_count();
+
+/*
+    @brief Возвращает индекс текущего потока в системе задач.
+    @note Thread-safe.
+    @return 0 - основной поток, 1..job_system_worker_count() - рабочие потоки, U32_MAX - поток вне системы.
+*/
+CORE_API u32 job_system_thread_index();
+
+/*
+    @brief Выполняет задачи очереди основного потока.
+    @note Вызывается приложением в каждой итерации главного цикла.
+    @warning Должна вызываться из основного потока.
+*/
+void job_system_main_update();
+
+/*
+    @brief Запускает пакет задач.
+    @note Thread-safe. Описания задач копируются, массив может быть освобожден сразу после вызова.
+    @param jobs Указатель на массив описаний задач.
+    @param count Количество задач.
+    @param counter Указатель на счетчик, увеличиваемый на count и уменьшаемый по завершении каждой задачи
+                   (может быть nullptr). Счетчик должен оставаться действительным до завершения задач.
+*/
+CORE_API void job_run(const job_decl* jobs, u32 count, job_counter* counter);
+
+/*
+    @brief Запускает одну задачу.
+    @note Thread-safe.
+    @param func Функция задачи.
+    @param data Данные задачи.
+    @param counter Указатель на счетчик (может быть nullptr).
+*/
+CORE_API void job_run_single(job_fn func, void* data, job_counter* counter);
+
+/*
+    @brief Добавляет задачу в очередь основного потока (выполняется в job_system_main_update()).
+    @note Thread-safe. Предназначена для операций, допустимых только в основном потоке (рендерер, окно).
+    @param func Функция задачи.
+    @param data Данные задачи.
+    @param counter Указатель на счетчик (может быть nullptr).
+*/
+CORE_API void job_run_main(job_fn func, void* data, job_counter* counter);
+
+/*
+    @brief Ожидает обнуления счетчика, выполняя готовые задачи в текущем потоке.
+    @note Thread-safe. Может вызываться из задачи.
+    @note В основном потоке также выполняются задачи очереди основного потока.
+    @note В режиме волокон задача рабочего потока приостанавливается, а поток выполняет другие задачи
+          на другом волокне.
+    @param counter Указатель на счетчик.
+*/
+CORE_API void job_wait(job_counter* counter);
+
+/*
+    @brief Проверяет, завершены ли все задачи счетчика.
+    @param counter Указатель на счетчик.
+    @return true - счетчик обнулен, false - есть незавершенные задачи.
+*/
+CORE_API bool job_counter_done(const job_counter* counter);
@@ -1,5 +1,6 @@
 #include "core/logger.h"
 #include "core/string.h"
+#include "core/string_builder.h"
 #include "core/memory.h"
 #include "debug/assert.h"
 #include "platform/console.h"
@@ -10,8 +11,13 @@
 // TODO: Потокобезопасность!
 
 // Размер стекового буфера.
+// NOTE: Сообщения длиннее буфера форматируются повторно в памяти из кучи.
 #define BUFFER_SIZE 1024
 
+// Размер стекового буфера строки обработчика по умолчанию (цвет, заголовок, сообщение и сброс цвета).
+// NOTE: Сообщение и строка вместе занимают около 2 КиБ стека, что допустимо и в волокнах системы задач.
+#define LINE_BUFFER_SIZE (BUFFER_SIZE + 256)
+
 typedef struct log_system_context {
     log_level_t level;
     log_handler_callback handler;
@@ -63,24 +69,35 @@ void log_write(log_level_t level, const char* file, u32 line, const char* format
     if(context.handler && level <= context.level)
     {
         // Внутренний буфер (стековый для потоко-безопасности).
+        // NOTE: Построитель над буфером не обращается к платформенному слою памяти, поэтому сообщения
+        //       можно писать до инициализации и после завершения подсистемы памяти.
         char internal_buffer[BUFFER_SIZE];
-        void* buffer = internal_buffer;
+        string_builder builder;
+        string_builder_create_buffer(internal_buffer, BUFFER_SIZE, &builder);
 
         // NOTE: Особенность определения va_list для Linux и Windows.
         __builtin_va_list args;
         va_start(args, format);
 
-        // Получение размера строки.
-        i32 buffer_length = string_format_va(nullptr, 0, format, args) + 1;
-        if(buffer_length > BUFFER_SIZE)
+        // Форматирование сообщения за один проход (без предварительного вычисления длины).
+        __builtin_va_list args_retry;
+        va_copy(args_retry, args);
+        string_builder_append_format_va(&builder, format, args);
+
+        // Редкий случай: сообщение не поместилось в стековый буфер.
+        char* heap_buffer = nullptr;
+        u64 heap_size = builder.required + 1;
+        if(string_builder_truncated(&builder) && memory_system_is_initialized())
         {
-            // TODO: Использовать линейный распределитель или пул памяти.
-            buffer = mallocate(buffer_length, MEMORY_TAG_STRING);
+            heap_buffer = mallocate(heap_size, MEMORY_TAG_STRING);
+            if(heap_buffer)
+            {
+                string_builder_create_buffer(heap_buffer, heap_size, &builder);
+                string_builder_append_format_va(&builder, format, args_retry);
+            }
         }
 
-        // Форматирование сообщения.
-        string_format_va(buffer, buffer_length, format, args);
-
+        va_end(args_retry);
         va_end(args);
 
         log_message_t msg = {
@@ -88,18 +105,17 @@ void log_write(log_level_t level, const char* file, u32 line, const char* format
             .filename_length = string_length(file),
             .fileline        = line,
             .level           = level,
-            .message         = buffer,
-            .message_length  = buffer_length,
+            .message         = builder.data,
+            .message_length  = builder.length,
             .timestamp       = platform_time_now(),
             .user_data       = context.user_data
         };
 
         context.handler(&msg);
 
-        if(buffer_length > BUFFER_SIZE)
+        if(heap_buffer)
         {
-            // TODO: Использовать линейный распределитель или пул памяти.
-            mfree(buffer, buffer_length, MEMORY_TAG_STRING);
+            mfree(heap_buffer, heap_size, MEMORY_TAG_STRING);
         }
     }
 
@@ -109,7 +125,8 @@ void log_write(log_level_t level, const char* file, u32 line, const char* format
     }
 }
 
-void log_default_handler(const log_message_t* message)
+// Добавляет строку сообщения обработчика по умолчанию: цвет, заголовок, текст сообщения и сброс цвета.
+static void log_default_format_line(string_builder* builder, const log_message_t* message, const platform_datetime* dt)
 {
     // Текстовые метки сообщений в соответствии с уровнем по умолчанию.
     static const char* levels[LOG_LEVEL_COUNT] = {
@@ -124,52 +141,64 @@ void log_default_handler(const log_message_t* message)
         [LOG_LEVEL_DEBUG] = CONSOLE_COLOR_BLUE,    [LOG_LEVEL_TRACE] = CONSOLE_COLOR_GRAY
     };
 
-    // Формат сообщения по умолчанию.
-    // static const char* format_message = "%hu-%02hhu-%02hhu %02hhu:%02hhu:%02hhu %s (%s:%-3u): %s\n";
-    static const char* format_message = "%02hhu:%02hhu:%02hhu %s (%s:%-3u): %s\n";
+    // Формат сообщения по умолчанию (цвет, заголовок, текст сообщения и сброс цвета).
+    // static const char* format_message = "\033[%sm%hu-%02hhu-%02hhu %02hhu:%02hhu:%02hhu %s (%s:%-3u): %.*s\033[0m\n";
+    static const char* format_message = "\033[%sm%02hhu:%02hhu:%02hhu %s (%s:%-3u): %.*s\033[0m\n";
 
+    // string_builder_append_format(builder, format_message, platform_console_color_code(colors[message->level]),
+    //     dt->year, dt->month, dt->day, dt->hour, dt->minute, dt->second, levels[message->level], message->filename,
+    //     message->fileline, (i32)message->message_length, message->message
+    // );
+    string_builder_append_format(builder, format_message, platform_console_color_code(colors[message->level]),
+        dt->hour, dt->minute, dt->second, levels[message->level], message->filename, message->fileline,
+        (i32)message->message_length, message->message
+    );
+}
+
+void log_default_handler(const log_message_t* message)
+{
     // Кешированная дата.
     static platform_datetime dt;
     static u64 ts = 0;
 
-    // Внутренний буфер (стековый для потоко-безопасности).
-    char internal_buffer[BUFFER_SIZE];
-    void* buffer = internal_buffer;
-
-    // Получение размера буфера сообщения.
-    u32 buffer_length = message->filename_length + message->message_length + 60;
-    if(buffer_length > BUFFER_SIZE)
-    {
-        // TODO: Использовать линейный распределитель или пул памяти.
-        buffer = mallocate(buffer_length, MEMORY_TAG_STRING);
-    }
-
     if(ts < message->timestamp)
     {
         ts = message->timestamp;
         dt = platform_time_to_local(message->timestamp);
     }
 
-    // Копирование сообщения в буфер.
-    // string_format(buffer, buffer_length, format_message, dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second,
-    //     levels[message->level], message->filename, message->fileline, message->message
-    // );
-    string_format(buffer, buffer_length, format_message, dt.hour, dt.minute, dt.second, levels[message->level],
-        message->filename, message->fileline, message->message
-    );
-
-    if(message->level <= LOG_LEVEL_ERROR)
+    // NOTE: Строка собирается целиком вместе с управляющими последовательностями цвета и выводится одной записью,
+    //       поэтому строки рабочих потоков не перемешиваются.
+    char line_buffer[LINE_BUFFER_SIZE];
+    string_builder builder;
+    string_builder_create_buffer(line_buffer, LINE_BUFFER_SIZE, &builder);
+    log_default_format_line(&builder, message, &dt);
+
+    // Редкий случай: строка не поместилась в стековый буфер.
+    char* heap_buffer = nullptr;
+    u64 heap_size = builder.required + 1;
+    if(string_builder_truncated(&builder) && memory_system_is_initialized())
     {
-        platform_console_write(CONSOLE_STREAM_STDERR, colors[message->level], buffer);
+        heap_buffer = mallocate(heap_size, MEMORY_TAG_STRING);
+        if(heap_buffer)
+        {
+            string_builder_create_buffer(heap_buffer, heap_size, &builder);
+            log_default_format_line(&builder, message, &dt);
+        }
     }
-    else
+
+    console_stream_t stream = message->level <= LOG_LEVEL_ERROR ? CONSOLE_STREAM_STDERR : CONSOLE_STREAM_STDOUT;
+    platform_console_write_raw(stream, builder.data, builder.length);
+
+    // NOTE: Усеченная строка (без памяти для повторного форматирования) завершается сбросом цвета отдельно.
+    if(string_builder_truncated(&builder))
     {
-        platform_console_write(CONSOLE_STREAM_STDOUT, colors[message->level], buffer);
+        static const char reset[] = "\033[0m\n";
+        platform_console_write_raw(stream, reset, sizeof(reset) - 1);
     }
 
-    if(buffer_length > BUFFER_SIZE)
+    if(heap_buffer)
     {
-        // TODO: Использовать линейный распределитель или пул памяти.
-        mfree(buffer, buffer_length, MEMORY_TAG_STRING);
+        mfree(heap_buffer, heap_size, MEMORY_TAG_STRING);
     }
 }
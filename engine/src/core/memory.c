@@ -1,33 +1,615 @@
 #include "core/memory.h"
+#include "core/allocators/linear_allocator.h"
+#include "core/allocators/pool_allocator.h"
+#include "core/allocators/stack_allocator.h"
+#include "core/allocators/tlsf_allocator.h"
 #include "core/logger.h"
-#include "core/string.h"
+#include "core/memory_profiler.h"
+#include "core/string_builder.h"
 #include "core/timer.h"
 #include "debug/assert.h"
 #include "platform/memory.h"
+#include "platform/thread.h"
 
+// Метка действительного заголовка выделенного блока.
+#define MEMORY_HEADER_MAGIC_ALLOCATED 0xA110U
+// Метка заголовка освобожденного блока (для обнаружения повторного освобождения).
+#define MEMORY_HEADER_MAGIC_FREED     0xF4EEU
+
+// Заголовок выделенного блока, располагается непосредственно перед блоком пользователя.
+// NOTE: Хранит все необходимое для освобождения, поэтому выравнивание не требуется передавать в memory_free.
+typedef struct memory_header {
+    // Запрошенный размер блока в байтах.
+    u64 size;
+    // Метка проверки целостности заголовка.
+    u16 magic;
+    // Смещение блока пользователя от начала выделенной памяти.
+    u16 offset;
+    // Тег памяти выделенного блока.
+    u8 tag;
+    // Источник выделенной памяти (см. memory_source).
+    u8 source;
+    // Индекс места вызова в профилировщике (MEMORY_PROFILER_INVALID_SITE, если профилирование выключено).
+    u16 site;
+} memory_header;
+
+// Источник памяти блока, определяет способ его освобождения.
+typedef enum memory_source {
+    // Память выделена платформой.
+    MEMORY_SOURCE_PLATFORM,
+    // Память выделена из пула размерного класса.
+    MEMORY_SOURCE_POOL,
+    // Память выделена распределителем TLSF.
+    MEMORY_SOURCE_TLSF,
+    // Большой блок отображен платформой на обычных страницах.
+    MEMORY_SOURCE_LARGE,
+    // Большой блок отображен платформой с рекомендацией больших страниц.
+    MEMORY_SOURCE_HUGE,
+} memory_source;
+
+// Минимальный размер блока пула (размерный класс 0).
+#define MEMORY_POOL_MIN_BLOCK_SIZE 32
+// Количество размерных классов пулов (степени двойки от 32 до 2048 байт).
+#define MEMORY_POOL_CLASS_COUNT 7
+// Максимальный размер блока пула, выделения большего размера передаются платформе.
+#define MEMORY_POOL_MAX_BLOCK_SIZE (MEMORY_POOL_MIN_BLOCK_SIZE << (MEMORY_POOL_CLASS_COUNT - 1))
+// Объем блоков, переносимых между пулом и кэшем потока за один захват блокировки пула.
+#define MEMORY_POOL_CACHE_BATCH_BYTES KIBIBYTES(4)
+// Минимальное количество блоков, переносимых за один захват блокировки пула.
+#define MEMORY_POOL_CACHE_MIN_BATCH 4
+
+// Минимальное выравнивание блока, обеспечивающее размещение заголовка перед ним.
+#define MEMORY_HEADER_ALIGNMENT sizeof(memory_header)
+
+// Начальный размер буфера отчета об использовании памяти (отчет целиком помещается без увеличения буфера).
+#define MEMORY_USAGE_STR_CAPACITY 4096
+
+// Начальный размер буфера отчета профилировщика (отчет о MEMORY_PROFILER_REPORT_MAX_SITES местах без увеличения буфера).
+#define MEMORY_PROFILE_STR_CAPACITY 8192
+
+STATIC_ASSERT(sizeof(memory_header) == 16, "Memory header must be 16 bytes.");
+STATIC_ASSERT(MEMORY_TAG_COUNT <= 256, "Memory tag must fit in header.");
+
+// Количество потоков с собственными счетчиками статистики (следующие потоки используют общие счетчики).
+#define MEMORY_THREAD_STATS_MAX 64
+// Индекс наибольшего значения общего использования памяти потоком (после наибольших значений тегов).
+#define MEMORY_STATS_HIGH_TOTAL MEMORY_TAG_COUNT
+
+// Счетчики статистики потока.
+// NOTE: Изменяются только потоком-владельцем обычными загрузкой и сохранением (без блокирующих инструкций) и
+//       сводятся в общую статистику при ее запросе. Значения берутся по модулю 2^64, т.к. поток может
+//       освобождать память, выделенную другим потоком, и его собственный счетчик становится "отрицательным".
+typedef struct memory_thread_stats {
+    // Изменение использования памяти по тегам.
+    PLATFORM_CACHE_ALIGNED u64 tagged_allocated[MEMORY_TAG_COUNT];
+    // Изменение количества выделенных блоков памяти.
+    u64 allocation_count;
+    // Изменение общего использования памяти.
+    u64 total_allocated;
+    // Наибольшие значения использования памяти по тегам и общего в кадре (по четности номера кадра).
+    // NOTE: Обновляются при выделениях потоком-владельцем, поэтому пики внутри кадра не теряются.
+    u64 high[2][MEMORY_TAG_COUNT + 1];
+    // Номера кадров, к которым относятся наибольшие значения (по четности номера кадра).
+    u64 high_frame[2];
+} memory_thread_stats;
+
+// NOTE: Счетчики изменяются атомарно с RELAXED упорядочиванием: они не синхронизируют доступ к данным, а
+//       только не должны терять обновления при выделениях из разных потоков.
 typedef struct memory_stats {
-    // Пиковое значение использования памяти.
+    // Пиковое значение использования памяти (по наибольшим значениям потоков).
     u64 peak_allocated;
-    // Обшее использование памяти в данный момент.
+    // Память с рекомендацией больших страниц по тегам в данный момент (целые большие страницы больших блоков).
+    // NOTE: В Linux это рекомендация MADV_HUGEPAGE, фактическое размещение определяет ядро (AnonHugePages
+    //       в /proc/self/smaps), поэтому значение является верхней границей памяти на больших страницах.
+    u64 huge_advised[MEMORY_TAG_COUNT];
+    // Пиковое использование памяти по тегам в текущем кадре (по снимкам статистики и наибольшим значениям потоков).
+    u64 frame_peak_allocated[MEMORY_TAG_COUNT];
+    // Номер текущего кадра (выбирает наибольшие значения потоков).
+    u64 frame;
+    // Количество потоков, получивших собственные счетчики (может превышать MEMORY_THREAD_STATS_MAX).
+    u32 thread_count;
+    // Общие счетчики потоков, которым не хватило собственных (изменяются атомарными операциями).
+    memory_thread_stats shared;
+    // Собственные счетчики потоков.
+    memory_thread_stats threads[MEMORY_THREAD_STATS_MAX];
+} memory_stats;
+
+// Снимок статистики, сведенной из счетчиков всех потоков.
+typedef struct memory_stats_snapshot {
+    // Обшее использование памяти.
     u64 total_allocated;
-    // Использование памяти по тегам в данный момент.
+    // Использование памяти по тегам.
     u64 tagged_allocated[MEMORY_TAG_COUNT];
-    // Количество выделенных блоков памяти в данный момент.
+    // Количество выделенных блоков памяти.
     u64 allocation_count;
-} memory_stats;
+} memory_stats_snapshot;
+
+// Пакет свободных блоков в стеке пакетов размерного класса (размещается в первом блоке пакета).
+typedef struct memory_pool_batch {
+    // Следующий блок пакета.
+    void* next_block;
+    // Следующий пакет стека.
+    struct memory_pool_batch* next_batch;
+} memory_pool_batch;
+
+STATIC_ASSERT(sizeof(memory_pool_batch) <= MEMORY_POOL_MIN_BLOCK_SIZE, "Pool batch must fit into the smallest block.");
+
+// Свободные блоки размерного класса в кэше потока.
+typedef struct memory_pool_cache {
+    // Список свободных блоков (указатель на следующий хранится в самом блоке).
+    void* free_list;
+    // Количество блоков в списке.
+    u32 count;
+    // Полный пакет блоков, отложенный при переполнении списка (nullptr - отсутствует).
+    void* spare;
+} memory_pool_cache;
+
+// Данные системы памяти, принадлежащие потоку.
+// NOTE: Блоки в кэше пулов потока считаются занятыми в статистике пулов. Кэш завершенного потока
+//       не возвращается в пулы до завершения системы памяти (не более 2 пакетов на размерный класс).
+typedef struct memory_thread_cache {
+    // Поколение системы памяти, к которому привязан поток (0 - не привязан).
+    u32 generation;
+    // Счетчики статистики потока (nullptr - используются общие счетчики).
+    memory_thread_stats* stats;
+    // Кэши свободных блоков размерных классов.
+    memory_pool_cache pools[MEMORY_POOL_CLASS_COUNT];
+} memory_thread_cache;
 
 typedef struct memory_system_context {
     // Статистика памяти.
     memory_stats stats;
+    // Поколение системы памяти (отличает повторные инициализации для привязки потоков).
+    u32 generation;
+    // Покадровый распределитель.
+    linear_allocator frame_allocator;
+    // Блокировка покадрового распределителя.
+    platform_spinlock frame_lock;
+    // Использование памяти покадровым распределителем в предыдущем кадре.
+    u64 frame_allocator_last_used;
+    // Двусторонний стековый распределитель уровня.
+    stack_allocator level_allocator;
+    // Блокировка распределителя уровня.
+    platform_spinlock level_lock;
+    // Пулы размерных классов для небольших выделений.
+    pool_allocator pools[MEMORY_POOL_CLASS_COUNT];
+    // Блокировки пулов размерных классов (отдельные, чтобы потоки с разными размерами не конкурировали).
+    // NOTE: Захватываются только при переносе пакета блоков между пулом и кэшем потока.
+    platform_mutex pool_locks[MEMORY_POOL_CLASS_COUNT];
+    // Стеки пакетов блоков, возвращенных кэшами потоков (выдаются при пополнении кэшей целиком).
+    void* pool_batches[MEMORY_POOL_CLASS_COUNT];
+    // Количество блоков в стеках пакетов (в пулах они учитываются как используемые).
+    u64 pool_batch_blocks[MEMORY_POOL_CLASS_COUNT];
+    // Количество блоков в пакете размерного класса.
+    u32 pool_batch_sizes[MEMORY_POOL_CLASS_COUNT];
+    // Распределитель общего назначения.
+    memory_backend backend;
+    // Минимальный размер блока, выделяемого напрямую у платформы (по возможности на больших страницах).
+    u64 large_allocation_threshold;
+    // Включен ли профилировщик выделений по местам вызова.
+    bool profiling;
+    // Бюджеты тегов в байтах (0 - без ограничения).
+    u64 tag_budgets[MEMORY_TAG_COUNT];
+    // Отказывать в выделениях, превышающих бюджет.
+    bool strict_budgets;
+    // Callback-функция уведомления о превышении бюджета.
+    memory_budget_callback on_budget_overrun;
+    // Пользовательские данные для on_budget_overrun.
+    void* budget_user_data;
+    // Флаги уведомления о превышении бюджета в текущем кадре (не более одного уведомления на тег за кадр).
+    u32 budget_reported[MEMORY_TAG_COUNT];
+    // Использование памяти по тегам за последний завершенный кадр.
+    memory_tag_usage frame_usage[MEMORY_TAG_COUNT];
+    // Распределитель TLSF (используется при backend == MEMORY_BACKEND_TLSF).
+    tlsf_allocator tlsf;
+    // Блокировка распределителя TLSF.
+    platform_spinlock tlsf_lock;
 } memory_system_context;
 
 static memory_system_context* context = nullptr;
 
-bool memory_system_initialize()
+// Номер последней инициализации системы памяти.
+static u32 memory_generation = 0;
+
+// Данные текущего потока.
+static PLATFORM_THREAD_LOCAL memory_thread_cache thread_cache;
+
+// Привязывает текущий поток к системе памяти: выделяет ему собственные счетчики статистики, если они остались.
+static NOINLINE void memory_thread_cache_bind(memory_thread_cache* cache)
+{
+    // NOTE: Блоки кэша, оставшиеся от предыдущей инициализации, принадлежали уже уничтоженным пулам.
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        cache->pools[i].free_list = nullptr;
+        cache->pools[i].count = 0;
+        cache->pools[i].spare = nullptr;
+    }
+
+    u32 index = platform_atomic_fetch_add_u32(&context->stats.thread_count, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    cache->stats = index < MEMORY_THREAD_STATS_MAX ? &context->stats.threads[index] : nullptr;
+    cache->generation = context->generation;
+}
+
+// Возвращает данные текущего потока, привязывая его к системе памяти при первом обращении.
+INLINE memory_thread_cache* memory_thread_cache_get()
+{
+    memory_thread_cache* cache = &thread_cache;
+    if(UNLIKELY(cache->generation != context->generation))
+    {
+        memory_thread_cache_bind(cache);
+    }
+
+    return cache;
+}
+
+// Сводит счетчики всех потоков в снимок статистики и обновляет пиковые значения наибольшими значениями
+// потоков в кадре frame.
+// NOTE: Сумма наибольших значений потоков не меньше действительного пика (потоки достигают своих наибольших
+//       значений в разное время), поэтому пик оценивается сверху.
+static void memory_stats_collect(memory_stats_snapshot* out_snapshot, u64 frame)
+{
+    u32 thread_count = platform_atomic_load_u32(&context->stats.thread_count, PLATFORM_MEMORY_ORDER_RELAXED);
+    thread_count = MIN(thread_count, (u32)MEMORY_THREAD_STATS_MAX);
+
+    // Наибольшие значения потока действительны, если он выделял память в кадре frame.
+    const u64* highs[MEMORY_THREAD_STATS_MAX];
+    for(u32 t = 0; t < thread_count; ++t)
+    {
+        const memory_thread_stats* stats = &context->stats.threads[t];
+        u64 high_frame = platform_atomic_load_u64(&stats->high_frame[frame & 1], PLATFORM_MEMORY_ORDER_ACQUIRE);
+        highs[t] = high_frame == frame ? stats->high[frame & 1] : nullptr;
+    }
+
+    const memory_thread_stats* shared = &context->stats.shared;
+    out_snapshot->total_allocated = 0;
+    out_snapshot->allocation_count = platform_atomic_load_u64(&shared->allocation_count, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    for(u32 t = 0; t < thread_count; ++t)
+    {
+        out_snapshot->allocation_count += platform_atomic_load_u64(
+            &context->stats.threads[t].allocation_count, PLATFORM_MEMORY_ORDER_RELAXED
+        );
+    }
+
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        u64 tagged = platform_atomic_load_u64(&shared->tagged_allocated[i], PLATFORM_MEMORY_ORDER_RELAXED);
+        u64 high = platform_atomic_load_u64(&shared->high[frame & 1][i], PLATFORM_MEMORY_ORDER_RELAXED);
+        high = (i64)high > (i64)tagged ? high : tagged;
+        for(u32 t = 0; t < thread_count; ++t)
+        {
+            u64 current = platform_atomic_load_u64(&context->stats.threads[t].tagged_allocated[i], PLATFORM_MEMORY_ORDER_RELAXED);
+            tagged += current;
+            high += highs[t] ? platform_atomic_load_u64(&highs[t][i], PLATFORM_MEMORY_ORDER_RELAXED) : current;
+        }
+
+        out_snapshot->tagged_allocated[i] = tagged;
+        out_snapshot->total_allocated += tagged;
+        platform_atomic_max_u64(&context->stats.frame_peak_allocated[i], MAX(tagged, high), PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    u64 shared_total = platform_atomic_load_u64(&shared->total_allocated, PLATFORM_MEMORY_ORDER_RELAXED);
+    u64 total_high = platform_atomic_load_u64(&shared->high[frame & 1][MEMORY_STATS_HIGH_TOTAL], PLATFORM_MEMORY_ORDER_RELAXED);
+    total_high = (i64)total_high > (i64)shared_total ? total_high : shared_total;
+
+    for(u32 t = 0; t < thread_count; ++t)
+    {
+        const u64* value = highs[t] ? &highs[t][MEMORY_STATS_HIGH_TOTAL] : &context->stats.threads[t].total_allocated;
+        total_high += platform_atomic_load_u64(value, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    platform_atomic_max_u64(
+        &context->stats.peak_allocated, MAX(out_snapshot->total_allocated, total_high), PLATFORM_MEMORY_ORDER_RELAXED
+    );
+}
+
+// Сводит счетчики всех потоков в снимок статистики текущего кадра.
+INLINE void memory_stats_collect_current(memory_stats_snapshot* out_snapshot)
+{
+    memory_stats_collect(out_snapshot, platform_atomic_load_u64(&context->stats.frame, PLATFORM_MEMORY_ORDER_RELAXED));
+}
+
+// Возвращает текущее использование памяти тегом, сведенное из счетчиков всех потоков.
+static u64 memory_stats_tagged(memory_tag tag)
+{
+    u32 thread_count = platform_atomic_load_u32(&context->stats.thread_count, PLATFORM_MEMORY_ORDER_RELAXED);
+    thread_count = MIN(thread_count, (u32)MEMORY_THREAD_STATS_MAX);
+
+    u64 tagged = platform_atomic_load_u64(&context->stats.shared.tagged_allocated[tag], PLATFORM_MEMORY_ORDER_RELAXED);
+    for(u32 t = 0; t < thread_count; ++t)
+    {
+        tagged += platform_atomic_load_u64(&context->stats.threads[t].tagged_allocated[tag], PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    return tagged;
+}
+
+// Проверяет, укладывается ли выделение в заданный бюджет тега, и уведомляет о превышении.
+static NOINLINE bool memory_budget_check_usage(memory_tag tag, u64 size, u64 budget)
+{
+    u64 usage = memory_stats_tagged(tag);
+    if(usage + size <= budget)
+    {
+        return true;
+    }
+
+    if(platform_atomic_exchange_u32(&context->budget_reported[tag], 1, PLATFORM_MEMORY_ORDER_RELAXED) == 0)
+    {
+        if(context->on_budget_overrun)
+        {
+            context->on_budget_overrun(tag, budget, usage, size, context->budget_user_data);
+        }
+        else
+        {
+            memory_format mbudget, musage, mrequested;
+            memory_get_format(budget, &mbudget);
+            memory_get_format(usage, &musage);
+            memory_get_format(size, &mrequested);
+            LOG_WARN("Memory budget exceeded for tag %u: usage %.2f %s + requested %.2f %s > budget %.2f %s.",
+                tag, musage.amount, musage.unit, mrequested.amount, mrequested.unit, mbudget.amount, mbudget.unit
+            );
+        }
+    }
+
+    return !context->strict_budgets;
+}
+
+// Проверяет, укладывается ли выделение в бюджет тега (теги без бюджета проверяются без вызова).
+INLINE bool memory_budget_check(memory_tag tag, u64 size)
+{
+    u64 budget = platform_atomic_load_u64(&context->tag_budgets[tag], PLATFORM_MEMORY_ORDER_RELAXED);
+    return LIKELY(budget == 0) || memory_budget_check_usage(tag, size, budget);
+}
+
+// Изменяет счетчики статистики потока на size байт и count блоков (по модулю 2^64).
+INLINE void memory_thread_stats_update(memory_thread_stats* stats, memory_tag tag, u64 size, u64 count)
+{
+    // NOTE: Только поток-владелец изменяет свои счетчики, поэтому атомарное чтение-модификация-запись не нужно.
+    u64 tagged = platform_atomic_load_u64(&stats->tagged_allocated[tag], PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&stats->tagged_allocated[tag], tagged + size, PLATFORM_MEMORY_ORDER_RELAXED);
+    u64 total = platform_atomic_load_u64(&stats->total_allocated, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&stats->total_allocated, total + size, PLATFORM_MEMORY_ORDER_RELAXED);
+    u64 allocations = platform_atomic_load_u64(&stats->allocation_count, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&stats->allocation_count, allocations + count, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+// Изменяет общие счетчики статистики на size байт и count блоков (по модулю 2^64).
+INLINE void memory_shared_stats_update(memory_tag tag, u64 size, u64 count)
+{
+    memory_thread_stats* shared = &context->stats.shared;
+    platform_atomic_fetch_add_u64(&shared->tagged_allocated[tag], size, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_fetch_add_u64(&shared->total_allocated, size, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_fetch_add_u64(&shared->allocation_count, count, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+// Учитывает выделение в общих счетчиках и их наибольших значениях за кадр.
+// NOTE: Общие наибольшие значения сбрасываются в memory_system_frame_end(), а не потоками.
+static NOINLINE void memory_shared_stats_add(memory_tag tag, u64 size, u64 count)
+{
+    memory_thread_stats* shared = &context->stats.shared;
+    u64 tagged = platform_atomic_fetch_add_u64(&shared->tagged_allocated[tag], size, PLATFORM_MEMORY_ORDER_RELAXED) + size;
+    u64 total = platform_atomic_fetch_add_u64(&shared->total_allocated, size, PLATFORM_MEMORY_ORDER_RELAXED) + size;
+    platform_atomic_fetch_add_u64(&shared->allocation_count, count, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    u64 frame = platform_atomic_load_u64(&context->stats.frame, PLATFORM_MEMORY_ORDER_RELAXED);
+    u64* high = shared->high[frame & 1];
+    u64 values[2] = { tagged, total };
+    u64* targets[2] = { &high[tag], &high[MEMORY_STATS_HIGH_TOTAL] };
+
+    // NOTE: Счетчики могут быть "отрицательными" (освобождение памяти потоков с собственными счетчиками),
+    //       поэтому сравнение знаковое.
+    for(u32 i = 0; i < 2; ++i)
+    {
+        u64 current = platform_atomic_load_u64(targets[i], PLATFORM_MEMORY_ORDER_RELAXED);
+        while((i64)values[i] > (i64)current)
+        {
+            if(platform_atomic_compare_exchange_u64(targets[i], &current, values[i], PLATFORM_MEMORY_ORDER_RELAXED))
+            {
+                break;
+            }
+        }
+    }
+}
+
+// Начинает отсчет наибольших значений потока в кадре frame с текущих значений его счетчиков.
+static NOINLINE void memory_thread_stats_high_reset(memory_thread_stats* stats, u64 frame)
+{
+    u64* high = stats->high[frame & 1];
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        u64 tagged = platform_atomic_load_u64(&stats->tagged_allocated[i], PLATFORM_MEMORY_ORDER_RELAXED);
+        platform_atomic_store_u64(&high[i], tagged, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    u64 total = platform_atomic_load_u64(&stats->total_allocated, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&high[MEMORY_STATS_HIGH_TOTAL], total, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    // NOTE: Номер кадра сохраняется после значений, чтобы сводящий поток не принял значения прошлого кадра за текущие.
+    platform_atomic_store_u64(&stats->high_frame[frame & 1], frame, PLATFORM_MEMORY_ORDER_RELEASE);
+}
+
+// Увеличивает наибольшее значение счетчика потока до value.
+INLINE void memory_thread_stats_high_raise(u64* high, u64 value)
+{
+    // NOTE: Счетчик потока может быть "отрицательным" (освобождение чужой памяти), поэтому сравнение знаковое.
+    if((i64)value > (i64)platform_atomic_load_u64(high, PLATFORM_MEMORY_ORDER_RELAXED))
+    {
+        platform_atomic_store_u64(high, value, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+// Учитывает выделение памяти в статистике и в наибольших значениях потока за кадр.
+INLINE void memory_stats_add(memory_tag tag, u64 size, u64 count)
+{
+    memory_thread_stats* stats = memory_thread_cache_get()->stats;
+    if(UNLIKELY(stats == nullptr))
+    {
+        memory_shared_stats_add(tag, size, count);
+        return;
+    }
+
+    memory_thread_stats_update(stats, tag, size, count);
+
+    // NOTE: Наибольшие значения растут только при выделениях, освобождения их не меняют.
+    u64 frame = platform_atomic_load_u64(&context->stats.frame, PLATFORM_MEMORY_ORDER_RELAXED);
+    if(UNLIKELY(platform_atomic_load_u64(&stats->high_frame[frame & 1], PLATFORM_MEMORY_ORDER_RELAXED) != frame))
+    {
+        // Первое выделение потока в кадре: значения начинаются с текущих (уже включающих это выделение).
+        memory_thread_stats_high_reset(stats, frame);
+        return;
+    }
+
+    u64* high = stats->high[frame & 1];
+    memory_thread_stats_high_raise(&high[tag], platform_atomic_load_u64(&stats->tagged_allocated[tag], PLATFORM_MEMORY_ORDER_RELAXED));
+    memory_thread_stats_high_raise(
+        &high[MEMORY_STATS_HIGH_TOTAL], platform_atomic_load_u64(&stats->total_allocated, PLATFORM_MEMORY_ORDER_RELAXED)
+    );
+}
+
+// Исключает освобожденную память из статистики.
+INLINE void memory_stats_sub(memory_tag tag, u64 size, u64 count)
+{
+    memory_thread_stats* stats = memory_thread_cache_get()->stats;
+    if(UNLIKELY(stats == nullptr))
+    {
+        memory_shared_stats_update(tag, (u64)0 - size, (u64)0 - count);
+        return;
+    }
+
+    memory_thread_stats_update(stats, tag, (u64)0 - size, (u64)0 - count);
+}
+
+// Возвращает размер целых больших страниц в большом блоке (платформа округляет блок до обычной страницы).
+INLINE u64 memory_huge_page_extent(u64 size)
+{
+    u64 page_size = platform_memory_page_size();
+    u64 mapped_size = (size + page_size - 1) & ~(page_size - 1);
+    return mapped_size & ~(u64)(PLATFORM_MEMORY_HUGE_PAGE_SIZE - 1);
+}
+
+// Возвращает индекс размерного класса пула для блока указанного размера (с учетом заголовка).
+INLINE u32 memory_pool_class_index(u64 total_size)
+{
+    if(total_size <= MEMORY_POOL_MIN_BLOCK_SIZE)
+    {
+        return 0;
+    }
+
+    // Номер старшего бита округленного вверх до степени двойки размера минус log2(MEMORY_POOL_MIN_BLOCK_SIZE).
+    return (64 - __builtin_clzll(total_size - 1)) - 5;
+}
+
+// Заполняет пустой кэш потока пакетом блоков и возвращает один из них.
+static NOINLINE void* memory_pool_cache_refill(u32 index, memory_pool_cache* cache)
+{
+    u32 batch = context->pool_batch_sizes[index];
+    void* block = cache->spare;
+    u64 taken = batch;
+
+    if(block)
+    {
+        cache->spare = nullptr;
+    }
+    else
+    {
+        // NOTE: Пакет, возвращенный другим кэшем, передается целиком, без обхода его блоков под блокировкой.
+        platform_mutex_lock(&context->pool_locks[index]);
+        memory_pool_batch* top = context->pool_batches[index];
+        if(top)
+        {
+            context->pool_batches[index] = top->next_batch;
+            context->pool_batch_blocks[index] -= batch;
+            block = top;
+        }
+        else
+        {
+            taken = pool_allocator_allocate_list(&context->pools[index], batch, &block);
+        }
+        platform_mutex_unlock(&context->pool_locks[index]);
+    }
+
+    if(taken > 0)
+    {
+        cache->free_list = *(void**)block;
+        cache->count = (u32)(taken - 1);
+    }
+
+    return block;
+}
+
+// Откладывает заполненный список кэша потока как полный пакет, а предыдущий отложенный пакет переносит
+// в стек пакетов размерного класса.
+static NOINLINE void memory_pool_cache_flush(u32 index, memory_pool_cache* cache)
+{
+    memory_pool_batch* full = cache->spare;
+
+    cache->spare = cache->free_list;
+    cache->free_list = nullptr;
+    cache->count = 0;
+
+    if(full)
+    {
+        platform_mutex_lock(&context->pool_locks[index]);
+        full->next_batch = context->pool_batches[index];
+        context->pool_batches[index] = full;
+        context->pool_batch_blocks[index] += context->pool_batch_sizes[index];
+        platform_mutex_unlock(&context->pool_locks[index]);
+    }
+}
+
+// Возвращает в пулы все блоки кэша текущего потока.
+static void memory_pool_cache_release()
+{
+    memory_thread_cache* cache = memory_thread_cache_get();
+
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        void* lists[] = { cache->pools[i].free_list, cache->pools[i].spare };
+
+        platform_mutex_lock(&context->pool_locks[i]);
+        for(u32 l = 0; l < ARRAY_SIZE(lists); ++l)
+        {
+            void* block = lists[l];
+            while(block)
+            {
+                void* next = *(void**)block;
+                pool_allocator_free(&context->pools[i], block);
+                block = next;
+            }
+        }
+        platform_mutex_unlock(&context->pool_locks[i]);
+
+        cache->pools[i].free_list = nullptr;
+        cache->pools[i].count = 0;
+        cache->pools[i].spare = nullptr;
+    }
+}
+
+// Уничтожает распределители и контекст системы памяти при ошибке инициализации.
+static void memory_system_destroy_allocators()
+{
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        pool_allocator_destroy(&context->pools[i]);
+    }
+    if(context->backend == MEMORY_BACKEND_TLSF)
+    {
+        tlsf_allocator_destroy(&context->tlsf);
+    }
+    if(context->profiling)
+    {
+        memory_profiler_shutdown();
+    }
+    platform_memory_free_aligned(context);
+    context = nullptr;
+}
+
+bool memory_system_initialize(const memory_system_config* config)
 {
     ASSERT(context == nullptr, "Memory system is already initialized.");
 
-    context = platform_memory_allocate(sizeof(memory_system_context));
+    // NOTE: Счетчики потоков выровнены по линии кэша, поэтому контекст выделяется с тем же выравниванием.
+    context = platform_memory_allocate_aligned(sizeof(memory_system_context), PLATFORM_CACHE_LINE_SIZE);
     if(!context)
     {
         timer_format requested;
@@ -36,6 +618,87 @@ bool memory_system_initialize()
         return false;
     }
     platform_memory_zero(context, sizeof(memory_system_context));
+    context->generation = ++memory_generation;
+
+    // Включение профилировщика выделений (при ошибке система памяти продолжает работу без него).
+    if(config && config->profile_allocations)
+    {
+        context->profiling = memory_profiler_initialize();
+        if(!context->profiling)
+        {
+            LOG_WARN("Failed to initialize memory profiler, allocation profiling is disabled.");
+        }
+    }
+
+    // Бюджеты тегов.
+    if(config)
+    {
+        for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            context->tag_budgets[i] = config->tag_budgets[i];
+        }
+        context->strict_budgets = config->strict_budgets;
+        context->on_budget_overrun = config->on_budget_overrun;
+        context->budget_user_data = config->budget_user_data;
+    }
+
+    // Создание распределителя общего назначения.
+    context->backend = config ? config->backend : MEMORY_BACKEND_PLATFORM;
+    context->large_allocation_threshold = MEMORY_LARGE_ALLOCATION_DEFAULT_THRESHOLD;
+    if(config && config->large_allocation_threshold > 0)
+    {
+        context->large_allocation_threshold = config->large_allocation_threshold;
+    }
+    if(context->backend == MEMORY_BACKEND_TLSF && !tlsf_allocator_create(config->tlsf_region_size, &context->tlsf))
+    {
+        LOG_ERROR("Failed to create TLSF allocator.");
+        if(context->profiling)
+        {
+            memory_profiler_shutdown();
+        }
+        platform_memory_free_aligned(context);
+        context = nullptr;
+        return false;
+    }
+
+    // Создание пулов размерных классов (страницы выделяются по требованию).
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        pool_allocator_create(MEMORY_POOL_MIN_BLOCK_SIZE << i, POOL_ALLOCATOR_DEFAULT_PAGE_SIZE, &context->pools[i]);
+        platform_mutex_create(&context->pool_locks[i]);
+        context->pool_batch_sizes[i] = MAX((u32)(MEMORY_POOL_CACHE_BATCH_BYTES / (MEMORY_POOL_MIN_BLOCK_SIZE << i)), (u32)MEMORY_POOL_CACHE_MIN_BATCH);
+    }
+
+    // Создание распределителя уровня.
+    u64 level_capacity = MEMORY_LEVEL_ALLOCATOR_DEFAULT_CAPACITY;
+    if(config && config->level_allocator_capacity > 0)
+    {
+        level_capacity = config->level_allocator_capacity;
+    }
+
+    if(!stack_allocator_create(level_capacity, &context->level_allocator))
+    {
+        LOG_ERROR("Failed to allocate memory for level allocator.");
+        memory_system_destroy_allocators();
+        return false;
+    }
+
+    // Создание покадрового распределителя.
+    u64 frame_capacity = MEMORY_FRAME_ALLOCATOR_DEFAULT_CAPACITY;
+    if(config && config->frame_allocator_capacity > 0)
+    {
+        frame_capacity = config->frame_allocator_capacity;
+    }
+
+    void* frame_memory = memory_allocate(frame_capacity, MEMORY_FRAME_ALLOCATOR_DEFAULT_ALIGNMENT, MEMORY_TAG_FRAME);
+    if(!frame_memory)
+    {
+        LOG_ERROR("Failed to allocate memory for frame allocator.");
+        stack_allocator_destroy(&context->level_allocator);
+        memory_system_destroy_allocators();
+        return false;
+    }
+    linear_allocator_create(frame_capacity, frame_memory, &context->frame_allocator);
 
     return true;
 }
@@ -44,13 +707,28 @@ void memory_system_shutdown()
 {
     ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
 
+    // Уничтожение покадрового распределителя (до проверки утечек, т.к. его память учитывается по тегу).
+    void* frame_memory = context->frame_allocator.memory;
+    u64 frame_capacity = context->frame_allocator.capacity;
+    linear_allocator_destroy(&context->frame_allocator);
+    memory_free(frame_memory, frame_capacity, MEMORY_TAG_FRAME);
+
+    // Уничтожение распределителя уровня (его память не учитывается по тегам).
+    stack_allocator_destroy(&context->level_allocator);
+
+    // Блоки кэша текущего потока возвращаются в пулы, чтобы отчет об утечках не учитывал их как используемые.
+    memory_pool_cache_release();
+
     bool detect_leaks = false;
 
+    memory_stats_snapshot snapshot;
+    memory_stats_collect_current(&snapshot);
+
     // Проверка порных тэгов.
     // NOTE: Случай, когда неверно установлены парные тэги.
     for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
     {
-        if(context->stats.tagged_allocated[i] != 0)
+        if(snapshot.tagged_allocated[i] != 0)
         {
             detect_leaks = true;
             break;
@@ -62,20 +740,40 @@ void memory_system_shutdown()
     //       или количество выделенной памяти не соответствует количеству освобожденной.
     //       Проверка хоть и избыточная, но она контролирует казалось бы невозможные случаи,
     //       а именно по тегам нули, а количество аллокаций не сходится.
-    if(context->stats.total_allocated != 0 || context->stats.allocation_count != 0)
+    if(snapshot.total_allocated != 0 || snapshot.allocation_count != 0)
     {
         detect_leaks = true;
     }
 
     if(detect_leaks)
     {
+        // NOTE: Покадровый распределитель уже уничтожен, поэтому отчет формируется в стековом буфере.
+        char buffer[MEMORY_USAGE_STR_CAPACITY];
+        string_builder builder;
+        string_builder_create_buffer(buffer, sizeof(buffer), &builder);
+        memory_system_usage_write(&builder);
+
         LOG_WARN("Detecting memory leaks...");
-        const char* meminfo = memory_system_usage_str();
-        LOG_WARN(meminfo);
-        string_free(meminfo);
+        LOG_WARN("%s", string_builder_cstr(&builder));
+    }
+
+    // Уничтожение пулов (после отчета об утечках, чтобы он содержал их статистику).
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        pool_allocator_destroy(&context->pools[i]);
+    }
+
+    if(context->backend == MEMORY_BACKEND_TLSF)
+    {
+        tlsf_allocator_destroy(&context->tlsf);
+    }
+
+    if(context->profiling)
+    {
+        memory_profiler_shutdown();
     }
 
-    platform_memory_free(context);
+    platform_memory_free_aligned(context);
     context = nullptr;
 }
 
@@ -84,10 +782,94 @@ bool memory_system_is_initialized()
     return context != nullptr;
 }
 
-const char* memory_system_usage_str()
+void memory_system_frame_end()
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+
+    platform_spinlock_lock(&context->frame_lock);
+    context->frame_allocator_last_used = context->frame_allocator.offset;
+    linear_allocator_reset(&context->frame_allocator);
+    platform_spinlock_unlock(&context->frame_lock);
+
+    // Фиксация использования памяти по тегам за кадр и начало отсчета пика следующего кадра с текущего значения.
+    // NOTE: Потоки с собственными счетчиками переходят к наибольшим значениям следующего кадра при первом выделении
+    //       после смены номера кадра, а общие наибольшие значения следующего кадра начинаются с текущих значений
+    //       общих счетчиков до нее. Значения завершенного кадра сводятся после смены номера.
+    u64 frame = platform_atomic_load_u64(&context->stats.frame, PLATFORM_MEMORY_ORDER_RELAXED);
+    memory_thread_stats* shared = &context->stats.shared;
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        u64 tagged = platform_atomic_load_u64(&shared->tagged_allocated[i], PLATFORM_MEMORY_ORDER_RELAXED);
+        platform_atomic_store_u64(&shared->high[(frame + 1) & 1][i], tagged, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+    u64 shared_total = platform_atomic_load_u64(&shared->total_allocated, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&shared->high[(frame + 1) & 1][MEMORY_STATS_HIGH_TOTAL], shared_total, PLATFORM_MEMORY_ORDER_RELAXED);
+    platform_atomic_store_u64(&context->stats.frame, frame + 1, PLATFORM_MEMORY_ORDER_RELEASE);
+
+    memory_stats_snapshot snapshot;
+    memory_stats_collect(&snapshot, frame);
+
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        u64 current = snapshot.tagged_allocated[i];
+        u64 peak = platform_atomic_exchange_u64(&context->stats.frame_peak_allocated[i], current, PLATFORM_MEMORY_ORDER_RELAXED);
+
+        context->frame_usage[i].current = current;
+        context->frame_usage[i].peak = MAX(peak, current);
+        context->frame_usage[i].budget = platform_atomic_load_u64(&context->tag_budgets[i], PLATFORM_MEMORY_ORDER_RELAXED);
+
+        platform_atomic_store_u32(&context->budget_reported[i], 0, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    if(context->profiling)
+    {
+        memory_profiler_frame_end();
+    }
+}
+
+void memory_system_set_tag_budget(memory_tag tag, u64 budget)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(tag < MEMORY_TAG_COUNT, "Tag must be between 0 and MEMORY_TAG_COUNT.");
+
+    platform_atomic_store_u64(&context->tag_budgets[tag], budget, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+void memory_system_tag_usage(memory_tag_usage* out_usage)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(out_usage != nullptr, "Output pointer must be non-null.");
+
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        out_usage[i] = context->frame_usage[i];
+    }
+}
+
+const char* memory_system_profile_str(u32 top_count, u32 frame_count)
 {
     ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
 
+    if(!context->profiling)
+    {
+        return "Allocation profiling is disabled.\n";
+    }
+
+    string_builder builder;
+    if(!string_builder_create_frame(MEMORY_PROFILE_STR_CAPACITY, &builder))
+    {
+        return "Allocation profile: frame allocator is out of memory.\n";
+    }
+
+    memory_profiler_report(&builder, top_count, frame_count);
+    return string_builder_cstr(&builder);
+}
+
+void memory_system_usage_write(string_builder* builder)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+
     static const char* tag_names[MEMORY_TAG_COUNT] = {
         "UNKNOWN        ",
         "DARRAY         ",
@@ -96,102 +878,292 @@ const char* memory_system_usage_str()
         "SYSTEM         ",
         "RENDERER       ",
         "TEXTURE        ",
+        "FRAME          ",
+        "HASHMAP        ",
+        "QUEUE          ",
     };
 
     //-----------------------------------------------------------------------------------------------------------------------
 
-    // Буфер для вывода информации о памяти.
-    char buffer[8000] = "Memory information:\n\n";
-    const u16 buffer_length = sizeof(buffer); // TODO: При изменнении смещения, нужно менять и длинну!
-    u64 offset = string_length(buffer);
+    string_builder_append(builder, "Memory information:\n\n");
+
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    // Снимок счетчиков потоков. Общее использование вычисляется по снимку, поэтому совпадает с суммой тегов
+    // даже при одновременных выделениях в других потоках.
+    memory_stats_snapshot snapshot;
+    memory_stats_collect_current(&snapshot);
+
+    u64* tagged_allocated = snapshot.tagged_allocated;
+    u64 total_allocated = snapshot.total_allocated;
+    u64 allocation_count = snapshot.allocation_count;
+    u64 peak_allocated = platform_atomic_load_u64(&context->stats.peak_allocated, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    u64 huge_advised[MEMORY_TAG_COUNT];
+    for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        huge_advised[i] = platform_atomic_load_u64(&context->stats.huge_advised[i], PLATFORM_MEMORY_ORDER_RELAXED);
+    }
 
     //-----------------------------------------------------------------------------------------------------------------------
 
     memory_format used;
-    memory_get_format(context->stats.total_allocated, &used);
+    memory_get_format(total_allocated, &used);
 
     // Запись статистики использования памяти в буфер.
-    i32 length = string_format(buffer + offset, buffer_length, "Total memory usage: %.2f %s\n", used.amount, used.unit);
-
-    // Обновление смещения для записи следующей строки.
-    offset += length;
+    string_builder_append_format(builder, "Total memory usage: %.2f %s\n", used.amount, used.unit);
 
     //-----------------------------------------------------------------------------------------------------------------------
 
     memory_format peak;
-    memory_get_format(context->stats.peak_allocated, &peak);
+    memory_get_format(MAX(peak_allocated, total_allocated), &peak);
 
     // Запись пикового использования памяти.
-    length = string_format(buffer + offset, buffer_length, "Peak memory usgae: %.2f %s\n", peak.amount, peak.unit);
-
-    // Обновление смещения для записи следующей строки.
-    offset += length;
+    string_builder_append_format(builder, "Peak memory usgae: %.2f %s\n", peak.amount, peak.unit);
 
     //-----------------------------------------------------------------------------------------------------------------------
 
     // Вывод количества текущих аллокаций, для наблюдения за утечками памяти при работе приложения.
-    length = string_format(buffer + offset, buffer_length, "Current memory allocations: %llu\n", context->stats.allocation_count);
-
-    // Обновление смещения для записи следующей строки.
-    offset += length;
+    string_builder_append_format(builder, "Current memory allocations: %llu\n", allocation_count);
 
     //-----------------------------------------------------------------------------------------------------------------------
 
     // Запись заглавной строки тегов.
-    length = string_format(buffer + offset, buffer_length, "Memory usege by tags:\n");
-
-    // Обновление смещения для записи следующей строки.
-    offset += length;
+    string_builder_append(builder, "Memory usege by tags:\n");
 
     //-----------------------------------------------------------------------------------------------------------------------
 
     for(u32 i = 0; i < MEMORY_TAG_COUNT; ++i)
     {
-        memory_format mtag;
-        memory_get_format(context->stats.tagged_allocated[i], &mtag);
+        memory_format mtag, mhuge;
+        memory_get_format(tagged_allocated[i], &mtag);
+        memory_get_format(huge_advised[i], &mhuge);
+
+        // Запись строки тега, его значения, объема памяти с рекомендацией больших страниц и бюджета (если задан) в буфер.
+        u64 budget = platform_atomic_load_u64(&context->tag_budgets[i], PLATFORM_MEMORY_ORDER_RELAXED);
+        if(budget > 0)
+        {
+            memory_format mbudget;
+            memory_get_format(budget, &mbudget);
+
+            string_builder_append_format(builder, "  %s: %7.2f %-3s (huge-page advised %7.2f %s, budget %7.2f %s)\n",
+                tag_names[i], mtag.amount, mtag.unit, mhuge.amount, mhuge.unit, mbudget.amount, mbudget.unit
+            );
+        }
+        else
+        {
+            string_builder_append_format(builder, "  %s: %7.2f %-3s (huge-page advised %7.2f %s)\n",
+                tag_names[i], mtag.amount, mtag.unit, mhuge.amount, mhuge.unit
+            );
+        }
+    }
+
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    platform_spinlock_lock(&context->frame_lock);
+    u64 frame_last_used = context->frame_allocator_last_used;
+    u64 frame_peak_used = context->frame_allocator.peak;
+    platform_spinlock_unlock(&context->frame_lock);
+
+    memory_format frame_used, frame_peak, frame_capacity;
+    memory_get_format(frame_last_used, &frame_used);
+    memory_get_format(frame_peak_used, &frame_peak);
+    memory_get_format(context->frame_allocator.capacity, &frame_capacity);
+
+    // Запись использования покадрового распределителя (последний завершенный кадр и пиковое значение).
+    string_builder_append_format(builder, "Frame allocator: %.2f %s (peak %.2f %s) of %.2f %s\n",
+        frame_used.amount, frame_used.unit, frame_peak.amount, frame_peak.unit, frame_capacity.amount, frame_capacity.unit
+    );
+
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    platform_spinlock_lock(&context->level_lock);
+    u64 level_bottom_used = context->level_allocator.bottom;
+    u64 level_top_used = context->level_allocator.capacity - context->level_allocator.top;
+    u64 level_peak_used = context->level_allocator.peak;
+    platform_spinlock_unlock(&context->level_lock);
+
+    memory_format level_bottom, level_top, level_peak, level_capacity;
+    memory_get_format(level_bottom_used, &level_bottom);
+    memory_get_format(level_top_used, &level_top);
+    memory_get_format(level_peak_used, &level_peak);
+    memory_get_format(context->level_allocator.capacity, &level_capacity);
+
+    // Запись использования распределителя уровня (нижний и верхний стеки и пиковое значение).
+    string_builder_append_format(builder, "Level allocator: %.2f %s + scratch %.2f %s (peak %.2f %s) of %.2f %s\n",
+        level_bottom.amount, level_bottom.unit, level_top.amount, level_top.unit, level_peak.amount, level_peak.unit,
+        level_capacity.amount, level_capacity.unit
+    );
+
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    // Запись заглавной строки пулов.
+    string_builder_append(builder, "Pool allocators:\n");
+
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    for(u32 i = 0; i < MEMORY_POOL_CLASS_COUNT; ++i)
+    {
+        // Копия состояния пула, чтобы не удерживать блокировку во время форматирования.
+        // NOTE: Блоки в кэшах потоков учитываются как используемые, блоки в стеке пакетов - как свободные.
+        platform_mutex_lock(&context->pool_locks[i]);
+        pool_allocator pool = context->pools[i];
+        pool.used_count -= context->pool_batch_blocks[i];
+        platform_mutex_unlock(&context->pool_locks[i]);
 
-        // Запись строки тега и его значение в буфер.
-        length = string_format(buffer + offset, buffer_length, "  %s: %7.2f %s\n", tag_names[i], mtag.amount, mtag.unit);
+        memory_format pool_reserved;
+        memory_get_format(pool.page_count * pool.page_size, &pool_reserved);
 
-        // Обновление смещения для записи следующей строки.
-        offset += length;
+        // Запись использования блоков пула и памяти его страниц.
+        string_builder_append_format(builder, "  %4llu B: %6llu / %6llu blocks (peak %6llu), %7.2f %s\n",
+            pool.block_size, pool.used_count, pool_allocator_capacity(&pool), pool.peak_used_count,
+            pool_reserved.amount, pool_reserved.unit
+        );
     }
 
-    // Вернуть копию строки. Не забыть удалить после использование с использованием 'string_free'.
-    return string_duplicate(buffer);
+    //-----------------------------------------------------------------------------------------------------------------------
+
+    if(context->backend == MEMORY_BACKEND_TLSF)
+    {
+        platform_spinlock_lock(&context->tlsf_lock);
+        u64 tlsf_used_size = context->tlsf.used_size;
+        u64 tlsf_peak_size = context->tlsf.peak_used_size;
+        u64 tlsf_reserved_size = context->tlsf.reserved_size;
+        u64 tlsf_region_count = context->tlsf.region_count;
+        platform_spinlock_unlock(&context->tlsf_lock);
+
+        memory_format tlsf_used, tlsf_peak, tlsf_reserved;
+        memory_get_format(tlsf_used_size, &tlsf_used);
+        memory_get_format(tlsf_peak_size, &tlsf_peak);
+        memory_get_format(tlsf_reserved_size, &tlsf_reserved);
+
+        // Запись использования регионов распределителя TLSF (с учетом заголовков блоков).
+        string_builder_append_format(builder, "TLSF allocator: %.2f %s (peak %.2f %s) of %.2f %s in %llu regions\n",
+            tlsf_used.amount, tlsf_used.unit, tlsf_peak.amount, tlsf_peak.unit, tlsf_reserved.amount, tlsf_reserved.unit,
+            tlsf_region_count
+        );
+    }
 }
 
-void* memory_allocate(u64 size, u16 alignment, memory_tag tag)
+const char* memory_system_usage_str()
 {
-    UNUSED(alignment);
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
 
+    string_builder builder;
+    if(!string_builder_create_frame(MEMORY_USAGE_STR_CAPACITY, &builder))
+    {
+        return "Memory information: frame allocator is out of memory.\n";
+    }
+
+    memory_system_usage_write(&builder);
+    return string_builder_cstr(&builder);
+}
+
+static void* memory_allocate_internal(u64 size, u16 alignment, memory_tag tag, const char* file, u32 line, const void* address)
+{
     ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
     ASSERT(size > 0, "Size must be greater than zero.");
-    ASSERT(alignment > 0, "Alignment must be greater than zero.");
+    ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
     ASSERT(tag < MEMORY_TAG_COUNT, "Tag must be between 0 and MEMORY_TAG_COUNT.");
 
-    void* block = platform_memory_allocate(size);
-    if(!block)
+    if(!memory_budget_check(tag, size))
     {
-        timer_format requested;
-        timer_get_format(size, &requested);
+        return nullptr;
+    }
+
+    // NOTE: Выделяется запас на величину выравнивания (не меньше размера заголовка). Все распределители
+    //       возвращают память, выровненную не меньше чем по MEMORY_HEADER_ALIGNMENT, поэтому выровненный
+    //       блок пользователя всегда помещается в запас вместе с заголовком перед ним.
+    u16 padding = MAX(alignment, (u16)MEMORY_HEADER_ALIGNMENT);
+    u64 total_size = size + padding;
+
+    // Небольшие выделения обслуживаются пулами размерных классов (блоки пулов выровнены по 16 байтам)
+    // через кэш свободных блоков потока, который пополняется из пула пакетами.
+    memory_source source = MEMORY_SOURCE_PLATFORM;
+    void* raw = nullptr;
+
+    if(padding == MEMORY_HEADER_ALIGNMENT && total_size <= MEMORY_POOL_MAX_BLOCK_SIZE)
+    {
+        u32 index = memory_pool_class_index(total_size);
+        memory_pool_cache* cache = &memory_thread_cache_get()->pools[index];
+        source = MEMORY_SOURCE_POOL;
+
+        raw = cache->free_list;
+        if(LIKELY(raw != nullptr))
+        {
+            cache->free_list = *(void**)raw;
+            cache->count--;
+        }
+        else
+        {
+            raw = memory_pool_cache_refill(index, cache);
+        }
+    }
+    else if(total_size >= context->large_allocation_threshold)
+    {
+        // NOTE: Блок выровнен не меньше чем по обычной странице, поэтому смещение блока пользователя равно запасу.
+        //       Отображение округляется до обычной страницы, и блок размером 2 МиБ с заголовком не занимает 4 МиБ.
+        bool huge_pages = false;
+        raw = platform_memory_allocate_large(total_size, &huge_pages);
+        source = huge_pages ? MEMORY_SOURCE_HUGE : MEMORY_SOURCE_LARGE;
+    }
+    else if(context->backend == MEMORY_BACKEND_TLSF)
+    {
+        source = MEMORY_SOURCE_TLSF;
+
+        platform_spinlock_lock(&context->tlsf_lock);
+        raw = tlsf_allocator_allocate(&context->tlsf, total_size);
+        platform_spinlock_unlock(&context->tlsf_lock);
+    }
+    else
+    {
+        raw = platform_memory_allocate_aligned(total_size, padding);
+    }
+
+    if(!raw)
+    {
+        memory_format requested;
+        memory_get_format(size, &requested);
         LOG_ERROR("Memory system did not allocate the requested %.2f%s of memory.", requested.amount, requested.unit);
         LOG_FATAL("Failed to allocate memory. Stopping for debugging.");
         return nullptr;
     }
 
-    context->stats.total_allocated += size;
-    context->stats.tagged_allocated[tag] += size;
-    context->stats.allocation_count++;
+    void* block = POINTER_ALIGN_UP(POINTER_ADD_OFFSET(raw, MEMORY_HEADER_ALIGNMENT), padding);
+    memory_header* header = (memory_header*)block - 1;
+    header->size   = size;
+    header->magic  = MEMORY_HEADER_MAGIC_ALLOCATED;
+    header->offset = (u16)((usize)block - (usize)raw);
+    header->tag    = (u8)tag;
+    header->source = (u8)source;
+    header->site   = MEMORY_PROFILER_INVALID_SITE;
+
+    if(context->profiling)
+    {
+        header->site = memory_profiler_record_allocate(file, line, address, size);
+    }
+
+    memory_stats_add(tag, size, 1);
 
-    if(context->stats.peak_allocated < context->stats.total_allocated)
+    if(source == MEMORY_SOURCE_HUGE)
     {
-        context->stats.peak_allocated = context->stats.total_allocated;
+        platform_atomic_fetch_add_u64(&context->stats.huge_advised[tag], memory_huge_page_extent(total_size), PLATFORM_MEMORY_ORDER_RELAXED);
     }
 
     return block;
 }
 
+void* memory_allocate(u64 size, u16 alignment, memory_tag tag)
+{
+    // NOTE: Место вызова неизвестно, поэтому профилировщик различает вызовы по адресу возврата.
+    return memory_allocate_internal(size, alignment, tag, nullptr, 0, __builtin_return_address(0));
+}
+
+void* memory_allocate_site(u64 size, u16 alignment, memory_tag tag, const char* file, u32 line)
+{
+    return memory_allocate_internal(size, alignment, tag, file, line, nullptr);
+}
+
 void memory_free(void* block, u64 size, memory_tag tag)
 {
     ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
@@ -199,11 +1171,201 @@ void memory_free(void* block, u64 size, memory_tag tag)
     ASSERT(size > 0, "Size must be greater than zero.");
     ASSERT(tag < MEMORY_TAG_COUNT, "Tag must be between 0 and MEMORY_TAG_COUNT.");
 
-    platform_memory_free(block);
+    memory_header* header = (memory_header*)block - 1;
+
+    // Проверка соответствия освобождения выделению.
+    ASSERT(header->magic != MEMORY_HEADER_MAGIC_FREED, "Block %p is already freed (double free).", block);
+    ASSERT(header->magic == MEMORY_HEADER_MAGIC_ALLOCATED, "Block %p was not allocated by memory system.", block);
+    ASSERT(header->size == size, "Block %p size mismatch: allocated %llu, freed %llu.", block, header->size, size);
+    ASSERT(header->tag == tag, "Block %p tag mismatch: allocated %u, freed %u.", block, header->tag, tag);
+
+    header->magic = MEMORY_HEADER_MAGIC_FREED;
+    void* raw = POINTER_SUB_OFFSET(block, header->offset);
+
+    if(header->site != MEMORY_PROFILER_INVALID_SITE)
+    {
+        memory_profiler_record_free(header->site, size);
+    }
+
+    if(header->source == MEMORY_SOURCE_POOL)
+    {
+        u32 index = memory_pool_class_index(size + header->offset);
+        memory_pool_cache* cache = &memory_thread_cache_get()->pools[index];
+
+        // Блок возвращается в кэш текущего потока (не обязательно выделившего его), излишек - в пул.
+        *(void**)raw = cache->free_list;
+        cache->free_list = raw;
+        if(UNLIKELY(++cache->count == context->pool_batch_sizes[index]))
+        {
+            memory_pool_cache_flush(index, cache);
+        }
+    }
+    else if(header->source == MEMORY_SOURCE_LARGE || header->source == MEMORY_SOURCE_HUGE)
+    {
+        // Заголовок находится внутри освобождаемого отображения, поэтому читается до освобождения.
+        u64 total_size = size + header->offset;
+        if(header->source == MEMORY_SOURCE_HUGE)
+        {
+            platform_atomic_fetch_sub_u64(&context->stats.huge_advised[tag], memory_huge_page_extent(total_size), PLATFORM_MEMORY_ORDER_RELAXED);
+        }
+
+        platform_memory_free_large(raw, total_size);
+    }
+    else if(header->source == MEMORY_SOURCE_TLSF)
+    {
+        platform_spinlock_lock(&context->tlsf_lock);
+        tlsf_allocator_free(&context->tlsf, raw);
+        platform_spinlock_unlock(&context->tlsf_lock);
+    }
+    else
+    {
+        platform_memory_free_aligned(raw);
+    }
+
+    memory_stats_sub(tag, size, 1);
+}
+
+void* memory_frame_allocate(u64 size, u16 alignment)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+    platform_spinlock_lock(&context->frame_lock);
+    void* block = linear_allocator_allocate(&context->frame_allocator, size, alignment);
+    platform_spinlock_unlock(&context->frame_lock);
+    if(!block)
+    {
+        memory_format requested, capacity;
+        memory_get_format(size, &requested);
+        memory_get_format(context->frame_allocator.capacity, &capacity);
+        LOG_ERROR("Frame allocator is out of memory: requested %.2f %s, capacity %.2f %s.",
+            requested.amount, requested.unit, capacity.amount, capacity.unit
+        );
+        return nullptr;
+    }
+
+    return block;
+}
+
+bool memory_frame_extend(void* block, u64 size, u64 new_size)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+
+    platform_spinlock_lock(&context->frame_lock);
+    bool result = linear_allocator_extend(&context->frame_allocator, block, size, new_size);
+    platform_spinlock_unlock(&context->frame_lock);
+
+    return result;
+}
+
+void* memory_level_allocate(stack_allocator_side side, u64 size, u16 alignment)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+    platform_spinlock_lock(&context->level_lock);
+    void* block = stack_allocator_allocate(&context->level_allocator, side, size, alignment);
+    platform_spinlock_unlock(&context->level_lock);
+    if(!block)
+    {
+        memory_format requested, capacity;
+        memory_get_format(size, &requested);
+        memory_get_format(context->level_allocator.capacity, &capacity);
+        LOG_ERROR("Level allocator is out of memory: requested %.2f %s, capacity %.2f %s.",
+            requested.amount, requested.unit, capacity.amount, capacity.unit
+        );
+        return nullptr;
+    }
+
+    return block;
+}
+
+stack_allocator_marker memory_level_get_marker(stack_allocator_side side)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+
+    platform_spinlock_lock(&context->level_lock);
+    stack_allocator_marker marker = stack_allocator_get_marker(&context->level_allocator, side);
+    platform_spinlock_unlock(&context->level_lock);
+
+    return marker;
+}
+
+void memory_level_rollback(stack_allocator_side side, stack_allocator_marker marker)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+
+    platform_spinlock_lock(&context->level_lock);
+    stack_allocator_rollback(&context->level_allocator, side, marker);
+    platform_spinlock_unlock(&context->level_lock);
+}
+
+void* memory_reserve(u64 size)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+
+    u64 page_size = platform_memory_page_size();
+    size = (size + page_size - 1) & ~(page_size - 1);
+
+    void* address = platform_memory_reserve(size);
+    if(!address)
+    {
+        memory_format requested;
+        memory_get_format(size, &requested);
+        LOG_ERROR("Failed to reserve %.2f %s of virtual memory.", requested.amount, requested.unit);
+        return nullptr;
+    }
+
+    return address;
+}
+
+bool memory_commit(void* address, u64 size, memory_tag tag)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(address != nullptr, "Address must be non-null.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(tag < MEMORY_TAG_COUNT, "Tag must be between 0 and MEMORY_TAG_COUNT.");
+
+    if(!memory_budget_check(tag, size))
+    {
+        return false;
+    }
+
+    if(!platform_memory_commit(address, size))
+    {
+        memory_format requested;
+        memory_get_format(size, &requested);
+        LOG_ERROR("Failed to commit %.2f %s of virtual memory.", requested.amount, requested.unit);
+        return false;
+    }
+
+    memory_stats_add(tag, size, 0);
+
+    return true;
+}
+
+void memory_decommit(void* address, u64 size, memory_tag tag)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(address != nullptr, "Address must be non-null.");
+    ASSERT(size > 0, "Size must be greater than zero.");
+    ASSERT(tag < MEMORY_TAG_COUNT, "Tag must be between 0 and MEMORY_TAG_COUNT.");
+
+    platform_memory_decommit(address, size);
+    memory_stats_sub(tag, size, 0);
+}
+
+void memory_release(void* address, u64 size)
+{
+    ASSERT(context != nullptr, "Memory system not initialized. Call memory_system_initialize() first.");
+    ASSERT(address != nullptr, "Address must be non-null.");
+    ASSERT(size > 0, "Size must be greater than zero.");
 
-    context->stats.total_allocated -= size;
-    context->stats.tagged_allocated[tag] -= size;
-    context->stats.allocation_count--;
+    u64 page_size = platform_memory_page_size();
+    platform_memory_release(address, (size + page_size - 1) & ~(page_size - 1));
 }
 
 void memory_get_format(u64 size, memory_format* out_format)
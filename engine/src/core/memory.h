@@ -2,8 +2,8 @@
     @file memory.h
     @brief Интерфейс системы менеджмента и контроля памяти с тегированием.
     @author Дмитрий Скляр.
-    @version 1.1
-    @date 03-05-2026
+    @version 1.8
+    @date 16-10-2026
 
     @license Лицензия Apache, версия 2.0 («Лицензия»);
           Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
@@ -19,6 +19,16 @@
             - Обнаружение утечек памяти при завершении работы
             - Безопасные операции с памятью (обнуление, заполнение, копирование)
             - Автоматическое форматирование размеров памяти в читаемые единицы
+            - Покадровый линейный распределитель для временных данных кадра
+            - Пулы размерных классов (степени двойки до 2 КиБ) для небольших выделений
+            - Выбор распределителя общего назначения: платформенный или TLSF с ограниченным временем выделения
+            - Безопасное выделение и освобождение памяти из нескольких потоков
+            - Кэши свободных блоков пулов в потоках, пополняемые и сбрасываемые пакетами
+            - Резервирование виртуальной памяти с учетом зафиксированных страниц по тегам
+            - Размещение больших блоков на больших страницах (2 МиБ) с учетом их объема по тегам (по рекомендации)
+            - Профилирование выделений по местам вызова с историей по кадрам (включается конфигурацией)
+            - Бюджеты тегов с уведомлением о превышении и пиковое использование тегов за кадр
+            - Двусторонний стековый распределитель уровня с откатом к маркерам для загрузки уровней
 
     @note Для корректной работы необходимо предварительно инициализировать (в указанном порядке):
             - Подсистему консоли platform_console_initialize()
@@ -30,6 +40,8 @@
 
 #include <core/defines.h>
 #include <platform/memory.h>
+#include <core/allocators/stack_allocator.h>
+#include <core/string_builder.h>
 
 /**
     @brief Доступные теги для обозначения участка памяти (используется при профилировании и отладке).
@@ -42,6 +54,9 @@ typedef enum memory_tag {
     MEMORY_TAG_SYSTEM,      /**< Память используемая системами движка.                 */
     MEMORY_TAG_RENDERER,    /**< Память используемая рендерером.                       */
     MEMORY_TAG_TEXTURE,     /**< Память используемая для текстурны данных.             */
+    MEMORY_TAG_FRAME,       /**< Память покадрового распределителя.                    */
+    MEMORY_TAG_HASHMAP,     /**< Память используемая хеш-таблицами.                    */
+    MEMORY_TAG_QUEUE,       /**< Память используемая многопоточными очередями.         */
     MEMORY_TAG_COUNT        /**< Количество тегов памяти (не является реальным тегом). */
 } memory_tag;
 
@@ -53,12 +68,84 @@ typedef struct memory_format {
     f32 amount;
 } memory_format;
 
+// @brief Размер покадрового распределителя по умолчанию.
+#define MEMORY_FRAME_ALLOCATOR_DEFAULT_CAPACITY MEBIBYTES(4)
+
+// @brief Выравнивание по умолчанию для выделений из покадрового распределителя.
+#define MEMORY_FRAME_ALLOCATOR_DEFAULT_ALIGNMENT 16
+
+// @brief Размер распределителя уровня по умолчанию.
+#define MEMORY_LEVEL_ALLOCATOR_DEFAULT_CAPACITY MEBIBYTES(32)
+
+// @brief Выравнивание по умолчанию для выделений из распределителя уровня.
+#define MEMORY_LEVEL_ALLOCATOR_DEFAULT_ALIGNMENT 16
+
+// @brief Минимальный размер блока (с заголовком), выделяемого напрямую у платформы на больших страницах.
+#define MEMORY_LARGE_ALLOCATION_DEFAULT_THRESHOLD PLATFORM_MEMORY_HUGE_PAGE_SIZE
+
+// @brief Распределители общего назначения, обслуживающие выделения, не попадающие в пулы.
+typedef enum memory_backend {
+    // @brief Распределитель платформы (malloc/HeapAlloc).
+    MEMORY_BACKEND_PLATFORM,
+    // @brief Распределитель TLSF с ограниченным временем выделения над регионами виртуальной памяти.
+    MEMORY_BACKEND_TLSF,
+} memory_backend;
+
+// @brief Использование памяти тегом за кадр.
+typedef struct memory_tag_usage {
+    // @brief Использование памяти в конце кадра в байтах.
+    u64 current;
+    // @brief Пиковое использование памяти в течение кадра в байтах.
+    // NOTE: Потоки отслеживают наибольшие значения своих счетчиков при выделениях, и в конце кадра они
+    //       суммируются, поэтому пик внутри кадра не теряется, но может быть оценен сверху, если потоки
+    //       достигали наибольших значений в разное время.
+    u64 peak;
+    // @brief Бюджет тега в байтах (0 - без ограничения).
+    u64 budget;
+} memory_tag_usage;
+
+/*
+    @brief Callback-функция, вызываемая при превышении бюджета тега.
+    @note Вызывается не чаще одного раза за кадр для каждого тега, в потоке, выполняющем выделение.
+    @param tag Тег памяти, бюджет которого превышен.
+    @param budget Бюджет тега в байтах.
+    @param usage Использование памяти тегом до выделения в байтах.
+    @param requested Запрошенный размер выделения в байтах.
+    @param user_data Пользовательские данные, указанные в конфигурации.
+*/
+typedef void (*memory_budget_callback)(memory_tag tag, u64 budget, u64 usage, u64 requested, void* user_data);
+
+// @brief Конфигурация системы менеджмента и контроля памяти.
+typedef struct memory_system_config {
+    // @brief Размер покадрового распределителя в байтах (0 - размер по умолчанию).
+    u64 frame_allocator_capacity;
+    // @brief Размер распределителя уровня в байтах (0 - размер по умолчанию).
+    u64 level_allocator_capacity;
+    // @brief Распределитель общего назначения.
+    memory_backend backend;
+    // @brief Минимальный размер региона распределителя TLSF в байтах (0 - размер по умолчанию).
+    u64 tlsf_region_size;
+    // @brief Минимальный размер блока для размещения на больших страницах в байтах (0 - размер по умолчанию).
+    u64 large_allocation_threshold;
+    // @brief Включить профилировщик выделений по местам вызова (замедляет выделения).
+    bool profile_allocations;
+    // @brief Бюджеты тегов в байтах (0 - без ограничения).
+    u64 tag_budgets[MEMORY_TAG_COUNT];
+    // @brief Отказывать в выделениях, превышающих бюджет (иначе только уведомлять).
+    bool strict_budgets;
+    // @brief Callback-функция уведомления о превышении бюджета (nullptr - предупреждение в журнал).
+    memory_budget_callback on_budget_overrun;
+    // @brief Пользовательские данные для on_budget_overrun.
+    void* budget_user_data;
+} memory_system_config;
+
 /*
     @brief Инициализирует систему менеджмента и контроля памяти.
     @note Должна быть вызвана один раз при старте приложения.
+    @param config Указатель на конфигурацию системы (может быть nullptr для настроек по умолчанию).
     @return true - инициализация завершилась успешно, false - произошла ошибка.
 */
-bool memory_system_initialize();
+bool memory_system_initialize(const memory_system_config* config);
 
 /*
     @brief Останавливает систему менеджмента и контроля памяти.
@@ -74,15 +161,64 @@ void memory_system_shutdown();
 */
 CORE_API bool memory_system_is_initialized();
 
+/*
+    @brief Завершает кадр системы памяти: освобождает все выделения покадрового распределителя
+           и фиксирует использование памяти по тегам за кадр.
+    @note Вызывается приложением в конце каждой итерации главного цикла.
+    @warning Не thread-safe. Должна вызываться из основного потока.
+*/
+void memory_system_frame_end();
+
+/*
+    @brief Изменяет бюджет тега.
+    @note Thread-safe. Новый бюджет применяется к последующим выделениям.
+    @param tag Тег памяти.
+    @param budget Бюджет в байтах (0 - без ограничения).
+*/
+CORE_API void memory_system_set_tag_budget(memory_tag tag, u64 budget);
+
+/*
+    @brief Копирует использование памяти по тегам за последний завершенный кадр.
+    @param out_usage Массив из MEMORY_TAG_COUNT элементов для записи использования.
+*/
+CORE_API void memory_system_tag_usage(memory_tag_usage* out_usage);
+
+/*
+    @brief Добавляет информацию об использовании памяти по тегам и распределителям в построитель строк.
+    @note Thread-safe. Общее использование вычисляется по снимку счетчиков тегов и всегда равно их сумме.
+    @param builder Указатель на построитель строк.
+*/
+CORE_API void memory_system_usage_write(string_builder* builder);
+
 /*
     @brief Возвращает строку с информацией об использовании памяти по тегам.
-    @note После использования освободить с использованием string_free.
+    @note Строка размещается в покадровом распределителе: действительна до конца текущего кадра
+          (см. memory_system_frame_end()) и не требует освобождения.
+    @note Thread-safe. Общее использование вычисляется по снимку счетчиков тегов и всегда равно их сумме.
     @return Строка с отформатированной статистикой использования памяти.
 */
 CORE_API const char* memory_system_usage_str();
 
+/*
+    @brief Возвращает отчет профилировщика о местах вызова с наибольшим количеством выделений.
+    @note Требует включенного профилирования (memory_system_config.profile_allocations).
+    @note Строка размещается в покадровом распределителе: действительна до конца текущего кадра
+          (см. memory_system_frame_end()) и не требует освобождения.
+    @param top_count Количество мест вызова в отчете (не больше 32).
+    @param frame_count Количество последних завершенных кадров для подсчета (не больше 63).
+    @return Строка с отчетом: выделения и байты за кадр, живые выделения и место вызова.
+*/
+CORE_API const char* memory_system_profile_str(u32 top_count, u32 frame_count);
+
 /*
     @brief Выделяет блок памяти с указанием размера, выравнивания и тегом.
+    @note Перед блоком размещается служебный заголовок, поэтому при освобождении выравнивание не требуется.
+    @note Небольшие блоки (с заголовком до 2 КиБ и выравниванием до 16 байт) выделяются из пулов за O(1).
+    @note Большие блоки (от MEMORY_LARGE_ALLOCATION_DEFAULT_THRESHOLD) выделяются напрямую у платформы
+          по возможности на больших страницах, минуя распределитель общего назначения.
+    @note Thread-safe. Статистика обновляется атомарно, распределители защищены раздельными блокировками.
+    @note При превышении бюджета тега вызывается on_budget_overrun, а в строгом режиме возвращается nullptr.
+          Одновременные выделения в нескольких потоках могут превысить бюджет на их суммарный размер.
     @param size Размер выделяемой памяти в байтах.
     @param alignment Требуемое выравнивание (степень двойки).
     @param tag Тег памяти для отслеживания.
@@ -90,15 +226,111 @@ CORE_API const char* memory_system_usage_str();
 */
 CORE_API void* memory_allocate(u64 size, u16 alignment, memory_tag tag);
 
+/*
+    @brief Выделяет блок памяти с указанием места вызова для профилировщика выделений.
+    @note Используется макросом mallocate(). Без профилирования эквивалентна memory_allocate().
+    @param size Размер выделяемой памяти в байтах.
+    @param alignment Требуемое выравнивание (степень двойки).
+    @param tag Тег памяти для отслеживания.
+    @param file Имя файла места вызова (строковый литерал __FILE__).
+    @param line Номер строки места вызова.
+    @return Указатель на выделенную память или nullptr при ошибке.
+*/
+CORE_API void* memory_allocate_site(u64 size, u16 alignment, memory_tag tag, const char* file, u32 line);
+
 /*
     @brief Освобождает ранее выделенный блок памяти.
     @note Использование указателя после освобождения приведет к непредсказуемому поведению!
+    @note В отладочной сборке проверяет соответствие размера и тега выделению, а также повторное освобождение.
+    @note Thread-safe. Блок может быть освобожден в потоке, отличном от потока выделения.
     @param block Указатель на блок памяти для освобождения.
     @param size Размер освобождаемой памяти в байтах.
     @param tag Тег памяти (должен соответствовать тегу выделения).
 */
 CORE_API void memory_free(void* block, u64 size, memory_tag tag);
 
+/*
+    @brief Выделяет блок памяти из покадрового распределителя.
+    @note Память действительна только до конца текущего кадра (см. memory_system_frame_end()) и не требует
+          освобождения. Выделение сводится к смещению указателя и не обращается к общей куче.
+    @note Thread-safe, но вызовы из других потоков не должны пересекаться с memory_system_frame_end().
+    @param size Размер выделяемой памяти в байтах.
+    @param alignment Требуемое выравнивание (степень двойки).
+    @return Указатель на выделенную память или nullptr, если память покадрового распределителя исчерпана.
+*/
+CORE_API void* memory_frame_allocate(u64 size, u16 alignment);
+
+/*
+    @brief Увеличивает размер блока покадрового распределителя на месте.
+    @note Увеличение возможно только для последнего выделения покадрового распределителя.
+    @note Thread-safe, но вызовы из других потоков не должны пересекаться с memory_system_frame_end().
+    @param block Указатель на блок, полученный из memory_frame_allocate().
+    @param size Текущий размер блока в байтах.
+    @param new_size Новый размер блока в байтах (не меньше текущего).
+    @return true - блок увеличен, false - блок не последний или память покадрового распределителя исчерпана.
+*/
+CORE_API bool memory_frame_extend(void* block, u64 size, u64 new_size);
+
+/*
+    @brief Выделяет блок памяти из двустороннего стекового распределителя уровня.
+    @note Нижний стек предназначен для долгоживущих данных уровня, верхний - для временных данных загрузчика.
+          Выделения не освобождаются по отдельности, а откатываются к маркеру (см. memory_level_rollback()).
+    @note Thread-safe, но откат не должен пересекаться с использованием освобождаемой памяти в других потоках.
+    @param side Сторона распределителя.
+    @param size Размер выделяемой памяти в байтах.
+    @param alignment Требуемое выравнивание (степень двойки).
+    @return Указатель на выделенную память или nullptr, если память распределителя уровня исчерпана.
+*/
+CORE_API void* memory_level_allocate(stack_allocator_side side, u64 size, u16 alignment);
+
+/*
+    @brief Возвращает маркер текущего положения стека распределителя уровня.
+    @param side Сторона распределителя.
+    @return Маркер для передачи в memory_level_rollback().
+*/
+CORE_API stack_allocator_marker memory_level_get_marker(stack_allocator_side side);
+
+/*
+    @brief Освобождает все выделения стека распределителя уровня, сделанные после получения маркера.
+    @note Использование освобожденных указателей приведет к непредсказуемому поведению!
+    @param side Сторона распределителя (должна совпадать со стороной маркера).
+    @param marker Маркер, полученный memory_level_get_marker().
+*/
+CORE_API void memory_level_rollback(stack_allocator_side side, stack_allocator_marker marker);
+
+/*
+    @brief Резервирует диапазон виртуальных адресов без выделения физической памяти.
+    @note Зарезервированная память не учитывается в статистике до фиксации страниц (см. memory_commit()).
+    @param size Размер диапазона в байтах (округляется вверх до размера страницы).
+    @return Указатель на начало диапазона (выровнен по странице) или nullptr при ошибке.
+*/
+CORE_API void* memory_reserve(u64 size);
+
+/*
+    @brief Фиксирует страницы зарезервированного диапазона и учитывает их размер по тегу.
+    @param address Адрес начала участка (выровнен по странице).
+    @param size Размер участка в байтах (кратный размеру страницы).
+    @param tag Тег памяти для отслеживания.
+    @return true - страницы доступны для чтения и записи, false - произошла ошибка.
+*/
+CORE_API bool memory_commit(void* address, u64 size, memory_tag tag);
+
+/*
+    @brief Возвращает системе физическую память страниц и исключает их размер из статистики тега.
+    @param address Адрес начала участка (выровнен по странице).
+    @param size Размер участка в байтах (кратный размеру страницы).
+    @param tag Тег памяти (должен соответствовать тегу фиксации).
+*/
+CORE_API void memory_decommit(void* address, u64 size, memory_tag tag);
+
+/*
+    @brief Освобождает диапазон, зарезервированный с помощью memory_reserve().
+    @note Зафиксированные страницы должны быть предварительно возвращены через memory_decommit().
+    @param address Адрес начала диапазона.
+    @param size Размер диапазона в байтах (тот же, что и при резервировании).
+*/
+CORE_API void memory_release(void* address, u64 size);
+
 /*
     @brief Форматирует размер памяти в наиболее подходящие единицы измерения.
     @note Функция автоматически выбирает наиболее читаемые единицы из:
@@ -110,11 +342,34 @@ CORE_API void memory_get_format(u64 size, memory_format* out_format);
 
 /*
     @brief Макрос выделения памяти без выравнивания (выравнивание = 1).
+    @note Передает профилировщику выделений файл и строку места вызова.
     @param size Размер выделяемой памяти в байтах.
     @param tag Тег категории памяти.
     @return Указатель на выделенную память или nullptr при ошибке.
 */
-#define mallocate(size, tag) memory_allocate(size, 1, tag)
+#define mallocate(size, tag) memory_allocate_site(size, 1, tag, __FILE__, __LINE__)
+
+/*
+    @brief Макрос выделения памяти из покадрового распределителя с выравниванием по умолчанию.
+    @note Память действительна только до конца текущего кадра и не требует освобождения.
+    @param size Размер выделяемой памяти в байтах.
+    @return Указатель на выделенную память или nullptr при ошибке.
+*/
+#define memory_frame_alloc(size) memory_frame_allocate(size, MEMORY_FRAME_ALLOCATOR_DEFAULT_ALIGNMENT)
+
+/*
+    @brief Макрос выделения долгоживущей памяти уровня (нижний стек) с выравниванием по умолчанию.
+    @param size Размер выделяемой памяти в байтах.
+    @return Указатель на выделенную память или nullptr при ошибке.
+*/
+#define memory_level_alloc(size) memory_level_allocate(STACK_ALLOCATOR_SIDE_BOTTOM, size, MEMORY_LEVEL_ALLOCATOR_DEFAULT_ALIGNMENT)
+
+/*
+    @brief Макрос выделения временной памяти загрузчика уровня (верхний стек) с выравниванием по умолчанию.
+    @param size Размер выделяемой памяти в байтах.
+    @return Указатель на выделенную память или nullptr при ошибке.
+*/
+#define memory_level_scratch_alloc(size) memory_level_allocate(STACK_ALLOCATOR_SIDE_TOP, size, MEMORY_LEVEL_ALLOCATOR_DEFAULT_ALIGNMENT)
 
 /*
     @brief Макрос освобождения памяти.
@@ -0,0 +1,275 @@
+#include "core/memory_profiler.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "debug/assert.h"
+#include "platform/memory.h"
+#include "platform/thread.h"
+
+// Размер хеш-таблицы мест вызова (вдвое больше количества мест для коротких цепочек пробирования).
+#define MEMORY_PROFILER_TABLE_SIZE (MEMORY_PROFILER_MAX_SITES * 2)
+
+STATIC_ASSERT(IS_POWER_OF_TWO(MEMORY_PROFILER_TABLE_SIZE), "Profiler table size must be a power of two.");
+STATIC_ASSERT(IS_POWER_OF_TWO(MEMORY_PROFILER_FRAME_HISTORY), "Profiler history must be a power of two.");
+STATIC_ASSERT(MEMORY_PROFILER_MAX_SITES < U16_MAX, "Profiler site index must fit in 16 bits.");
+
+// Счетчики выделений одного кадра.
+typedef struct memory_profiler_frame {
+    // Количество выделений за кадр.
+    u32 allocations;
+    // Объем выделений за кадр в байтах (насыщающийся).
+    u32 bytes;
+} memory_profiler_frame;
+
+// Место вызова выделения памяти.
+typedef struct memory_profiler_site {
+    // Имя файла (nullptr, если место определено адресом возврата).
+    const char* file;
+    // Адрес возврата (если имя файла неизвестно).
+    const void* address;
+    // Номер строки.
+    u32 line;
+    // Общее количество выделений.
+    u64 total_allocations;
+    // Общий объем выделений в байтах.
+    u64 total_bytes;
+    // Количество неосвобожденных выделений.
+    u64 live_allocations;
+    // Объем неосвобожденных выделений в байтах.
+    u64 live_bytes;
+    // История выделений по кадрам (кольцевой буфер, текущий кадр - frame_index).
+    memory_profiler_frame frames[MEMORY_PROFILER_FRAME_HISTORY];
+} memory_profiler_site;
+
+typedef struct memory_profiler_context {
+    // Блокировка профилировщика.
+    platform_spinlock lock;
+    // Номер текущего кадра.
+    u64 frame_index;
+    // Количество мест вызова (индекс 0 не используется).
+    u32 site_count;
+    // Количество выделений, не попавших в таблицу из-за ее заполнения.
+    u64 dropped_allocations;
+    // Хеш-таблица: индексы мест вызова (0 - пустая ячейка).
+    u16 table[MEMORY_PROFILER_TABLE_SIZE];
+    // Места вызова.
+    memory_profiler_site sites[MEMORY_PROFILER_MAX_SITES + 1];
+} memory_profiler_context;
+
+static memory_profiler_context* context = nullptr;
+
+INLINE u64 memory_profiler_hash(const void* key, u32 line)
+{
+    // Перемешивание указателя и строки (финализатор splitmix64).
+    u64 hash = (u64)(usize)key ^ ((u64)line << 32);
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+bool memory_profiler_initialize()
+{
+    ASSERT(context == nullptr, "Memory profiler is already initialized.");
+
+    // NOTE: Память профилировщика не учитывается системой памяти, чтобы не искажать статистику.
+    context = platform_memory_allocate(sizeof(memory_profiler_context));
+    if(!context)
+    {
+        LOG_ERROR("Failed to allocate memory for memory profiler.");
+        return false;
+    }
+    platform_memory_zero(context, sizeof(memory_profiler_context));
+
+    return true;
+}
+
+void memory_profiler_shutdown()
+{
+    ASSERT(context != nullptr, "Memory profiler not initialized. Call memory_profiler_initialize() first.");
+
+    if(context->dropped_allocations > 0)
+    {
+        LOG_WARN("Memory profiler site table overflowed, %llu allocations were not attributed.", context->dropped_allocations);
+    }
+
+    platform_memory_free(context);
+    context = nullptr;
+}
+
+bool memory_profiler_is_initialized()
+{
+    return context != nullptr;
+}
+
+u16 memory_profiler_record_allocate(const char* file, u32 line, const void* address, u64 size)
+{
+    ASSERT(context != nullptr, "Memory profiler not initialized. Call memory_profiler_initialize() first.");
+
+    const void* key = file ? (const void*)file : address;
+    u32 slot = (u32)memory_profiler_hash(key, line) & (MEMORY_PROFILER_TABLE_SIZE - 1);
+
+    platform_spinlock_lock(&context->lock);
+
+    // Поиск места вызова линейным пробированием.
+    // NOTE: Сравниваются указатели на имена файлов: __FILE__ одного места вызова всегда дает один и тот же литерал.
+    u16 index = MEMORY_PROFILER_INVALID_SITE;
+    while(context->table[slot] != MEMORY_PROFILER_INVALID_SITE)
+    {
+        memory_profiler_site* site = &context->sites[context->table[slot]];
+        if(site->line == line && (file ? site->file == file : (site->file == nullptr && site->address == address)))
+        {
+            index = context->table[slot];
+            break;
+        }
+        slot = (slot + 1) & (MEMORY_PROFILER_TABLE_SIZE - 1);
+    }
+
+    // Добавление нового места вызова.
+    if(index == MEMORY_PROFILER_INVALID_SITE)
+    {
+        if(context->site_count >= MEMORY_PROFILER_MAX_SITES)
+        {
+            context->dropped_allocations++;
+            platform_spinlock_unlock(&context->lock);
+            return MEMORY_PROFILER_INVALID_SITE;
+        }
+
+        index = (u16)(++context->site_count);
+        context->table[slot] = index;
+
+        memory_profiler_site* site = &context->sites[index];
+        site->file = file;
+        site->address = file ? nullptr : address;
+        site->line = line;
+    }
+
+    memory_profiler_site* site = &context->sites[index];
+    site->total_allocations++;
+    site->total_bytes += size;
+    site->live_allocations++;
+    site->live_bytes += size;
+
+    memory_profiler_frame* frame = &site->frames[context->frame_index & (MEMORY_PROFILER_FRAME_HISTORY - 1)];
+    frame->allocations++;
+    frame->bytes = (u32)MIN((u64)frame->bytes + size, (u64)U32_MAX);
+
+    platform_spinlock_unlock(&context->lock);
+    return index;
+}
+
+void memory_profiler_record_free(u16 site, u64 size)
+{
+    ASSERT(context != nullptr, "Memory profiler not initialized. Call memory_profiler_initialize() first.");
+
+    if(site == MEMORY_PROFILER_INVALID_SITE)
+    {
+        return;
+    }
+
+    platform_spinlock_lock(&context->lock);
+    context->sites[site].live_allocations--;
+    context->sites[site].live_bytes -= size;
+    platform_spinlock_unlock(&context->lock);
+}
+
+void memory_profiler_frame_end()
+{
+    ASSERT(context != nullptr, "Memory profiler not initialized. Call memory_profiler_initialize() first.");
+
+    platform_spinlock_lock(&context->lock);
+
+    // Переход к следующему кадру и очистка его ячейки истории (в ней хранился самый старый кадр).
+    context->frame_index++;
+    u32 slot = (u32)(context->frame_index & (MEMORY_PROFILER_FRAME_HISTORY - 1));
+    for(u32 i = 1; i <= context->site_count; ++i)
+    {
+        context->sites[i].frames[slot].allocations = 0;
+        context->sites[i].frames[slot].bytes = 0;
+    }
+
+    platform_spinlock_unlock(&context->lock);
+}
+
+void memory_profiler_report(string_builder* builder, u32 top_count, u32 frame_count)
+{
+    ASSERT(context != nullptr, "Memory profiler not initialized. Call memory_profiler_initialize() first.");
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+
+    platform_spinlock_lock(&context->lock);
+
+    // Учитываются только завершенные кадры.
+    frame_count = (u32)MIN((u64)MIN(frame_count, (u32)MEMORY_PROFILER_FRAME_HISTORY - 1), context->frame_index);
+
+    // Выборка мест вызова с наибольшим количеством выделений за последние кадры (частичная сортировка вставками).
+    u16 top_sites[MEMORY_PROFILER_REPORT_MAX_SITES];
+    u64 top_allocations[MEMORY_PROFILER_REPORT_MAX_SITES];
+    u64 top_bytes[MEMORY_PROFILER_REPORT_MAX_SITES];
+    u32 found = 0;
+    top_count = MIN(top_count, (u32)MEMORY_PROFILER_REPORT_MAX_SITES);
+
+    for(u32 i = 1; i <= context->site_count && top_count > 0; ++i)
+    {
+        u64 allocations = 0, bytes = 0;
+        for(u32 f = 1; f <= frame_count; ++f)
+        {
+            const memory_profiler_frame* frame = &context->sites[i].frames[(context->frame_index - f) & (MEMORY_PROFILER_FRAME_HISTORY - 1)];
+            allocations += frame->allocations;
+            bytes += frame->bytes;
+        }
+
+        if(allocations == 0 || (found == top_count && allocations <= top_allocations[found - 1]))
+        {
+            continue;
+        }
+
+        u32 position = found < top_count ? found++ : found - 1;
+        while(position > 0 && top_allocations[position - 1] < allocations)
+        {
+            top_sites[position] = top_sites[position - 1];
+            top_allocations[position] = top_allocations[position - 1];
+            top_bytes[position] = top_bytes[position - 1];
+            position--;
+        }
+
+        top_sites[position] = (u16)i;
+        top_allocations[position] = allocations;
+        top_bytes[position] = bytes;
+    }
+
+    string_builder_append_format(builder, "Allocation sites: %u (top %u over last %u frames)\n",
+        context->site_count, found, frame_count
+    );
+
+    for(u32 i = 0; i < found; ++i)
+    {
+        const memory_profiler_site* site = &context->sites[top_sites[i]];
+
+        memory_format bytes, live;
+        memory_get_format(top_bytes[i] / MAX(frame_count, 1U), &bytes);
+        memory_get_format(site->live_bytes, &live);
+
+        f32 allocations_per_frame = (f32)top_allocations[i] / (f32)MAX(frame_count, 1U);
+
+        // Место вызова: файл и строка или адрес возврата.
+        if(site->file)
+        {
+            string_builder_append_format(builder,
+                "  %8.1f allocs/frame %7.2f %s/frame, live %6llu (%.2f %s), total %8llu: %s:%u\n",
+                allocations_per_frame, bytes.amount, bytes.unit, site->live_allocations, live.amount, live.unit,
+                site->total_allocations, site->file, site->line
+            );
+        }
+        else
+        {
+            string_builder_append_format(builder,
+                "  %8.1f allocs/frame %7.2f %s/frame, live %6llu (%.2f %s), total %8llu: %p\n",
+                allocations_per_frame, bytes.amount, bytes.unit, site->live_allocations, live.amount, live.unit,
+                site->total_allocations, site->address
+            );
+        }
+    }
+
+    platform_spinlock_unlock(&context->lock);
+}
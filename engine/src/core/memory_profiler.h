@@ -0,0 +1,92 @@
+/*
+    @file memory_profiler.h
+    @brief Интерфейс профилировщика выделений памяти по местам вызова.
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Учет количества и объема выделений для каждого места вызова (файл и строка или адрес возврата)
+            - Учет живых (неосвобожденных) выделений каждого места вызова
+            - Историю выделений по кадрам для поиска мест с наибольшей частотой выделений
+
+    @note Особенности реализации:
+            - Используется системой памяти и включается конфигурацией memory_system_config
+            - Места вызова хранятся в хеш-таблице с открытой адресацией фиксированного размера
+            - Индекс места вызова хранится в заголовке блока, что позволяет учитывать освобождения
+            - Все операции защищены спин-блокировкой, поэтому режим профилирования замедляет выделения
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/string_builder.h>
+
+// @brief Максимальное количество отслеживаемых мест вызова.
+#define MEMORY_PROFILER_MAX_SITES        2048
+
+// @brief Количество кадров в истории выделений.
+#define MEMORY_PROFILER_FRAME_HISTORY    64
+
+// @brief Максимальное количество мест вызова в отчете.
+#define MEMORY_PROFILER_REPORT_MAX_SITES 32
+
+// @brief Индекс места вызова, означающий отсутствие записи (профилирование выключено или таблица заполнена).
+#define MEMORY_PROFILER_INVALID_SITE     0
+
+/*
+    @brief Инициализирует профилировщик выделений памяти.
+    @note Вызывается системой памяти при включенном профилировании.
+    @return true - инициализация успешна, false - произошла ошибка.
+*/
+bool memory_profiler_initialize();
+
+/*
+    @brief Завершает работу профилировщика выделений памяти.
+*/
+void memory_profiler_shutdown();
+
+/*
+    @brief Проверяет, был ли инициализирован профилировщик выделений памяти.
+    @return true - профилировщик инициализирован, false - профилировщик не инициализирован.
+*/
+bool memory_profiler_is_initialized();
+
+/*
+    @brief Учитывает выделение памяти в месте вызова.
+    @note Место вызова определяется файлом и строкой, а при их отсутствии - адресом возврата.
+    @param file Имя файла места вызова (может быть nullptr).
+    @param line Номер строки места вызова.
+    @param address Адрес возврата места вызова (используется, если file равен nullptr).
+    @param size Размер выделения в байтах.
+    @return Индекс места вызова для сохранения в заголовке блока или MEMORY_PROFILER_INVALID_SITE.
+*/
+u16 memory_profiler_record_allocate(const char* file, u32 line, const void* address, u64 size);
+
+/*
+    @brief Учитывает освобождение памяти, выделенной в месте вызова.
+    @param site Индекс места вызова, полученный при выделении.
+    @param size Размер освобождаемой памяти в байтах.
+*/
+void memory_profiler_record_free(u16 site, u64 size);
+
+/*
+    @brief Завершает кадр профилировщика: сохраняет счетчики кадра в историю.
+*/
+void memory_profiler_frame_end();
+
+/*
+    @brief Добавляет в построитель строк отчет о местах вызова с наибольшим количеством выделений за последние кадры.
+    @param builder Указатель на построитель строк.
+    @param top_count Количество мест вызова в отчете.
+    @param frame_count Количество последних завершенных кадров (не больше MEMORY_PROFILER_FRAME_HISTORY).
+*/
+void memory_profiler_report(string_builder* builder, u32 top_count, u32 frame_count);
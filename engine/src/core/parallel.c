@@ -0,0 +1,129 @@
+#include "core/parallel.h"
+#include "core/job.h"
+#include "platform/thread.h"
+#include "debug/assert.h"
+
+// Количество пакетов на поток: мелкое дробление выравнивает нагрузку при разной стоимости элементов.
+#define PARALLEL_FOR_BATCHES_PER_THREAD 4
+
+typedef struct parallel_for_context {
+    // Функция обработки пакета индексов (nullptr - обрабатывается массив).
+    parallel_for_fn func;
+    // Функция обработки пакета элементов массива.
+    parallel_for_array_fn array_func;
+    // Пользовательские данные.
+    void* user;
+    // Элементы массива.
+    u8* elements;
+    // Размер элемента массива в байтах.
+    u64 stride;
+    // Количество элементов.
+    u64 count;
+    // Размер пакета.
+    u64 batch_size;
+    // Количество пакетов.
+    u64 batch_count;
+    // Индекс следующего необработанного пакета.
+    PLATFORM_CACHE_ALIGNED u64 next_batch;
+} parallel_for_context;
+
+// Обрабатывает пакеты, пока они не закончатся.
+static void parallel_for_run(parallel_for_context* context)
+{
+    for(;;)
+    {
+        u64 batch = platform_atomic_fetch_add_u64(&context->next_batch, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+        if(batch >= context->batch_count)
+        {
+            break;
+        }
+
+        u64 begin = batch * context->batch_size;
+        u64 end = MIN(begin + context->batch_size, context->count);
+
+        if(context->func)
+        {
+            context->func(begin, end, context->user);
+        }
+        else
+        {
+            context->array_func(context->elements + begin * context->stride, begin, end, context->user);
+        }
+    }
+}
+
+static void parallel_for_job(void* data)
+{
+    parallel_for_run(data);
+}
+
+static void parallel_for_dispatch(parallel_for_context* context, u64 min_batch)
+{
+    if(context->count == 0)
+    {
+        return;
+    }
+
+    context->batch_size = parallel_for_batch_size(context->count, min_batch);
+    context->batch_count = (context->count + context->batch_size - 1) / context->batch_size;
+    context->next_batch = 0;
+
+    u32 worker_count = job_system_is_initialized() ? job_system_worker_count() : 0;
+    u32 job_count = (u32)MIN(context->batch_count - 1, (u64)worker_count);
+
+    if(job_count == 0)
+    {
+        parallel_for_run(context);
+        return;
+    }
+
+    job_decl jobs[JOB_SYSTEM_MAX_WORKERS];
+    for(u32 i = 0; i < job_count; ++i)
+    {
+        jobs[i].func = parallel_for_job;
+        jobs[i].data = context;
+    }
+
+    job_counter counter = { 0 };
+    job_run(jobs, job_count, &counter);
+
+    // Вызывающий поток обрабатывает пакеты наравне с рабочими.
+    parallel_for_run(context);
+    job_wait(&counter);
+}
+
+u64 parallel_for_batch_size(u64 count, u64 min_batch)
+{
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    u64 thread_count = job_system_is_initialized() ? job_system_worker_count() + 1 : 1;
+    u64 batch_count = thread_count * PARALLEL_FOR_BATCHES_PER_THREAD;
+    u64 batch_size = (count + batch_count - 1) / batch_count;
+
+    return MAX(batch_size, MAX(min_batch, 1ULL));
+}
+
+void parallel_for(u64 count, u64 min_batch, parallel_for_fn func, void* user)
+{
+    ASSERT(func != nullptr, "Function pointer must be non-null.");
+
+    parallel_for_context context = {
+        .func = func, .user = user, .count = count
+    };
+    parallel_for_dispatch(&context, min_batch);
+}
+
+void parallel_for_array(void* elements, u64 stride, u64 count, u64 min_batch, parallel_for_array_fn func, void* user)
+{
+    ASSERT(elements != nullptr || count == 0, "Elements pointer must be non-null.");
+    ASSERT(stride > 0, "Stride must be greater than zero.");
+    ASSERT(func != nullptr, "Function pointer must be non-null.");
+
+    parallel_for_context context = {
+        .array_func = func, .user = user, .elements = elements, .stride = stride, .count = count
+    };
+    parallel_for_dispatch(&context, min_batch);
+}
@@ -0,0 +1,96 @@
+/*
+    @file parallel.h
+    @brief Параллельная обработка диапазонов индексов и массивов с помощью системы задач.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Вызов функции для диапазона индексов [0, count), разбитого на пакеты (parallel_for)
+            - Вызов функции для элементов массива и динамического массива (darray) пакетами
+
+    @note Особенности реализации:
+            - Размер пакета выбирается по количеству элементов и потоков: на каждый поток приходится несколько
+              пакетов, чтобы неравномерная нагрузка выравнивалась, но не меньше min_batch элементов
+            - Границы пакетов зависят только от count, min_batch и количества рабочих потоков, поэтому при
+              одинаковом количестве потоков результат поэлементных вычислений и частичных сумм по пакетам
+              воспроизводим (меняется лишь поток, обрабатывающий пакет)
+            - Потоки забирают пакеты атомарным счетчиком: запускается не больше задач, чем рабочих потоков,
+              вызывающий поток тоже обрабатывает пакеты
+            - Если пакет один или система задач не инициализирована, функция вызывается в текущем потоке
+            - Функция возвращает управление после обработки всех пакетов
+
+    @note Для параллельного выполнения необходимо предварительно инициализировать систему задач job_system_initialize().
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+/*
+    @brief Функция обработки пакета индексов.
+    @note Вызывается одновременно из нескольких потоков для разных пакетов.
+    @param begin Первый индекс пакета.
+    @param end Индекс, следующий за последним индексом пакета.
+    @param user Пользовательские данные.
+*/
+typedef void (*parallel_for_fn)(u64 begin, u64 end, void* user);
+
+/*
+    @brief Функция обработки пакета элементов массива.
+    @note Вызывается одновременно из нескольких потоков для разных пакетов.
+    @param elements Указатель на первый элемент пакета (элемент с индексом begin).
+    @param begin Индекс первого элемента пакета.
+    @param end Индекс, следующий за последним элементом пакета.
+    @param user Пользовательские данные.
+*/
+typedef void (*parallel_for_array_fn)(void* elements, u64 begin, u64 end, void* user);
+
+/*
+    @brief Возвращает размер пакета, который будет выбран для указанного количества элементов.
+    @note Позволяет заранее выделить место для частичных результатов по пакетам (индекс пакета - begin / размер).
+    @param count Количество элементов.
+    @param min_batch Минимальный размер пакета (0 - один элемент).
+    @return Размер пакета в элементах (0, если count равен 0).
+*/
+CORE_API u64 parallel_for_batch_size(u64 count, u64 min_batch);
+
+/*
+    @brief Вызывает функцию для пакетов диапазона индексов [0, count) на рабочих потоках.
+    @note Thread-safe. Может вызываться из задачи.
+    @param count Количество индексов.
+    @param min_batch Минимальный размер пакета (0 - один элемент).
+    @param func Функция обработки пакета.
+    @param user Пользовательские данные.
+*/
+CORE_API void parallel_for(u64 count, u64 min_batch, parallel_for_fn func, void* user);
+
+/*
+    @brief Вызывает функцию для пакетов элементов массива на рабочих потоках.
+    @note Thread-safe. Может вызываться из задачи.
+    @param elements Указатель на массив элементов.
+    @param stride Размер элемента в байтах.
+    @param count Количество элементов.
+    @param min_batch Минимальный размер пакета (0 - один элемент).
+    @param func Функция обработки пакета.
+    @param user Пользовательские данные.
+*/
+CORE_API void parallel_for_array(void* elements, u64 stride, u64 count, u64 min_batch, parallel_for_array_fn func, void* user);
+
+/*
+    @brief Вызывает функцию для пакетов элементов динамического массива на рабочих потоках.
+    @param array Динамический массив.
+    @param min_batch Минимальный размер пакета (0 - один элемент).
+    @param func Функция обработки пакета (parallel_for_array_fn).
+    @param user Пользовательские данные.
+*/
+#define darray_parallel_for(array, min_batch, func, user) \
+    parallel_for_array((void*)(array), darray_stride(array), darray_length(array), min_batch, func, user)
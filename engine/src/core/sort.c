@@ -0,0 +1,366 @@
+#include "core/sort.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "core/parallel.h"
+#include "debug/assert.h"
+
+// Количество бит в разряде и количество значений разряда.
+#define RADIX_BITS    8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_MASK    (RADIX_BUCKETS - 1)
+
+// Выравнивание временного буфера.
+#define RADIX_SCRATCH_ALIGNMENT 16
+
+// Минимальный размер пакета параллельной сортировки (меньшие массивы сортируются в текущем потоке).
+#define RADIX_PARALLEL_MIN_BATCH (16 * 1024)
+// Выравнивание гистограмм пакетов (гистограммы разных пакетов не делят строки кэша).
+#define RADIX_HISTOGRAM_ALIGNMENT 64
+
+// Состояние прохода параллельной сортировки.
+typedef struct radix_parallel_context {
+    // Исходный массив прохода.
+    const void* src;
+    // Массив результата прохода.
+    void* dst;
+    // Сдвиг текущего разряда.
+    u32 shift;
+    // Размер пакета (индекс пакета - begin / batch_size).
+    u64 batch_size;
+    // Гистограммы пакетов, после префиксной суммы - позиции записи каждого пакета в корзины.
+    u32* histograms;
+} radix_parallel_context;
+
+// Преобразует гистограмму разряда в начальные позиции корзин.
+// Возвращает false, если все элементы попадают в одну корзину и проход не нужен.
+static bool radix_prefix_sum(u32* histogram, u64 count)
+{
+    u32 offset = 0;
+    for(u32 i = 0; i < RADIX_BUCKETS; ++i)
+    {
+        u32 bucket = histogram[i];
+        if(bucket == count)
+        {
+            return false;
+        }
+
+        histogram[i] = offset;
+        offset += bucket;
+    }
+    return true;
+}
+
+// Преобразует гистограммы пакетов в позиции записи: корзины идут по порядку, внутри корзины - пакеты по порядку,
+// поэтому порядок равных ключей сохраняется. Возвращает false, если все элементы попадают в одну корзину.
+static bool radix_prefix_sum_batches(u32* histograms, u64 batch_count, u64 count)
+{
+    u32 offset = 0;
+    for(u32 i = 0; i < RADIX_BUCKETS; ++i)
+    {
+        u32 bucket_start = offset;
+        for(u64 b = 0; b < batch_count; ++b)
+        {
+            u32* slot = &histograms[b * RADIX_BUCKETS + i];
+            u32 bucket = *slot;
+            *slot = offset;
+            offset += bucket;
+        }
+
+        if(offset - bucket_start == count)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Выполняет проходы параллельной сортировки, функции пакетов зависят от типа пары.
+static bool radix_sort_parallel(
+    void* items, u64 count, void* scratch, u64 stride, u32 key_size, parallel_for_fn histogram_func, parallel_for_fn scatter_func
+)
+{
+    u64 batch_size = parallel_for_batch_size(count, RADIX_PARALLEL_MIN_BATCH);
+    u64 batch_count = (count + batch_size - 1) / batch_size;
+    u64 histograms_size = batch_count * RADIX_BUCKETS * sizeof(u32);
+
+    void* buffer = scratch;
+    if(!buffer)
+    {
+        buffer = memory_allocate(count * stride, RADIX_SCRATCH_ALIGNMENT, MEMORY_TAG_DARRAY);
+        if(!buffer)
+        {
+            LOG_ERROR("Failed to allocate scratch buffer to sort %llu items.", count);
+            return false;
+        }
+    }
+
+    u32* histograms = memory_allocate(histograms_size, RADIX_HISTOGRAM_ALIGNMENT, MEMORY_TAG_DARRAY);
+    if(!histograms)
+    {
+        LOG_ERROR("Failed to allocate histograms to sort %llu items.", count);
+        if(!scratch)
+        {
+            memory_free(buffer, count * stride, MEMORY_TAG_DARRAY);
+        }
+        return false;
+    }
+
+    radix_parallel_context context = { .batch_size = batch_size, .histograms = histograms };
+    void* src = items;
+    void* dst = buffer;
+
+    // NOTE: Границы пакетов обоих вызовов parallel_for совпадают (зависят только от количества элементов,
+    //       минимального размера пакета и количества потоков), поэтому каждый пакет записывает свои элементы
+    //       по позициям, вычисленным из его же гистограммы.
+    for(u32 d = 0; d < key_size; ++d)
+    {
+        context.src = src;
+        context.dst = dst;
+        context.shift = d * RADIX_BITS;
+
+        parallel_for(count, RADIX_PARALLEL_MIN_BATCH, histogram_func, &context);
+        if(!radix_prefix_sum_batches(histograms, batch_count, count))
+        {
+            continue;
+        }
+        parallel_for(count, RADIX_PARALLEL_MIN_BATCH, scatter_func, &context);
+
+        void* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // После нечетного числа проходов результат находится в буфере.
+    if(src != items)
+    {
+        mcopy(items, src, count * stride);
+    }
+
+    memory_free(histograms, histograms_size, MEMORY_TAG_DARRAY);
+    if(!scratch)
+    {
+        memory_free(buffer, count * stride, MEMORY_TAG_DARRAY);
+    }
+
+    return true;
+}
+
+static void radix_histogram_u32(u64 begin, u64 end, void* user)
+{
+    radix_parallel_context* context = user;
+    const sort_key32* src = context->src;
+    u32* histogram = context->histograms + (begin / context->batch_size) * RADIX_BUCKETS;
+
+    mzero(histogram, RADIX_BUCKETS * sizeof(u32));
+    for(u64 i = begin; i < end; ++i)
+    {
+        histogram[(src[i].key >> context->shift) & RADIX_MASK]++;
+    }
+}
+
+static void radix_scatter_u32(u64 begin, u64 end, void* user)
+{
+    radix_parallel_context* context = user;
+    const sort_key32* src = context->src;
+    sort_key32* dst = context->dst;
+    u32* offsets = context->histograms + (begin / context->batch_size) * RADIX_BUCKETS;
+
+    for(u64 i = begin; i < end; ++i)
+    {
+        dst[offsets[(src[i].key >> context->shift) & RADIX_MASK]++] = src[i];
+    }
+}
+
+static void radix_histogram_u64(u64 begin, u64 end, void* user)
+{
+    radix_parallel_context* context = user;
+    const sort_key64* src = context->src;
+    u32* histogram = context->histograms + (begin / context->batch_size) * RADIX_BUCKETS;
+
+    mzero(histogram, RADIX_BUCKETS * sizeof(u32));
+    for(u64 i = begin; i < end; ++i)
+    {
+        histogram[(src[i].key >> context->shift) & RADIX_MASK]++;
+    }
+}
+
+static void radix_scatter_u64(u64 begin, u64 end, void* user)
+{
+    radix_parallel_context* context = user;
+    const sort_key64* src = context->src;
+    sort_key64* dst = context->dst;
+    u32* offsets = context->histograms + (begin / context->batch_size) * RADIX_BUCKETS;
+
+    for(u64 i = begin; i < end; ++i)
+    {
+        dst[offsets[(src[i].key >> context->shift) & RADIX_MASK]++] = src[i];
+    }
+}
+
+bool radix_sort_u32(sort_key32* items, u64 count, sort_key32* scratch)
+{
+    ASSERT(items != nullptr || count == 0, "Items pointer must be non-null.");
+    ASSERT(count <= U32_MAX, "Item count must fit in 32 bits.");
+
+    if(count < 2)
+    {
+        return true;
+    }
+
+    sort_key32* buffer = scratch;
+    if(!buffer)
+    {
+        buffer = memory_allocate(count * sizeof(sort_key32), RADIX_SCRATCH_ALIGNMENT, MEMORY_TAG_DARRAY);
+        if(!buffer)
+        {
+            LOG_ERROR("Failed to allocate scratch buffer to sort %llu items.", count);
+            return false;
+        }
+    }
+
+    // Гистограммы всех разрядов за один проход.
+    u32 histograms[sizeof(u32)][RADIX_BUCKETS] = {0};
+    for(u64 i = 0; i < count; ++i)
+    {
+        u32 key = items[i].key;
+        for(u32 d = 0; d < sizeof(u32); ++d)
+        {
+            histograms[d][(key >> (d * RADIX_BITS)) & RADIX_MASK]++;
+        }
+    }
+
+    sort_key32* src = items;
+    sort_key32* dst = buffer;
+
+    for(u32 d = 0; d < sizeof(u32); ++d)
+    {
+        u32* offsets = histograms[d];
+        if(!radix_prefix_sum(offsets, count))
+        {
+            continue;
+        }
+
+        u32 shift = d * RADIX_BITS;
+        for(u64 i = 0; i < count; ++i)
+        {
+            dst[offsets[(src[i].key >> shift) & RADIX_MASK]++] = src[i];
+        }
+
+        sort_key32* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // После нечетного числа проходов результат находится в буфере.
+    if(src != items)
+    {
+        mcopy(items, src, count * sizeof(sort_key32));
+    }
+
+    if(!scratch)
+    {
+        memory_free(buffer, count * sizeof(sort_key32), MEMORY_TAG_DARRAY);
+    }
+
+    return true;
+}
+
+bool radix_sort_u64(sort_key64* items, u64 count, sort_key64* scratch)
+{
+    ASSERT(items != nullptr || count == 0, "Items pointer must be non-null.");
+    ASSERT(count <= U32_MAX, "Item count must fit in 32 bits.");
+
+    if(count < 2)
+    {
+        return true;
+    }
+
+    sort_key64* buffer = scratch;
+    if(!buffer)
+    {
+        buffer = memory_allocate(count * sizeof(sort_key64), RADIX_SCRATCH_ALIGNMENT, MEMORY_TAG_DARRAY);
+        if(!buffer)
+        {
+            LOG_ERROR("Failed to allocate scratch buffer to sort %llu items.", count);
+            return false;
+        }
+    }
+
+    // Гистограммы всех разрядов за один проход.
+    u32 histograms[sizeof(u64)][RADIX_BUCKETS] = {0};
+    for(u64 i = 0; i < count; ++i)
+    {
+        u64 key = items[i].key;
+        for(u32 d = 0; d < sizeof(u64); ++d)
+        {
+            histograms[d][(key >> (d * RADIX_BITS)) & RADIX_MASK]++;
+        }
+    }
+
+    sort_key64* src = items;
+    sort_key64* dst = buffer;
+
+    for(u32 d = 0; d < sizeof(u64); ++d)
+    {
+        u32* offsets = histograms[d];
+        if(!radix_prefix_sum(offsets, count))
+        {
+            continue;
+        }
+
+        u32 shift = d * RADIX_BITS;
+        for(u64 i = 0; i < count; ++i)
+        {
+            dst[offsets[(src[i].key >> shift) & RADIX_MASK]++] = src[i];
+        }
+
+        sort_key64* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // После нечетного числа проходов результат находится в буфере.
+    if(src != items)
+    {
+        mcopy(items, src, count * sizeof(sort_key64));
+    }
+
+    if(!scratch)
+    {
+        memory_free(buffer, count * sizeof(sort_key64), MEMORY_TAG_DARRAY);
+    }
+
+    return true;
+}
+
+bool radix_sort_u32_parallel(sort_key32* items, u64 count, sort_key32* scratch)
+{
+    ASSERT(items != nullptr || count == 0, "Items pointer must be non-null.");
+    ASSERT(count <= U32_MAX, "Item count must fit in 32 bits.");
+
+    // Один пакет: параллельные проходы только добавили бы чтение данных для гистограмм.
+    if(count <= parallel_for_batch_size(count, RADIX_PARALLEL_MIN_BATCH))
+    {
+        return radix_sort_u32(items, count, scratch);
+    }
+
+    return radix_sort_parallel(
+        items, count, scratch, sizeof(sort_key32), sizeof(u32), radix_histogram_u32, radix_scatter_u32
+    );
+}
+
+bool radix_sort_u64_parallel(sort_key64* items, u64 count, sort_key64* scratch)
+{
+    ASSERT(items != nullptr || count == 0, "Items pointer must be non-null.");
+    ASSERT(count <= U32_MAX, "Item count must fit in 32 bits.");
+
+    // Один пакет: параллельные проходы только добавили бы чтение данных для гистограмм.
+    if(count <= parallel_for_batch_size(count, RADIX_PARALLEL_MIN_BATCH))
+    {
+        return radix_sort_u64(items, count, scratch);
+    }
+
+    return radix_sort_parallel(
+        items, count, scratch, sizeof(sort_key64), sizeof(u64), radix_histogram_u64, radix_scatter_u64
+    );
+}
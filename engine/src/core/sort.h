@@ -0,0 +1,164 @@
+/*
+    @file sort.h
+    @brief Интерфейс поразрядной сортировки ключей с индексами и преобразования значений в ключи сортировки.
+    @author Дмитрий Скляр.
+    @version 1.1
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Устойчивую поразрядную сортировку (LSD radix sort) пар ключ-индекс с 32 и 64-битными ключами
+            - Параллельную поразрядную сортировку на рабочих потоках системы задач
+            - Сортировку содержимого динамических массивов (darray)
+            - Преобразование знаковых и вещественных чисел в беззнаковые ключи с сохранением порядка
+
+    @note Особенности реализации:
+            - Ключ обрабатывается разрядами по 8 бит: 4 прохода для 32-битных и 8 проходов для 64-битных ключей
+            - Гистограммы всех разрядов строятся за один проход по данным
+            - Проход пропускается, если все ключи имеют одинаковое значение разряда (например, старшие нулевые байты)
+            - Требуется буфер того же размера, что и сортируемые данные; без него буфер выделяется на время сортировки
+            - Сложность O(n) по времени, сравнение ключей не выполняется
+            - Сортировка ведется по возрастанию; порядок равных ключей сохраняется
+            - Параллельная сортировка делит массив на пакеты parallel_for: на каждый разряд строятся гистограммы
+              пакетов, позиции записи пакетов в каждую корзину идут по порядку пакетов (сохраняет устойчивость),
+              затем пакеты параллельно переносят элементы; если пакет один, выполняется обычная сортировка
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Пара 32-битного ключа сортировки и индекса связанных данных.
+typedef struct sort_key32 {
+    // @brief Ключ сортировки.
+    u32 key;
+    // @brief Индекс связанных данных (например, объекта или команды отрисовки).
+    u32 index;
+} sort_key32;
+
+// @brief Пара 64-битного ключа сортировки и индекса связанных данных.
+typedef struct sort_key64 {
+    // @brief Ключ сортировки.
+    u64 key;
+    // @brief Индекс связанных данных (например, объекта или команды отрисовки).
+    u32 index;
+} sort_key64;
+
+/*
+    @brief Сортирует пары по возрастанию 32-битного ключа.
+    @param items Массив пар.
+    @param count Количество пар.
+    @param scratch Буфер на count пар (nullptr - выделяется на время сортировки).
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+CORE_API bool radix_sort_u32(sort_key32* items, u64 count, sort_key32* scratch);
+
+/*
+    @brief Сортирует пары по возрастанию 64-битного ключа.
+    @param items Массив пар.
+    @param count Количество пар.
+    @param scratch Буфер на count пар (nullptr - выделяется на время сортировки).
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+CORE_API bool radix_sort_u64(sort_key64* items, u64 count, sort_key64* scratch);
+
+/*
+    @brief Сортирует пары по возрастанию 32-битного ключа на рабочих потоках системы задач.
+    @note Результат совпадает с radix_sort_u32(). Без инициализированной системы задач пакеты обрабатываются в текущем потоке.
+    @param items Массив пар.
+    @param count Количество пар.
+    @param scratch Буфер на count пар (nullptr - выделяется на время сортировки).
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+CORE_API bool radix_sort_u32_parallel(sort_key32* items, u64 count, sort_key32* scratch);
+
+/*
+    @brief Сортирует пары по возрастанию 64-битного ключа на рабочих потоках системы задач.
+    @note Результат совпадает с radix_sort_u64(). Без инициализированной системы задач пакеты обрабатываются в текущем потоке.
+    @param items Массив пар.
+    @param count Количество пар.
+    @param scratch Буфер на count пар (nullptr - выделяется на время сортировки).
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+CORE_API bool radix_sort_u64_parallel(sort_key64* items, u64 count, sort_key64* scratch);
+
+/*
+    @brief Преобразует знаковое число в ключ с сохранением порядка.
+    @param value Значение.
+    @return Ключ сортировки.
+*/
+INLINE u32 sort_key_from_i32(i32 value)
+{
+    return (u32)value ^ 0x80000000U;
+}
+
+/*
+    @brief Преобразует знаковое число в ключ с сохранением порядка.
+    @param value Значение.
+    @return Ключ сортировки.
+*/
+INLINE u64 sort_key_from_i64(i64 value)
+{
+    return (u64)value ^ 0x8000000000000000ULL;
+}
+
+/*
+    @brief Преобразует вещественное число в ключ с сохранением порядка.
+    @note У отрицательных чисел инвертируются все биты, у положительных - только знаковый.
+    @param value Значение (не NaN).
+    @return Ключ сортировки.
+*/
+INLINE u32 sort_key_from_f32(f32 value)
+{
+    u32 bits;
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    return bits ^ ((u32)-(i32)(bits >> 31) | 0x80000000U);
+}
+
+/*
+    @brief Преобразует вещественное число в ключ с сохранением порядка.
+    @note У отрицательных чисел инвертируются все биты, у положительных - только знаковый.
+    @param value Значение (не NaN).
+    @return Ключ сортировки.
+*/
+INLINE u64 sort_key_from_f64(f64 value)
+{
+    u64 bits;
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    return bits ^ ((u64)-(i64)(bits >> 63) | 0x8000000000000000ULL);
+}
+
+/*
+    @brief Сортирует динамический массив пар sort_key32 по возрастанию ключа.
+    @param array Динамический массив пар.
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+#define darray_radix_sort_u32(array) radix_sort_u32(array, darray_length(array), nullptr)
+
+/*
+    @brief Сортирует динамический массив пар sort_key64 по возрастанию ключа.
+    @param array Динамический массив пар.
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+#define darray_radix_sort_u64(array) radix_sort_u64(array, darray_length(array), nullptr)
+
+/*
+    @brief Сортирует динамический массив пар sort_key32 по возрастанию ключа на рабочих потоках.
+    @param array Динамический массив пар.
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+#define darray_radix_sort_u32_parallel(array) radix_sort_u32_parallel(array, darray_length(array), nullptr)
+
+/*
+    @brief Сортирует динамический массив пар sort_key64 по возрастанию ключа на рабочих потоках.
+    @param array Динамический массив пар.
+    @return true - сортировка выполнена, false - ошибка выделения буфера.
+*/
+#define darray_radix_sort_u64_parallel(array) radix_sort_u64_parallel(array, darray_length(array), nullptr)
@@ -0,0 +1,821 @@
+#include "core/string_builder.h"
+#include "core/memory.h"
+#include "core/string.h"
+#include "debug/assert.h"
+
+#include <stdarg.h>
+
+// Флаги спецификатора формата.
+#define FORMAT_FLAG_LEFT      0x01
+#define FORMAT_FLAG_ZERO      0x02
+#define FORMAT_FLAG_PLUS      0x04
+#define FORMAT_FLAG_SPACE     0x08
+#define FORMAT_FLAG_ALTERNATE 0x10
+
+// Модификаторы размера аргумента.
+typedef enum format_length {
+    FORMAT_LENGTH_NONE,
+    FORMAT_LENGTH_HH,
+    FORMAT_LENGTH_H,
+    FORMAT_LENGTH_L,
+    FORMAT_LENGTH_LL,
+    FORMAT_LENGTH_Z,
+    FORMAT_LENGTH_J,
+    FORMAT_LENGTH_T,
+    FORMAT_LENGTH_LD
+} format_length;
+
+// Максимальная точность, форматируемая без платформенной функции.
+#define FORMAT_FLOAT_MAX_PRECISION 9
+
+// Размер буфера для записи одного числа (64-битное число в любой системе счисления с запасом).
+#define FORMAT_NUMBER_BUFFER_SIZE 32
+
+// Пары десятичных цифр для чисел 00..99.
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char hex_digits_lower[16] = "0123456789abcdef";
+static const char hex_digits_upper[16] = "0123456789ABCDEF";
+
+static const u64 powers_of_ten[FORMAT_FLOAT_MAX_PRECISION + 1] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL
+};
+
+// Записывает десятичные цифры числа так, чтобы последняя цифра оказалась перед end.
+// Возвращает количество записанных цифр.
+static u32 format_decimal(char* end, u64 value)
+{
+    char* p = end;
+    while(value >= 100)
+    {
+        u64 pair = (value % 100) * 2;
+        value /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    }
+
+    if(value >= 10)
+    {
+        *--p = digit_pairs[value * 2 + 1];
+        *--p = digit_pairs[value * 2];
+    }
+    else
+    {
+        *--p = (char)('0' + value);
+    }
+
+    return (u32)(end - p);
+}
+
+// Записывает шестнадцатеричные цифры числа так, чтобы последняя цифра оказалась перед end.
+// Возвращает количество записанных цифр.
+static u32 format_hex(char* end, u64 value, bool uppercase)
+{
+    const char* digits = uppercase ? hex_digits_upper : hex_digits_lower;
+    char* p = end;
+    do
+    {
+        *--p = digits[value & 0xF];
+        value >>= 4;
+    }
+    while(value);
+
+    return (u32)(end - p);
+}
+
+// Возвращает точную ошибку округления произведения a * b (a * b = product + ошибка).
+static f64 format_product_error(f64 a, f64 b, f64 product)
+{
+#if defined(__FMA__)
+    return __builtin_fma(a, b, -product);
+#else
+    // Разбиение Veltkamp-Dekker на старшие и младшие 26 бит, произведения половин точные.
+    const f64 split = 134217729.0;
+    f64 ca = split * a;
+    f64 a_high = ca - (ca - a);
+    f64 a_low = a - a_high;
+    f64 cb = split * b;
+    f64 b_high = cb - (cb - b);
+    f64 b_low = b - b_high;
+    return ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low;
+#endif
+}
+
+// Записывает неотрицательное конечное число с фиксированной точкой в начало dst.
+// Возвращает количество записанных символов или 0, если число не может быть отформатировано быстро.
+static u32 format_fixed(char* dst, f64 value, u32 precision)
+{
+    // NOTE: Значения от 2^64 не помещаются в целую часть.
+    if(precision > FORMAT_FLOAT_MAX_PRECISION || !(value < 18446744073709551616.0))
+    {
+        return 0;
+    }
+
+    u64 scale = powers_of_ten[precision];
+    u64 integer = (u64)value;
+    f64 remainder = value - (f64)integer;
+
+    // NOTE: Произведение округляется, поэтому для остатков около половины учитывается его точная ошибка:
+    //       знак разности с половиной определяет направление, точная половина округляется к четному (как printf).
+    f64 product = remainder * (f64)scale;
+    f64 error = format_product_error(remainder, (f64)scale, product);
+    u64 fraction = (u64)product;
+    f64 above_half = (product - (f64)fraction - 0.5) + error;
+
+    u64 last_digit = precision ? fraction : integer;
+    if(above_half > 0.0 || (above_half == 0.0 && (last_digit & 1)))
+    {
+        fraction++;
+    }
+
+    if(fraction >= scale)
+    {
+        integer++;
+        fraction -= scale;
+    }
+
+    char digits[FORMAT_NUMBER_BUFFER_SIZE];
+    char* end = digits + FORMAT_NUMBER_BUFFER_SIZE;
+    u32 count = format_decimal(end, integer);
+    __builtin_memcpy(dst, end - count, count);
+
+    if(precision > 0)
+    {
+        dst[count++] = '.';
+
+        u32 fraction_count = format_decimal(end, fraction);
+        for(u32 i = fraction_count; i < precision; ++i)
+        {
+            dst[count++] = '0';
+        }
+        __builtin_memcpy(dst + count, end - fraction_count, fraction_count);
+        count += fraction_count;
+    }
+
+    return count;
+}
+
+// Обеспечивает место для добавления extra символов.
+// Возвращает количество символов, которое может быть записано (меньше extra, если строка усекается).
+static u64 string_builder_grow(string_builder* builder, u64 extra)
+{
+    u64 available = builder->capacity - 1 - builder->length;
+    if(extra <= available)
+    {
+        return extra;
+    }
+
+    // NOTE: Усеченная строка не растет, чтобы последующие добавления не образовали разрыв.
+    if(builder->source == STRING_BUILDER_SOURCE_BUFFER || string_builder_truncated(builder))
+    {
+        return available;
+    }
+
+    u64 needed = builder->length + extra + 1;
+    u64 new_capacity = MAX(builder->capacity * 2, needed);
+    char* block = nullptr;
+
+    if(builder->source == STRING_BUILDER_SOURCE_ARENA)
+    {
+        if(linear_allocator_extend(builder->arena, builder->data, builder->capacity, new_capacity))
+        {
+            builder->capacity = new_capacity;
+            return extra;
+        }
+        block = linear_allocator_allocate(builder->arena, new_capacity, 1);
+    }
+    else
+    {
+        if(memory_frame_extend(builder->data, builder->capacity, new_capacity))
+        {
+            builder->capacity = new_capacity;
+            return extra;
+        }
+        block = memory_frame_allocate(new_capacity, 1);
+    }
+
+    if(!block)
+    {
+        return available;
+    }
+
+    __builtin_memcpy(block, builder->data, builder->length + 1);
+    builder->data = block;
+    builder->capacity = new_capacity;
+    return extra;
+}
+
+// Добавляет участок с выравниванием по ширине: префикс (знак, 0x), ведущие нули и тело.
+static void string_builder_append_padded(
+    string_builder* builder, const char* prefix, u32 prefix_length, u32 zeros, const char* body, u64 body_length,
+    u32 width, u32 flags
+)
+{
+    u64 total = prefix_length + zeros + body_length;
+    u64 padding = width > total ? width - total : 0;
+
+    if(!(flags & FORMAT_FLAG_LEFT) && !(flags & FORMAT_FLAG_ZERO))
+    {
+        string_builder_append_char(builder, ' ', padding);
+    }
+
+    string_builder_append_length(builder, prefix, prefix_length);
+
+    if(!(flags & FORMAT_FLAG_LEFT) && (flags & FORMAT_FLAG_ZERO))
+    {
+        string_builder_append_char(builder, '0', padding);
+    }
+
+    string_builder_append_char(builder, '0', zeros);
+    string_builder_append_length(builder, body, body_length);
+
+    if(flags & FORMAT_FLAG_LEFT)
+    {
+        string_builder_append_char(builder, ' ', padding);
+    }
+}
+
+// Добавляет результат платформенного форматирования (для редких спецификаторов и больших чисел).
+static void string_builder_append_platform(string_builder* builder, const char* format, ...)
+{
+    char buffer[128];
+    va_list args;
+
+    va_start(args, format);
+    i32 length = string_format_va(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if(length < 0)
+    {
+        return;
+    }
+
+    if((u64)length < sizeof(buffer))
+    {
+        string_builder_append_length(builder, buffer, length);
+        return;
+    }
+
+    // Длинный результат форматируется сразу в буфер построителя.
+    u64 available = string_builder_grow(builder, length);
+    va_start(args, format);
+    string_format_va(builder->data + builder->length, available + 1, format, args);
+    va_end(args);
+
+    builder->length += available;
+    builder->required += length;
+    builder->data[builder->length] = '\0';
+}
+
+void string_builder_create_buffer(char* buffer, u64 size, string_builder* out_builder)
+{
+    ASSERT(buffer != nullptr, "Buffer pointer must be non-null.");
+    ASSERT(size > 0, "Buffer size must be greater than zero.");
+    ASSERT(out_builder != nullptr, "Builder pointer must be non-null.");
+
+    out_builder->data = buffer;
+    out_builder->length = 0;
+    out_builder->capacity = size;
+    out_builder->required = 0;
+    out_builder->arena = nullptr;
+    out_builder->source = STRING_BUILDER_SOURCE_BUFFER;
+    buffer[0] = '\0';
+}
+
+bool string_builder_create_arena(linear_allocator* arena, u64 capacity, string_builder* out_builder)
+{
+    ASSERT(arena != nullptr, "Arena pointer must be non-null.");
+    ASSERT(out_builder != nullptr, "Builder pointer must be non-null.");
+
+    capacity = capacity ? capacity : STRING_BUILDER_DEFAULT_CAPACITY;
+    char* buffer = linear_allocator_allocate(arena, capacity, 1);
+    if(!buffer)
+    {
+        return false;
+    }
+
+    string_builder_create_buffer(buffer, capacity, out_builder);
+    out_builder->arena = arena;
+    out_builder->source = STRING_BUILDER_SOURCE_ARENA;
+    return true;
+}
+
+bool string_builder_create_frame(u64 capacity, string_builder* out_builder)
+{
+    ASSERT(out_builder != nullptr, "Builder pointer must be non-null.");
+
+    capacity = capacity ? capacity : STRING_BUILDER_DEFAULT_CAPACITY;
+    char* buffer = memory_frame_allocate(capacity, 1);
+    if(!buffer)
+    {
+        return false;
+    }
+
+    string_builder_create_buffer(buffer, capacity, out_builder);
+    out_builder->source = STRING_BUILDER_SOURCE_FRAME;
+    return true;
+}
+
+void string_builder_reset(string_builder* builder)
+{
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+
+    builder->length = 0;
+    builder->required = 0;
+    builder->data[0] = '\0';
+}
+
+void string_builder_append_length(string_builder* builder, const char* str, u64 length)
+{
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+    ASSERT(str != nullptr || length == 0, "String pointer must be non-null.");
+
+    if(length == 0)
+    {
+        return;
+    }
+
+    u64 count = string_builder_grow(builder, length);
+    if(count)
+    {
+        __builtin_memcpy(builder->data + builder->length, str, count);
+    }
+
+    builder->length += count;
+    builder->required += length;
+    builder->data[builder->length] = '\0';
+}
+
+void string_builder_append(string_builder* builder, const char* str)
+{
+    ASSERT(str != nullptr, "String pointer must be non-null.");
+    string_builder_append_length(builder, str, string_length(str));
+}
+
+void string_builder_append_char(string_builder* builder, char c, u64 count)
+{
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    u64 written = string_builder_grow(builder, count);
+    if(written)
+    {
+        __builtin_memset(builder->data + builder->length, (u8)c, written);
+    }
+
+    builder->length += written;
+    builder->required += count;
+    builder->data[builder->length] = '\0';
+}
+
+void string_builder_append_u64(string_builder* builder, u64 value)
+{
+    char digits[FORMAT_NUMBER_BUFFER_SIZE];
+    char* end = digits + FORMAT_NUMBER_BUFFER_SIZE;
+    u32 count = format_decimal(end, value);
+    string_builder_append_length(builder, end - count, count);
+}
+
+void string_builder_append_i64(string_builder* builder, i64 value)
+{
+    char digits[FORMAT_NUMBER_BUFFER_SIZE];
+    char* end = digits + FORMAT_NUMBER_BUFFER_SIZE;
+
+    // NOTE: Модуль вычисляется в беззнаковом типе, чтобы не переполнить I64_MIN.
+    u64 magnitude = value < 0 ? 0 - (u64)value : (u64)value;
+    u32 count = format_decimal(end, magnitude);
+    if(value < 0)
+    {
+        *(end - ++count) = '-';
+    }
+
+    string_builder_append_length(builder, end - count, count);
+}
+
+void string_builder_append_hex(string_builder* builder, u64 value, bool uppercase)
+{
+    char digits[FORMAT_NUMBER_BUFFER_SIZE];
+    char* end = digits + FORMAT_NUMBER_BUFFER_SIZE;
+    u32 count = format_hex(end, value, uppercase);
+    string_builder_append_length(builder, end - count, count);
+}
+
+void string_builder_append_f64(string_builder* builder, f64 value, u32 precision)
+{
+    if(__builtin_isnan(value))
+    {
+        string_builder_append_length(builder, "nan", 3);
+        return;
+    }
+
+    if(__builtin_signbit(value))
+    {
+        string_builder_append_length(builder, "-", 1);
+        value = -value;
+    }
+
+    if(__builtin_isinf(value))
+    {
+        string_builder_append_length(builder, "inf", 3);
+        return;
+    }
+
+    char buffer[FORMAT_NUMBER_BUFFER_SIZE * 2];
+    u32 count = format_fixed(buffer, value, precision);
+    if(count)
+    {
+        string_builder_append_length(builder, buffer, count);
+    }
+    else
+    {
+        string_builder_append_platform(builder, "%.*f", (i32)precision, value);
+    }
+}
+
+void string_builder_append_format_va(string_builder* builder, const char* format, __builtin_va_list args)
+{
+    ASSERT(builder != nullptr, "Builder pointer must be non-null.");
+    ASSERT(format != nullptr, "Format string must be non-null.");
+
+    const char* p = format;
+    while(*p)
+    {
+        // Копирование текста до следующего спецификатора одним участком.
+        const char* text = p;
+        while(*p && *p != '%')
+        {
+            p++;
+        }
+
+        if(p != text)
+        {
+            string_builder_append_length(builder, text, p - text);
+        }
+
+        if(!*p)
+        {
+            break;
+        }
+
+        const char* spec = p++;
+
+        // Флаги.
+        u32 flags = 0;
+        for(;; ++p)
+        {
+            if(*p == '-')      flags |= FORMAT_FLAG_LEFT;
+            else if(*p == '0') flags |= FORMAT_FLAG_ZERO;
+            else if(*p == '+') flags |= FORMAT_FLAG_PLUS;
+            else if(*p == ' ') flags |= FORMAT_FLAG_SPACE;
+            else if(*p == '#') flags |= FORMAT_FLAG_ALTERNATE;
+            else break;
+        }
+
+        // Ширина.
+        u32 width = 0;
+        if(*p == '*')
+        {
+            i32 value = va_arg(args, i32);
+            if(value < 0)
+            {
+                flags |= FORMAT_FLAG_LEFT;
+                value = -value;
+            }
+            width = (u32)value;
+            p++;
+        }
+        else
+        {
+            while(*p >= '0' && *p <= '9')
+            {
+                width = width * 10 + (u32)(*p++ - '0');
+            }
+        }
+
+        // Точность.
+        i32 precision = -1;
+        if(*p == '.')
+        {
+            p++;
+            if(*p == '*')
+            {
+                precision = va_arg(args, i32);
+                p++;
+            }
+            else
+            {
+                precision = 0;
+                while(*p >= '0' && *p <= '9')
+                {
+                    precision = precision * 10 + (*p++ - '0');
+                }
+            }
+        }
+
+        // Модификатор размера.
+        format_length length = FORMAT_LENGTH_NONE;
+        switch(*p)
+        {
+            case 'h':
+                length = p[1] == 'h' ? FORMAT_LENGTH_HH : FORMAT_LENGTH_H;
+                p += length == FORMAT_LENGTH_HH ? 2 : 1;
+                break;
+            case 'l':
+                length = p[1] == 'l' ? FORMAT_LENGTH_LL : FORMAT_LENGTH_L;
+                p += length == FORMAT_LENGTH_LL ? 2 : 1;
+                break;
+            case 'z': length = FORMAT_LENGTH_Z;  p++; break;
+            case 'j': length = FORMAT_LENGTH_J;  p++; break;
+            case 't': length = FORMAT_LENGTH_T;  p++; break;
+            case 'L': length = FORMAT_LENGTH_LD; p++; break;
+            default: break;
+        }
+
+        char conversion = *p;
+        if(!conversion)
+        {
+            // Незавершенный спецификатор выводится как есть.
+            string_builder_append_length(builder, spec, p - spec);
+            break;
+        }
+        p++;
+
+        char number[FORMAT_NUMBER_BUFFER_SIZE * 2];
+        char* end = number + FORMAT_NUMBER_BUFFER_SIZE;
+        char prefix[2];
+        u32 prefix_length = 0;
+
+        switch(conversion)
+        {
+            case 'd':
+            case 'i': {
+                i64 value;
+                switch(length)
+                {
+                    case FORMAT_LENGTH_HH: value = (signed char)va_arg(args, i32); break;
+                    case FORMAT_LENGTH_H:  value = (short)va_arg(args, i32);       break;
+                    case FORMAT_LENGTH_L:  value = va_arg(args, long);             break;
+                    case FORMAT_LENGTH_LL:
+                    case FORMAT_LENGTH_J:  value = va_arg(args, long long);        break;
+                    case FORMAT_LENGTH_Z:
+                    case FORMAT_LENGTH_T:  value = (i64)va_arg(args, isize);       break;
+                    default:               value = va_arg(args, i32);              break;
+                }
+
+                if(value < 0)                     prefix[prefix_length++] = '-';
+                else if(flags & FORMAT_FLAG_PLUS)  prefix[prefix_length++] = '+';
+                else if(flags & FORMAT_FLAG_SPACE) prefix[prefix_length++] = ' ';
+
+                u64 magnitude = value < 0 ? 0 - (u64)value : (u64)value;
+                u32 count = (precision == 0 && magnitude == 0) ? 0 : format_decimal(end, magnitude);
+                u32 zeros = precision > (i32)count ? (u32)precision - count : 0;
+
+                // NOTE: При указанной точности флаг '0' игнорируется.
+                string_builder_append_padded(
+                    builder, prefix, prefix_length, zeros, end - count, count, width,
+                    precision >= 0 ? flags & ~FORMAT_FLAG_ZERO : flags
+                );
+            } break;
+
+            case 'u':
+            case 'x':
+            case 'X': {
+                u64 value;
+                switch(length)
+                {
+                    case FORMAT_LENGTH_HH: value = (unsigned char)va_arg(args, u32);  break;
+                    case FORMAT_LENGTH_H:  value = (unsigned short)va_arg(args, u32); break;
+                    case FORMAT_LENGTH_L:  value = va_arg(args, unsigned long);       break;
+                    case FORMAT_LENGTH_LL:
+                    case FORMAT_LENGTH_J:  value = va_arg(args, unsigned long long);  break;
+                    case FORMAT_LENGTH_Z:
+                    case FORMAT_LENGTH_T:  value = va_arg(args, usize);               break;
+                    default:               value = va_arg(args, u32);                 break;
+                }
+
+                u32 count = 0;
+                if(precision != 0 || value != 0)
+                {
+                    count = conversion == 'u' ? format_decimal(end, value) : format_hex(end, value, conversion == 'X');
+                }
+
+                if(conversion != 'u' && (flags & FORMAT_FLAG_ALTERNATE) && value != 0)
+                {
+                    prefix[prefix_length++] = '0';
+                    prefix[prefix_length++] = conversion;
+                }
+
+                u32 zeros = precision > (i32)count ? (u32)precision - count : 0;
+                string_builder_append_padded(
+                    builder, prefix, prefix_length, zeros, end - count, count, width,
+                    precision >= 0 ? flags & ~FORMAT_FLAG_ZERO : flags
+                );
+            } break;
+
+            case 'p': {
+                usize value = (usize)va_arg(args, void*);
+                if(value == 0)
+                {
+                    // NOTE: Нулевой указатель выводится как в glibc.
+                    string_builder_append_padded(builder, nullptr, 0, 0, "(nil)", 5, width, flags & ~FORMAT_FLAG_ZERO);
+                    break;
+                }
+
+                u32 count = format_hex(end, value, false);
+                prefix[prefix_length++] = '0';
+                prefix[prefix_length++] = 'x';
+                string_builder_append_padded(builder, prefix, prefix_length, 0, end - count, count, width, flags);
+            } break;
+
+            case 'c': {
+                char c = (char)va_arg(args, i32);
+                string_builder_append_padded(builder, nullptr, 0, 0, &c, 1, width, flags & ~FORMAT_FLAG_ZERO);
+            } break;
+
+            case 's': {
+                const char* str = va_arg(args, const char*);
+                if(!str)
+                {
+                    str = "(null)";
+                }
+
+                // NOTE: С указанной точностью строка может не иметь завершающего нуль-символа.
+                u64 count = 0;
+                if(precision >= 0)
+                {
+                    while(count < (u64)precision && str[count])
+                    {
+                        count++;
+                    }
+                }
+                else
+                {
+                    count = string_length(str);
+                }
+
+                string_builder_append_padded(builder, nullptr, 0, 0, str, count, width, flags & ~FORMAT_FLAG_ZERO);
+            } break;
+
+            case 'f':
+            case 'F': {
+                f64 value = 0.0;
+                long double long_value = 0.0L;
+                u32 digits = precision < 0 ? 6 : (u32)precision;
+                u32 count = 0;
+
+                if(length == FORMAT_LENGTH_LD)
+                {
+                    long_value = va_arg(args, long double);
+                }
+                else
+                {
+                    value = va_arg(args, f64);
+
+                    if(__builtin_signbit(value))       prefix[prefix_length++] = '-';
+                    else if(flags & FORMAT_FLAG_PLUS)  prefix[prefix_length++] = '+';
+                    else if(flags & FORMAT_FLAG_SPACE) prefix[prefix_length++] = ' ';
+
+                    f64 magnitude = __builtin_fabs(value);
+                    if(__builtin_isnan(magnitude) || __builtin_isinf(magnitude))
+                    {
+                        const char* text = __builtin_isnan(magnitude) ? (conversion == 'F' ? "NAN" : "nan")
+                                                                      : (conversion == 'F' ? "INF" : "inf");
+                        __builtin_memcpy(number, text, 3);
+                        count = 3;
+                        flags &= ~FORMAT_FLAG_ZERO;
+                    }
+                    else
+                    {
+                        count = format_fixed(number, magnitude, digits);
+
+                        // NOTE: Флаг '#' сохраняет десятичную точку при нулевой точности.
+                        if(count && digits == 0 && (flags & FORMAT_FLAG_ALTERNATE))
+                        {
+                            number[count++] = '.';
+                        }
+                    }
+                }
+
+                if(count)
+                {
+                    string_builder_append_padded(builder, prefix, prefix_length, 0, number, count, width, flags);
+                    break;
+                }
+
+                // Большие значения, высокая точность и long double: пересборка спецификатора для платформенного форматирования.
+                char platform_format[16];
+                u32 n = 0;
+                platform_format[n++] = '%';
+                if(flags & FORMAT_FLAG_LEFT)      platform_format[n++] = '-';
+                if(flags & FORMAT_FLAG_ZERO)      platform_format[n++] = '0';
+                if(flags & FORMAT_FLAG_PLUS)      platform_format[n++] = '+';
+                if(flags & FORMAT_FLAG_SPACE)     platform_format[n++] = ' ';
+                if(flags & FORMAT_FLAG_ALTERNATE) platform_format[n++] = '#';
+                platform_format[n++] = '*';
+                platform_format[n++] = '.';
+                platform_format[n++] = '*';
+
+                if(length == FORMAT_LENGTH_LD)
+                {
+                    platform_format[n++] = 'L';
+                    platform_format[n++] = conversion;
+                    platform_format[n] = '\0';
+                    string_builder_append_platform(builder, platform_format, (i32)width, (i32)digits, long_value);
+                }
+                else
+                {
+                    platform_format[n++] = conversion;
+                    platform_format[n] = '\0';
+                    string_builder_append_platform(builder, platform_format, (i32)width, (i32)digits, value);
+                }
+            } break;
+
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+            case 'o': {
+                // Редкие спецификаторы: пересборка спецификатора с явными шириной и точностью.
+                char platform_format[16];
+                u32 n = 0;
+                platform_format[n++] = '%';
+                if(flags & FORMAT_FLAG_LEFT)      platform_format[n++] = '-';
+                if(flags & FORMAT_FLAG_ZERO)      platform_format[n++] = '0';
+                if(flags & FORMAT_FLAG_PLUS)      platform_format[n++] = '+';
+                if(flags & FORMAT_FLAG_SPACE)     platform_format[n++] = ' ';
+                if(flags & FORMAT_FLAG_ALTERNATE) platform_format[n++] = '#';
+                platform_format[n++] = '*';
+                platform_format[n++] = '.';
+                platform_format[n++] = '*';
+
+                if(conversion == 'o')
+                {
+                    u64 value;
+                    switch(length)
+                    {
+                        case FORMAT_LENGTH_HH: value = (unsigned char)va_arg(args, u32);  break;
+                        case FORMAT_LENGTH_H:  value = (unsigned short)va_arg(args, u32); break;
+                        case FORMAT_LENGTH_L:  value = va_arg(args, unsigned long);       break;
+                        case FORMAT_LENGTH_LL:
+                        case FORMAT_LENGTH_J:  value = va_arg(args, unsigned long long);  break;
+                        case FORMAT_LENGTH_Z:
+                        case FORMAT_LENGTH_T:  value = va_arg(args, usize);               break;
+                        default:               value = va_arg(args, u32);                 break;
+                    }
+
+                    platform_format[n++] = 'l';
+                    platform_format[n++] = 'l';
+                    platform_format[n++] = 'o';
+                    platform_format[n] = '\0';
+                    string_builder_append_platform(builder, platform_format, (i32)width, precision, (unsigned long long)value);
+                }
+                else if(length == FORMAT_LENGTH_LD)
+                {
+                    platform_format[n++] = 'L';
+                    platform_format[n++] = conversion;
+                    platform_format[n] = '\0';
+                    string_builder_append_platform(builder, platform_format, (i32)width, precision, va_arg(args, long double));
+                }
+                else
+                {
+                    platform_format[n++] = conversion;
+                    platform_format[n] = '\0';
+                    string_builder_append_platform(builder, platform_format, (i32)width, precision, va_arg(args, f64));
+                }
+            } break;
+
+            case '%':
+                string_builder_append_length(builder, "%", 1);
+                break;
+
+            default:
+                // Неизвестный спецификатор выводится как есть.
+                string_builder_append_length(builder, spec, p - spec);
+                break;
+        }
+    }
+}
+
+void string_builder_append_format(string_builder* builder, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    string_builder_append_format_va(builder, format, args);
+    va_end(args);
+}
@@ -0,0 +1,196 @@
+/*
+    @file string_builder.h
+    @brief Интерфейс построителя строк с быстрым форматированием чисел.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Последовательное добавление строк, символов и чисел в один буфер
+            - Размещение буфера в памяти вызывающей стороны, линейном распределителе или покадровом распределителе
+            - Форматирование в стиле printf без обращения к vsnprintf
+            - Форматирование целых чисел (десятичное и шестнадцатеричное) и чисел с плавающей точкой
+
+    @note Особенности реализации:
+            - Строка в буфере всегда завершена нуль-символом
+            - Буфер вызывающей стороны не растет: при переполнении строка усекается, а required продолжает
+              учитывать полную длину, поэтому необходимый размер буфера известен после одного прохода
+            - Буфер в распределителе растет на месте, если является последним выделением, иначе удваивается
+              с копированием (прежний участок освобождается при сбросе распределителя)
+            - Целые числа выводятся по две цифры за шаг по таблице, числа с плавающей точкой - через
+              целую и дробную части (для точности до 9 знаков и значений до 2^64, иначе через платформенный формат)
+            - Форматирование поддерживает флаги (-, 0, +, пробел, #), ширину и точность (в том числе *),
+              модификаторы hh, h, l, ll, z, j, t и спецификаторы d, i, u, x, X, c, s, p, f, F, %;
+              прочие спецификаторы (e, g, a, o) передаются платформенному форматированию
+            - Нулевой указатель %p выводится как (nil), как в glibc, на всех платформах
+            - Копирование идет через __builtin_memcpy/__builtin_memset, а не через платформенный слой памяти,
+              поэтому построитель над буфером вызывающей стороны работает до инициализации и после завершения
+              подсистем (им пользуется логгер)
+            - Не thread-safe, один построитель используется одним потоком
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/allocators/linear_allocator.h>
+
+// @brief Источник памяти буфера построителя.
+typedef enum string_builder_source {
+    // @brief Буфер вызывающей стороны фиксированного размера.
+    STRING_BUILDER_SOURCE_BUFFER,
+    // @brief Линейный распределитель вызывающей стороны.
+    STRING_BUILDER_SOURCE_ARENA,
+    // @brief Покадровый распределитель системы памяти (memory_frame_allocate()).
+    STRING_BUILDER_SOURCE_FRAME
+} string_builder_source;
+
+// @brief Контекст построителя строк.
+typedef struct string_builder {
+    // @brief Буфер строки (всегда завершен нуль-символом).
+    char* data;
+    // @brief Длина строки в буфере (без учета завершающего нуль-символа).
+    u64 length;
+    // @brief Размер буфера в байтах (включая место для завершающего нуль-символа).
+    u64 capacity;
+    // @brief Полная длина добавленной строки (больше length, если строка усечена).
+    u64 required;
+    // @brief Линейный распределитель (только для STRING_BUILDER_SOURCE_ARENA).
+    linear_allocator* arena;
+    // @brief Источник памяти буфера.
+    string_builder_source source;
+} string_builder;
+
+// @brief Начальный размер буфера в распределителе по умолчанию.
+#define STRING_BUILDER_DEFAULT_CAPACITY 256
+
+/*
+    @brief Инициализирует построитель над буфером вызывающей стороны.
+    @param buffer Указатель на буфер.
+    @param size Размер буфера в байтах (не меньше 1).
+    @param out_builder Указатель на построитель для инициализации.
+*/
+CORE_API void string_builder_create_buffer(char* buffer, u64 size, string_builder* out_builder);
+
+/*
+    @brief Инициализирует построитель с буфером в линейном распределителе.
+    @note Распределитель должен оставаться действительным, а его память не должна сбрасываться до окончания
+          использования построителя.
+    @param arena Указатель на линейный распределитель.
+    @param capacity Начальный размер буфера в байтах (0 - STRING_BUILDER_DEFAULT_CAPACITY).
+    @param out_builder Указатель на построитель для инициализации.
+    @return true - построитель инициализирован, false - в распределителе недостаточно памяти.
+*/
+CORE_API bool string_builder_create_arena(linear_allocator* arena, u64 capacity, string_builder* out_builder);
+
+/*
+    @brief Инициализирует построитель с буфером в покадровом распределителе.
+    @note Строка действительна до конца текущего кадра (см. memory_system_frame_end()).
+    @param capacity Начальный размер буфера в байтах (0 - STRING_BUILDER_DEFAULT_CAPACITY).
+    @param out_builder Указатель на построитель для инициализации.
+    @return true - построитель инициализирован, false - память покадрового распределителя исчерпана.
+*/
+CORE_API bool string_builder_create_frame(u64 capacity, string_builder* out_builder);
+
+/*
+    @brief Очищает строку без освобождения буфера.
+    @param builder Указатель на построитель.
+*/
+CORE_API void string_builder_reset(string_builder* builder);
+
+/*
+    @brief Добавляет строку указанной длины.
+    @param builder Указатель на построитель.
+    @param str Указатель на строку (может не содержать завершающий нуль-символ).
+    @param length Длина строки.
+*/
+CORE_API void string_builder_append_length(string_builder* builder, const char* str, u64 length);
+
+/*
+    @brief Добавляет нуль-терминированную строку.
+    @param builder Указатель на построитель.
+    @param str Указатель на строку.
+*/
+CORE_API void string_builder_append(string_builder* builder, const char* str);
+
+/*
+    @brief Добавляет символ указанное количество раз.
+    @param builder Указатель на построитель.
+    @param c Символ.
+    @param count Количество повторений.
+*/
+CORE_API void string_builder_append_char(string_builder* builder, char c, u64 count);
+
+/*
+    @brief Добавляет беззнаковое целое число в десятичной записи.
+    @param builder Указатель на построитель.
+    @param value Значение.
+*/
+CORE_API void string_builder_append_u64(string_builder* builder, u64 value);
+
+/*
+    @brief Добавляет знаковое целое число в десятичной записи.
+    @param builder Указатель на построитель.
+    @param value Значение.
+*/
+CORE_API void string_builder_append_i64(string_builder* builder, i64 value);
+
+/*
+    @brief Добавляет беззнаковое целое число в шестнадцатеричной записи (без префикса 0x).
+    @param builder Указатель на построитель.
+    @param value Значение.
+    @param uppercase true - цифры A-F, false - цифры a-f.
+*/
+CORE_API void string_builder_append_hex(string_builder* builder, u64 value, bool uppercase);
+
+/*
+    @brief Добавляет число с плавающей точкой с фиксированным количеством знаков после точки.
+    @param builder Указатель на построитель.
+    @param value Значение.
+    @param precision Количество знаков после точки.
+*/
+CORE_API void string_builder_append_f64(string_builder* builder, f64 value, u32 precision);
+
+/*
+    @brief Добавляет строку, отформатированную в стиле printf, с использованием списка аргументов.
+    @param builder Указатель на построитель.
+    @param format Строка формата.
+    @param args Список аргументов переменной длины (va_list).
+*/
+CORE_API void string_builder_append_format_va(string_builder* builder, const char* format, __builtin_va_list args);
+
+/*
+    @brief Добавляет строку, отформатированную в стиле printf.
+    @param builder Указатель на построитель.
+    @param format Строка формата.
+    @param ... Аргументы для подстановки в строку формата.
+*/
+CORE_API void string_builder_append_format(string_builder* builder, const char* format, ...);
+
+/*
+    @brief Проверяет, была ли строка усечена из-за нехватки памяти.
+    @param builder Указатель на построитель.
+    @return true - строка усечена (полная длина в required), false - строка полная.
+*/
+INLINE bool string_builder_truncated(const string_builder* builder)
+{
+    return builder->required > builder->length;
+}
+
+/*
+    @brief Возвращает нуль-терминированную строку построителя.
+    @note Указатель действителен до следующего добавления в построитель.
+    @param builder Указатель на построитель.
+    @return Указатель на строку.
+*/
+INLINE const char* string_builder_cstr(const string_builder* builder)
+{
+    return builder->data;
+}
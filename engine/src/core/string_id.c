@@ -0,0 +1,186 @@
+#include "core/string_id.h"
+#include "core/logger.h"
+#include "core/memory.h"
+#include "core/string.h"
+#include "core/allocators/linear_allocator.h"
+#include "core/containers/darray.h"
+#include "core/containers/hashmap.h"
+#include "debug/assert.h"
+
+typedef struct string_id_page {
+    // Размер страницы в байтах.
+    u64 size;
+    // Память страницы.
+    char* memory;
+} string_id_page;
+
+typedef struct string_id_system_context {
+    // Таблица интернированных строк (string_id -> const char*).
+    hash_map table;
+    // Страницы памяти строк (darray).
+    string_id_page* pages;
+    // Распределитель текущей (последней) страницы.
+    linear_allocator page_allocator;
+} string_id_system_context;
+
+static string_id_system_context* context = nullptr;
+
+// Хеширование ключа таблицы: ключ уже является хешем строки.
+static u64 string_id_table_hash(const void* key, u64 key_size)
+{
+    UNUSED(key_size);
+    return *(const string_id*)key;
+}
+
+// Выделяет память под копию строки, при необходимости добавляя новую страницу.
+static char* string_id_page_allocate(u64 size)
+{
+    if(context->page_allocator.memory)
+    {
+        char* memory = linear_allocator_allocate(&context->page_allocator, size, 1);
+        if(memory)
+        {
+            return memory;
+        }
+    }
+
+    // NOTE: Длинные строки занимают отдельную страницу своего размера, текущая страница при этом сохраняется.
+    bool dedicated = size > STRING_ID_PAGE_SIZE / 4;
+    string_id_page page = {
+        .size = dedicated ? size : STRING_ID_PAGE_SIZE,
+        .memory = nullptr
+    };
+
+    page.memory = mallocate(page.size, MEMORY_TAG_STRING);
+    if(!page.memory)
+    {
+        return nullptr;
+    }
+
+    darray_push(context->pages, page);
+    if(dedicated)
+    {
+        return page.memory;
+    }
+
+    linear_allocator_create(page.size, page.memory, &context->page_allocator);
+    return linear_allocator_allocate(&context->page_allocator, size, 1);
+}
+
+bool string_id_system_initialize()
+{
+    ASSERT(context == nullptr, "String id system is already initialized.");
+
+    context = mallocate(sizeof(string_id_system_context), MEMORY_TAG_SYSTEM);
+    if(!context)
+    {
+        LOG_ERROR("Failed to allocate memory for string id system to initialize.");
+        return false;
+    }
+    mzero(context, sizeof(string_id_system_context));
+
+    if(!hashmap_create_custom(context->table, string_id, const char*, HASHMAP_DEFAULT_CAPACITY, string_id_table_hash, nullptr))
+    {
+        LOG_ERROR("Failed to create string id table.");
+        mfree(context, sizeof(string_id_system_context), MEMORY_TAG_SYSTEM);
+        context = nullptr;
+        return false;
+    }
+
+    context->pages = darray_create(string_id_page);
+    return true;
+}
+
+void string_id_system_shutdown()
+{
+    ASSERT(context != nullptr, "String id system not initialized. Call string_id_system_initialize() first.");
+
+    u64 page_count = darray_length(context->pages);
+    for(u64 i = 0; i < page_count; ++i)
+    {
+        mfree(context->pages[i].memory, context->pages[i].size, MEMORY_TAG_STRING);
+    }
+
+    darray_destroy(context->pages);
+    hashmap_destroy(context->table);
+
+    mfree(context, sizeof(string_id_system_context), MEMORY_TAG_SYSTEM);
+    context = nullptr;
+}
+
+bool string_id_system_is_initialized()
+{
+    return context != nullptr;
+}
+
+string_id string_id_hash(const char* str, u64 length)
+{
+    ASSERT(str != nullptr || length == 0, "Pointer to string must be non-null.");
+    return hash_bytes(str, length);
+}
+
+string_id string_id_intern(const char* str)
+{
+    ASSERT(str != nullptr, "Pointer to string must be non-null.");
+    return string_id_intern_length(str, string_length(str));
+}
+
+string_id string_id_intern_length(const char* str, u64 length)
+{
+    ASSERT(context != nullptr, "String id system not initialized. Call string_id_system_initialize() first.");
+    ASSERT(str != nullptr, "Pointer to string must be non-null.");
+
+    string_id id = hash_bytes(str, length);
+    if(UNLIKELY(id == STRING_ID_INVALID))
+    {
+        LOG_ERROR("String '%.*s' hashes to invalid id.", (i32)length, str);
+        return STRING_ID_INVALID;
+    }
+
+    bool inserted = false;
+    const char** slot = hash_map_emplace(&context->table, &id, &inserted);
+    if(!slot)
+    {
+        LOG_ERROR("Failed to insert string into string id table.");
+        return STRING_ID_INVALID;
+    }
+
+    if(!inserted)
+    {
+        // Строка уже интернирована, проверка на коллизию хешей.
+        if(UNLIKELY(!string_nequal(*slot, str, length) || (*slot)[length] != '\0'))
+        {
+            LOG_ERROR("String id collision: '%.*s' and '%s'.", (i32)length, str, *slot);
+            return STRING_ID_INVALID;
+        }
+        return id;
+    }
+
+    char* copy = string_id_page_allocate(length + 1);
+    if(!copy)
+    {
+        LOG_ERROR("Failed to allocate memory for interned string.");
+        hash_map_remove(&context->table, &id, nullptr);
+        return STRING_ID_INVALID;
+    }
+
+    mcopy(copy, str, length);
+    copy[length] = '\0';
+    *slot = copy;
+
+    return id;
+}
+
+const char* string_id_str(string_id id)
+{
+    ASSERT(context != nullptr, "String id system not initialized. Call string_id_system_initialize() first.");
+
+    const char** str = hashmap_get(context->table, id);
+    return str ? *str : nullptr;
+}
+
+u64 string_id_count()
+{
+    ASSERT(context != nullptr, "String id system not initialized. Call string_id_system_initialize() first.");
+    return hashmap_length(context->table);
+}
@@ -0,0 +1,114 @@
+/*
+    @file string_id.h
+    @brief Интерфейс таблицы интернированных строк и 64-битных идентификаторов строк.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Идентификаторы строк (string_id) для хранения и сравнения имен как целых чисел
+            - Интернирование строк: единственная копия каждой строки на все время работы системы
+            - Получение строки по идентификатору (для логирования и отладки)
+            - Вычисление идентификатора строкового литерала без обращения к таблице (STRING_ID)
+
+    @note Особенности реализации:
+            - Идентификатор является 64-битным хешем строки (hash_bytes), поэтому не зависит от порядка
+              интернирования и совпадает между запусками
+            - Значение STRING_ID("name") равно идентификатору, полученному string_id_intern("name")
+            - Строки копируются в страницы по STRING_ID_PAGE_SIZE байт и не освобождаются до завершения системы
+            - Коллизия хешей разных строк обнаруживается при интернировании и приводит к ошибке
+            - Не thread-safe, функции должны вызываться из основного потока
+
+    @note Для корректной работы необходимо предварительно инициализировать (в указанном порядке):
+            - Подсистему консоли platform_console_initialize()
+            - Подсистему памяти platform_memory_initialize()
+            - Систему памяти memory_system_initialize()
+*/
+
+#pragma once
+
+#include <core/defines.h>
+#include <core/hash.h>
+
+// @brief Идентификатор строки.
+typedef u64 string_id;
+
+// @brief Недействительный идентификатор строки (отсутствие имени).
+#define STRING_ID_INVALID  0ULL
+
+// @brief Размер страницы для хранения интернированных строк в байтах.
+#define STRING_ID_PAGE_SIZE 16384
+
+/*
+    @brief Вычисляет идентификатор строкового литерала.
+    @note При включенной оптимизации значение вычисляется компилятором. Таблица строк не изменяется,
+          поэтому для получения строки по идентификатору ее необходимо интернировать.
+    @param literal Строковый литерал.
+    @return Идентификатор строки.
+*/
+#define STRING_ID(literal) ((string_id)hash_bytes("" literal, sizeof(literal) - 1))
+
+/*
+    @brief Инициализирует систему интернированных строк.
+    @warning Не thread-safe. Должна вызываться из основного потока.
+    @return true - инициализация прошла успешно, false - ошибка выделения памяти.
+*/
+bool string_id_system_initialize();
+
+/*
+    @brief Завершает работу системы интернированных строк и освобождает все строки.
+    @warning Не thread-safe. Должна вызываться из основного потока.
+*/
+void string_id_system_shutdown();
+
+/*
+    @brief Проверяет, была ли инициализирована система интернированных строк.
+    @return true - система инициализирована и готова к работе, false - система не инициализирована.
+*/
+CORE_API bool string_id_system_is_initialized();
+
+/*
+    @brief Вычисляет идентификатор строки без интернирования.
+    @param str Указатель на строку.
+    @param length Длина строки (без учета завершающего нуль-символа).
+    @return Идентификатор строки.
+*/
+CORE_API string_id string_id_hash(const char* str, u64 length);
+
+/*
+    @brief Интернирует нуль-терминированную строку.
+    @param str Указатель на строку (не nullptr).
+    @return Идентификатор строки или STRING_ID_INVALID в случае ошибки.
+*/
+CORE_API string_id string_id_intern(const char* str);
+
+/*
+    @brief Интернирует строку указанной длины.
+    @note Строка может не содержать завершающий нуль-символ, он добавляется к копии.
+    @param str Указатель на строку (не nullptr).
+    @param length Длина строки.
+    @return Идентификатор строки или STRING_ID_INVALID в случае ошибки.
+*/
+CORE_API string_id string_id_intern_length(const char* str, u64 length);
+
+/*
+    @brief Возвращает интернированную строку по идентификатору.
+    @note Указатель действителен до завершения системы.
+    @param id Идентификатор строки.
+    @return Указатель на строку или nullptr, если строка с таким идентификатором не интернирована.
+*/
+CORE_API const char* string_id_str(string_id id);
+
+/*
+    @brief Возвращает количество интернированных строк.
+    @return Количество строк.
+*/
+CORE_API u64 string_id_count();
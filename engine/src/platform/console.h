@@ -86,6 +86,25 @@ CORE_API bool platform_console_is_initialized(void);
 */
 CORE_API void platform_console_write(console_stream_t stream, console_color_t color, const char* message);
 
+/**
+    @brief Выводит участок строки в заданный стандартный поток без изменения цвета одной записью.
+    @param stream Тип стандартного потока.
+    @param message Указатель на начало участка строки, не может быть nullptr.
+    @param length Длина участка строки в байтах.
+
+    @note Участок выводится одним вызовом записи в поток, поэтому строки, выводимые из разных потоков, не перемешиваются.
+*/
+CORE_API void platform_console_write_raw(console_stream_t stream, const char* message, u64 length);
+
+/**
+    @brief Возвращает параметры управляющей последовательности цвета (без префикса ESC[ и суффикса m).
+    @param color Цвет сообщения.
+    @return Строка параметров цвета, например "0;38;5;196".
+
+    @note Используется для сборки строки с цветом в буфере перед выводом через platform_console_write_raw().
+*/
+CORE_API const char* platform_console_color_code(console_color_t color);
+
 /**
     @brief Выводит форматируемое сообщение со списком аргументов в заданный стандартный поток.
     @param stream Тип стандартного потока.
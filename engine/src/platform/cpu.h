@@ -0,0 +1,100 @@
+/*
+    @file cpu.h
+    @brief Кросс-платформенный интерфейс для получения топологии процессора.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Реализации функций являются платформозависимыми и находятся в соответствующих
+          platform/ модулях (windows, linux и т.д.).
+
+    @note Предоставляет:
+            - Количество логических процессоров, физических ядер, процессоров (сокетов) и узлов NUMA
+            - Принадлежность логических процессоров ядрам (SMT), сокетам и узлам NUMA
+            - Тип ядра на гибридных процессорах (производительные и энергоэффективные ядра)
+            - Размеры кэшей и линии кэша
+
+    @note Особенности реализации:
+            - Linux: данные читаются из /sys/devices/system/cpu и /sys/devices/system/node; физические ядра
+              определяются по спискам thread_siblings_list (core_id может повторяться в одном сокете); тип ядра
+              определяется по /sys/devices/cpu_core и cpu_atom (Intel) или по cpu_capacity (ARM big.LITTLE)
+            - Windows: данные получаются из GetLogicalProcessorInformationEx(), тип ядра - по EfficiencyClass
+            - Описываются только логические процессоры, на которых может выполняться вызывающий поток
+              (маска привязки), поэтому топологию следует получать до привязки потока к процессорам
+            - При отсутствии данных о топологии каждый логический процессор считается отдельным ядром
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Максимальное количество описываемых логических процессоров.
+#define PLATFORM_CPU_MAX_LOGICAL 256
+
+// @brief Тип ядра процессора.
+typedef enum platform_cpu_core_type {
+    // @brief Тип не определен (все ядра одинаковые или данных нет).
+    PLATFORM_CPU_CORE_TYPE_UNKNOWN,
+    // @brief Производительное ядро (P-core, big).
+    PLATFORM_CPU_CORE_TYPE_PERFORMANCE,
+    // @brief Энергоэффективное ядро (E-core, LITTLE).
+    PLATFORM_CPU_CORE_TYPE_EFFICIENCY
+} platform_cpu_core_type;
+
+// @brief Описание логического процессора.
+typedef struct platform_cpu_logical {
+    // @brief Системный номер логического процессора (используется в platform_thread_set_affinity()).
+    u16 id;
+    // @brief Индекс физического ядра (0..physical_count-1).
+    u16 core;
+    // @brief Индекс процессора (сокета).
+    u16 package;
+    // @brief Номер узла NUMA.
+    u16 numa_node;
+    // @brief Порядковый номер среди логических процессоров своего ядра (0 - первый поток SMT).
+    u8 smt_index;
+    // @brief Тип ядра (platform_cpu_core_type).
+    u8 core_type;
+} platform_cpu_logical;
+
+// @brief Топология процессора.
+typedef struct platform_cpu_info_t {
+    // @brief Количество логических процессоров.
+    u32 logical_count;
+    // @brief Количество физических ядер.
+    u32 physical_count;
+    // @brief Количество процессоров (сокетов).
+    u32 package_count;
+    // @brief Количество узлов NUMA.
+    u32 numa_node_count;
+    // @brief Количество производительных физических ядер (0 - процессор не гибридный).
+    u32 performance_core_count;
+    // @brief Количество энергоэффективных физических ядер.
+    u32 efficiency_core_count;
+    // @brief Размер линии кэша в байтах (0 - неизвестно).
+    u32 cache_line_size;
+    // @brief Размер кэша данных L1 одного ядра в байтах (0 - неизвестно).
+    u64 l1_data_cache_size;
+    // @brief Размер кэша L2 в байтах (0 - неизвестно).
+    u64 l2_cache_size;
+    // @brief Размер кэша L3 в байтах (0 - неизвестно).
+    u64 l3_cache_size;
+    // @brief Логические процессоры в порядке возрастания системного номера.
+    platform_cpu_logical logical[PLATFORM_CPU_MAX_LOGICAL];
+} platform_cpu_info_t;
+
+/*
+    @brief Получает топологию процессора.
+    @note Thread-safe. Данные каждый раз запрашиваются у системы, результат следует сохранить.
+    @param out_info Указатель на структуру для записи топологии.
+    @return true - топология получена, false - произошла ошибка.
+*/
+CORE_API bool platform_cpu_info(platform_cpu_info_t* out_info);
@@ -0,0 +1,93 @@
+/*
+    @file fiber.h
+    @brief Кросс-платформенный интерфейс для работы с волокнами (fibers).
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Реализации функций являются платформозависимыми и находятся в соответствующих
+          platform/ модулях (windows, linux и т.д.).
+
+    @note Предоставляет:
+            - Создание волокон с собственным стеком и передачу управления между ними без обращения к ядру
+            - Преобразование текущего потока в волокно (для возврата управления в стек потока)
+
+    @note Особенности реализации:
+            - Linux: переключение контекста написано на ассемблере для x86-64 и AArch64 (сохраняются только
+              регистры, которые функция обязана сохранить по ABI), для остальных архитектур используется ucontext
+            - Windows: системные волокна (CreateFiberEx, SwitchToFiber)
+            - Стек волокна резервируется отдельным диапазоном виртуальных адресов, под стеком находится
+              защитная страница: переполнение стека приводит к ошибке доступа, а не к порче памяти
+            - Волокно не привязано к потоку: приостановленное волокно может быть продолжено в другом потоке
+
+    @warning Thread-local переменные в волокне, продолженном в другом потоке, относятся к новому потоку.
+             Адреса thread-local переменных нельзя сохранять между переключениями.
+
+    @note Для корректной работы необходимо предварительно инициализировать (в указанном порядке):
+            - Подсистему консоли platform_console_initialize()
+            - Подсистему памяти platform_memory_initialize()
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Размер стека волокна по умолчанию в байтах.
+#define PLATFORM_FIBER_DEFAULT_STACK_SIZE (64 * 1024)
+
+// @brief Волокно (внутренняя структура платформенного модуля).
+typedef struct platform_fiber platform_fiber;
+
+/*
+    @brief Функция-исполнитель волокна.
+    @warning Функция не должна возвращать управление: по завершении работы волокно должно переключиться
+             на другое волокно и больше не продолжаться.
+    @param data Данные для передачи в функцию-исполнитель.
+*/
+typedef void (*platform_fiber_start_fn)(void* data);
+
+/*
+    @brief Создает волокно с собственным стеком. Исполнитель запускается при первом переключении на волокно.
+    @param func Функция-исполнитель волокна.
+    @param data Данные для передачи в функцию-исполнитель.
+    @param stack_size Размер стека в байтах (округляется до размера страницы, 0 - PLATFORM_FIBER_DEFAULT_STACK_SIZE).
+    @return Указатель на волокно или nullptr при ошибке.
+*/
+CORE_API platform_fiber* platform_fiber_create(platform_fiber_start_fn func, void* data, u64 stack_size);
+
+/*
+    @brief Уничтожает волокно и освобождает его стек.
+    @warning Нельзя уничтожать выполняющееся волокно.
+    @param fiber Указатель на волокно.
+*/
+CORE_API void platform_fiber_destroy(platform_fiber* fiber);
+
+/*
+    @brief Преобразует текущий поток в волокно, чтобы из него можно было переключиться на другие волокна.
+    @note Волокно потока использует стек потока, на него можно вернуться только в этом же потоке.
+    @return Указатель на волокно потока или nullptr при ошибке.
+*/
+CORE_API platform_fiber* platform_fiber_convert_thread();
+
+/*
+    @brief Преобразует волокно потока обратно в поток и освобождает его.
+    @warning Должна вызываться в потоке, который был преобразован, при выполнении волокна потока.
+    @param fiber Указатель на волокно потока.
+*/
+CORE_API void platform_fiber_convert_fiber(platform_fiber* fiber);
+
+/*
+    @brief Сохраняет состояние текущего волокна и передает управление другому волокну.
+    @note Управление возвращается из функции, когда на волокно from переключится какое-либо волокно.
+    @param from Указатель на текущее волокно (выполняющее вызов).
+    @param to Указатель на волокно, которому передается управление.
+*/
+CORE_API void platform_fiber_switch(platform_fiber* from, platform_fiber* to);
@@ -0,0 +1,382 @@
+#include "platform/cpu.h"
+
+#ifdef PLATFORM_LINUX_FLAG
+
+    // Нужна для sched_getaffinity и макросов CPU_*.
+    #define _GNU_SOURCE 1
+
+    #include "debug/assert.h"
+    #include "platform/memory.h"
+
+    #include <sched.h>
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <unistd.h>
+
+    // Количество слов маски логических процессоров.
+    #define CPU_MASK_WORDS (PLATFORM_CPU_MAX_LOGICAL / 64)
+
+    // Максимальное количество проверяемых узлов NUMA и уровней кэша.
+    #define CPU_MAX_NUMA_NODES  64
+    #define CPU_MAX_CACHE_INDEX 16
+
+    // Маска логических процессоров.
+    typedef struct cpu_mask {
+        u64 bits[CPU_MASK_WORDS];
+    } cpu_mask;
+
+    INLINE bool cpu_mask_test(const cpu_mask* mask, u32 cpu)
+    {
+        return cpu < PLATFORM_CPU_MAX_LOGICAL && (mask->bits[cpu / 64] & (1ULL << (cpu % 64))) != 0;
+    }
+
+    // Возвращает наименьший номер процессора маски (U32_MAX - маска пуста).
+    INLINE u32 cpu_mask_first(const cpu_mask* mask)
+    {
+        for(u32 word = 0; word < CPU_MASK_WORDS; ++word)
+        {
+            if(mask->bits[word])
+            {
+                return word * 64 + (u32)__builtin_ctzll(mask->bits[word]);
+            }
+        }
+        return U32_MAX;
+    }
+
+    // Читает первую строку файла.
+    static bool cpu_read_line(const char* path, char* buffer, u32 size)
+    {
+        FILE* file = fopen(path, "r");
+        if(!file)
+        {
+            return false;
+        }
+
+        bool success = fgets(buffer, (int)size, file) != nullptr;
+        fclose(file);
+
+        if(success)
+        {
+            buffer[strcspn(buffer, "\n")] = '\0';
+        }
+        return success;
+    }
+
+    // Читает число из файла.
+    static bool cpu_read_u64(const char* path, u64* out_value)
+    {
+        char buffer[64];
+        if(!cpu_read_line(path, buffer, sizeof(buffer)))
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        *out_value = strtoull(buffer, &end, 10);
+        return end != buffer;
+    }
+
+    // Разбирает список процессоров вида "0-3,8,10-11".
+    static void cpu_list_parse(const char* text, cpu_mask* out_mask)
+    {
+        memset(out_mask, 0, sizeof(cpu_mask));
+
+        while(*text)
+        {
+            char* end = nullptr;
+            u64 first = strtoull(text, &end, 10);
+            if(end == text)
+            {
+                break;
+            }
+
+            u64 last = first;
+            text = end;
+            if(*text == '-')
+            {
+                last = strtoull(text + 1, &end, 10);
+                text = end;
+            }
+
+            for(u64 cpu = first; cpu <= last && cpu < PLATFORM_CPU_MAX_LOGICAL; ++cpu)
+            {
+                out_mask->bits[cpu / 64] |= 1ULL << (cpu % 64);
+            }
+
+            if(*text == ',')
+            {
+                ++text;
+            }
+        }
+    }
+
+    // Читает список процессоров из файла.
+    static bool cpu_read_list(const char* path, cpu_mask* out_mask)
+    {
+        char buffer[1024];
+        if(!cpu_read_line(path, buffer, sizeof(buffer)))
+        {
+            return false;
+        }
+
+        cpu_list_parse(buffer, out_mask);
+        return true;
+    }
+
+    // Читает размер вида "32K" или "16M" в байтах.
+    static u64 cpu_read_size(const char* path)
+    {
+        char buffer[64];
+        if(!cpu_read_line(path, buffer, sizeof(buffer)))
+        {
+            return 0;
+        }
+
+        char* end = nullptr;
+        u64 size = strtoull(buffer, &end, 10);
+        switch(*end)
+        {
+            case 'K': return size << 10;
+            case 'M': return size << 20;
+            case 'G': return size << 30;
+            default:  return size;
+        }
+    }
+
+    // Определяет тип ядер: гибридные процессоры Intel, затем относительная производительность ядер ARM.
+    static void cpu_detect_core_types(platform_cpu_info_t* info)
+    {
+        cpu_mask performance, efficiency;
+        if(cpu_read_list("/sys/devices/cpu_core/cpus", &performance) && cpu_read_list("/sys/devices/cpu_atom/cpus", &efficiency))
+        {
+            for(u32 i = 0; i < info->logical_count; ++i)
+            {
+                platform_cpu_logical* logical = &info->logical[i];
+                if(cpu_mask_test(&performance, logical->id))
+                {
+                    logical->core_type = PLATFORM_CPU_CORE_TYPE_PERFORMANCE;
+                }
+                else if(cpu_mask_test(&efficiency, logical->id))
+                {
+                    logical->core_type = PLATFORM_CPU_CORE_TYPE_EFFICIENCY;
+                }
+            }
+            return;
+        }
+
+        // NOTE: cpu_capacity - производительность ядра относительно самого быстрого (1024).
+        u64 capacity[PLATFORM_CPU_MAX_LOGICAL];
+        u64 max_capacity = 0;
+        u64 min_capacity = U64_MAX;
+        char path[128];
+
+        for(u32 i = 0; i < info->logical_count; ++i)
+        {
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpu_capacity", info->logical[i].id);
+            if(!cpu_read_u64(path, &capacity[i]))
+            {
+                return;
+            }
+            max_capacity = MAX(max_capacity, capacity[i]);
+            min_capacity = MIN(min_capacity, capacity[i]);
+        }
+
+        if(info->logical_count == 0 || max_capacity == min_capacity)
+        {
+            return;
+        }
+
+        for(u32 i = 0; i < info->logical_count; ++i)
+        {
+            info->logical[i].core_type = capacity[i] == max_capacity ? PLATFORM_CPU_CORE_TYPE_PERFORMANCE : PLATFORM_CPU_CORE_TYPE_EFFICIENCY;
+        }
+    }
+
+    // Определяет узлы NUMA логических процессоров.
+    static void cpu_detect_numa_nodes(platform_cpu_info_t* info)
+    {
+        char path[128];
+        cpu_mask node_cpus;
+
+        for(u32 node = 0; node < CPU_MAX_NUMA_NODES; ++node)
+        {
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+            if(!cpu_read_list(path, &node_cpus))
+            {
+                continue;
+            }
+
+            bool used = false;
+            for(u32 i = 0; i < info->logical_count; ++i)
+            {
+                if(cpu_mask_test(&node_cpus, info->logical[i].id))
+                {
+                    info->logical[i].numa_node = (u16)node;
+                    used = true;
+                }
+            }
+
+            info->numa_node_count += used ? 1 : 0;
+        }
+
+        info->numa_node_count = MAX(info->numa_node_count, 1U);
+    }
+
+    // Определяет размеры кэшей по первому логическому процессору.
+    static void cpu_detect_caches(platform_cpu_info_t* info)
+    {
+        char path[128];
+        char type[32];
+
+        for(u32 index = 0; index < CPU_MAX_CACHE_INDEX && info->logical_count > 0; ++index)
+        {
+            u32 cpu = info->logical[0].id;
+            u64 level = 0;
+
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+            if(!cpu_read_u64(path, &level))
+            {
+                break;
+            }
+
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu, index);
+            if(!cpu_read_line(path, type, sizeof(type)) || strcmp(type, "Instruction") == 0)
+            {
+                continue;
+            }
+
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+            u64 size = cpu_read_size(path);
+
+            switch(level)
+            {
+                case 1: info->l1_data_cache_size = size; break;
+                case 2: info->l2_cache_size = size; break;
+                case 3: info->l3_cache_size = size; break;
+                default: break;
+            }
+
+            u64 line_size = 0;
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/coherency_line_size", cpu, index);
+            if(info->cache_line_size == 0 && cpu_read_u64(path, &line_size))
+            {
+                info->cache_line_size = (u32)line_size;
+            }
+        }
+    }
+
+    bool platform_cpu_info(platform_cpu_info_t* out_info)
+    {
+        ASSERT(out_info != nullptr, "Info pointer must be non-null.");
+
+        platform_memory_zero(out_info, sizeof(platform_cpu_info_t));
+
+        cpu_set_t allowed;
+        if(sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0)
+        {
+            return false;
+        }
+
+        // Первые процессоры ядер и номера сокетов для сопоставления логических процессоров одного ядра.
+        // NOTE: Ядро определяется по списку соседних потоков SMT, а не по core_id: core_id уникален только
+        //       внутри кластера или кристалла и на части систем (гибридные и многокристальные процессоры,
+        //       ARM) повторяется для разных ядер одного сокета.
+        u32 core_keys[PLATFORM_CPU_MAX_LOGICAL];
+        u32 package_ids[PLATFORM_CPU_MAX_LOGICAL];
+        char path[128];
+
+        for(u32 cpu = 0; cpu < PLATFORM_CPU_MAX_LOGICAL && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if(!CPU_ISSET(cpu, &allowed))
+            {
+                continue;
+            }
+
+            u32 index = out_info->logical_count++;
+            platform_cpu_logical* logical = &out_info->logical[index];
+            logical->id = (u16)cpu;
+
+            u64 package_id = 0;
+            u32 core_key = cpu;
+            cpu_mask siblings;
+
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+            cpu_read_u64(path, &package_id);
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+
+            // Номер в ядре - количество логических процессоров ядра с меньшими номерами, ключ ядра - первый из них.
+            // Без списка соседних потоков каждый логический процессор считается отдельным ядром.
+            if(cpu_read_list(path, &siblings) && cpu_mask_test(&siblings, cpu))
+            {
+                for(u32 sibling = 0; sibling < cpu; ++sibling)
+                {
+                    logical->smt_index += cpu_mask_test(&siblings, sibling) ? 1 : 0;
+                }
+                core_key = cpu_mask_first(&siblings);
+            }
+
+            core_keys[index] = core_key;
+            package_ids[index] = (u32)package_id;
+        }
+
+        // Сквозная нумерация физических ядер и сокетов.
+        for(u32 i = 0; i < out_info->logical_count; ++i)
+        {
+            platform_cpu_logical* logical = &out_info->logical[i];
+            bool core_found = false;
+            bool package_found = false;
+
+            for(u32 j = 0; j < i; ++j)
+            {
+                if(!core_found && core_keys[j] == core_keys[i])
+                {
+                    logical->core = out_info->logical[j].core;
+                    core_found = true;
+                }
+                if(!package_found && package_ids[j] == package_ids[i])
+                {
+                    logical->package = out_info->logical[j].package;
+                    package_found = true;
+                }
+            }
+
+            if(!core_found)
+            {
+                logical->core = (u16)out_info->physical_count++;
+            }
+            if(!package_found)
+            {
+                logical->package = (u16)out_info->package_count++;
+            }
+        }
+
+        cpu_detect_core_types(out_info);
+        cpu_detect_numa_nodes(out_info);
+        cpu_detect_caches(out_info);
+
+        // Количество ядер каждого типа считается по первому логическому процессору ядра.
+        for(u32 i = 0; i < out_info->logical_count; ++i)
+        {
+            platform_cpu_logical* logical = &out_info->logical[i];
+            bool first = true;
+
+            for(u32 j = 0; j < i && first; ++j)
+            {
+                first = out_info->logical[j].core != logical->core;
+            }
+
+            if(first && logical->core_type == PLATFORM_CPU_CORE_TYPE_PERFORMANCE)
+            {
+                out_info->performance_core_count++;
+            }
+            else if(first && logical->core_type == PLATFORM_CPU_CORE_TYPE_EFFICIENCY)
+            {
+                out_info->efficiency_core_count++;
+            }
+        }
+
+        return out_info->logical_count > 0;
+    }
+
+#endif
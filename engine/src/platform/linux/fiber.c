@@ -0,0 +1,300 @@
+#include "platform/fiber.h"
+
+#ifdef PLATFORM_LINUX_FLAG
+
+    #include "debug/assert.h"
+    #include "core/logger.h"
+    #include "platform/memory.h"
+
+    // Для архитектур без собственного переключения контекста используется ucontext.
+    #if !defined(__x86_64__) && !defined(__aarch64__)
+        #define FIBER_UCONTEXT_FLAG 1
+        #include <ucontext.h>
+    #endif
+
+    struct platform_fiber {
+    #ifdef FIBER_UCONTEXT_FLAG
+        // Сохраненный контекст волокна.
+        ucontext_t context;
+    #else
+        // Указатель стека приостановленного волокна (регистры сохранены на вершине его стека).
+        void* stack_pointer;
+    #endif
+        // Начало зарезервированного диапазона стека с защитной страницей (nullptr - волокно потока).
+        void* stack;
+        // Размер зарезервированного диапазона в байтах.
+        u64 stack_size;
+        // Функция-исполнитель волокна.
+        platform_fiber_start_fn func;
+        // Данные функции-исполнителя.
+        void* data;
+    };
+
+    // Вызывает исполнитель волокна (первая функция на стеке нового волокна).
+    static void fiber_start(platform_fiber* fiber)
+    {
+        fiber->func(fiber->data);
+
+        LOG_FATAL("Fiber function must not return.");
+        __builtin_trap();
+    }
+
+    #ifndef FIBER_UCONTEXT_FLAG
+
+    // Сохраняет регистры на стеке текущего волокна, записывает указатель стека в from, переходит на стек to
+    // и восстанавливает его регистры. Возврат происходит по адресу, сохраненному на стеке to.
+    void fiber_switch_context(void** from, void* to);
+
+    // Точка входа нового волокна: вызывает fiber_start() с волокном из сохраненного регистра.
+    void fiber_trampoline();
+
+    #if defined(__x86_64__)
+
+        // Кадр сохраненного контекста (System V ABI): управляющие слова MXCSR и FPU, r15, r14, r13, r12, rbx, rbp
+        // и адрес возврата. Регистры xmm не сохраняются: по ABI все они изменяемые при вызове.
+        #define FIBER_FRAME_SIZE 64
+
+        __asm__(
+            ".text\n"
+            ".p2align 4\n"
+            ".globl fiber_switch_context\n"
+            ".hidden fiber_switch_context\n"
+            ".type fiber_switch_context, @function\n"
+            "fiber_switch_context:\n"
+            "    pushq %rbp\n"
+            "    pushq %rbx\n"
+            "    pushq %r12\n"
+            "    pushq %r13\n"
+            "    pushq %r14\n"
+            "    pushq %r15\n"
+            "    subq $8, %rsp\n"
+            "    stmxcsr (%rsp)\n"
+            "    fnstcw 4(%rsp)\n"
+            "    movq %rsp, (%rdi)\n"
+            "    movq %rsi, %rsp\n"
+            "    ldmxcsr (%rsp)\n"
+            "    fldcw 4(%rsp)\n"
+            "    addq $8, %rsp\n"
+            "    popq %r15\n"
+            "    popq %r14\n"
+            "    popq %r13\n"
+            "    popq %r12\n"
+            "    popq %rbx\n"
+            "    popq %rbp\n"
+            "    ret\n"
+            ".size fiber_switch_context, .-fiber_switch_context\n"
+            "\n"
+            ".p2align 4\n"
+            ".globl fiber_trampoline\n"
+            ".hidden fiber_trampoline\n"
+            ".type fiber_trampoline, @function\n"
+            "fiber_trampoline:\n"
+            "    movq %r12, %rdi\n"
+            "    callq *%r13\n"
+            "    ud2\n"
+            ".size fiber_trampoline, .-fiber_trampoline\n"
+        );
+
+        // Подготавливает кадр, из которого fiber_switch_context() перейдет в fiber_trampoline().
+        static void* fiber_frame_create(platform_fiber* fiber, u8* stack_top)
+        {
+            // NOTE: После возврата в fiber_trampoline() указатель стека должен быть выровнен по 16 байтам,
+            //       чтобы вызов fiber_start() получил выравнивание, требуемое ABI.
+            u64* frame = (u64*)(stack_top - 16 - FIBER_FRAME_SIZE);
+            frame[0] = 0x1F80ULL | (0x037FULL << 32); // MXCSR и управляющее слово FPU по умолчанию.
+            frame[1] = 0;                             // r15
+            frame[2] = 0;                             // r14
+            frame[3] = (u64)(usize)fiber_start;       // r13
+            frame[4] = (u64)(usize)fiber;             // r12
+            frame[5] = 0;                             // rbx
+            frame[6] = 0;                             // rbp
+            frame[7] = (u64)(usize)fiber_trampoline;  // Адрес возврата.
+            return frame;
+        }
+
+    #elif defined(__aarch64__)
+
+        // Кадр сохраненного контекста (AAPCS64): x19-x28, x29 (fp), x30 (lr) и нижние половины v8-v15.
+        #define FIBER_FRAME_SIZE 160
+
+        __asm__(
+            ".text\n"
+            ".p2align 4\n"
+            ".globl fiber_switch_context\n"
+            ".hidden fiber_switch_context\n"
+            ".type fiber_switch_context, %function\n"
+            "fiber_switch_context:\n"
+            "    sub sp, sp, #160\n"
+            "    stp x19, x20, [sp, #0]\n"
+            "    stp x21, x22, [sp, #16]\n"
+            "    stp x23, x24, [sp, #32]\n"
+            "    stp x25, x26, [sp, #48]\n"
+            "    stp x27, x28, [sp, #64]\n"
+            "    stp x29, x30, [sp, #80]\n"
+            "    stp d8, d9, [sp, #96]\n"
+            "    stp d10, d11, [sp, #112]\n"
+            "    stp d12, d13, [sp, #128]\n"
+            "    stp d14, d15, [sp, #144]\n"
+            "    mov x2, sp\n"
+            "    str x2, [x0]\n"
+            "    mov sp, x1\n"
+            "    ldp x19, x20, [sp, #0]\n"
+            "    ldp x21, x22, [sp, #16]\n"
+            "    ldp x23, x24, [sp, #32]\n"
+            "    ldp x25, x26, [sp, #48]\n"
+            "    ldp x27, x28, [sp, #64]\n"
+            "    ldp x29, x30, [sp, #80]\n"
+            "    ldp d8, d9, [sp, #96]\n"
+            "    ldp d10, d11, [sp, #112]\n"
+            "    ldp d12, d13, [sp, #128]\n"
+            "    ldp d14, d15, [sp, #144]\n"
+            "    add sp, sp, #160\n"
+            "    ret\n"
+            ".size fiber_switch_context, .-fiber_switch_context\n"
+            "\n"
+            ".p2align 4\n"
+            ".globl fiber_trampoline\n"
+            ".hidden fiber_trampoline\n"
+            ".type fiber_trampoline, %function\n"
+            "fiber_trampoline:\n"
+            "    mov x0, x19\n"
+            "    blr x20\n"
+            "    brk #0\n"
+            ".size fiber_trampoline, .-fiber_trampoline\n"
+        );
+
+        // Подготавливает кадр, из которого fiber_switch_context() перейдет в fiber_trampoline().
+        static void* fiber_frame_create(platform_fiber* fiber, u8* stack_top)
+        {
+            u64* frame = (u64*)(stack_top - FIBER_FRAME_SIZE);
+            platform_memory_zero(frame, FIBER_FRAME_SIZE);
+            frame[0] = (u64)(usize)fiber;             // x19
+            frame[1] = (u64)(usize)fiber_start;       // x20
+            frame[11] = (u64)(usize)fiber_trampoline; // x30 (адрес возврата)
+            return frame;
+        }
+
+    #endif
+
+    #else
+
+    // NOTE: makecontext() передает только аргументы типа int, поэтому указатель делится на две половины.
+    static void fiber_start_ucontext(u32 high, u32 low)
+    {
+        fiber_start((platform_fiber*)(usize)(((u64)high << 32) | low));
+    }
+
+    // Подготавливает контекст, из которого swapcontext() перейдет в fiber_start_ucontext().
+    // NOTE: Вынесено из platform_fiber_create(): getcontext() возвращает управление дважды, и локальные
+    //       переменные вызывающей функции могли бы быть испорчены.
+    static bool fiber_context_create(platform_fiber* fiber, u8* stack_bottom, u64 stack_size)
+    {
+        if(getcontext(&fiber->context) != 0)
+        {
+            return false;
+        }
+
+        fiber->context.uc_stack.ss_sp = stack_bottom;
+        fiber->context.uc_stack.ss_size = (size_t)stack_size;
+        fiber->context.uc_link = nullptr;
+
+        u64 address = (u64)(usize)fiber;
+        makecontext(&fiber->context, (void (*)())fiber_start_ucontext, 2, (u32)(address >> 32), (u32)address);
+        return true;
+    }
+
+    #endif
+
+    platform_fiber* platform_fiber_create(platform_fiber_start_fn func, void* data, u64 stack_size)
+    {
+        ASSERT(func != nullptr, "Fiber function must be non-null.");
+
+        u64 page_size = platform_memory_page_size();
+        if(stack_size == 0)
+        {
+            stack_size = PLATFORM_FIBER_DEFAULT_STACK_SIZE;
+        }
+        stack_size = (stack_size + page_size - 1) & ~(page_size - 1);
+
+        platform_fiber* fiber = platform_memory_allocate(sizeof(platform_fiber));
+        if(!fiber)
+        {
+            return nullptr;
+        }
+        platform_memory_zero(fiber, sizeof(platform_fiber));
+
+        // Нижняя страница остается зарезервированной без доступа: стек растет вниз и упирается в нее.
+        fiber->stack_size = stack_size + page_size;
+        fiber->stack = platform_memory_reserve(fiber->stack_size);
+        if(!fiber->stack)
+        {
+            platform_memory_free(fiber);
+            return nullptr;
+        }
+
+        u8* stack_bottom = (u8*)fiber->stack + page_size;
+        if(!platform_memory_commit(stack_bottom, stack_size))
+        {
+            platform_memory_release(fiber->stack, fiber->stack_size);
+            platform_memory_free(fiber);
+            return nullptr;
+        }
+
+        fiber->func = func;
+        fiber->data = data;
+
+    #ifdef FIBER_UCONTEXT_FLAG
+        if(!fiber_context_create(fiber, stack_bottom, stack_size))
+        {
+            platform_memory_release(fiber->stack, fiber->stack_size);
+            platform_memory_free(fiber);
+            return nullptr;
+        }
+    #else
+        fiber->stack_pointer = fiber_frame_create(fiber, stack_bottom + stack_size);
+    #endif
+
+        return fiber;
+    }
+
+    void platform_fiber_destroy(platform_fiber* fiber)
+    {
+        ASSERT(fiber != nullptr, "Fiber pointer must be non-null.");
+        ASSERT(fiber->stack != nullptr, "Thread fiber must be released with platform_fiber_convert_fiber().");
+
+        platform_memory_release(fiber->stack, fiber->stack_size);
+        platform_memory_free(fiber);
+    }
+
+    platform_fiber* platform_fiber_convert_thread()
+    {
+        // NOTE: Волокну потока стек не нужен: состояние сохраняется на стеке потока при переключении.
+        platform_fiber* fiber = platform_memory_allocate(sizeof(platform_fiber));
+        if(fiber)
+        {
+            platform_memory_zero(fiber, sizeof(platform_fiber));
+        }
+        return fiber;
+    }
+
+    void platform_fiber_convert_fiber(platform_fiber* fiber)
+    {
+        ASSERT(fiber != nullptr, "Fiber pointer must be non-null.");
+        ASSERT(fiber->stack == nullptr, "Fiber with own stack must be released with platform_fiber_destroy().");
+
+        platform_memory_free(fiber);
+    }
+
+    void platform_fiber_switch(platform_fiber* from, platform_fiber* to)
+    {
+        ASSERT(from != nullptr && to != nullptr, "Fiber pointers must be non-null.");
+        ASSERT(from != to, "Fiber cannot switch to itself.");
+
+    #ifdef FIBER_UCONTEXT_FLAG
+        swapcontext(&from->context, &to->context);
+    #else
+        fiber_switch_context(&from->stack_pointer, to->stack_pointer);
+    #endif
+    }
+
+#endif
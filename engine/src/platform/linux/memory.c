@@ -3,15 +3,39 @@
 #ifdef PLATFORM_LINUX_FLAG
 
     #include "debug/assert.h"
+    #include <stdio.h>
     #include <stdlib.h>
     #include <string.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
 
     static bool initialized = false;
+    static u64 page_size = 0;
+    static bool huge_pages_available = false;
+
+    static bool transparent_huge_pages_enabled()
+    {
+        // NOTE: Режим выбран квадратными скобками, например "always [madvise] never".
+        FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+        if(!file)
+        {
+            return false;
+        }
+
+        char mode[128] = {0};
+        bool enabled = fgets(mode, sizeof(mode), file) != nullptr && (strstr(mode, "[always]") || strstr(mode, "[madvise]"));
+        fclose(file);
+
+        return enabled;
+    }
 
     bool platform_memory_initialize()
     {
         ASSERT(initialized == false, "Memory subsystem is already initialized.");
 
+        page_size = (u64)sysconf(_SC_PAGESIZE);
+        huge_pages_available = transparent_huge_pages_enabled();
+
         initialized = true;
         return true;
     }
@@ -42,6 +66,146 @@
         free(block);
     }
 
+    void* platform_memory_allocate_aligned(u64 size, u16 alignment)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+        ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+        // NOTE: posix_memalign требует выравнивание не меньше размера указателя.
+        void* block = nullptr;
+        if(posix_memalign(&block, MAX((usize)alignment, sizeof(void*)), (size_t)size) != 0)
+        {
+            return nullptr;
+        }
+
+        return block;
+    }
+
+    void platform_memory_free_aligned(void* block)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(block != nullptr, "Block pointer must be non-null.");
+
+        free(block);
+    }
+
+    void* platform_memory_allocate_large(u64 size, bool* out_huge_pages)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+
+        const u64 huge_page_size = PLATFORM_MEMORY_HUGE_PAGE_SIZE;
+        u64 mapped_size = (size + page_size - 1) & ~(page_size - 1);
+        u64 huge_size = mapped_size & ~(huge_page_size - 1);
+
+        if(out_huge_pages)
+        {
+            *out_huge_pages = false;
+        }
+
+        // Блок меньше большой страницы не может быть размещен на ней и не требует выравнивания.
+        if(!huge_pages_available || huge_size == 0)
+        {
+            void* block = mmap(nullptr, (size_t)mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            return block != MAP_FAILED ? block : nullptr;
+        }
+
+        // NOTE: Отображение округляется до обычной страницы, а запас нужен только для выравнивания начала блока
+        //       по границе большой страницы, иначе ядро не сможет разместить его на больших страницах.
+        u64 align_size = huge_page_size - page_size;
+        u8* raw = mmap(nullptr, (size_t)(mapped_size + align_size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(raw == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        u8* block = POINTER_ALIGN_UP(raw, huge_page_size);
+        u64 head_size = (u64)(block - raw);
+        u64 tail_size = align_size - head_size;
+
+        // Возврат неиспользуемых участков до и после выровненного блока.
+        if(head_size > 0)
+        {
+            munmap(raw, (size_t)head_size);
+        }
+
+        if(tail_size > 0)
+        {
+            munmap(block + mapped_size, (size_t)tail_size);
+        }
+
+        // NOTE: Рекомендация охватывает только целые большие страницы, остаток блока остается на обычных страницах.
+        //       Ядро может не выполнить рекомендацию (например, при фрагментации физической памяти).
+        bool huge_pages = madvise(block, (size_t)huge_size, MADV_HUGEPAGE) == 0;
+
+        if(out_huge_pages)
+        {
+            *out_huge_pages = huge_pages;
+        }
+
+        return block;
+    }
+
+    void platform_memory_free_large(void* block, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(block != nullptr, "Block pointer must be non-null.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+
+        munmap(block, (size_t)((size + page_size - 1) & ~(page_size - 1)));
+    }
+
+    u64 platform_memory_page_size()
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+
+        return page_size;
+    }
+
+    void* platform_memory_reserve(u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        // NOTE: MAP_NORESERVE исключает учет диапазона в overcommit до фактического использования страниц.
+        void* address = mmap(nullptr, (size_t)size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if(address == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        return address;
+    }
+
+    bool platform_memory_commit(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr && (usize)address % page_size == 0, "Address must be non-null and page aligned.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        return mprotect(address, (size_t)size, PROT_READ | PROT_WRITE) == 0;
+    }
+
+    void platform_memory_decommit(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr && (usize)address % page_size == 0, "Address must be non-null and page aligned.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        madvise(address, (size_t)size, MADV_DONTNEED);
+        mprotect(address, (size_t)size, PROT_NONE);
+    }
+
+    void platform_memory_release(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr, "Address must be non-null.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+
+        munmap(address, (size_t)size);
+    }
+
     void platform_memory_zero(void* block, u64 size)
     {
         ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
@@ -2,17 +2,105 @@
 
 #ifdef PLATFORM_LINUX_FLAG
 
+    // Нужна для pthread_setname_np, gettid и макросов CPU_*.
+    #define _GNU_SOURCE 1
+
     #include "debug/assert.h"
+    #include "core/logger.h"
+    #include "platform/memory.h"
 
+    #include <errno.h>
+    #include <limits.h>
+    #include <pthread.h>
+    #include <sched.h>
     #include <time.h>
-    #include <asm-generic/errno-base.h>
+    #include <unistd.h>
+    #include <sys/resource.h>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+
+    // Количество попыток захвата мьютекса активным циклом перед переходом в ожидание.
+    #define MUTEX_SPIN_COUNT 128
+
+    // Состояния мьютекса.
+    #define MUTEX_UNLOCKED   0
+    #define MUTEX_LOCKED     1
+    #define MUTEX_CONTENDED  2
+
+    // Контекст запуска потока (передается в новый поток и освобождается им).
+    typedef struct thread_start_context {
+        platform_thread_start_fn func;
+        void* data;
+        char name[PLATFORM_THREAD_NAME_MAX + 1];
+    } thread_start_context;
 
     static bool initialized = false;
+    static PLATFORM_THREAD_LOCAL u64 current_thread_id = 0;
+
+    // Маска привязки процесса при инициализации (привязка отдельных потоков ее не меняет).
+    static cpu_set_t process_cpus;
+    static bool process_cpus_valid = false;
+
+    // Копирует имя потока с усечением до PLATFORM_THREAD_NAME_MAX.
+    static void thread_name_copy(char* dst, const char* name)
+    {
+        u32 length = 0;
+        if(name)
+        {
+            while(length < PLATFORM_THREAD_NAME_MAX && name[length] != '\0')
+            {
+                dst[length] = name[length];
+                ++length;
+            }
+        }
+        dst[length] = '\0';
+    }
+
+    static void* thread_start(void* arg)
+    {
+        thread_start_context context = *(thread_start_context*)arg;
+        platform_memory_free(arg);
+
+        if(context.name[0] != '\0')
+        {
+            pthread_setname_np(pthread_self(), context.name);
+        }
+
+        return (void*)(usize)context.func(context.data);
+    }
+
+    // Монотонное время в наносекундах для отсчета времени ожидания.
+    static u64 thread_time_ns()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (u64)now.tv_sec * 1000000000ULL + (u64)now.tv_nsec;
+    }
+
+    // Время окончания ожидания (0 - без ограничения).
+    static u64 thread_deadline(u32 timeout_ms)
+    {
+        return timeout_ms == PLATFORM_WAIT_INFINITE ? 0 : thread_time_ns() + (u64)timeout_ms * 1000000ULL;
+    }
+
+    // Оставшееся время ожидания в миллисекундах (округляется вверх).
+    static u32 thread_remaining_ms(u64 deadline)
+    {
+        if(deadline == 0)
+        {
+            return PLATFORM_WAIT_INFINITE;
+        }
+
+        u64 now = thread_time_ns();
+        return now >= deadline ? 0 : (u32)((deadline - now + 999999ULL) / 1000000ULL);
+    }
 
     bool platform_thread_initialize()
     {
         ASSERT(initialized == false, "Thread subsystem is already initialized.");
 
+        process_cpus_valid = sched_getaffinity(0, sizeof(cpu_set_t), &process_cpus) == 0;
+
         initialized = true;
         return true;
     }
@@ -40,4 +128,336 @@
         return (result == 0 || result == EINTR);
     }
 
+    bool platform_thread_create(platform_thread_start_fn func, void* data, const char* name, platform_thread* out_thread)
+    {
+        ASSERT(initialized == true, "Thread subsystem not initialized. Call platform_thread_initialize() first.");
+        ASSERT(func != nullptr, "Thread function must be non-null.");
+        ASSERT(out_thread != nullptr, "Thread pointer must be non-null.");
+
+        out_thread->handle = 0;
+
+        thread_start_context* context = platform_memory_allocate(sizeof(thread_start_context));
+        if(!context)
+        {
+            LOG_ERROR("Failed to allocate memory for thread start context.");
+            return false;
+        }
+
+        context->func = func;
+        context->data = data;
+        thread_name_copy(context->name, name);
+
+        pthread_t thread;
+        i32 result = pthread_create(&thread, nullptr, thread_start, context);
+        if(result != 0)
+        {
+            LOG_ERROR("Failed to create thread '%s' (error %d).", name ? name : "", result);
+            platform_memory_free(context);
+            return false;
+        }
+
+        out_thread->handle = (u64)thread;
+        return true;
+    }
+
+    bool platform_thread_join(platform_thread* thread, u32* out_result)
+    {
+        ASSERT(thread != nullptr && thread->handle != 0, "Thread must be created.");
+
+        void* result = nullptr;
+        i32 error = pthread_join((pthread_t)thread->handle, &result);
+        if(error != 0)
+        {
+            LOG_ERROR("Failed to join thread (error %d).", error);
+            return false;
+        }
+
+        if(out_result)
+        {
+            *out_result = (u32)(usize)result;
+        }
+
+        thread->handle = 0;
+        return true;
+    }
+
+    void platform_thread_detach(platform_thread* thread)
+    {
+        ASSERT(thread != nullptr && thread->handle != 0, "Thread must be created.");
+
+        pthread_detach((pthread_t)thread->handle);
+        thread->handle = 0;
+    }
+
+    void platform_thread_set_name(const char* name)
+    {
+        ASSERT(name != nullptr, "Thread name must be non-null.");
+
+        char truncated[PLATFORM_THREAD_NAME_MAX + 1];
+        thread_name_copy(truncated, name);
+        pthread_setname_np(pthread_self(), truncated);
+    }
+
+    u64 platform_thread_current_id()
+    {
+        if(UNLIKELY(current_thread_id == 0))
+        {
+            current_thread_id = (u64)gettid();
+        }
+        return current_thread_id;
+    }
+
+    void platform_thread_yield()
+    {
+        sched_yield();
+    }
+
+    u32 platform_processor_count()
+    {
+        if(process_cpus_valid)
+        {
+            return MAX((u32)CPU_COUNT(&process_cpus), 1U);
+        }
+
+        cpu_set_t cpus;
+        if(sched_getaffinity(0, sizeof(cpu_set_t), &cpus) == 0)
+        {
+            return MAX((u32)CPU_COUNT(&cpus), 1U);
+        }
+
+        long count = sysconf(_SC_NPROCESSORS_ONLN);
+        return count > 0 ? (u32)count : 1;
+    }
+
+    bool platform_thread_set_affinity(const u16* cpus, u32 count)
+    {
+        ASSERT(cpus != nullptr || count == 0, "CPUs pointer must be non-null.");
+
+        cpu_set_t mask;
+        if(count == 0)
+        {
+            if(!process_cpus_valid)
+            {
+                return false;
+            }
+            mask = process_cpus;
+        }
+        else
+        {
+            CPU_ZERO(&mask);
+            for(u32 i = 0; i < count; ++i)
+            {
+                if(cpus[i] < CPU_SETSIZE)
+                {
+                    CPU_SET(cpus[i], &mask);
+                }
+            }
+        }
+
+        // NOTE: Для sched_setaffinity() нулевой идентификатор означает вызывающий поток, а не процесс.
+        return sched_setaffinity(0, sizeof(cpu_set_t), &mask) == 0;
+    }
+
+    bool platform_thread_set_priority(platform_thread_priority priority)
+    {
+        // Значения nice для приоритетов от самого низкого до самого высокого.
+        static const i32 nice_values[] = { 10, 5, 0, -5, -10 };
+        ASSERT((u32)priority < ARRAY_SIZE(nice_values), "Invalid thread priority.");
+
+        // NOTE: В Linux значение nice задается для отдельного потока по его идентификатору.
+        return setpriority(PRIO_PROCESS, (id_t)platform_thread_current_id(), nice_values[priority]) == 0;
+    }
+
+    bool platform_address_wait(u32* address, u32 expected, u32 timeout_ms)
+    {
+        ASSERT(address != nullptr && POINTER_IS_ALIGNED(address, sizeof(u32)), "Address must be non-null and aligned to 4 bytes.");
+
+        struct timespec timeout;
+        struct timespec* timeout_ptr = nullptr;
+
+        if(timeout_ms != PLATFORM_WAIT_INFINITE)
+        {
+            timeout.tv_sec = timeout_ms / 1000ULL;
+            timeout.tv_nsec = (timeout_ms % 1000ULL) * 1000000ULL;
+            timeout_ptr = &timeout;
+        }
+
+        // NOTE: Ядро сравнивает значение с ожидаемым атомарно с постановкой в очередь ожидания.
+        long result = syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeout_ptr, nullptr, 0);
+        return result == 0 || errno != ETIMEDOUT;
+    }
+
+    void platform_address_wake(u32* address, u32 count)
+    {
+        ASSERT(address != nullptr, "Address must be non-null.");
+
+        syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count > INT_MAX ? INT_MAX : (i32)count, nullptr, nullptr, 0);
+    }
+
+    void platform_mutex_create(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+        mutex->state = MUTEX_UNLOCKED;
+    }
+
+    // Захватывает мьютекс в состоянии с ожидающими потоками (освобождение обязательно разбудит следующий).
+    static void mutex_lock_contended(platform_mutex* mutex)
+    {
+        while(__atomic_exchange_n(&mutex->state, MUTEX_CONTENDED, __ATOMIC_ACQUIRE) != MUTEX_UNLOCKED)
+        {
+            platform_address_wait(&mutex->state, MUTEX_CONTENDED, PLATFORM_WAIT_INFINITE);
+        }
+    }
+
+    void platform_mutex_lock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        u32 state = MUTEX_UNLOCKED;
+        if(LIKELY(__atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)))
+        {
+            return;
+        }
+
+        // Короткие критические секции часто освобождаются быстрее перехода в ядро.
+        for(u32 i = 0; i < MUTEX_SPIN_COUNT && state != MUTEX_CONTENDED; ++i)
+        {
+            platform_cpu_pause();
+
+            state = __atomic_load_n(&mutex->state, __ATOMIC_RELAXED);
+            if(state == MUTEX_UNLOCKED
+            && __atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return;
+            }
+        }
+
+        mutex_lock_contended(mutex);
+    }
+
+    bool platform_mutex_try_lock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        u32 state = MUTEX_UNLOCKED;
+        return __atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    }
+
+    void platform_mutex_unlock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr && platform_atomic_load_u32(&mutex->state, PLATFORM_MEMORY_ORDER_RELAXED) != MUTEX_UNLOCKED, "Mutex must be locked.");
+
+        if(__atomic_exchange_n(&mutex->state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+        {
+            platform_address_wake(&mutex->state, 1);
+        }
+    }
+
+    void platform_condition_create(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+        condition->sequence = 0;
+    }
+
+    bool platform_condition_wait(platform_condition* condition, platform_mutex* mutex, u32 timeout_ms)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        // NOTE: Номер читается до освобождения мьютекса, поэтому сигнал после освобождения не теряется.
+        u32 sequence = __atomic_load_n(&condition->sequence, __ATOMIC_RELAXED);
+        platform_mutex_unlock(mutex);
+
+        bool signaled = platform_address_wait(&condition->sequence, sequence, timeout_ms);
+
+        // Другие потоки могут ожидать мьютекс, поэтому он захватывается сразу в состоянии с ожидающими.
+        mutex_lock_contended(mutex);
+        return signaled;
+    }
+
+    void platform_condition_signal(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+
+        __atomic_fetch_add(&condition->sequence, 1, __ATOMIC_RELEASE);
+        platform_address_wake(&condition->sequence, 1);
+    }
+
+    void platform_condition_broadcast(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+
+        __atomic_fetch_add(&condition->sequence, 1, __ATOMIC_RELEASE);
+        platform_address_wake(&condition->sequence, U32_MAX);
+    }
+
+    void platform_semaphore_create(platform_semaphore* semaphore, u32 count)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        semaphore->count = count;
+        semaphore->waiters = 0;
+    }
+
+    bool platform_semaphore_try_wait(platform_semaphore* semaphore)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        u32 count = __atomic_load_n(&semaphore->count, __ATOMIC_RELAXED);
+        while(count > 0)
+        {
+            if(__atomic_compare_exchange_n(&semaphore->count, &count, count - 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool platform_semaphore_wait(platform_semaphore* semaphore, u32 timeout_ms)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        if(platform_semaphore_try_wait(semaphore))
+        {
+            return true;
+        }
+
+        u64 deadline = thread_deadline(timeout_ms);
+        while(true)
+        {
+            u32 remaining = thread_remaining_ms(deadline);
+            if(remaining == 0)
+            {
+                return false;
+            }
+
+            // NOTE: Последовательная согласованность исключает ситуацию, когда post() не видит ожидающего,
+            //       а ожидающий не видит увеличенного счетчика.
+            __atomic_fetch_add(&semaphore->waiters, 1, __ATOMIC_SEQ_CST);
+            if(__atomic_load_n(&semaphore->count, __ATOMIC_SEQ_CST) == 0)
+            {
+                platform_address_wait(&semaphore->count, 0, remaining);
+            }
+            __atomic_fetch_sub(&semaphore->waiters, 1, __ATOMIC_RELAXED);
+
+            if(platform_semaphore_try_wait(semaphore))
+            {
+                return true;
+            }
+        }
+    }
+
+    void platform_semaphore_post(platform_semaphore* semaphore, u32 count)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+        ASSERT(count > 0, "Count must be greater than zero.");
+
+        __atomic_fetch_add(&semaphore->count, count, __ATOMIC_SEQ_CST);
+        if(__atomic_load_n(&semaphore->waiters, __ATOMIC_SEQ_CST) > 0)
+        {
+            platform_address_wake(&semaphore->count, count);
+        }
+    }
+
 #endif
@@ -2,8 +2,8 @@
     @file memory.h
     @brief Кросс-платформенный интерфейс для управления памятью.
     @author Дмитрий Скляр.
-    @version 1.0
-    @date 23-08-2025
+    @version 1.2
+    @date 16-10-2026
 
     @license Лицензия Apache, версия 2.0 («Лицензия»);
           Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
@@ -25,6 +25,9 @@
 
 #include <core/defines.h>
 
+// @brief Размер большой страницы памяти в байтах.
+#define PLATFORM_MEMORY_HUGE_PAGE_SIZE MEBIBYTES(2)
+
 /*
     @brief Инициализирует подсистему для работы с памятью.
     @note Должна быть вызвана один раз при старте приложения.
@@ -65,6 +68,83 @@ CORE_API void* platform_memory_allocate(u64 size);
 */
 CORE_API void platform_memory_free(void* block);
 
+/*
+    @brief Запрашивает у системы блок памяти заданного размера с указанным выравниванием.
+    @note Выделенная память не инициализирована (может содержать мусор).
+    @warning Освобождать только с помощью platform_memory_free_aligned()!
+    @param size Размер выделяемого блока памяти в байтах.
+    @param alignment Требуемое выравнивание начала блока (степень двойки).
+    @return Указатель на выровненный блок памяти или nullptr при ошибке.
+*/
+CORE_API void* platform_memory_allocate_aligned(u64 size, u16 alignment);
+
+/*
+    @brief Освобождает блок памяти, выделенный с помощью platform_memory_allocate_aligned().
+    @note Использование указателя после освобождения приведет к неопределенному поведению!
+    @param block Указатель на блок памяти для освобождения.
+*/
+CORE_API void platform_memory_free_aligned(void* block);
+
+/*
+    @brief Запрашивает у системы большой блок памяти, по возможности на больших страницах.
+    @note Размер округляется вверх до размера обычной страницы. Блок от PLATFORM_MEMORY_HUGE_PAGE_SIZE выровнен
+          по этой границе, и на больших страницах размещаются только целые большие страницы внутри блока
+          (Linux: рекомендация MADV_HUGEPAGE для них, Windows: размер блока кратен большой странице).
+    @note Если большие страницы недоступны, блок размещается на обычных страницах.
+    @warning Освобождать только с помощью platform_memory_free_large()!
+    @param size Размер выделяемого блока памяти в байтах.
+    @param out_huge_pages Указатель для записи признака рекомендации больших страниц (может быть nullptr).
+           В Linux ядро само решает, размещать ли рекомендованную память на больших страницах.
+    @return Указатель на блок памяти (заполнен нулями) или nullptr при ошибке.
+*/
+CORE_API void* platform_memory_allocate_large(u64 size, bool* out_huge_pages);
+
+/*
+    @brief Освобождает блок памяти, выделенный с помощью platform_memory_allocate_large().
+    @param block Указатель на блок памяти.
+    @param size Размер блока в байтах (тот же, что и при выделении).
+*/
+CORE_API void platform_memory_free_large(void* block, u64 size);
+
+/*
+    @brief Возвращает размер страницы виртуальной памяти системы.
+    @return Размер страницы в байтах.
+*/
+CORE_API u64 platform_memory_page_size();
+
+/*
+    @brief Резервирует диапазон виртуальных адресов без выделения физической памяти.
+    @note Доступ к зарезервированной памяти до вызова platform_memory_commit() приведет к ошибке доступа.
+    @warning Освобождать только с помощью platform_memory_release()!
+    @param size Размер диапазона в байтах (кратный размеру страницы).
+    @return Указатель на начало диапазона (выровнен по странице) или nullptr при ошибке.
+*/
+CORE_API void* platform_memory_reserve(u64 size);
+
+/*
+    @brief Делает доступными для чтения и записи страницы зарезервированного диапазона.
+    @note Физическая память выделяется системой при первом обращении к странице и заполнена нулями.
+    @param address Адрес начала участка (выровнен по странице).
+    @param size Размер участка в байтах (кратный размеру страницы).
+    @return true - участок доступен, false - произошла ошибка.
+*/
+CORE_API bool platform_memory_commit(void* address, u64 size);
+
+/*
+    @brief Возвращает системе физическую память страниц, оставляя диапазон зарезервированным.
+    @note Доступ к участку после вызова приведет к ошибке доступа.
+    @param address Адрес начала участка (выровнен по странице).
+    @param size Размер участка в байтах (кратный размеру страницы).
+*/
+CORE_API void platform_memory_decommit(void* address, u64 size);
+
+/*
+    @brief Освобождает диапазон, зарезервированный с помощью platform_memory_reserve().
+    @param address Адрес начала диапазона.
+    @param size Размер диапазона в байтах (тот же, что и при резервировании).
+*/
+CORE_API void platform_memory_release(void* address, u64 size);
+
 /*
     @brief Заполняет блок памяти нулевыми байтами.
     @warning Не thread-safe. Клиентский код должен обеспечить синхронизацию при использовании из нескольких потоков.
@@ -2,8 +2,8 @@
     @file thread.h
     @brief Кросс-платформенный интерфейс для работы с потоками.
     @author Дмитрий Скляр.
-    @version 1.0
-    @date 23-08-2025
+    @version 1.4
+    @date 16-10-2026
 
     @license Лицензия Apache, версия 2.0 («Лицензия»);
           Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
@@ -16,8 +16,16 @@
     @note Реализации функций являются платформозависимыми и находятся в соответствующих
           platform/ модулях (windows, linux и т.д.).
 
+    @note Атомарные операции и спин-блокировка реализованы встраиваемыми функциями на встроенных функциях
+          компилятора и не требуют инициализации подсистемы.
+
+    @note Мьютекс, условная переменная и семафор построены на ожидании по адресу (futex в Linux,
+          WaitOnAddress в Windows): занимают 4-8 байт, не требуют уничтожения, нулевое значение является
+          начальным состоянием, а захват и освобождение без конкуренции не обращаются к ядру.
+
     @note Для корректной работы необходимо предварительно инициализировать (в указанном порядке):
             - Подсистему консоли platform_console_initialize()
+            - Подсистему памяти platform_memory_initialize()
             - Подсистему потоков platform_thread_initialize()
 */
 
@@ -25,6 +33,92 @@
 
 #include <core/defines.h>
 
+#if !defined(COMPILER_CLANG_FLAG) && !defined(COMPILER_GCC_FLAG)
+    #error "Atomic operations are implemented only for Clang and GCC compilers."
+#endif
+
+// @brief Размер линии кэша процессора в байтах (для разнесения данных разных потоков).
+#define PLATFORM_CACHE_LINE_SIZE 64
+
+// @brief Выравнивает поле или переменную по линии кэша, исключая ложное разделение (false sharing).
+#define PLATFORM_CACHE_ALIGNED __attribute__((aligned(PLATFORM_CACHE_LINE_SIZE)))
+
+// @brief Порядок доступа к памяти для атомарных операций (соответствует memory_order из C11).
+typedef enum platform_memory_order {
+    // @brief Только атомарность операции, без упорядочивания.
+    PLATFORM_MEMORY_ORDER_RELAXED = __ATOMIC_RELAXED,
+    // @brief Последующие операции не переносятся до данной (для загрузки).
+    PLATFORM_MEMORY_ORDER_ACQUIRE = __ATOMIC_ACQUIRE,
+    // @brief Предыдущие операции не переносятся после данной (для сохранения).
+    PLATFORM_MEMORY_ORDER_RELEASE = __ATOMIC_RELEASE,
+    // @brief Сочетание ACQUIRE и RELEASE (для операций чтения-модификации-записи).
+    PLATFORM_MEMORY_ORDER_ACQ_REL = __ATOMIC_ACQ_REL,
+    // @brief Последовательная согласованность.
+    PLATFORM_MEMORY_ORDER_SEQ_CST = __ATOMIC_SEQ_CST,
+} platform_memory_order;
+
+// @brief Спин-блокировка для коротких критических секций.
+typedef struct platform_spinlock {
+    // @brief Состояние блокировки (0 - свободна, 1 - захвачена).
+    u32 locked;
+} platform_spinlock;
+
+// @brief Объявляет переменную, у каждого потока которой собственная копия (thread-local storage).
+#define PLATFORM_THREAD_LOCAL _Thread_local
+
+// @brief Максимальная длина имени потока (без учета завершающего нуль-символа, ограничение Linux).
+#define PLATFORM_THREAD_NAME_MAX 15
+
+// @brief Бесконечное время ожидания.
+#define PLATFORM_WAIT_INFINITE U32_MAX
+
+/*
+    @brief Функция-исполнитель потока.
+    @param data Данные, переданные при создании потока.
+    @return Код завершения потока.
+*/
+typedef u32 (*platform_thread_start_fn)(void* data);
+
+// @brief Дескриптор потока.
+typedef struct platform_thread {
+    // @brief Платформенный дескриптор потока (pthread_t или HANDLE, 0 - поток не создан).
+    u64 handle;
+} platform_thread;
+
+// @brief Мьютекс (не рекурсивный).
+typedef struct platform_mutex {
+    // @brief Состояние (0 - свободен, 1 - захвачен, 2 - захвачен и есть ожидающие потоки).
+    u32 state;
+} platform_mutex;
+
+// @brief Условная переменная.
+typedef struct platform_condition {
+    // @brief Номер последовательности, увеличивается при каждом сигнале.
+    u32 sequence;
+} platform_condition;
+
+// @brief Семафор со счетчиком.
+typedef struct platform_semaphore {
+    // @brief Текущее значение счетчика.
+    u32 count;
+    // @brief Количество ожидающих потоков.
+    u32 waiters;
+} platform_semaphore;
+
+// @brief Приоритет потока.
+typedef enum platform_thread_priority {
+    // @brief Самый низкий приоритет (фоновые задачи).
+    PLATFORM_THREAD_PRIORITY_LOWEST,
+    // @brief Пониженный приоритет.
+    PLATFORM_THREAD_PRIORITY_LOW,
+    // @brief Обычный приоритет.
+    PLATFORM_THREAD_PRIORITY_NORMAL,
+    // @brief Повышенный приоритет.
+    PLATFORM_THREAD_PRIORITY_HIGH,
+    // @brief Самый высокий приоритет (без перехода в режим реального времени).
+    PLATFORM_THREAD_PRIORITY_HIGHEST
+} platform_thread_priority;
+
 /*
     @brief Инициализирует подсистему для работы с потоками.
     @note Должна быть вызвана один раз при старте приложения.
@@ -59,15 +153,517 @@ CORE_API bool platform_thread_sleep(u32 time_ms);
 
 /*
     @brief Создает новый поток выполнения.
+    @note Имя потока отображается в отладчике и профилировщике, длинные имена усекаются до PLATFORM_THREAD_NAME_MAX.
     @param func Функция-исполнитель потока.
     @param data Данные для передачи в функцию-исполнитель.
-    @return Идентификатор созданного потока или 0 при ошибке.
+    @param name Имя потока (может быть nullptr).
+    @param out_thread Указатель на дескриптор для записи созданного потока.
+    @return true - поток создан, false - произошла ошибка.
+*/
+CORE_API bool platform_thread_create(platform_thread_start_fn func, void* data, const char* name, platform_thread* out_thread);
+
+/*
+    @brief Ожидает завершения указанного потока и освобождает его дескриптор.
+    @param thread Указатель на дескриптор потока.
+    @param out_result Указатель для записи кода завершения потока (может быть nullptr).
+    @return true - поток завершен, false - произошла ошибка.
+*/
+CORE_API bool platform_thread_join(platform_thread* thread, u32* out_result);
+
+/*
+    @brief Отсоединяет поток: ресурсы потока освобождаются автоматически после его завершения.
+    @note После вызова дескриптор недействителен, ожидание потока невозможно.
+    @param thread Указатель на дескриптор потока.
+*/
+CORE_API void platform_thread_detach(platform_thread* thread);
+
+/*
+    @brief Устанавливает имя текущего потока.
+    @param name Имя потока (усекается до PLATFORM_THREAD_NAME_MAX).
+*/
+CORE_API void platform_thread_set_name(const char* name);
+
+/*
+    @brief Возвращает идентификатор текущего потока в операционной системе.
+    @note Значение кешируется в thread-local переменной, повторные вызовы не обращаются к ядру.
+    @return Идентификатор потока.
+*/
+CORE_API u64 platform_thread_current_id();
+
+/*
+    @brief Уступает остаток кванта времени текущего потока другим потокам.
+*/
+CORE_API void platform_thread_yield();
+
+/*
+    @brief Возвращает количество логических процессоров, доступных процессу.
+    @note Учитывается маска привязки процесса к процессорам (например, ограничения контейнера).
+    @return Количество логических процессоров (не меньше 1).
+*/
+CORE_API u32 platform_processor_count();
+
+/*
+    @brief Привязывает текущий поток к указанным логическим процессорам.
+    @note Номера процессоров соответствуют platform_cpu_logical.id (см. platform/cpu.h).
+    @note Windows: процессоры должны принадлежать одной группе процессоров (первого процессора в списке),
+          процессоры других групп игнорируются.
+    @param cpus Указатель на массив номеров логических процессоров (может быть nullptr при count равном 0).
+    @param count Количество процессоров (0 - снять привязку: поток выполняется на любом процессоре процесса).
+    @return true - привязка установлена, false - произошла ошибка.
+*/
+CORE_API bool platform_thread_set_affinity(const u16* cpus, u32 count);
+
+/*
+    @brief Устанавливает приоритет текущего потока.
+    @note Linux: приоритет задается значением nice потока; повышение выше обычного требует прав
+          (CAP_SYS_NICE или RLIMIT_NICE), без них функция возвращает false.
+    @param priority Приоритет потока.
+    @return true - приоритет установлен, false - произошла ошибка или недостаточно прав.
+*/
+CORE_API bool platform_thread_set_priority(platform_thread_priority priority);
+
+/*
+    @brief Блокирует поток, пока значение по адресу равно ожидаемому.
+    @note Возможны ложные пробуждения, поэтому условие необходимо проверять повторно.
+    @param address Указатель на значение (выровненный по 4 байтам).
+    @param expected Ожидаемое значение.
+    @param timeout_ms Максимальное время ожидания в миллисекундах (PLATFORM_WAIT_INFINITE - без ограничения).
+    @return true - поток пробужден или значение уже изменено, false - истекло время ожидания.
+*/
+CORE_API bool platform_address_wait(u32* address, u32 expected, u32 timeout_ms);
+
+/*
+    @brief Пробуждает потоки, ожидающие по адресу.
+    @param address Указатель на значение.
+    @param count Количество пробуждаемых потоков (U32_MAX - все потоки).
+*/
+CORE_API void platform_address_wake(u32* address, u32 count);
+
+/*
+    @brief Инициализирует мьютекс (эквивалентно обнулению).
+    @param mutex Указатель на мьютекс.
+*/
+CORE_API void platform_mutex_create(platform_mutex* mutex);
+
+/*
+    @brief Захватывает мьютекс, при необходимости ожидая его освобождения.
+    @note Перед переходом в ожидание поток некоторое время проверяет мьютекс активным циклом.
+    @param mutex Указатель на мьютекс.
+*/
+CORE_API void platform_mutex_lock(platform_mutex* mutex);
+
+/*
+    @brief Пытается захватить мьютекс без ожидания.
+    @param mutex Указатель на мьютекс.
+    @return true - мьютекс захвачен, false - мьютекс занят другим потоком.
+*/
+CORE_API bool platform_mutex_try_lock(platform_mutex* mutex);
+
+/*
+    @brief Освобождает мьютекс.
+    @param mutex Указатель на мьютекс, захваченный текущим потоком.
+*/
+CORE_API void platform_mutex_unlock(platform_mutex* mutex);
+
+/*
+    @brief Инициализирует условную переменную (эквивалентно обнулению).
+    @param condition Указатель на условную переменную.
+*/
+CORE_API void platform_condition_create(platform_condition* condition);
+
+/*
+    @brief Освобождает мьютекс и ожидает сигнала условной переменной, затем снова захватывает мьютекс.
+    @note Возможны ложные пробуждения, поэтому условие необходимо проверять в цикле.
+    @param condition Указатель на условную переменную.
+    @param mutex Указатель на мьютекс, захваченный текущим потоком.
+    @param timeout_ms Максимальное время ожидания в миллисекундах (PLATFORM_WAIT_INFINITE - без ограничения).
+    @return true - получен сигнал (или ложное пробуждение), false - истекло время ожидания.
+*/
+CORE_API bool platform_condition_wait(platform_condition* condition, platform_mutex* mutex, u32 timeout_ms);
+
+/*
+    @brief Пробуждает один поток, ожидающий условную переменную.
+    @param condition Указатель на условную переменную.
+*/
+CORE_API void platform_condition_signal(platform_condition* condition);
+
+/*
+    @brief Пробуждает все потоки, ожидающие условную переменную.
+    @param condition Указатель на условную переменную.
+*/
+CORE_API void platform_condition_broadcast(platform_condition* condition);
+
+/*
+    @brief Инициализирует семафор.
+    @param semaphore Указатель на семафор.
+    @param count Начальное значение счетчика.
+*/
+CORE_API void platform_semaphore_create(platform_semaphore* semaphore, u32 count);
+
+/*
+    @brief Уменьшает счетчик семафора, ожидая, пока он станет больше нуля.
+    @param semaphore Указатель на семафор.
+    @param timeout_ms Максимальное время ожидания в миллисекундах (PLATFORM_WAIT_INFINITE - без ограничения).
+    @return true - счетчик уменьшен, false - истекло время ожидания.
+*/
+CORE_API bool platform_semaphore_wait(platform_semaphore* semaphore, u32 timeout_ms);
+
+/*
+    @brief Уменьшает счетчик семафора, если он больше нуля, без ожидания.
+    @param semaphore Указатель на семафор.
+    @return true - счетчик уменьшен, false - счетчик равен нулю.
+*/
+CORE_API bool platform_semaphore_try_wait(platform_semaphore* semaphore);
+
+/*
+    @brief Увеличивает счетчик семафора и пробуждает ожидающие потоки.
+    @param semaphore Указатель на семафор.
+    @param count Величина увеличения счетчика.
+*/
+CORE_API void platform_semaphore_post(platform_semaphore* semaphore, u32 count);
+
+/*
+    @brief Атомарно загружает значение.
+    @param ptr Указатель на значение.
+    @param order Порядок доступа к памяти.
+    @return Загруженное значение.
+*/
+INLINE u32 platform_atomic_load_u32(const u32* ptr, platform_memory_order order)
+{
+    return __atomic_load_n(ptr, (int)order);
+}
+
+/*
+    @brief Атомарно загружает значение.
+    @param ptr Указатель на значение.
+    @param order Порядок доступа к памяти.
+    @return Загруженное значение.
+*/
+INLINE u64 platform_atomic_load_u64(const u64* ptr, platform_memory_order order)
+{
+    return __atomic_load_n(ptr, (int)order);
+}
+
+/*
+    @brief Атомарно сохраняет значение.
+    @param ptr Указатель на значение.
+    @param value Новое значение.
+    @param order Порядок доступа к памяти.
+*/
+INLINE void platform_atomic_store_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    __atomic_store_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно сохраняет значение.
+    @param ptr Указатель на значение.
+    @param value Новое значение.
+    @param order Порядок доступа к памяти.
+*/
+INLINE void platform_atomic_store_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    __atomic_store_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно прибавляет значение.
+    @param ptr Указатель на значение.
+    @param value Прибавляемое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u32 platform_atomic_fetch_add_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    return __atomic_fetch_add(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно прибавляет значение.
+    @param ptr Указатель на значение.
+    @param value Прибавляемое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u64 platform_atomic_fetch_add_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    return __atomic_fetch_add(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно вычитает значение.
+    @param ptr Указатель на значение.
+    @param value Вычитаемое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u32 platform_atomic_fetch_sub_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    return __atomic_fetch_sub(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно вычитает значение.
+    @param ptr Указатель на значение.
+    @param value Вычитаемое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u64 platform_atomic_fetch_sub_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    return __atomic_fetch_sub(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно заменяет значение.
+    @param ptr Указатель на значение.
+    @param value Новое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u32 platform_atomic_exchange_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    return __atomic_exchange_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно заменяет значение.
+    @param ptr Указатель на значение.
+    @param value Новое значение.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u64 platform_atomic_exchange_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    return __atomic_exchange_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно заменяет значение, если текущее равно ожидаемому.
+    @note При неудаче в expected записывается текущее значение.
+    @param ptr Указатель на значение.
+    @param expected Указатель на ожидаемое значение.
+    @param desired Новое значение.
+    @param order Порядок доступа к памяти при успехе (при неудаче - RELAXED).
+    @return true - значение заменено, false - текущее значение не равно ожидаемому.
+*/
+INLINE bool platform_atomic_compare_exchange_u32(u32* ptr, u32* expected, u32 desired, platform_memory_order order)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+}
+
+/*
+    @brief Атомарно заменяет значение, если текущее равно ожидаемому.
+    @note При неудаче в expected записывается текущее значение.
+    @param ptr Указатель на значение.
+    @param expected Указатель на ожидаемое значение.
+    @param desired Новое значение.
+    @param order Порядок доступа к памяти при успехе (при неудаче - RELAXED).
+    @return true - значение заменено, false - текущее значение не равно ожидаемому.
+*/
+INLINE bool platform_atomic_compare_exchange_u64(u64* ptr, u64* expected, u64 desired, platform_memory_order order)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+}
+
+/*
+    @brief Атомарно заменяет значение, если текущее равно ожидаемому (допускает ложные неудачи).
+    @note Предназначена для циклов повторных попыток, где ложная неудача только повторяет итерацию.
+    @note При неудаче в expected записывается текущее значение.
+    @param ptr Указатель на значение.
+    @param expected Указатель на ожидаемое значение.
+    @param desired Новое значение.
+    @param order Порядок доступа к памяти при успехе (при неудаче - RELAXED).
+    @return true - значение заменено, false - текущее значение не равно ожидаемому или ложная неудача.
+*/
+INLINE bool platform_atomic_compare_exchange_weak_u32(u32* ptr, u32* expected, u32 desired, platform_memory_order order)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, true, (int)order, __ATOMIC_RELAXED);
+}
+
+/*
+    @brief Атомарно заменяет значение, если текущее равно ожидаемому (допускает ложные неудачи).
+    @note Предназначена для циклов повторных попыток, где ложная неудача только повторяет итерацию.
+    @note При неудаче в expected записывается текущее значение.
+    @param ptr Указатель на значение.
+    @param expected Указатель на ожидаемое значение.
+    @param desired Новое значение.
+    @param order Порядок доступа к памяти при успехе (при неудаче - RELAXED).
+    @return true - значение заменено, false - текущее значение не равно ожидаемому или ложная неудача.
+*/
+INLINE bool platform_atomic_compare_exchange_weak_u64(u64* ptr, u64* expected, u64 desired, platform_memory_order order)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, true, (int)order, __ATOMIC_RELAXED);
+}
+
+/*
+    @brief Атомарно выполняет побитовое ИЛИ.
+    @param ptr Указатель на значение.
+    @param value Маска.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u32 platform_atomic_fetch_or_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    return __atomic_fetch_or(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно выполняет побитовое ИЛИ.
+    @param ptr Указатель на значение.
+    @param value Маска.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u64 platform_atomic_fetch_or_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    return __atomic_fetch_or(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно выполняет побитовое И.
+    @param ptr Указатель на значение.
+    @param value Маска.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u32 platform_atomic_fetch_and_u32(u32* ptr, u32 value, platform_memory_order order)
+{
+    return __atomic_fetch_and(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно выполняет побитовое И.
+    @param ptr Указатель на значение.
+    @param value Маска.
+    @param order Порядок доступа к памяти.
+    @return Значение до изменения.
+*/
+INLINE u64 platform_atomic_fetch_and_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    return __atomic_fetch_and(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно загружает указатель.
+    @param ptr Указатель на переменную-указатель.
+    @param order Порядок доступа к памяти.
+    @return Загруженный указатель.
+*/
+INLINE void* platform_atomic_load_ptr(void* const* ptr, platform_memory_order order)
+{
+    return __atomic_load_n(ptr, (int)order);
+}
+
+/*
+    @brief Атомарно сохраняет указатель.
+    @param ptr Указатель на переменную-указатель.
+    @param value Новый указатель.
+    @param order Порядок доступа к памяти.
+*/
+INLINE void platform_atomic_store_ptr(void** ptr, void* value, platform_memory_order order)
+{
+    __atomic_store_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно заменяет указатель.
+    @param ptr Указатель на переменную-указатель.
+    @param value Новый указатель.
+    @param order Порядок доступа к памяти.
+    @return Указатель до изменения.
+*/
+INLINE void* platform_atomic_exchange_ptr(void** ptr, void* value, platform_memory_order order)
+{
+    return __atomic_exchange_n(ptr, value, (int)order);
+}
+
+/*
+    @brief Атомарно заменяет указатель, если текущий равен ожидаемому.
+    @note При неудаче в expected записывается текущий указатель.
+    @param ptr Указатель на переменную-указатель.
+    @param expected Указатель на ожидаемый указатель.
+    @param desired Новый указатель.
+    @param order Порядок доступа к памяти при успехе (при неудаче - RELAXED).
+    @return true - указатель заменен, false - текущий указатель не равен ожидаемому.
+*/
+INLINE bool platform_atomic_compare_exchange_ptr(void** ptr, void** expected, void* desired, platform_memory_order order)
+{
+    return __atomic_compare_exchange_n(ptr, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+}
+
+/*
+    @brief Барьер памяти: упорядочивает окружающие операции с памятью без атомарной операции.
+    @param order Порядок доступа к памяти.
+*/
+INLINE void platform_atomic_thread_fence(platform_memory_order order)
+{
+    __atomic_thread_fence((int)order);
+}
+
+/*
+    @brief Атомарно увеличивает значение до указанного, если текущее меньше.
+    @param ptr Указатель на значение.
+    @param value Значение-кандидат.
+    @param order Порядок доступа к памяти.
+*/
+INLINE void platform_atomic_max_u64(u64* ptr, u64 value, platform_memory_order order)
+{
+    u64 current = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    while(current < value)
+    {
+        // При неудаче current обновляется текущим значением и условие проверяется повторно.
+        if(__atomic_compare_exchange_n(ptr, &current, value, true, (int)order, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+}
+
+/*
+    @brief Подсказывает процессору, что поток находится в цикле активного ожидания.
+*/
+INLINE void platform_cpu_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*
+    @brief Захватывает спин-блокировку, ожидая ее освобождения активным циклом.
+    @note Не рекурсивная. Предназначена только для коротких критических секций.
+    @param lock Указатель на спин-блокировку.
+*/
+INLINE void platform_spinlock_lock(platform_spinlock* lock)
+{
+    while(__atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE))
+    {
+        // Ожидание чтением, чтобы не занимать линию кэша попытками записи.
+        while(__atomic_load_n(&lock->locked, __ATOMIC_RELAXED))
+        {
+            platform_cpu_pause();
+        }
+    }
+}
+
+/*
+    @brief Пытается захватить спин-блокировку без ожидания.
+    @param lock Указатель на спин-блокировку.
+    @return true - блокировка захвачена, false - блокировка занята другим потоком.
 */
-// CORE_API thread_id platform_thread_create(thread_func func, void* data);
+INLINE bool platform_spinlock_try_lock(platform_spinlock* lock)
+{
+    return __atomic_load_n(&lock->locked, __ATOMIC_RELAXED) == 0 && __atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE) == 0;
+}
 
 /*
-    @brief Ожидает завершения указанного потока.
-    @param thread_id Идентификатор потока для ожидания.
-    @return Код возврата потока или -1 при ошибке.
+    @brief Освобождает спин-блокировку.
+    @param lock Указатель на спин-блокировку.
 */
-// CORE_API i32 platform_thread_join(thread_id thread_id);
+INLINE void platform_spinlock_unlock(platform_spinlock* lock)
+{
+    __atomic_store_n(&lock->locked, 0, __ATOMIC_RELEASE);
+}
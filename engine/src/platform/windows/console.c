@@ -110,6 +110,24 @@
         fprintf((stream == CONSOLE_STREAM_STDOUT ? stdout : stderr), "\033[%sm%s\033[0m", colors[color], message);
     }
 
+    void platform_console_write_raw(console_stream_t stream, const char* message, u64 length)
+    {
+        if(!initialized) return;
+
+        ASSERT(stream < CONSOLE_STREAM_COUNT, "Must be less than CONSOLE_STREAM_COUNT");
+        ASSERT(message != nullptr || length == 0, "Message pointer must be non-null.");
+
+        // NOTE: Один вызов fwrite выполняется под блокировкой потока целиком.
+        fwrite(message, 1, length, (stream == CONSOLE_STREAM_STDOUT ? stdout : stderr));
+    }
+
+    const char* platform_console_color_code(console_color_t color)
+    {
+        ASSERT(color < CONSOLE_COLOR_COUNT, "Must be less than CONSOLE_COLOR_COUNT");
+
+        return colors[color];
+    }
+
     void platform_console_writef(console_stream_t stream, console_color_t color, const char* format, ...)
     {
         if(!initialized) return;
@@ -0,0 +1,215 @@
+#include "platform/cpu.h"
+
+#ifdef PLATFORM_WINDOWS_FLAG
+
+    #include "debug/assert.h"
+    #include "platform/memory.h"
+    #include <Windows.h>
+
+    // Находит описание логического процессора по системному номеру.
+    static platform_cpu_logical* cpu_find_logical(platform_cpu_info_t* info, u32 id)
+    {
+        for(u32 i = 0; i < info->logical_count; ++i)
+        {
+            if(info->logical[i].id == id)
+            {
+                return &info->logical[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Добавляет ядро и его логические процессоры, доступные текущему потоку.
+    static void cpu_add_core(platform_cpu_info_t* info, const PROCESSOR_RELATIONSHIP* core, const GROUP_AFFINITY* thread_affinity)
+    {
+        u8 smt_index = 0;
+        bool added = false;
+
+        for(WORD g = 0; g < core->GroupCount; ++g)
+        {
+            const GROUP_AFFINITY* group = &core->GroupMask[g];
+            for(u32 bit = 0; bit < 64; ++bit)
+            {
+                if(!(group->Mask & ((KAFFINITY)1 << bit)))
+                {
+                    continue;
+                }
+
+                // NOTE: Номер составлен из номера группы и номера в группе (как в platform_thread_set_affinity()).
+                bool allowed = group->Group != thread_affinity->Group || (thread_affinity->Mask & ((KAFFINITY)1 << bit));
+                u32 id = group->Group * 64 + bit;
+
+                if(allowed && info->logical_count < PLATFORM_CPU_MAX_LOGICAL)
+                {
+                    platform_cpu_logical* logical = &info->logical[info->logical_count++];
+                    logical->id = (u16)id;
+                    logical->core = (u16)info->physical_count;
+                    logical->smt_index = smt_index++;
+                    // Временно хранит класс эффективности ядра (преобразуется в тип после обхода всех ядер).
+                    logical->core_type = core->EfficiencyClass;
+                    added = true;
+                }
+            }
+        }
+
+        info->physical_count += added ? 1 : 0;
+    }
+
+    // Назначает узел NUMA или сокет логическим процессорам из маски группы.
+    static bool cpu_assign_group(platform_cpu_info_t* info, const GROUP_AFFINITY* group, u16 value, bool numa)
+    {
+        bool used = false;
+        for(u32 bit = 0; bit < 64; ++bit)
+        {
+            platform_cpu_logical* logical = (group->Mask & ((KAFFINITY)1 << bit)) ? cpu_find_logical(info, group->Group * 64 + bit) : nullptr;
+            if(logical)
+            {
+                if(numa)
+                {
+                    logical->numa_node = value;
+                }
+                else
+                {
+                    logical->package = value;
+                }
+                used = true;
+            }
+        }
+        return used;
+    }
+
+    bool platform_cpu_info(platform_cpu_info_t* out_info)
+    {
+        ASSERT(out_info != nullptr, "Info pointer must be non-null.");
+
+        platform_memory_zero(out_info, sizeof(platform_cpu_info_t));
+
+        DWORD length = 0;
+        GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+        if(GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+        {
+            return false;
+        }
+
+        u8* buffer = platform_memory_allocate(length);
+        if(!buffer)
+        {
+            return false;
+        }
+
+        if(!GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer, &length))
+        {
+            platform_memory_free(buffer);
+            return false;
+        }
+
+        GROUP_AFFINITY thread_affinity;
+        if(!GetThreadGroupAffinity(GetCurrentThread(), &thread_affinity))
+        {
+            thread_affinity.Group = 0;
+            thread_affinity.Mask = ~(KAFFINITY)0;
+        }
+
+        // Первый проход: ядра и кэши (сокеты и узлы NUMA назначаются уже известным логическим процессорам).
+        for(DWORD offset = 0; offset < length;)
+        {
+            PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX entry = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer + offset);
+            offset += entry->Size;
+
+            if(entry->Relationship == RelationProcessorCore)
+            {
+                cpu_add_core(out_info, &entry->Processor, &thread_affinity);
+            }
+            else if(entry->Relationship == RelationCache && entry->Cache.Type != CacheInstruction)
+            {
+                u64 size = entry->Cache.CacheSize;
+                switch(entry->Cache.Level)
+                {
+                    case 1: out_info->l1_data_cache_size = MAX(out_info->l1_data_cache_size, size); break;
+                    case 2: out_info->l2_cache_size = MAX(out_info->l2_cache_size, size); break;
+                    case 3: out_info->l3_cache_size = MAX(out_info->l3_cache_size, size); break;
+                    default: break;
+                }
+
+                if(out_info->cache_line_size == 0)
+                {
+                    out_info->cache_line_size = entry->Cache.LineSize;
+                }
+            }
+        }
+
+        for(DWORD offset = 0; offset < length;)
+        {
+            PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX entry = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer + offset);
+            offset += entry->Size;
+
+            if(entry->Relationship == RelationProcessorPackage)
+            {
+                bool used = false;
+                for(WORD g = 0; g < entry->Processor.GroupCount; ++g)
+                {
+                    used |= cpu_assign_group(out_info, &entry->Processor.GroupMask[g], (u16)out_info->package_count, false);
+                }
+                out_info->package_count += used ? 1 : 0;
+            }
+            else if(entry->Relationship == RelationNumaNode)
+            {
+                bool used = cpu_assign_group(out_info, &entry->NumaNode.GroupMask, (u16)entry->NumaNode.NodeNumber, true);
+                out_info->numa_node_count += used ? 1 : 0;
+            }
+        }
+
+        platform_memory_free(buffer);
+
+        out_info->package_count = MAX(out_info->package_count, 1U);
+        out_info->numa_node_count = MAX(out_info->numa_node_count, 1U);
+
+        // Класс эффективности больше у более производительных ядер; одинаковый класс - процессор не гибридный.
+        u8 min_class = U8_MAX;
+        u8 max_class = 0;
+        for(u32 i = 0; i < out_info->logical_count; ++i)
+        {
+            min_class = MIN(min_class, out_info->logical[i].core_type);
+            max_class = MAX(max_class, out_info->logical[i].core_type);
+        }
+
+        for(u32 i = 0; i < out_info->logical_count; ++i)
+        {
+            platform_cpu_logical* logical = &out_info->logical[i];
+            if(min_class == max_class)
+            {
+                logical->core_type = PLATFORM_CPU_CORE_TYPE_UNKNOWN;
+                continue;
+            }
+
+            logical->core_type = logical->core_type == max_class ? PLATFORM_CPU_CORE_TYPE_PERFORMANCE : PLATFORM_CPU_CORE_TYPE_EFFICIENCY;
+            if(logical->smt_index == 0)
+            {
+                if(logical->core_type == PLATFORM_CPU_CORE_TYPE_PERFORMANCE)
+                {
+                    out_info->performance_core_count++;
+                }
+                else
+                {
+                    out_info->efficiency_core_count++;
+                }
+            }
+        }
+
+        // Ядра перечисляются системой по порядку, но порядок номеров логических процессоров не гарантирован.
+        for(u32 i = 1; i < out_info->logical_count; ++i)
+        {
+            platform_cpu_logical value = out_info->logical[i];
+            u32 j = i;
+            while(j > 0 && out_info->logical[j - 1].id > value.id)
+            {
+                out_info->logical[j] = out_info->logical[j - 1];
+                --j;
+            }
+            out_info->logical[j] = value;
+        }
+
+        return out_info->logical_count > 0;
+    }
+
+#endif
@@ -0,0 +1,112 @@
+#include "platform/fiber.h"
+
+#ifdef PLATFORM_WINDOWS_FLAG
+
+    #include "debug/assert.h"
+    #include "core/logger.h"
+    #include "platform/memory.h"
+    #include <Windows.h>
+
+    struct platform_fiber {
+        // Дескриптор системного волокна.
+        LPVOID handle;
+        // Признак волокна потока (создано ConvertThreadToFiber).
+        bool thread;
+        // Функция-исполнитель волокна.
+        platform_fiber_start_fn func;
+        // Данные функции-исполнителя.
+        void* data;
+    };
+
+    // Вызывает исполнитель волокна (первая функция на стеке нового волокна).
+    static VOID CALLBACK fiber_start(LPVOID parameter)
+    {
+        platform_fiber* fiber = parameter;
+        fiber->func(fiber->data);
+
+        LOG_FATAL("Fiber function must not return.");
+        __builtin_trap();
+    }
+
+    platform_fiber* platform_fiber_create(platform_fiber_start_fn func, void* data, u64 stack_size)
+    {
+        ASSERT(func != nullptr, "Fiber function must be non-null.");
+
+        u64 page_size = platform_memory_page_size();
+        if(stack_size == 0)
+        {
+            stack_size = PLATFORM_FIBER_DEFAULT_STACK_SIZE;
+        }
+        stack_size = (stack_size + page_size - 1) & ~(page_size - 1);
+
+        platform_fiber* fiber = platform_memory_allocate(sizeof(platform_fiber));
+        if(!fiber)
+        {
+            return nullptr;
+        }
+
+        fiber->thread = false;
+        fiber->func = func;
+        fiber->data = data;
+
+        // NOTE: Стек резервируется и увеличивается системой, защитная страница под стеком создается автоматически.
+        fiber->handle = CreateFiberEx(0, (SIZE_T)stack_size, 0, fiber_start, fiber);
+        if(!fiber->handle)
+        {
+            platform_memory_free(fiber);
+            return nullptr;
+        }
+
+        return fiber;
+    }
+
+    void platform_fiber_destroy(platform_fiber* fiber)
+    {
+        ASSERT(fiber != nullptr, "Fiber pointer must be non-null.");
+        ASSERT(fiber->thread == false, "Thread fiber must be released with platform_fiber_convert_fiber().");
+
+        DeleteFiber(fiber->handle);
+        platform_memory_free(fiber);
+    }
+
+    platform_fiber* platform_fiber_convert_thread()
+    {
+        platform_fiber* fiber = platform_memory_allocate(sizeof(platform_fiber));
+        if(!fiber)
+        {
+            return nullptr;
+        }
+
+        fiber->thread = true;
+        fiber->func = nullptr;
+        fiber->data = nullptr;
+
+        fiber->handle = ConvertThreadToFiber(fiber);
+        if(!fiber->handle)
+        {
+            platform_memory_free(fiber);
+            return nullptr;
+        }
+
+        return fiber;
+    }
+
+    void platform_fiber_convert_fiber(platform_fiber* fiber)
+    {
+        ASSERT(fiber != nullptr, "Fiber pointer must be non-null.");
+        ASSERT(fiber->thread == true, "Fiber with own stack must be released with platform_fiber_destroy().");
+
+        ConvertFiberToThread();
+        platform_memory_free(fiber);
+    }
+
+    void platform_fiber_switch(platform_fiber* from, platform_fiber* to)
+    {
+        ASSERT(from != nullptr && to != nullptr, "Fiber pointers must be non-null.");
+        ASSERT(from != to, "Fiber cannot switch to itself.");
+        UNUSED(from);
+
+        SwitchToFiber(to->handle);
+    }
+
+#endif
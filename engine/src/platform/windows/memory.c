@@ -6,9 +6,12 @@
     #include "core/logger.h"
     #include <windows.h>
     #include <heapapi.h>
+    #include <malloc.h>
     #include <string.h>
 
     static HANDLE process_heap = nullptr;
+    static u64 page_size = 0;
+    static u64 large_page_size = 0;
     static bool initialized = false;
 
     bool platform_memory_initialize()
@@ -22,6 +25,15 @@
             return false;
         }
 
+        // NOTE: Резервирование выполняется с гранулярностью dwAllocationGranularity, но фиксация - страницами.
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        page_size = (u64)info.dwPageSize;
+
+        // NOTE: Большие страницы требуют привилегии SeLockMemoryPrivilege, без нее выделение завершится
+        //       ошибкой и блок будет размещен на обычных страницах.
+        large_page_size = (u64)GetLargePageMinimum();
+
         initialized = true;
         return true;
     }
@@ -53,6 +65,106 @@
         HeapFree(process_heap, 0, block);
     }
 
+    void* platform_memory_allocate_aligned(u64 size, u16 alignment)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+        ASSERT(IS_POWER_OF_TWO(alignment), "Alignment must be a power of two.");
+
+        return _aligned_malloc((size_t)size, (size_t)alignment);
+    }
+
+    void platform_memory_free_aligned(void* block)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(block != nullptr, "Block pointer must be non-null.");
+
+        _aligned_free(block);
+    }
+
+    void* platform_memory_allocate_large(u64 size, bool* out_huge_pages)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+
+        u64 mapped_size = (size + page_size - 1) & ~(page_size - 1);
+
+        // NOTE: Блок на больших страницах занимает их целиком, поэтому они используются только для размеров,
+        //       кратных большой странице, чтобы округление не увеличивало занимаемую физическую память.
+        void* block = nullptr;
+        if(large_page_size > 0 && mapped_size % large_page_size == 0)
+        {
+            block = VirtualAlloc(nullptr, (SIZE_T)mapped_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+
+        bool huge_pages = block != nullptr;
+        if(!block)
+        {
+            block = VirtualAlloc(nullptr, (SIZE_T)mapped_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        }
+
+        if(out_huge_pages)
+        {
+            *out_huge_pages = huge_pages;
+        }
+
+        return block;
+    }
+
+    void platform_memory_free_large(void* block, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(block != nullptr, "Block pointer must be non-null.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+        UNUSED(size);
+
+        VirtualFree(block, 0, MEM_RELEASE);
+    }
+
+    u64 platform_memory_page_size()
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+
+        return page_size;
+    }
+
+    void* platform_memory_reserve(u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        return VirtualAlloc(nullptr, (SIZE_T)size, MEM_RESERVE, PAGE_NOACCESS);
+    }
+
+    bool platform_memory_commit(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr && (usize)address % page_size == 0, "Address must be non-null and page aligned.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        return VirtualAlloc(address, (SIZE_T)size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    void platform_memory_decommit(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr && (usize)address % page_size == 0, "Address must be non-null and page aligned.");
+        ASSERT(size > 0 && size % page_size == 0, "Size must be a non-zero multiple of page size.");
+
+        VirtualFree(address, (SIZE_T)size, MEM_DECOMMIT);
+    }
+
+    void platform_memory_release(void* address, u64 size)
+    {
+        ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
+        ASSERT(address != nullptr, "Address must be non-null.");
+        ASSERT(size > 0, "Size must be greater than zero.");
+        UNUSED(size);
+
+        // NOTE: При MEM_RELEASE размер должен быть равен нулю, освобождается весь зарезервированный диапазон.
+        VirtualFree(address, 0, MEM_RELEASE);
+    }
+
     void platform_memory_zero(void* block, u64 size)
     {
         ASSERT(initialized == true, "Memory subsystem not initialized. Call platform_memory_initialize() first.");
@@ -4,10 +4,83 @@
 
     #include "debug/assert.h"
     #include "core/logger.h"
+    #include "platform/memory.h"
     #include <Windows.h>
 
+    // Количество попыток захвата мьютекса активным циклом перед переходом в ожидание.
+    #define MUTEX_SPIN_COUNT 128
+
+    // Состояния мьютекса.
+    #define MUTEX_UNLOCKED   0
+    #define MUTEX_LOCKED     1
+    #define MUTEX_CONTENDED  2
+
+    // Контекст запуска потока (передается в новый поток и освобождается им).
+    typedef struct thread_start_context {
+        platform_thread_start_fn func;
+        void* data;
+        char name[PLATFORM_THREAD_NAME_MAX + 1];
+    } thread_start_context;
+
     static u32 timer_resolution = 0;
     static bool initialized = false;
+    static PLATFORM_THREAD_LOCAL u64 current_thread_id = 0;
+
+    // Копирует имя потока с усечением до PLATFORM_THREAD_NAME_MAX.
+    static void thread_name_copy(char* dst, const char* name)
+    {
+        u32 length = 0;
+        if(name)
+        {
+            while(length < PLATFORM_THREAD_NAME_MAX && name[length] != '\0')
+            {
+                dst[length] = name[length];
+                ++length;
+            }
+        }
+        dst[length] = '\0';
+    }
+
+    // Устанавливает имя потока (отображается в отладчике и профилировщике).
+    static void thread_name_set(HANDLE thread, const char* name)
+    {
+        WCHAR wide_name[PLATFORM_THREAD_NAME_MAX + 1];
+        if(MultiByteToWideChar(CP_UTF8, 0, name, -1, wide_name, PLATFORM_THREAD_NAME_MAX + 1) > 0)
+        {
+            SetThreadDescription(thread, wide_name);
+        }
+    }
+
+    static DWORD WINAPI thread_start(LPVOID arg)
+    {
+        thread_start_context context = *(thread_start_context*)arg;
+        platform_memory_free(arg);
+
+        if(context.name[0] != '\0')
+        {
+            thread_name_set(GetCurrentThread(), context.name);
+        }
+
+        return (DWORD)context.func(context.data);
+    }
+
+    // Время окончания ожидания (0 - без ограничения).
+    static u64 thread_deadline(u32 timeout_ms)
+    {
+        return timeout_ms == PLATFORM_WAIT_INFINITE ? 0 : GetTickCount64() + timeout_ms;
+    }
+
+    // Оставшееся время ожидания в миллисекундах.
+    static u32 thread_remaining_ms(u64 deadline)
+    {
+        if(deadline == 0)
+        {
+            return PLATFORM_WAIT_INFINITE;
+        }
+
+        u64 now = GetTickCount64();
+        return now >= deadline ? 0 : (u32)(deadline - now);
+    }
 
     bool platform_thread_initialize()
     {
@@ -66,4 +139,327 @@
         return true;  
     }
 
+    bool platform_thread_create(platform_thread_start_fn func, void* data, const char* name, platform_thread* out_thread)
+    {
+        ASSERT(initialized == true, "Thread subsystem not initialized. Call platform_thread_initialize() first.");
+        ASSERT(func != nullptr, "Thread function must be non-null.");
+        ASSERT(out_thread != nullptr, "Thread pointer must be non-null.");
+
+        out_thread->handle = 0;
+
+        thread_start_context* context = platform_memory_allocate(sizeof(thread_start_context));
+        if(!context)
+        {
+            LOG_ERROR("Failed to allocate memory for thread start context.");
+            return false;
+        }
+
+        context->func = func;
+        context->data = data;
+        thread_name_copy(context->name, name);
+
+        HANDLE thread = CreateThread(nullptr, 0, thread_start, context, 0, nullptr);
+        if(!thread)
+        {
+            LOG_ERROR("Failed to create thread '%s' (error %lu).", name ? name : "", GetLastError());
+            platform_memory_free(context);
+            return false;
+        }
+
+        out_thread->handle = (u64)thread;
+        return true;
+    }
+
+    bool platform_thread_join(platform_thread* thread, u32* out_result)
+    {
+        ASSERT(thread != nullptr && thread->handle != 0, "Thread must be created.");
+
+        HANDLE handle = (HANDLE)thread->handle;
+        if(WaitForSingleObject(handle, INFINITE) != WAIT_OBJECT_0)
+        {
+            LOG_ERROR("Failed to join thread (error %lu).", GetLastError());
+            return false;
+        }
+
+        DWORD result = 0;
+        GetExitCodeThread(handle, &result);
+        CloseHandle(handle);
+
+        if(out_result)
+        {
+            *out_result = (u32)result;
+        }
+
+        thread->handle = 0;
+        return true;
+    }
+
+    void platform_thread_detach(platform_thread* thread)
+    {
+        ASSERT(thread != nullptr && thread->handle != 0, "Thread must be created.");
+
+        CloseHandle((HANDLE)thread->handle);
+        thread->handle = 0;
+    }
+
+    void platform_thread_set_name(const char* name)
+    {
+        ASSERT(name != nullptr, "Thread name must be non-null.");
+
+        char truncated[PLATFORM_THREAD_NAME_MAX + 1];
+        thread_name_copy(truncated, name);
+        thread_name_set(GetCurrentThread(), truncated);
+    }
+
+    u64 platform_thread_current_id()
+    {
+        if(UNLIKELY(current_thread_id == 0))
+        {
+            current_thread_id = (u64)GetCurrentThreadId();
+        }
+        return current_thread_id;
+    }
+
+    void platform_thread_yield()
+    {
+        SwitchToThread();
+    }
+
+    u32 platform_processor_count()
+    {
+        DWORD count = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+        return count > 0 ? (u32)count : 1;
+    }
+
+    bool platform_thread_set_affinity(const u16* cpus, u32 count)
+    {
+        ASSERT(cpus != nullptr || count == 0, "CPUs pointer must be non-null.");
+
+        if(count == 0)
+        {
+            DWORD_PTR process_mask = 0;
+            DWORD_PTR system_mask = 0;
+            if(!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+            {
+                return false;
+            }
+            return SetThreadAffinityMask(GetCurrentThread(), process_mask) != 0;
+        }
+
+        // NOTE: Номер процессора составлен из номера группы и номера в группе (group * 64 + index).
+        GROUP_AFFINITY affinity;
+        ZeroMemory(&affinity, sizeof(GROUP_AFFINITY));
+        affinity.Group = (WORD)(cpus[0] / 64);
+
+        for(u32 i = 0; i < count; ++i)
+        {
+            if(cpus[i] / 64 == affinity.Group)
+            {
+                affinity.Mask |= (KAFFINITY)1 << (cpus[i] % 64);
+            }
+        }
+
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+    }
+
+    bool platform_thread_set_priority(platform_thread_priority priority)
+    {
+        // Приоритеты Windows для приоритетов от самого низкого до самого высокого.
+        static const int priorities[] = {
+            THREAD_PRIORITY_LOWEST, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL,
+            THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST
+        };
+        ASSERT((u32)priority < ARRAY_SIZE(priorities), "Invalid thread priority.");
+
+        return SetThreadPriority(GetCurrentThread(), priorities[priority]) != 0;
+    }
+
+    bool platform_address_wait(u32* address, u32 expected, u32 timeout_ms)
+    {
+        ASSERT(address != nullptr && POINTER_IS_ALIGNED(address, sizeof(u32)), "Address must be non-null and aligned to 4 bytes.");
+
+        DWORD timeout = timeout_ms == PLATFORM_WAIT_INFINITE ? INFINITE : (DWORD)timeout_ms;
+        return WaitOnAddress(address, &expected, sizeof(u32), timeout) || GetLastError() != ERROR_TIMEOUT;
+    }
+
+    void platform_address_wake(u32* address, u32 count)
+    {
+        ASSERT(address != nullptr, "Address must be non-null.");
+
+        if(count == 1)
+        {
+            WakeByAddressSingle(address);
+        }
+        else
+        {
+            WakeByAddressAll(address);
+        }
+    }
+
+    void platform_mutex_create(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+        mutex->state = MUTEX_UNLOCKED;
+    }
+
+    // Захватывает мьютекс в состоянии с ожидающими потоками (освобождение обязательно разбудит следующий).
+    static void mutex_lock_contended(platform_mutex* mutex)
+    {
+        while(__atomic_exchange_n(&mutex->state, MUTEX_CONTENDED, __ATOMIC_ACQUIRE) != MUTEX_UNLOCKED)
+        {
+            platform_address_wait(&mutex->state, MUTEX_CONTENDED, PLATFORM_WAIT_INFINITE);
+        }
+    }
+
+    void platform_mutex_lock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        u32 state = MUTEX_UNLOCKED;
+        if(LIKELY(__atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)))
+        {
+            return;
+        }
+
+        // Короткие критические секции часто освобождаются быстрее перехода в ядро.
+        for(u32 i = 0; i < MUTEX_SPIN_COUNT && state != MUTEX_CONTENDED; ++i)
+        {
+            platform_cpu_pause();
+
+            state = __atomic_load_n(&mutex->state, __ATOMIC_RELAXED);
+            if(state == MUTEX_UNLOCKED
+            && __atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return;
+            }
+        }
+
+        mutex_lock_contended(mutex);
+    }
+
+    bool platform_mutex_try_lock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        u32 state = MUTEX_UNLOCKED;
+        return __atomic_compare_exchange_n(&mutex->state, &state, MUTEX_LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    }
+
+    void platform_mutex_unlock(platform_mutex* mutex)
+    {
+        ASSERT(mutex != nullptr && platform_atomic_load_u32(&mutex->state, PLATFORM_MEMORY_ORDER_RELAXED) != MUTEX_UNLOCKED, "Mutex must be locked.");
+
+        if(__atomic_exchange_n(&mutex->state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+        {
+            platform_address_wake(&mutex->state, 1);
+        }
+    }
+
+    void platform_condition_create(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+        condition->sequence = 0;
+    }
+
+    bool platform_condition_wait(platform_condition* condition, platform_mutex* mutex, u32 timeout_ms)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+        ASSERT(mutex != nullptr, "Mutex pointer must be non-null.");
+
+        // NOTE: Номер читается до освобождения мьютекса, поэтому сигнал после освобождения не теряется.
+        u32 sequence = __atomic_load_n(&condition->sequence, __ATOMIC_RELAXED);
+        platform_mutex_unlock(mutex);
+
+        bool signaled = platform_address_wait(&condition->sequence, sequence, timeout_ms);
+
+        // Другие потоки могут ожидать мьютекс, поэтому он захватывается сразу в состоянии с ожидающими.
+        mutex_lock_contended(mutex);
+        return signaled;
+    }
+
+    void platform_condition_signal(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+
+        __atomic_fetch_add(&condition->sequence, 1, __ATOMIC_RELEASE);
+        platform_address_wake(&condition->sequence, 1);
+    }
+
+    void platform_condition_broadcast(platform_condition* condition)
+    {
+        ASSERT(condition != nullptr, "Condition pointer must be non-null.");
+
+        __atomic_fetch_add(&condition->sequence, 1, __ATOMIC_RELEASE);
+        platform_address_wake(&condition->sequence, U32_MAX);
+    }
+
+    void platform_semaphore_create(platform_semaphore* semaphore, u32 count)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        semaphore->count = count;
+        semaphore->waiters = 0;
+    }
+
+    bool platform_semaphore_try_wait(platform_semaphore* semaphore)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        u32 count = __atomic_load_n(&semaphore->count, __ATOMIC_RELAXED);
+        while(count > 0)
+        {
+            if(__atomic_compare_exchange_n(&semaphore->count, &count, count - 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool platform_semaphore_wait(platform_semaphore* semaphore, u32 timeout_ms)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+
+        if(platform_semaphore_try_wait(semaphore))
+        {
+            return true;
+        }
+
+        u64 deadline = thread_deadline(timeout_ms);
+        while(true)
+        {
+            u32 remaining = thread_remaining_ms(deadline);
+            if(remaining == 0)
+            {
+                return false;
+            }
+
+            // NOTE: Последовательная согласованность исключает ситуацию, когда post() не видит ожидающего,
+            //       а ожидающий не видит увеличенного счетчика.
+            __atomic_fetch_add(&semaphore->waiters, 1, __ATOMIC_SEQ_CST);
+            if(__atomic_load_n(&semaphore->count, __ATOMIC_SEQ_CST) == 0)
+            {
+                platform_address_wait(&semaphore->count, 0, remaining);
+            }
+            __atomic_fetch_sub(&semaphore->waiters, 1, __ATOMIC_RELAXED);
+
+            if(platform_semaphore_try_wait(semaphore))
+            {
+                return true;
+            }
+        }
+    }
+
+    void platform_semaphore_post(platform_semaphore* semaphore, u32 count)
+    {
+        ASSERT(semaphore != nullptr, "Semaphore pointer must be non-null.");
+        ASSERT(count > 0, "Count must be greater than zero.");
+
+        __atomic_fetch_add(&semaphore->count, count, __ATOMIC_SEQ_CST);
+        if(__atomic_load_n(&semaphore->waiters, __ATOMIC_SEQ_CST) > 0)
+        {
+            platform_address_wake(&semaphore->count, count);
+        }
+    }
+
 #endif
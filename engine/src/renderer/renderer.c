@@ -34,10 +34,10 @@ typedef struct renderer_system_context {
 
     bool (*shader_create)(shader_t* shader, u32 stage_count, shader_stage_file_t* stage_files);
     void (*shader_destroy)(shader_t* shader);
-    bool (*shader_acquire_resource)(shader_t* shader, u32 set_index, u32* out_resource_id);
-    void (*shader_release_resource)(shader_t* shader, u32 resource_id);
-    void (*shader_update_resource_binding)(shader_t* shader, u32 resource_id, u32 binding_index, const void* data);
-    void (*shader_apply_resource)(shader_t* shader, u32 resource_id);
+    bool (*shader_acquire_resource)(shader_t* shader, u32 set_index, slot_handle* out_resource_id);
+    void (*shader_release_resource)(shader_t* shader, slot_handle resource_id);
+    void (*shader_update_resource_binding)(shader_t* shader, slot_handle resource_id, u32 binding_index, const void* data);
+    void (*shader_apply_resource)(shader_t* shader, slot_handle resource_id);
 
     // TODO: Временно, убрать!
     void (*shader_update_model)(shader_t* shader, renderer_model_t* model);
@@ -273,28 +273,28 @@ void renderer_shader_destroy(shader_t* shader)
     context->shader_destroy(shader);
 }
 
-bool renderer_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_resource_id)
+bool renderer_shader_acquire_resource(shader_t* shader, u32 set_index, slot_handle* out_resource_id)
 {
     ASSERT(context != nullptr, "Renderer system should be initialized.");
 
     return context->shader_acquire_resource(shader, set_index, out_resource_id);
 }
 
-void renderer_shader_release_resource(shader_t* shader, u32 resource_id)
+void renderer_shader_release_resource(shader_t* shader, slot_handle resource_id)
 {
     ASSERT(context != nullptr, "Renderer system should be initialized.");
 
     context->shader_release_resource(shader, resource_id);
 }
 
-void renderer_shader_update_resource_binding(shader_t* shader, u32 resource_id, u32 binding_index, const void* data)
+void renderer_shader_update_resource_binding(shader_t* shader, slot_handle resource_id, u32 binding_index, const void* data)
 {
     ASSERT(context != nullptr, "Renderer system should be initialized.");
 
     context->shader_update_resource_binding(shader, resource_id, binding_index, data);
 }
 
-void renderer_shader_apply_resource(shader_t* shader, u32 resource_id)
+void renderer_shader_apply_resource(shader_t* shader, slot_handle resource_id)
 {
     ASSERT(context != nullptr, "Renderer system should be initialized.");
 
@@ -2,6 +2,7 @@
 
 #include <core/defines.h>
 #include <math/types.h>
+#include <core/containers/slotmap.h>
 
 typedef struct platform_window platform_window;
 
@@ -27,11 +28,6 @@ typedef struct platform_window platform_window;
 */
 #define RENDERER_MAX_SHADER_SET_BINDINGS 1
 
-/**
-    @brief Максимальное количество ресурсов шейдера
-*/
-#define RENDERER_MAX_SHADER_RESOURCES    64
-
 
 typedef enum renderer_backend_type {
     RENDERER_BACKEND_TYPE_VULKAN,
@@ -74,7 +70,7 @@ typedef enum buffer_type {
 typedef struct buffer {
     buffer_type_t type;                         /**< Тип буфера данных.         */
     usize size;                                 /**< Размера буфера в байтах.   */
-    void* internal_data;                        /**< Внутренние данные бэкенда. */
+    slot_handle handle;                         /**< Дескриптор данных бэкенда. */
 } buffer_t;
 
 /**
@@ -13,6 +13,7 @@
 #include "core/memory.h"
 #include "core/string.h"
 #include "core/containers/darray.h"
+#include "core/containers/slotmap.h"
 #include "platform/file.h"
 
 // TODO: В отдельный файл.
@@ -260,9 +261,7 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL debug_messenger_handler(
             LOG_ERROR("[Vulkan %s]: %s.", message_type, callback_data->pMessage);
 
             // Вывод дополнительной информации по памяти.
-            const char* memory_info = memory_system_usage_str();
-            LOG_WARN(memory_info);
-            string_free(memory_info);
+            LOG_WARN("%s", memory_system_usage_str());
 
             DEBUG_BREAK();
             return VK_TRUE; // Указывает прервать работу.
@@ -555,6 +554,12 @@ bool vulkan_backend_initialize(platform_window* window)
     // TODO: Реализовать кастомный аллокатор.
     context->allocator = nullptr;
 
+    if(!slotmap_create(context->buffers, vulkan_buffer_t, MEMORY_TAG_RENDERER) || !slotmap_create(context->textures, vulkan_texture_map_t, MEMORY_TAG_TEXTURE))
+    {
+        LOG_ERROR("Failed to create vulkan resource storage.");
+        return false;
+    }
+
     // Сохранение контекста связанного окна.
     context->window = window;
     u32 framebuffer_width = 0;
@@ -661,6 +666,19 @@ void vulkan_backend_shutdown()
         LOG_TRACE("Vulkan instance destroy complete.");
     }
 
+    if(context->buffers.data && slotmap_length(context->buffers) > 0)
+    {
+        LOG_WARN("Vulkan backend shutdown with %llu buffers not destroyed.", slotmap_length(context->buffers));
+    }
+
+    if(context->textures.data && slotmap_length(context->textures) > 0)
+    {
+        LOG_WARN("Vulkan backend shutdown with %llu textures not destroyed.", slotmap_length(context->textures));
+    }
+
+    slotmap_destroy(context->buffers);
+    slotmap_destroy(context->textures);
+
     mfree(context, sizeof(vulkan_context), MEMORY_TAG_RENDERER);
     context = nullptr;
 
@@ -945,11 +963,19 @@ void vulkan_frame_bind_shader(shader_t* shader)
     vkCmdBindPipeline(cmdbuf, VK_PIPELINE_BIND_POINT_GRAPHICS, vk_shader->pipeline);
 }
 
+// Возвращает внутренние данные буфера (указатель действителен до создания или уничтожения другого буфера).
+static vulkan_buffer_t* buffer_get(const buffer_t* buffer)
+{
+    vulkan_buffer_t* vk_buffer = slotmap_get(context->buffers, buffer->handle);
+    ASSERT(vk_buffer != nullptr, "Buffer handle is invalid or buffer has already been destroyed.");
+    return vk_buffer;
+}
+
 void vulkan_frame_bind_buffer(buffer_t* buffer, const usize buffer_offset)
 {
     u32 current_frame = context->swapchain.current_frame;
     VkCommandBuffer cmdbuf = context->graphics_command_buffers[current_frame];
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = buffer_get(buffer);
 
     switch(buffer->type)
     {
@@ -1040,9 +1066,13 @@ static void buffer_copy_range(vulkan_buffer_t* src, usize src_offset, vulkan_buf
 
 bool vulkan_buffer_create(buffer_t* buffer)
 {
-    buffer->internal_data = mallocate(sizeof(vulkan_buffer_t), MEMORY_TAG_RENDERER);
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
-    mzero(vk_buffer, sizeof(vulkan_buffer_t));
+    vulkan_buffer_t* vk_buffer = nullptr;
+    buffer->handle = slot_map_insert(&context->buffers, nullptr, (void**)&vk_buffer);
+    if(buffer->handle == SLOT_HANDLE_INVALID)
+    {
+        LOG_ERROR("Failed to allocate memory for buffer type %u.", buffer->type);
+        return false;
+    }
 
     switch(buffer->type)
     {
@@ -1067,6 +1097,7 @@ bool vulkan_buffer_create(buffer_t* buffer)
         case BUFFER_TYPE_STORAGE:
         default:
             LOG_ERROR("Buffer type %u is not yet supported.", buffer->type);
+            vulkan_buffer_destroy(buffer);
             return false;
     }
 
@@ -1081,6 +1112,7 @@ bool vulkan_buffer_create(buffer_t* buffer)
     if(!vulkan_result_is_success(result))
     {
         LOG_ERROR("Failed to create buffer type %u: %s.", buffer->type, vulkan_result_get_string(result));
+        vulkan_buffer_destroy(buffer);
         return false;
     }
 
@@ -1092,6 +1124,7 @@ bool vulkan_buffer_create(buffer_t* buffer)
     if(vk_buffer->memory_index == INVALID_ID32)
     {
         LOG_ERROR("Failed to find memory index for buffer type %u.", buffer->type);
+        vulkan_buffer_destroy(buffer);
         return false;
     }
 
@@ -1106,6 +1139,7 @@ bool vulkan_buffer_create(buffer_t* buffer)
     if(!vulkan_result_is_success(result))
     {
         LOG_ERROR("Failed to allocate memory for buffer type %u: %s.", buffer->type, vulkan_result_get_string(result));
+        vulkan_buffer_destroy(buffer);
         return false;
     }
 
@@ -1114,6 +1148,7 @@ bool vulkan_buffer_create(buffer_t* buffer)
     if(!vulkan_result_is_success(result))
     {
         LOG_ERROR("Failed to bind memory buffer of type %u: %s.", buffer->type, vulkan_result_get_string(result));
+        vulkan_buffer_destroy(buffer);
         return false;
     }
 
@@ -1122,7 +1157,13 @@ bool vulkan_buffer_create(buffer_t* buffer)
 
 void vulkan_buffer_destroy(buffer_t* buffer)
 {
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = slotmap_get(context->buffers, buffer->handle);
+    if(!vk_buffer)
+    {
+        LOG_ERROR("Failed to destroy buffer type %u: Invalid or stale handle.", buffer->type);
+        ASSERT(false, "Buffer handle is invalid or buffer has already been destroyed.");
+        return;
+    }
 
     if(vk_buffer->memory != nullptr)
     {
@@ -1134,12 +1175,13 @@ void vulkan_buffer_destroy(buffer_t* buffer)
         vkDestroyBuffer(context->device.logical, vk_buffer->handle, context->allocator);
     }
 
-    mfree(vk_buffer, sizeof(vulkan_buffer_t), MEMORY_TAG_RENDERER);
+    slotmap_remove(context->buffers, buffer->handle, nullptr);
+    buffer->handle = SLOT_HANDLE_INVALID;
 }
 
 bool vulkan_buffer_resize(buffer_t* buffer, usize new_size)
 {
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = buffer_get(buffer);
 
     VkBufferCreateInfo buffer_info = {
         .sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
@@ -1207,7 +1249,7 @@ bool vulkan_buffer_resize(buffer_t* buffer, usize new_size)
 
 bool vulkan_buffer_map_memory(buffer_t* buffer, usize offset, usize size, void** data)
 {
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = buffer_get(buffer);
     VkResult result = vkMapMemory(context->device.logical, vk_buffer->memory, offset, size, 0, data);
     if(!vulkan_result_is_success(result))
     {
@@ -1220,13 +1262,13 @@ bool vulkan_buffer_map_memory(buffer_t* buffer, usize offset, usize size, void**
 
 void vulkan_buffer_unmap_memory(buffer_t* buffer)
 {
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = buffer_get(buffer);
     vkUnmapMemory(context->device.logical, vk_buffer->memory);
 }
 
 bool vulkan_buffer_load_range(buffer_t* buffer, usize offset, usize size, const void* data)
 {
-    vulkan_buffer_t* vk_buffer = buffer->internal_data;
+    vulkan_buffer_t* vk_buffer = buffer_get(buffer);
 
     if(buffer_is_device_local_only(vk_buffer))
     {
@@ -1268,7 +1310,7 @@ bool vulkan_buffer_load_range(buffer_t* buffer, usize offset, usize size, const
 
 void vulkan_buffer_copy_range(buffer_t* src, usize src_offset, buffer_t* dst, usize dst_offset, usize size)
 {
-    buffer_copy_range(src->internal_data, src_offset, dst->internal_data, dst_offset, size);
+    buffer_copy_range(buffer_get(src), src_offset, buffer_get(dst), dst_offset, size);
 }
 
 // static u32 shader_reflect_attribute_size(SpvReflectInterfaceVariable* attr)
@@ -1917,7 +1959,7 @@ bool vulkan_shader_create(shader_t* shader, u32 stage_count, shader_stage_file_t
 
     // Создание uniform буфера для сетов.
     // TODO: Проверить и установить размер minUniformBufferOffsetAlignment.
-    vk_shader->uniform_buffer = (buffer_t){ BUFFER_TYPE_UNIFORM, uniform_buffer_size, nullptr };
+    vk_shader->uniform_buffer = (buffer_t){ .type = BUFFER_TYPE_UNIFORM, .size = uniform_buffer_size };
     if(!vulkan_buffer_create(&vk_shader->uniform_buffer))
     {
         LOG_ERROR("Failed to create shader: Unable to create uniform buffer.");
@@ -1930,10 +1972,10 @@ bool vulkan_shader_create(shader_t* shader, u32 stage_count, shader_stage_file_t
         return false;
     }
 
-    // Инвалидация ресурсов.
-    for(u32 i = 0; i < RENDERER_MAX_SHADER_RESOURCES; ++i)
+    if(!slotmap_create(vk_shader->resources, vulkan_shader_resource_t, MEMORY_TAG_RENDERER))
     {
-        vk_shader->resources[i].id = INVALID_ID32;
+        LOG_ERROR("Failed to create shader: Unable to create resource storage.");
+        return false;
     }
 
     return true;
@@ -1972,15 +2014,16 @@ void vulkan_shader_destroy(shader_t* shader)
         }
     }
 
+    slotmap_destroy(vk_shader->resources);
     mfree(vk_shader, sizeof(vulkan_shader_t), MEMORY_TAG_RENDERER);
 }
 
 // TODO: Проверить получение, освобождени, обновление и применение для биндингов с несколькими дексрипторами.
 //       в спешке не стал их временно учитывать.
-bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_resource_id)
+bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, slot_handle* out_resource_id)
 {
     vulkan_shader_t* vk_shader = shader->internal_data;
-    *out_resource_id = INVALID_ID32;
+    *out_resource_id = SLOT_HANDLE_INVALID;
 
     if(set_index >= vk_shader->set_count)
     {
@@ -1988,26 +2031,15 @@ bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_re
         return false;
     }
 
-    // Поиск свободного слота.
-    u32 resource_id = INVALID_ID32;
-    for(u32 i = 0; i < RENDERER_MAX_SHADER_RESOURCES; ++i)
-    {
-        if(vk_shader->resources[i].id == INVALID_ID32)
-        {
-            resource_id = i;
-            break;
-        }
-    }
-
-    if(resource_id == INVALID_ID32)
+    // Получение свободного слота и указателя на ресурс.
+    vulkan_shader_resource_t* resource = nullptr;
+    slot_handle resource_id = slot_map_insert(&vk_shader->resources, nullptr, (void**)&resource);
+    if(resource_id == SLOT_HANDLE_INVALID)
     {
-        LOG_ERROR("Failed to acquire shader resource for SET=%u: No free resource slots left.", set_index);
+        LOG_ERROR("Failed to acquire shader resource for SET=%u: Unable to allocate resource slot.", set_index);
         return false;
     }
 
-    // Получение указателя на ресурс.
-    vulkan_shader_resource_t* resource = &vk_shader->resources[resource_id];
-    resource->id = resource_id;
     resource->set_index = set_index;
     resource->binding_count = vk_shader->set_configs[set_index].binding_count;
 
@@ -2026,6 +2058,7 @@ bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_re
             {
                 LOG_ERROR("Failed to acquire shader resource for SET=%u: Out of space in uniform buffer.", set_index);
                 LOG_DEBUG("SET=%u, required size %zu byte, but buffer size %zu byte.", set_index, memory_requirements, vk_shader->uniform_buffer.size);
+                slotmap_remove(vk_shader->resources, resource_id, nullptr);
                 return false;
             }
 
@@ -2056,58 +2089,59 @@ bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_re
     if(!vulkan_result_is_success(result))
     {
         LOG_ERROR("Failed to acquire shader resource for SET=%u: Descriptor sets could not be allocated: %s.", set_index, vulkan_result_get_string(result));
+        slotmap_remove(vk_shader->resources, resource_id, nullptr);
         return false;
     }
 
     *out_resource_id = resource_id;
-    vk_shader->resource_count++;
     return true;
 }
 
-void vulkan_shader_release_resource(shader_t* shader, u32 resource_id)
+void vulkan_shader_release_resource(shader_t* shader, slot_handle resource_id)
 {
     vulkan_shader_t* vk_shader = shader->internal_data;
-    vulkan_shader_resource_t* resource = &vk_shader->resources[resource_id];
+    vulkan_shader_resource_t* resource = slotmap_get(vk_shader->resources, resource_id);
 
-    // Ожидание завершения операций использующих этот ресурс.
-    vkDeviceWaitIdle(context->device.logical);
-
-    if(resource->id == INVALID_ID32)
+    if(!resource)
     {
-        LOG_ERROR("Failed to release shader resource for ID=%u: Slot is free.", resource_id);
+        LOG_ERROR("Failed to release shader resource for ID=%llu: Resource is already released.", resource_id);
+        ASSERT(false, "Shader resource handle is invalid or resource has already been released.");
         return;
     }
 
+    // Ожидание завершения операций использующих этот ресурс.
+    vkDeviceWaitIdle(context->device.logical);
+
     VkResult result = vkFreeDescriptorSets(
         context->device.logical, vk_shader->descriptor_pool, context->swapchain.max_frames_in_flight, resource->descriptor_sets
     );
 
     if(!vulkan_result_is_success(result))
     {
-        LOG_ERROR("Failed to release shader resource for ID=%u: Descriptor sets could not be freed: %s.", resource_id, vulkan_result_get_string(result));
+        LOG_ERROR("Failed to release shader resource for ID=%llu: Descriptor sets could not be freed: %s.", resource_id, vulkan_result_get_string(result));
         return;
     }
 
     // TODO: Организовать список свободных участков буфера + освободить память буфера.
 
-    // Освобождение памяти ресурса и инвалидация его.
-    mzero(resource, sizeof(vulkan_shader_resource_t));
-    resource->id = INVALID_ID32;
-    vk_shader->resource_count--;
+    // Освобождение слота ресурса (все копии дескриптора становятся недействительными).
+    slotmap_remove(vk_shader->resources, resource_id, nullptr);
 }
 
-void vulkan_shader_update_resource_binding(shader_t* shader, u32 resource_id, u32 binding_index, const void* data)
+void vulkan_shader_update_resource_binding(shader_t* shader, slot_handle resource_id, u32 binding_index, const void* data)
 {
     vulkan_shader_t* vk_shader = shader->internal_data;
-    vulkan_shader_resource_t* resource = &vk_shader->resources[resource_id];
-    vulkan_shader_set_config_t* resource_config = &vk_shader->set_configs[resource->set_index];
+    vulkan_shader_resource_t* resource = slotmap_get(vk_shader->resources, resource_id);
 
-    if(resource->id == INVALID_ID32)
+    if(!resource)
     {
-        LOG_ERROR("Failed to update resource for BINDING=%u: Invalid resource ID=%u.", binding_index, resource_id);
+        LOG_ERROR("Failed to update resource for BINDING=%u: Invalid resource ID=%llu.", binding_index, resource_id);
+        ASSERT(false, "Shader resource handle is invalid or resource has already been released.");
         return;
     }
 
+    vulkan_shader_set_config_t* resource_config = &vk_shader->set_configs[resource->set_index];
+
     // TODO: Пока что обновляет массив ресурсов целиком. Сделать отдельное обновление по индексу: u32 array_first, u32 array_count.
     usize resource_size = resource_config->binding_sizes[binding_index] * resource_config->bindings[binding_index].descriptorCount;
     usize resource_offset = resource->bindings[binding_index].uniform_buffer_offset + resource_size * context->swapchain.current_frame;
@@ -2120,18 +2154,20 @@ void vulkan_shader_update_resource_binding(shader_t* shader, u32 resource_id, u3
     // resource->bindings[binding_index].generation++;
 }
 
-void vulkan_shader_apply_resource(shader_t* shader, u32 resource_id)
+void vulkan_shader_apply_resource(shader_t* shader, slot_handle resource_id)
 {
     vulkan_shader_t* vk_shader = shader->internal_data;
-    vulkan_shader_resource_t* resource = &vk_shader->resources[resource_id];
-    vulkan_shader_set_config_t* resource_config = &vk_shader->set_configs[resource->set_index];
+    vulkan_shader_resource_t* resource = slotmap_get(vk_shader->resources, resource_id);
 
-    if(resource->id == INVALID_ID32)
+    if(!resource)
     {
-        LOG_ERROR("Failed to apply resource: Invalid resource ID=%u.", resource_id);
+        LOG_ERROR("Failed to apply resource: Invalid resource ID=%llu.", resource_id);
+        ASSERT(false, "Shader resource handle is invalid or resource has already been released.");
         return;
     }
 
+    vulkan_shader_set_config_t* resource_config = &vk_shader->set_configs[resource->set_index];
+
     u32 current_frame = context->swapchain.current_frame;
     VkCommandBuffer cmdbuf = context->graphics_command_buffers[current_frame];
     VkDescriptorSet descriptor_set = resource->descriptor_sets[current_frame];
@@ -2150,7 +2186,7 @@ void vulkan_shader_apply_resource(shader_t* shader, u32 resource_id)
         usize resource_offset = binding->uniform_buffer_offset + resource_size * current_frame;
 
         VkDescriptorBufferInfo buffer_info = {
-            .buffer = ((vulkan_buffer_t*)vk_shader->uniform_buffer.internal_data)->handle,
+            .buffer = buffer_get(&vk_shader->uniform_buffer)->handle,
             .offset = resource_offset,
             .range  = resource_size
         };
@@ -2174,7 +2210,7 @@ void vulkan_shader_apply_resource(shader_t* shader, u32 resource_id)
     if(write_set_count > 0)
     {
         vkUpdateDescriptorSets(context->device.logical, write_set_count, write_sets, 0, nullptr);
-        LOG_DEBUG("Resource descriptor with ID=%u has been updated. Current frame %u, set %u.", resource_id, current_frame, resource->set_index);
+        LOG_DEBUG("Resource descriptor with ID=%llu has been updated. Current frame %u, set %u.", resource_id, current_frame, resource->set_index);
     }
 
     // Привязка текущего ресурса к соответствующему размещению пайплайна.
@@ -2192,11 +2228,24 @@ void vulkan_shader_update_model(shader_t* shader, renderer_model_t* model)
     vkCmdPushConstants(cmdbuf, vk_shader->pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(renderer_model_t), model);
 }
 
+// Уничтожает объекты текстуры (в том числе частично созданной) и освобождает ее слот.
+static void texture_release(texture_t* t, vulkan_texture_map_t* map)
+{
+    vkDestroySampler(context->device.logical, map->sampler, context->allocator);
+    vulkan_image_destroy(context, &map->image);
+    slotmap_remove(context->textures, t->handle, nullptr);
+    t->handle = SLOT_HANDLE_INVALID;
+}
+
 void vulkan_texture_create(texture_t* t, const void* data)
 {
-    t->internal_data = mallocate(sizeof(vulkan_texture_map_t), MEMORY_TAG_TEXTURE);
-    vulkan_texture_map_t* map = t->internal_data;
-    mzero(map, sizeof(vulkan_texture_map_t));
+    vulkan_texture_map_t* map = nullptr;
+    t->handle = slot_map_insert(&context->textures, nullptr, (void**)&map);
+    if(t->handle == SLOT_HANDLE_INVALID)
+    {
+        LOG_ERROR("Failed to allocate memory for texture.");
+        return;
+    }
 
     VkFormat image_format = VK_FORMAT_R8G8B8A8_UNORM;
     u32 image_size = t->width * t->height * t->channels;
@@ -2209,12 +2258,14 @@ void vulkan_texture_create(texture_t* t, const void* data)
     ))
     {
         LOG_ERROR("Failed to create texture image.");
+        texture_release(t, map);
         return;
     }
 
     if(!vulkan_image_create_view(context, image_format, VK_IMAGE_ASPECT_COLOR_BIT, &map->image))
     {
         LOG_ERROR("Failed to create texture image views.");
+        texture_release(t, map);
         return;
     }
 
@@ -2222,6 +2273,7 @@ void vulkan_texture_create(texture_t* t, const void* data)
     if(!vulkan_buffer_create(&staging))
     {
         LOG_ERROR("Failed to create staging buffer.");
+        texture_release(t, map);
         return;
     }
 
@@ -2233,7 +2285,7 @@ void vulkan_texture_create(texture_t* t, const void* data)
 
     // 3. Копирование данных из промежуточного буфера.
     vulkan_image_transition_layout(cmdbuf, VULKAN_IMAGE_TRANSITION_UNDEFINED_TO_TRANSFER_DST, &map->image.handle);
-    vulkan_image_copy_from_buffer(cmdbuf, &map->image, ((vulkan_buffer_t*)staging.internal_data)->handle);
+    vulkan_image_copy_from_buffer(cmdbuf, &map->image, buffer_get(&staging)->handle);
     vulkan_image_transition_layout(cmdbuf, VULKAN_IMAGE_TRANSITION_TRANSFER_DST_TO_SHADER_READ, &map->image.handle);
 
     vulkan_command_buffer_end_single_use(&context->graphics_command_manager, cmdbuf);
@@ -2263,6 +2315,7 @@ void vulkan_texture_create(texture_t* t, const void* data)
     if(!vulkan_result_is_success(result))
     {
         LOG_ERROR("Failed to create sampler: %s.", vulkan_result_get_string(result));
+        texture_release(t, map);
         return;
     }
 
@@ -2271,8 +2324,13 @@ void vulkan_texture_create(texture_t* t, const void* data)
 
 void vulkan_texture_destroy(texture_t* t)
 {
-    vulkan_texture_map_t* map = t->internal_data;
-    vkDestroySampler(context->device.logical, map->sampler, context->allocator);
-    vulkan_image_destroy(context, &map->image);
-    t->internal_data = nullptr;
+    vulkan_texture_map_t* map = slotmap_get(context->textures, t->handle);
+    if(!map)
+    {
+        LOG_ERROR("Failed to destroy texture: Invalid or stale handle.");
+        ASSERT(false, "Texture handle is invalid or texture has already been destroyed.");
+        return;
+    }
+
+    texture_release(t, map);
 }
@@ -30,10 +30,10 @@ void vulkan_buffer_copy_range(buffer_t* src, usize src_offset, buffer_t* dst, us
 
 bool vulkan_shader_create(shader_t* shader, u32 stage_count, shader_stage_file_t* stage_files);
 void vulkan_shader_destroy(shader_t* shader);
-bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, u32* out_resource_id);
-void vulkan_shader_release_resource(shader_t* shader, u32 resource_id);
-void vulkan_shader_update_resource_binding(shader_t* shader, u32 resource_id, u32 binding_index, const void* data);
-void vulkan_shader_apply_resource(shader_t* shader, u32 resource_id);
+bool vulkan_shader_acquire_resource(shader_t* shader, u32 set_index, slot_handle* out_resource_id);
+void vulkan_shader_release_resource(shader_t* shader, slot_handle resource_id);
+void vulkan_shader_update_resource_binding(shader_t* shader, slot_handle resource_id, u32 binding_index, const void* data);
+void vulkan_shader_apply_resource(shader_t* shader, slot_handle resource_id);
 
 // TODO: Временно, убрать!
 void vulkan_shader_update_model(shader_t* shader, renderer_model_t* model);
@@ -175,7 +175,6 @@ typedef struct vulkan_shader_resource_binding {
     @brief Состояние ресурса.
 */
 typedef struct vulkan_shader_resource {
-    u32 id;                                                                      /**< Идентификатор ресурса.                             */
     u32 set_index;                                                               /**< Индекс сета к которому может быть привязан ресурс. */
     VkDescriptorSet descriptor_sets[RENDERER_MAX_FRAME_IN_FLIGHT];               /**< Дескрипторные сеты (по одному на кадр).            */
     u32 binding_count;                                                           /**< Используемое количество привязок сета.             */
@@ -204,8 +203,7 @@ typedef struct vulkan_shader {
     buffer_t uniform_buffer;                                                     /**< Uniform буфер данных.                       */
     void* uniform_buffer_mapped_data;                                            /**< Указатель на память буфера.                 */
     usize uniform_buffer_next_offset;                                            /**< Индекс следующего смещения.                 */ // TODO: временно.
-    u32 resource_count;                                                          /**< Количество используемых ресурсов.           */
-    vulkan_shader_resource_t resources[RENDERER_MAX_SHADER_RESOURCES];           /**< Массив ресурсов.                            */
+    slot_map resources;                                                          /**< Ресурсы шейдера (vulkan_shader_resource_t). */
 } vulkan_shader_t;
 
 // @brief Основной контекст рендерера.
@@ -259,6 +257,11 @@ typedef struct vulkan_context {
 
     // @brief Буферы команд для графических операций (на кадр).
     VkCommandBuffer* graphics_command_buffers;
+
+    // @brief Буферы данных (vulkan_buffer_t), доступ по дескриптору buffer_t.handle.
+    slot_map buffers;
+    // @brief Текстуры (vulkan_texture_map_t), доступ по дескриптору texture_t.handle.
+    slot_map textures;
 } vulkan_context;
 
 // TODO: Временно.
@@ -17,8 +17,8 @@
 #pragma once
 
 #include <core/defines.h>
-
-#define TEXTURE_NAME_MAX_LANGTH 256
+#include <core/string_id.h>
+#include <core/containers/slotmap.h>
 
 /**
     @brief Тип текстур.
@@ -32,11 +32,11 @@ typedef enum texture_type {
     @brief Данные текстуры.
 */
 typedef struct texture {
-    char name[TEXTURE_NAME_MAX_LANGTH]; /**< Имя текстуры.                                          */
+    string_id name;                     /**< Идентификатор имени текстуры.                          */
     texture_type_t type;                /**< Тип текстуры.                                          */
     u32 width;                          /**< Ширина текстуры в пикселях.                            */
     u32 height;                         /**< Высота текстуры в пикселях.                            */
     u8 channels;                        /**< Количество каналов пикселя.                            */
     u32 generation;                     /**< Версия изменений. Используется для обновления данных.  */
-    void* internal_data;                /**< Указатель на внутренние данные рендерера.              */
+    slot_handle handle;                 /**< Дескриптор внутренних данных рендерера.                */
 } texture_t;
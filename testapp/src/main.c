@@ -20,7 +20,7 @@ static u32 height_cached;
 static bool cursor_locked;
 
 static shader_t world_shader;
-static u32 world_shader_camera;
+static slot_handle world_shader_camera;
 
 static renderer_camera_t world_camera;
 static renderer_model_t plane_model;
@@ -204,9 +204,7 @@ static bool game_update(f32 delta_time)
     {
         if(input_key_down('M'))
         {
-            const char* meminfo = memory_system_usage_str();
-            LOG_DEBUG(meminfo);
-            string_free(meminfo);
+            LOG_DEBUG("%s", memory_system_usage_str());
         }
 
         if(input_key_down('F'))
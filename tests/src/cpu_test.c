@@ -0,0 +1,49 @@
+#include "test.h"
+
+#include <core/memory.h>
+#include <platform/cpu.h>
+
+bool test_cpu_topology()
+{
+    platform_cpu_info_t* info = memory_allocate(sizeof(platform_cpu_info_t), 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(info != nullptr);
+    TEST_CHECK(platform_cpu_info(info));
+
+    bool valid = info->logical_count > 0 && info->physical_count > 0 && info->physical_count <= info->logical_count
+              && info->package_count > 0 && info->package_count <= info->physical_count;
+
+    for(u32 i = 0; i < info->logical_count && valid; ++i)
+    {
+        const platform_cpu_logical* logical = &info->logical[i];
+        valid = logical->core < info->physical_count && logical->package < info->package_count;
+        valid = valid && (i == 0 || info->logical[i - 1].id < logical->id);
+
+        // Ядра нумеруются по порядку первого логического процессора.
+        bool core_seen = false;
+        for(u32 j = 0; j < i && valid; ++j)
+        {
+            const platform_cpu_logical* other = &info->logical[j];
+            if(other->core == logical->core)
+            {
+                // Потоки одного ядра находятся в одном сокете и различаются номером в ядре.
+                valid = other->package == logical->package && other->smt_index < logical->smt_index
+                     && other->core_type == logical->core_type;
+                core_seen = true;
+            }
+        }
+
+        if(!core_seen)
+        {
+            u32 max_core = 0;
+            for(u32 j = 0; j < i; ++j)
+            {
+                max_core = MAX(max_core, info->logical[j].core + 1U);
+            }
+            valid = valid && logical->core == max_core;
+        }
+    }
+
+    memory_free(info, sizeof(platform_cpu_info_t), MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(valid);
+    return true;
+}
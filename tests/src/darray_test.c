@@ -0,0 +1,291 @@
+#include "test.h"
+
+#include <core/containers/darray.h>
+#include <core/logger.h>
+#include <core/memory.h>
+
+// Количество элементов массива с тегом памяти.
+#define DARRAY_TEST_TAGGED_LENGTH 1000
+
+// Возвращает текущее использование памяти тегом по итогам кадра.
+static u64 darray_test_tag_usage(memory_tag tag)
+{
+    memory_tag_usage usage[MEMORY_TAG_COUNT];
+    memory_system_frame_end();
+    memory_system_tag_usage(usage);
+    return usage[tag].current;
+}
+
+// Максимальная емкость виртуального массива в проверке (несколько страниц).
+#define DARRAY_TEST_VIRTUAL_CAPACITY 10000
+
+bool test_darray_virtual_grow()
+{
+    u32* array = darray_create_virtual(u32, DARRAY_TEST_VIRTUAL_CAPACITY);
+    TEST_CHECK(array != nullptr);
+    TEST_CHECK(dynamic_array_is_virtual(array));
+
+    // Рост выполняется на месте, множитель роста ограничивается зарезервированным диапазоном.
+    u32* base = array;
+    for(u32 i = 0; i < DARRAY_TEST_VIRTUAL_CAPACITY; ++i)
+    {
+        darray_push(array, i);
+    }
+    TEST_CHECK(array == base);
+    TEST_CHECK(darray_length(array) == DARRAY_TEST_VIRTUAL_CAPACITY);
+
+    // Максимальная емкость включает остаток последней зарезервированной страницы.
+    u64 max_capacity = darray_capacity(array);
+    TEST_CHECK(max_capacity >= DARRAY_TEST_VIRTUAL_CAPACITY);
+    TEST_CHECK(darray_reserve(array, max_capacity));
+    TEST_CHECK(darray_capacity(array) == max_capacity);
+
+    for(u64 i = DARRAY_TEST_VIRTUAL_CAPACITY; i < max_capacity; ++i)
+    {
+        darray_push(array, (u32)i);
+    }
+    TEST_CHECK(array == base);
+    TEST_CHECK(darray_length(array) == max_capacity);
+
+    // NOTE: Ожидаемые ошибки превышения максимальной емкости не выводятся.
+    log_set_level(LOG_LEVEL_FATAL);
+    TEST_CHECK(!darray_reserve(array, max_capacity + 1));
+    darray_push(array, 0u);
+    TEST_CHECK(!darray_resize(array, max_capacity / 2));
+    log_set_level(LOG_LEVEL_WARN);
+
+    // Неудачные изменения емкости оставляют массив неизменным.
+    TEST_CHECK(array == base);
+    TEST_CHECK(darray_length(array) == max_capacity);
+    TEST_CHECK(darray_capacity(array) == max_capacity);
+    for(u64 i = 0; i < max_capacity; ++i)
+    {
+        TEST_CHECK(array[i] == (u32)i);
+    }
+
+    darray_destroy(array);
+    return true;
+}
+
+bool test_darray_tagged()
+{
+    u64 base = darray_test_tag_usage(MEMORY_TAG_TEXTURE);
+    u64 base_darray = darray_test_tag_usage(MEMORY_TAG_DARRAY);
+
+    u32* array = darray_create_tagged(u32, 1, MEMORY_TAG_TEXTURE);
+    TEST_CHECK(array != nullptr);
+
+    // Перевыделения при росте учитываются по тегу массива.
+    for(u32 i = 0; i < DARRAY_TEST_TAGGED_LENGTH; ++i)
+    {
+        darray_push(array, i);
+    }
+    TEST_CHECK(darray_test_tag_usage(MEMORY_TAG_TEXTURE) >= base + DARRAY_TEST_TAGGED_LENGTH * sizeof(u32));
+    TEST_CHECK(darray_test_tag_usage(MEMORY_TAG_DARRAY) == base_darray);
+
+    darray_destroy(array);
+    TEST_CHECK(darray_test_tag_usage(MEMORY_TAG_TEXTURE) == base);
+    return true;
+}
+
+// Количество элементов исходных данных в проверках пакетных операций.
+#define DARRAY_TEST_SOURCE_LENGTH 64
+
+// Проверяет, что элементы массива совпадают с ожидаемыми значениями.
+static bool darray_test_equal(const u32* array, const u32* expected, u64 count)
+{
+    if(darray_length(array) != count)
+    {
+        return false;
+    }
+
+    for(u64 i = 0; i < count; ++i)
+    {
+        if(array[i] != expected[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_darray_push_n()
+{
+    u32 source[DARRAY_TEST_SOURCE_LENGTH];
+    for(u32 i = 0; i < DARRAY_TEST_SOURCE_LENGTH; ++i)
+    {
+        source[i] = i + 100;
+    }
+
+    u32* array = darray_create(u32);
+    TEST_CHECK(array != nullptr);
+
+    // Пустой пакет не изменяет массив.
+    darray_push_n(array, source, 0);
+    TEST_CHECK(darray_length(array) == 0 && darray_capacity(array) == DARRAY_DEFAULT_CAPACITY);
+
+    // Пакет больше удвоенной емкости: емкость увеличивается один раз ровно до требуемой.
+    darray_push_n(array, source, 10);
+    TEST_CHECK(darray_test_equal(array, source, 10));
+    TEST_CHECK(darray_capacity(array) == 10);
+
+    // Пакет меньше удвоенной емкости: емкость увеличивается по множителю роста.
+    darray_push_n(array, source + 10, 5);
+    TEST_CHECK(darray_test_equal(array, source, 15));
+    TEST_CHECK(darray_capacity(array) == 20);
+
+    // Пакет в пределах емкости не перевыделяет массив; без данных элементы обнуляются.
+    u32* base = array;
+    darray_push_n(array, nullptr, 5);
+    TEST_CHECK(array == base && darray_length(array) == 20 && darray_capacity(array) == 20);
+    for(u32 i = 15; i < 20; ++i)
+    {
+        TEST_CHECK(array[i] == 0);
+    }
+    for(u32 i = 0; i < 15; ++i)
+    {
+        TEST_CHECK(array[i] == source[i]);
+    }
+
+    darray_destroy(array);
+    return true;
+}
+
+bool test_darray_insert_range()
+{
+    u32 source[] = { 1, 2, 3, 4 };
+    u32* array = darray_create_custom(u32, 4);
+    TEST_CHECK(array != nullptr);
+
+    // Вставка в пустой массив (позиция 0 совпадает с длиной).
+    darray_insert_range(array, 0, source, 2);
+    u32 expected0[] = { 1, 2 };
+    TEST_CHECK(darray_test_equal(array, expected0, ARRAY_SIZE(expected0)));
+
+    // Вставка в начало и в конец массива, вторая - с ростом емкости.
+    u32 head[] = { 7, 8 };
+    darray_insert_range(array, 0, head, 2);
+    u32 expected1[] = { 7, 8, 1, 2 };
+    TEST_CHECK(darray_test_equal(array, expected1, ARRAY_SIZE(expected1)));
+    TEST_CHECK(darray_capacity(array) == 4);
+
+    darray_insert_range(array, darray_length(array), source, ARRAY_SIZE(source));
+    u32 expected2[] = { 7, 8, 1, 2, 1, 2, 3, 4 };
+    TEST_CHECK(darray_test_equal(array, expected2, ARRAY_SIZE(expected2)));
+    TEST_CHECK(darray_capacity(array) == 8);
+
+    // Вставка в середину с ростом емкости сохраняет элементы до и после позиции.
+    u32 middle[] = { 9, 9, 9 };
+    darray_insert_range(array, 3, middle, ARRAY_SIZE(middle));
+    u32 expected3[] = { 7, 8, 1, 9, 9, 9, 2, 1, 2, 3, 4 };
+    TEST_CHECK(darray_test_equal(array, expected3, ARRAY_SIZE(expected3)));
+    TEST_CHECK(darray_capacity(array) == 16);
+
+    // Пустой диапазон и позиция за концом массива не изменяют массив.
+    darray_insert_range(array, 0, source, 0);
+    log_set_level(LOG_LEVEL_FATAL);
+    darray_insert_range(array, darray_length(array) + 1, source, 1);
+    log_set_level(LOG_LEVEL_WARN);
+    TEST_CHECK(darray_test_equal(array, expected3, ARRAY_SIZE(expected3)));
+
+    darray_destroy(array);
+    return true;
+}
+
+bool test_darray_remove_swap()
+{
+    u32 source[] = { 10, 11, 12, 13, 14 };
+    u32* array = darray_create(u32);
+    TEST_CHECK(array != nullptr);
+    darray_push_n(array, source, ARRAY_SIZE(source));
+
+    // Удаленный элемент замещается последним.
+    u32 removed = 0;
+    darray_remove_swap(array, 1, &removed);
+    u32 expected0[] = { 10, 14, 12, 13 };
+    TEST_CHECK(removed == 11);
+    TEST_CHECK(darray_test_equal(array, expected0, ARRAY_SIZE(expected0)));
+
+    // Удаление последнего элемента только уменьшает длину.
+    darray_remove_swap(array, darray_length(array) - 1, &removed);
+    u32 expected1[] = { 10, 14, 12 };
+    TEST_CHECK(removed == 13);
+    TEST_CHECK(darray_test_equal(array, expected1, ARRAY_SIZE(expected1)));
+
+    // Удаление первого элемента без копирования удаленного значения.
+    darray_remove_swap(array, 0, nullptr);
+    u32 expected2[] = { 12, 14 };
+    TEST_CHECK(darray_test_equal(array, expected2, ARRAY_SIZE(expected2)));
+
+    // Позиция за концом массива не изменяет массив; единственный элемент удаляется.
+    log_set_level(LOG_LEVEL_FATAL);
+    darray_remove_swap(array, 2, &removed);
+    log_set_level(LOG_LEVEL_WARN);
+    TEST_CHECK(darray_test_equal(array, expected2, ARRAY_SIZE(expected2)));
+
+    darray_remove_swap(array, 1, &removed);
+    darray_remove_swap(array, 0, &removed);
+    TEST_CHECK(removed == 12 && darray_length(array) == 0);
+
+    darray_destroy(array);
+    return true;
+}
+
+bool test_darray_reserve_growth()
+{
+    u32* array = darray_create(u32);
+    TEST_CHECK(array != nullptr);
+
+    // Рост по множителю по умолчанию удваивает емкость при заполнении.
+    u64 capacity = darray_capacity(array);
+    for(u32 i = 0; i < 1000; ++i)
+    {
+        darray_push(array, i);
+        if(darray_capacity(array) != capacity)
+        {
+            TEST_CHECK(darray_length(array) == capacity + 1);
+            TEST_CHECK(darray_capacity(array) == capacity * DARRAY_DEFAULT_RESIZE_FACTOR / 100);
+            capacity = darray_capacity(array);
+        }
+    }
+    TEST_CHECK(capacity == 1024);
+
+    // Резервирование меньшей емкости не изменяет массив, большей - устанавливает емкость без изменения длины.
+    u32* base = array;
+    TEST_CHECK(darray_reserve(array, 10));
+    TEST_CHECK(array == base && darray_capacity(array) == 1024);
+    TEST_CHECK(darray_reserve(array, 3000));
+    TEST_CHECK(darray_capacity(array) == 3000 && darray_length(array) == 1000);
+
+    // Добавления в пределах зарезервированной емкости не перевыделяют массив.
+    base = array;
+    for(u32 i = 1000; i < 3000; ++i)
+    {
+        darray_push(array, i);
+    }
+    TEST_CHECK(array == base && darray_capacity(array) == 3000);
+    for(u32 i = 0; i < 3000; ++i)
+    {
+        TEST_CHECK(array[i] == i);
+    }
+
+    // Множитель роста задается для массива; рост не меньше одного элемента.
+    darray_set_resize_factor(array, 150);
+    darray_push(array, 3000u);
+    TEST_CHECK(darray_capacity(array) == 4500);
+
+    u32* small = darray_create_custom(u32, 5);
+    TEST_CHECK(small != nullptr);
+    darray_set_resize_factor(small, DARRAY_MIN_RESIZE_FACTOR);
+    for(u32 i = 0; i < 6; ++i)
+    {
+        darray_push(small, i);
+    }
+    TEST_CHECK(darray_capacity(small) == 6 && darray_length(small) == 6);
+    darray_push(small, 6u);
+    TEST_CHECK(darray_capacity(small) == 7);
+
+    darray_destroy(small);
+    darray_destroy(array);
+    return true;
+}
@@ -0,0 +1,119 @@
+#include "test.h"
+
+#include <core/event.h>
+#include <core/logger.h>
+
+// Количество кодов событий, на которые подписывается проверка (больше начальной емкости хранилища событий).
+#define EVENT_TEST_CODES 32
+
+// Счетчики вызовов обработчиков и код, при котором обработчик останавливает распространение события.
+typedef struct event_test_listener {
+    u32 calls[EVENT_TEST_CODES];
+    u32 stop_value;
+} event_test_listener;
+
+// Возвращает код события для i-го кода проверки (коды разбросаны по всему диапазону).
+static event_code event_test_code(u32 i)
+{
+    return (event_code)((i * 257) % EVENT_CODE_COUNT);
+}
+
+static bool event_test_handler(event_code code, void* sender, void* listener, event_context* data)
+{
+    UNUSED(code);
+    UNUSED(sender);
+    event_test_listener* test = listener;
+    test->calls[data->u32[0]]++;
+    return data->u32[1] == test->stop_value;
+}
+
+static bool event_test_register_handler(event_code code, void* sender, void* listener, event_context* data)
+{
+    UNUSED(sender);
+    UNUSED(data);
+
+    // Подписка на новые коды во время отправки перемещает хранилище событий.
+    for(u32 i = 1; i < EVENT_TEST_CODES; ++i)
+    {
+        event_register(event_test_code(i), listener, event_test_handler);
+    }
+
+    event_register(code, listener, event_test_handler);
+    return false;
+}
+
+bool test_event_register_send()
+{
+    TEST_CHECK(event_system_initialize());
+
+    event_test_listener first = { .stop_value = 1 };
+    event_test_listener second = { .stop_value = 2 };
+
+    for(u32 i = 0; i < EVENT_TEST_CODES; ++i)
+    {
+        TEST_CHECK(event_register(event_test_code(i), &first, event_test_handler));
+        TEST_CHECK(event_register(event_test_code(i), &second, event_test_handler));
+    }
+
+    // NOTE: Ожидаемые предупреждения о повторной подписке и отписке не выводятся.
+    log_set_level(LOG_LEVEL_ERROR);
+    TEST_CHECK(!event_register(event_test_code(5), &first, event_test_handler));
+    log_set_level(LOG_LEVEL_WARN);
+
+    // Слушатели вызываются в порядке подписки, пока один из них не остановит распространение.
+    for(u32 i = 0; i < EVENT_TEST_CODES; ++i)
+    {
+        event_context data = { .u32 = { i, 0 } };
+        TEST_CHECK(!event_send(event_test_code(i), nullptr, &data));
+        TEST_CHECK(first.calls[i] == 1 && second.calls[i] == 1);
+
+        data.u32[1] = 1;
+        TEST_CHECK(event_send(event_test_code(i), nullptr, &data));
+        TEST_CHECK(first.calls[i] == 2 && second.calls[i] == 1);
+    }
+
+    // Коды без подписчиков не обрабатываются.
+    event_context data = { .u32 = { 0, 0 } };
+    TEST_CHECK(!event_send((event_code)1, nullptr, &data));
+
+    log_set_level(LOG_LEVEL_ERROR);
+    TEST_CHECK(!event_unregister((event_code)1, &first, event_test_handler));
+    TEST_CHECK(event_unregister(event_test_code(3), &first, event_test_handler));
+    TEST_CHECK(!event_unregister(event_test_code(3), &first, event_test_handler));
+    log_set_level(LOG_LEVEL_WARN);
+    data.u32[0] = 3;
+    data.u32[1] = 1;
+    TEST_CHECK(!event_send(event_test_code(3), nullptr, &data));
+    TEST_CHECK(first.calls[3] == 2 && second.calls[3] == 2);
+
+    event_system_shutdown();
+    return true;
+}
+
+bool test_event_register_during_send()
+{
+    TEST_CHECK(event_system_initialize());
+
+    event_test_listener listener = { .stop_value = U32_MAX };
+    TEST_CHECK(event_register(event_test_code(0), &listener, event_test_register_handler));
+
+    // Слушатели, подписанные во время отправки, не вызываются в ней.
+    event_context data = { .u32 = { 0, 0 } };
+    TEST_CHECK(!event_send(event_test_code(0), nullptr, &data));
+    TEST_CHECK(listener.calls[0] == 0);
+
+    log_set_level(LOG_LEVEL_ERROR);
+    TEST_CHECK(!event_send(event_test_code(0), nullptr, &data));
+    log_set_level(LOG_LEVEL_WARN);
+    TEST_CHECK(listener.calls[0] == 1);
+
+    for(u32 i = 1; i < EVENT_TEST_CODES; ++i)
+    {
+        data.u32[0] = i;
+        TEST_CHECK(!event_send(event_test_code(i), nullptr, &data));
+        TEST_CHECK(listener.calls[i] == 1);
+    }
+
+    event_system_shutdown();
+    return true;
+}
@@ -0,0 +1,174 @@
+#include "test.h"
+
+#include <core/containers/hashmap.h>
+
+// Количество ключей в проверках (таблица несколько раз увеличивается).
+#define HASHMAP_TEST_KEYS 10000
+// Количество одновременно хранимых ключей при чередовании вставок и удалений.
+#define HASHMAP_TEST_CHURN_WINDOW 24
+// Количество вставок при чередовании вставок и удалений.
+#define HASHMAP_TEST_CHURN_STEPS 100000
+
+// Возвращает ключ для i-го элемента проверки (ключи не идут подряд).
+static u64 hashmap_test_key(u64 i)
+{
+    return i * 0x9E3779B97F4A7C15ULL + 1;
+}
+
+bool test_hashmap_insert_get_remove()
+{
+    hash_map map;
+    TEST_CHECK(hashmap_create(map, u64, u64));
+    TEST_CHECK(hashmap_length(map) == 0);
+    TEST_CHECK(!hashmap_contains(map, hashmap_test_key(0)));
+
+    for(u64 i = 0; i < HASHMAP_TEST_KEYS; ++i)
+    {
+        TEST_CHECK(hashmap_insert(map, hashmap_test_key(i), i));
+    }
+    TEST_CHECK(hashmap_length(map) == HASHMAP_TEST_KEYS);
+
+    for(u64 i = 0; i < HASHMAP_TEST_KEYS; ++i)
+    {
+        u64* value = hashmap_get(map, hashmap_test_key(i));
+        TEST_CHECK(value != nullptr && *value == i);
+    }
+    TEST_CHECK(!hashmap_contains(map, hashmap_test_key(HASHMAP_TEST_KEYS)));
+
+    // Повторная вставка заменяет значение без добавления пары.
+    TEST_CHECK(hashmap_insert(map, hashmap_test_key(7), 700ULL));
+    TEST_CHECK(hashmap_length(map) == HASHMAP_TEST_KEYS);
+    TEST_CHECK(*(u64*)hashmap_get(map, hashmap_test_key(7)) == 700);
+
+    // Удаление нечетных ключей возвращает их значения.
+    for(u64 i = 1; i < HASHMAP_TEST_KEYS; i += 2)
+    {
+        u64 value = 0;
+        TEST_CHECK(hashmap_remove(map, hashmap_test_key(i), &value));
+        TEST_CHECK(value == (i == 7 ? 700 : i));
+        TEST_CHECK(!hashmap_remove(map, hashmap_test_key(i), nullptr));
+    }
+    TEST_CHECK(hashmap_length(map) == HASHMAP_TEST_KEYS / 2);
+
+    for(u64 i = 0; i < HASHMAP_TEST_KEYS; ++i)
+    {
+        TEST_CHECK(hashmap_contains(map, hashmap_test_key(i)) == (i % 2 == 0));
+    }
+
+    // Обход посещает каждую оставшуюся пару один раз.
+    u64 count = 0;
+    u64 sum = 0;
+    u64* key = nullptr;
+    u64* value = nullptr;
+    hashmap_foreach(map, key, value)
+    {
+        TEST_CHECK(*key == hashmap_test_key(*value));
+        sum += *value;
+        count++;
+    }
+    TEST_CHECK(count == HASHMAP_TEST_KEYS / 2);
+    TEST_CHECK(sum == (u64)(HASHMAP_TEST_KEYS / 2) * (HASHMAP_TEST_KEYS / 2 - 1));
+
+    // Очистка сохраняет память таблицы.
+    u64 capacity = map.capacity;
+    hashmap_clear(map);
+    TEST_CHECK(hashmap_length(map) == 0 && map.capacity == capacity);
+    TEST_CHECK(!hashmap_contains(map, hashmap_test_key(0)));
+    TEST_CHECK(hashmap_insert(map, hashmap_test_key(0), 1ULL));
+    TEST_CHECK(*(u64*)hashmap_get(map, hashmap_test_key(0)) == 1);
+
+    hashmap_destroy(map);
+    return true;
+}
+
+bool test_hashmap_emplace()
+{
+    hash_map map;
+    TEST_CHECK(hashmap_create_custom(map, u32, u32, 0, nullptr, nullptr));
+    TEST_CHECK(map.capacity == 0);
+
+    // Новая пара получает обнуленное значение, существующая возвращается без изменений.
+    bool inserted = false;
+    u32 key = 42;
+    u32* value = hash_map_emplace(&map, &key, &inserted);
+    TEST_CHECK(value != nullptr && inserted && *value == 0);
+    *value = 5;
+
+    value = hash_map_emplace(&map, &key, &inserted);
+    TEST_CHECK(value != nullptr && !inserted && *value == 5);
+    TEST_CHECK(hashmap_length(map) == 1);
+
+    // Значение nullptr при вставке обнуляет значение пары.
+    key = 43;
+    TEST_CHECK(hash_map_insert(&map, &key, nullptr));
+    TEST_CHECK(*(u32*)hashmap_get(map, 43u) == 0);
+
+    // Резервирование выделяет место сразу под все пары.
+    TEST_CHECK(hashmap_reserve(map, 1000));
+    u64 capacity = map.capacity;
+    for(u32 i = 0; i < 1000; ++i)
+    {
+        TEST_CHECK(hashmap_insert(map, i + 100, i));
+    }
+    TEST_CHECK(map.capacity == capacity);
+
+    hashmap_destroy(map);
+    return true;
+}
+
+bool test_hashmap_string_keys()
+{
+    hash_map map;
+    TEST_CHECK(hashmap_create_custom(map, const char*, u32, 4, hash_map_hash_string, hash_map_equal_string));
+
+    TEST_CHECK(hashmap_insert(map, (const char*)"alpha", 1u));
+    TEST_CHECK(hashmap_insert(map, (const char*)"beta", 2u));
+
+    // Ключи сравниваются по содержимому строк, а не по указателям.
+    char buffer[] = "alpha";
+    const char* key = buffer;
+    u32* value = hashmap_get(map, key);
+    TEST_CHECK(value != nullptr && *value == 1);
+    TEST_CHECK(!hashmap_contains(map, (const char*)"gamma"));
+
+    TEST_CHECK(hashmap_insert(map, key, 10u));
+    TEST_CHECK(hashmap_length(map) == 2);
+    TEST_CHECK(*(u32*)hashmap_get(map, (const char*)"alpha") == 10);
+
+    TEST_CHECK(hashmap_remove(map, (const char*)"beta", nullptr));
+    TEST_CHECK(!hashmap_contains(map, (const char*)"beta"));
+
+    hashmap_destroy(map);
+    return true;
+}
+
+bool test_hashmap_churn()
+{
+    hash_map map;
+    TEST_CHECK(hash_map_create(sizeof(u64), 0, HASHMAP_TEST_CHURN_WINDOW * 2, nullptr, nullptr, &map));
+    u64 capacity = map.capacity;
+
+    // Удаленные ячейки переиспользуются перестроением на месте, таблица не растет.
+    for(u64 i = 0; i < HASHMAP_TEST_CHURN_STEPS; ++i)
+    {
+        u64 key = hashmap_test_key(i);
+        TEST_CHECK(hash_map_insert(&map, &key, nullptr));
+
+        if(i >= HASHMAP_TEST_CHURN_WINDOW)
+        {
+            key = hashmap_test_key(i - HASHMAP_TEST_CHURN_WINDOW);
+            TEST_CHECK(hash_map_remove(&map, &key, nullptr));
+        }
+    }
+    TEST_CHECK(hashmap_length(map) == HASHMAP_TEST_CHURN_WINDOW);
+    TEST_CHECK(map.capacity == capacity);
+
+    for(u64 i = 0; i < HASHMAP_TEST_CHURN_STEPS; ++i)
+    {
+        u64 key = hashmap_test_key(i);
+        TEST_CHECK((hash_map_get(&map, &key) != nullptr) == (i >= HASHMAP_TEST_CHURN_STEPS - HASHMAP_TEST_CHURN_WINDOW));
+    }
+
+    hashmap_destroy(map);
+    return true;
+}
@@ -0,0 +1,396 @@
+#include "test.h"
+
+#include <core/job.h>
+#include <core/memory.h>
+#include <core/parallel.h>
+#include <platform/thread.h>
+
+// Количество рабочих потоков в проверках с несколькими потоками.
+#define JOB_TEST_WORKERS 4
+// Количество дочерних задач каждой задачи дерева.
+#define JOB_TEST_BRANCH 6
+// Глубина дерева вложенных ожиданий.
+#define JOB_TEST_DEPTH 3
+// Количество повторов проверок с вложенными ожиданиями.
+#define JOB_TEST_ROUNDS 20
+// Размеры внешнего и вложенного диапазонов вложенного parallel_for.
+#define JOB_TEST_OUTER 48
+#define JOB_TEST_INNER 300
+// Количество задач пакета в проверке забора задач (меньше емкости деки, чтобы задачи не выполнялись сразу).
+#define JOB_TEST_STEAL_JOBS 4000
+// Количество повторов с пакетами из нескольких задач (соревнование за последнюю задачу деки).
+#define JOB_TEST_STEAL_ROUNDS 2000
+// Количество задач, ожидающих один счетчик.
+#define JOB_TEST_WAITERS 8
+
+// Конфигурации системы задач для проверок режима волокон: один и несколько рабочих потоков,
+// минимальный пул волокон (fiber_count повышается до количества рабочих потоков + 1).
+static const job_system_config job_test_fiber_configs[] = {
+    { .worker_count = 1,                .fiber_count = 1 },
+    { .worker_count = JOB_TEST_WORKERS, .fiber_count = 1 },
+};
+
+typedef struct job_test_shared {
+    // Количество выполненных листовых задач.
+    u32 leaves;
+    // Количество задач, продолживших выполнение до завершения дочерних задач.
+    u32 failures;
+} job_test_shared;
+
+typedef struct job_test_node {
+    job_test_shared* shared;
+    // Количество завершенных дочерних задач (увеличивается дочерними задачами).
+    u32* parent_done;
+    // Глубина задачи в дереве (0 - листовая задача).
+    u32 depth;
+} job_test_node;
+
+// Задача дерева: запускает дочерние задачи и ожидает их (на волокне - с приостановкой задачи).
+static void job_test_tree(void* data)
+{
+    job_test_node* node = data;
+
+    if(node->depth > 0)
+    {
+        u32 done = 0;
+        job_test_node children[JOB_TEST_BRANCH];
+        job_decl jobs[JOB_TEST_BRANCH];
+        for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+        {
+            children[i] = (job_test_node){ .shared = node->shared, .parent_done = &done, .depth = node->depth - 1 };
+            jobs[i] = (job_decl){ .func = job_test_tree, .data = &children[i] };
+        }
+
+        job_counter counter = { 0 };
+        job_run(jobs, JOB_TEST_BRANCH, &counter);
+        job_wait(&counter);
+
+        // Ожидание завершается только после выполнения всех дочерних задач.
+        if(platform_atomic_load_u32(&done, PLATFORM_MEMORY_ORDER_ACQUIRE) != JOB_TEST_BRANCH)
+        {
+            platform_atomic_fetch_add_u32(&node->shared->failures, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+        }
+    }
+    else
+    {
+        platform_atomic_fetch_add_u32(&node->shared->leaves, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+
+    if(node->parent_done)
+    {
+        platform_atomic_fetch_add_u32(node->parent_done, 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    }
+}
+
+static void job_test_parallel_inner(u64 begin, u64 end, void* user)
+{
+    u32* cells = user;
+    for(u64 i = begin; i < end; ++i)
+    {
+        platform_atomic_fetch_add_u32(&cells[i], 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+// Пакет внешнего диапазона: каждая строка обрабатывается вложенным parallel_for (ожидание внутри задачи).
+static void job_test_parallel_outer(u64 begin, u64 end, void* user)
+{
+    u32* cells = user;
+    for(u64 i = begin; i < end; ++i)
+    {
+        parallel_for(JOB_TEST_INNER, 1, job_test_parallel_inner, &cells[i * JOB_TEST_INNER]);
+    }
+}
+
+// Задача отмечает свою ячейку: повторное выполнение или потеря задачи видны по значению ячейки.
+static void job_test_mark(void* data)
+{
+    platform_atomic_fetch_add_u32(data, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+}
+
+// Задача рабочего потока запускает пакет задач в собственную деку, пока остальные потоки их забирают.
+static void job_test_spawn(void* data)
+{
+    u32* cells = data;
+    job_decl jobs[JOB_TEST_BRANCH];
+    for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+    {
+        jobs[i] = (job_decl){ .func = job_test_mark, .data = &cells[i] };
+    }
+
+    job_counter counter = { 0 };
+    job_run(jobs, JOB_TEST_BRANCH, &counter);
+    job_wait(&counter);
+}
+
+// Поток вне системы задач: задачи попадают в общую очередь.
+static u32 job_test_external_run(void* data)
+{
+    u32* cells = data;
+    job_decl jobs[JOB_TEST_BRANCH];
+    for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+    {
+        jobs[i] = (job_decl){ .func = job_test_mark, .data = &cells[i] };
+    }
+
+    job_counter counter = { 0 };
+    for(u32 r = 0; r < JOB_TEST_ROUNDS; ++r)
+    {
+        job_run(jobs, JOB_TEST_BRANCH, &counter);
+        job_wait(&counter);
+    }
+
+    return job_system_thread_index() == U32_MAX && job_counter_done(&counter) ? 0 : 1;
+}
+
+typedef struct job_test_gate {
+    // Признак разрешения завершить задачу.
+    u32 open;
+    // Счетчик, который ожидают задачи.
+    job_counter* counter;
+    // Количество задач, увидевших обнуленный счетчик после ожидания.
+    u32 done;
+} job_test_gate;
+
+// Задача завершается только после разрешения основного потока.
+static void job_test_gate_job(void* data)
+{
+    job_test_gate* gate = data;
+    while(!platform_atomic_load_u32(&gate->open, PLATFORM_MEMORY_ORDER_ACQUIRE))
+    {
+        platform_thread_yield();
+    }
+}
+
+// Задача ожидает общий счетчик (в рабочем потоке без волокон - со сном на счетчике).
+static void job_test_waiter(void* data)
+{
+    job_test_gate* gate = data;
+    job_wait(gate->counter);
+    if(job_counter_done(gate->counter))
+    {
+        platform_atomic_fetch_add_u32(&gate->done, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+// Проверяет, что каждая ячейка отмечена ровно один раз, и обнуляет ячейки.
+static bool job_test_marked_once(u32* cells, u32 count)
+{
+    bool valid = true;
+    for(u32 i = 0; i < count; ++i)
+    {
+        valid = valid && cells[i] == 1;
+        cells[i] = 0;
+    }
+    return valid;
+}
+
+// Ожидает счетчик в основном потоке, не выполняя задач: задачи выполняются только рабочими потоками на волокнах.
+static void job_test_wait_workers(job_counter* counter)
+{
+    while(!job_counter_done(counter))
+    {
+        platform_thread_yield();
+    }
+}
+
+static void job_test_parallel_run(void* data)
+{
+    parallel_for(JOB_TEST_OUTER, 1, job_test_parallel_outer, data);
+}
+
+bool test_job_fiber_nested_wait()
+{
+    u32 leaves = 1;
+    for(u32 i = 0; i < JOB_TEST_DEPTH; ++i)
+    {
+        leaves *= JOB_TEST_BRANCH;
+    }
+
+    for(u32 c = 0; c < ARRAY_SIZE(job_test_fiber_configs); ++c)
+    {
+        TEST_CHECK(job_system_initialize(&job_test_fiber_configs[c]));
+        bool valid = job_system_worker_count() == job_test_fiber_configs[c].worker_count;
+
+        // Корни дерева запускаются несколькими задачами, чтобы ожидающих задач было больше, чем волокон.
+        for(u32 r = 0; r < JOB_TEST_ROUNDS && valid; ++r)
+        {
+            job_test_shared shared = { 0 };
+            job_test_node roots[JOB_TEST_BRANCH];
+            job_decl jobs[JOB_TEST_BRANCH];
+            for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+            {
+                roots[i] = (job_test_node){ .shared = &shared, .depth = JOB_TEST_DEPTH };
+                jobs[i] = (job_decl){ .func = job_test_tree, .data = &roots[i] };
+            }
+
+            job_counter counter = { 0 };
+            job_run(jobs, JOB_TEST_BRANCH, &counter);
+            job_test_wait_workers(&counter);
+
+            valid = job_counter_done(&counter) && shared.failures == 0 && shared.leaves == leaves * JOB_TEST_BRANCH;
+        }
+
+        job_system_shutdown();
+        TEST_CHECK(valid);
+    }
+
+    return true;
+}
+
+bool test_job_fiber_nested_parallel_for()
+{
+    u64 size = sizeof(u32) * JOB_TEST_OUTER * JOB_TEST_INNER;
+    u32* cells = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(cells != nullptr);
+
+    for(u32 c = 0; c < ARRAY_SIZE(job_test_fiber_configs); ++c)
+    {
+        TEST_CHECK(job_system_initialize(&job_test_fiber_configs[c]));
+
+        // Каждый индекс вложенных диапазонов обрабатывается ровно один раз.
+        bool valid = true;
+        for(u32 r = 0; r < JOB_TEST_ROUNDS && valid; ++r)
+        {
+            mzero(cells, size);
+            job_counter counter = { 0 };
+            job_run_single(job_test_parallel_run, cells, &counter);
+            job_test_wait_workers(&counter);
+            for(u32 i = 0; i < JOB_TEST_OUTER * JOB_TEST_INNER; ++i)
+            {
+                valid = valid && cells[i] == 1;
+            }
+        }
+
+        job_system_shutdown();
+        TEST_CHECK(valid);
+    }
+
+    memory_free(cells, size, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_job_steal_contention()
+{
+    u64 size = sizeof(u32) * JOB_TEST_STEAL_JOBS;
+    u32* cells = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+    job_decl* jobs = memory_allocate(sizeof(job_decl) * JOB_TEST_STEAL_JOBS, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(cells != nullptr && jobs != nullptr);
+    mzero(cells, size);
+
+    job_system_config config = { .worker_count = JOB_TEST_WORKERS };
+    TEST_CHECK(job_system_initialize(&config));
+    bool valid = true;
+
+    // Основной поток извлекает задачи из своей деки с одного конца, рабочие потоки забирают с другого.
+    for(u32 i = 0; i < JOB_TEST_STEAL_JOBS; ++i)
+    {
+        jobs[i] = (job_decl){ .func = job_test_mark, .data = &cells[i] };
+    }
+    for(u32 r = 0; r < JOB_TEST_ROUNDS && valid; ++r)
+    {
+        job_counter counter = { 0 };
+        job_run(jobs, JOB_TEST_STEAL_JOBS, &counter);
+        job_wait(&counter);
+        valid = job_counter_done(&counter) && job_test_marked_once(cells, JOB_TEST_STEAL_JOBS);
+    }
+
+    // Пакеты из нескольких задач: владелец и забирающие потоки соревнуются за последнюю задачу деки.
+    for(u32 r = 0; r < JOB_TEST_STEAL_ROUNDS && valid; ++r)
+    {
+        u32 count = r % 3 + 1;
+        job_counter counter = { 0 };
+        job_run(jobs, count, &counter);
+        job_wait(&counter);
+        valid = job_counter_done(&counter) && job_test_marked_once(cells, count);
+    }
+
+    // Задачи добавляются в деки рабочих потоков и в общую очередь из потока вне системы.
+    platform_thread thread;
+    u32 external = 1;
+    u32* external_cells = &cells[JOB_TEST_STEAL_JOBS - JOB_TEST_BRANCH];
+    bool created = valid && platform_thread_create(job_test_external_run, external_cells, "job_test", &thread);
+    for(u32 r = 0; r < JOB_TEST_ROUNDS && valid; ++r)
+    {
+        for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+        {
+            jobs[i] = (job_decl){ .func = job_test_spawn, .data = &cells[i * JOB_TEST_BRANCH] };
+        }
+
+        job_counter counter = { 0 };
+        job_run(jobs, JOB_TEST_BRANCH, &counter);
+        job_wait(&counter);
+        valid = job_counter_done(&counter) && job_test_marked_once(cells, JOB_TEST_BRANCH * JOB_TEST_BRANCH);
+    }
+    if(created)
+    {
+        platform_thread_join(&thread, &external);
+    }
+
+    job_system_shutdown();
+    TEST_CHECK(valid && created);
+    TEST_CHECK(external == 0);
+    for(u32 i = 0; i < JOB_TEST_BRANCH; ++i)
+    {
+        TEST_CHECK(external_cells[i] == JOB_TEST_ROUNDS);
+    }
+
+    memory_free(jobs, sizeof(job_decl) * JOB_TEST_STEAL_JOBS, MEMORY_TAG_UNKNOWN);
+    memory_free(cells, size, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_job_counters()
+{
+    // Без рабочих потоков (один процессор) задачи выполняются сразу при запуске.
+    u32 cell = 0;
+    job_counter counter = { 0 };
+    if(platform_processor_count() == 1)
+    {
+        TEST_CHECK(job_system_initialize(nullptr));
+        job_run_single(job_test_mark, &cell, &counter);
+        bool immediate = job_system_worker_count() == 0 && job_counter_done(&counter) && cell == 1;
+        job_system_shutdown();
+        TEST_CHECK(immediate);
+        cell = 0;
+    }
+
+    job_system_config config = { .worker_count = JOB_TEST_WORKERS };
+    TEST_CHECK(job_system_initialize(&config));
+
+    // Пустой пакет не изменяет счетчик, пакеты нескольких вызовов накапливаются в одном счетчике.
+    job_test_gate gate = { .counter = &counter };
+    job_run(nullptr, 0, &counter);
+    bool empty = job_counter_done(&counter);
+    job_run_single(job_test_gate_job, &gate, &counter);
+    job_run_single(job_test_mark, &cell, &counter);
+    job_run_single(job_test_mark, &cell, nullptr);
+
+    // Задача не завершена, пока ее не отпустит основной поток (основной поток задачи не выполняет).
+    bool pending = !job_counter_done(&counter);
+
+    // Несколько задач рабочих потоков ожидают один счетчик.
+    job_counter waiters = { 0 };
+    for(u32 i = 0; i < JOB_TEST_WAITERS; ++i)
+    {
+        job_run_single(job_test_waiter, &gate, &waiters);
+    }
+
+    platform_atomic_store_u32(&gate.open, 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    job_wait(&waiters);
+    bool released = job_counter_done(&counter) && gate.done == JOB_TEST_WAITERS;
+
+    // Задача основного потока уменьшает счетчик только при обработке очереди основного потока.
+    job_counter main_counter = { 0 };
+    job_run_main(job_test_mark, &cell, &main_counter);
+    bool main_pending = !job_counter_done(&main_counter);
+    job_system_main_update();
+    bool main_done = job_counter_done(&main_counter);
+
+    job_system_shutdown();
+    TEST_CHECK(empty && pending);
+    TEST_CHECK(released);
+    TEST_CHECK(main_pending && main_done);
+    TEST_CHECK(cell == 3);
+
+    return true;
+}
@@ -0,0 +1,191 @@
+#include "test.h"
+
+#include <core/containers/list.h>
+
+typedef struct list_test_item {
+    u32 value;
+    list_node node;
+} list_test_item;
+
+// Проверяет, что значения узлов списка совпадают с ожидаемыми в прямом и обратном порядке.
+static bool list_test_equals(const list_node* head, const u32* values, u32 count)
+{
+    u32 index = 0;
+    list_foreach(head, node)
+    {
+        if(index >= count || list_entry(node, list_test_item, node)->value != values[index])
+        {
+            return false;
+        }
+        index++;
+    }
+
+    if(index != count)
+    {
+        return false;
+    }
+
+    list_foreach_reverse(head, node)
+    {
+        if(list_entry(node, list_test_item, node)->value != values[--index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Инициализирует элементы значениями по порядку.
+static void list_test_items_init(list_test_item* items, u32 count)
+{
+    for(u32 i = 0; i < count; ++i)
+    {
+        items[i].value = i;
+        list_init(&items[i].node);
+    }
+}
+
+bool test_list_insert_remove()
+{
+    list_node head;
+    list_init(&head);
+    list_test_item items[6];
+    list_test_items_init(items, ARRAY_SIZE(items));
+
+    TEST_CHECK(list_empty(&head));
+    TEST_CHECK(list_front(&head) == nullptr && list_back(&head) == nullptr);
+    TEST_CHECK(list_pop_front(&head) == nullptr && list_pop_back(&head) == nullptr);
+    TEST_CHECK(!list_linked(&items[0].node));
+
+    list_push_back(&head, &items[1].node);
+    list_push_front(&head, &items[0].node);
+    list_push_back(&head, &items[3].node);
+    list_insert_before(&items[3].node, &items[2].node);
+    list_insert_after(&items[3].node, &items[4].node);
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 0, 1, 2, 3, 4 }, 5));
+    TEST_CHECK(list_front(&head) == &items[0].node && list_back(&head) == &items[4].node);
+    TEST_CHECK(list_linked(&items[2].node));
+
+    // Удаление из середины, начала и конца.
+    list_remove(&items[2].node);
+    TEST_CHECK(!list_linked(&items[2].node));
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 0, 1, 3, 4 }, 4));
+    TEST_CHECK(list_pop_front(&head) == &items[0].node);
+    TEST_CHECK(list_pop_back(&head) == &items[4].node);
+    TEST_CHECK(!list_linked(&items[0].node) && !list_linked(&items[4].node));
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 1, 3 }, 2));
+
+    // Перемещение внутри списка и из другого списка.
+    list_move_front(&head, &items[3].node);
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 3, 1 }, 2));
+    list_move_back(&head, &items[3].node);
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 1, 3 }, 2));
+
+    list_node other;
+    list_init(&other);
+    list_push_back(&other, &items[5].node);
+    list_move_front(&head, &items[5].node);
+    TEST_CHECK(list_empty(&other));
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 5, 1, 3 }, 3));
+
+    // Удаление последнего узла оставляет пустой список.
+    list_remove(&items[5].node);
+    list_remove(&items[1].node);
+    list_remove(&items[3].node);
+    TEST_CHECK(list_empty(&head));
+    TEST_CHECK(head.next == &head && head.prev == &head);
+
+    return true;
+}
+
+bool test_list_splice()
+{
+    list_node head;
+    list_node source;
+    list_init(&head);
+    list_init(&source);
+    list_test_item items[5];
+    list_test_items_init(items, ARRAY_SIZE(items));
+
+    // Пустой источник не изменяет список.
+    list_push_back(&head, &items[0].node);
+    list_splice_back(&head, &source);
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 0 }, 1));
+    TEST_CHECK(list_empty(&source));
+
+    // Узлы источника добавляются в конец с сохранением порядка, источник становится пустым.
+    for(u32 i = 1; i < ARRAY_SIZE(items); ++i)
+    {
+        list_push_back(&source, &items[i].node);
+    }
+    list_splice_back(&head, &source);
+    TEST_CHECK(list_empty(&source));
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 0, 1, 2, 3, 4 }, 5));
+
+    // Перенос в пустой список.
+    list_node target;
+    list_init(&target);
+    list_splice_back(&target, &head);
+    TEST_CHECK(list_empty(&head));
+    TEST_CHECK(list_test_equals(&target, (u32[]){ 0, 1, 2, 3, 4 }, 5));
+
+    // Источник пригоден для повторного использования.
+    list_remove(&items[4].node);
+    list_push_back(&head, &items[4].node);
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 4 }, 1));
+
+    return true;
+}
+
+bool test_list_foreach_safe()
+{
+    list_node head;
+    list_node removed;
+    list_init(&head);
+    list_init(&removed);
+    list_test_item items[8];
+    list_test_items_init(items, ARRAY_SIZE(items));
+
+    for(u32 i = 0; i < ARRAY_SIZE(items); ++i)
+    {
+        list_push_back(&head, &items[i].node);
+    }
+
+    // Удаление и перенос текущего узла в другой список во время обхода.
+    u32 visited = 0;
+    list_foreach_safe(&head, node)
+    {
+        list_test_item* item = list_entry(node, list_test_item, node);
+        TEST_CHECK(item->value == visited);
+        visited++;
+
+        if(item->value % 2 == 0)
+        {
+            list_remove(node);
+        }
+        else if(item->value % 3 == 0)
+        {
+            list_move_back(&removed, node);
+        }
+    }
+
+    TEST_CHECK(visited == ARRAY_SIZE(items));
+    TEST_CHECK(list_test_equals(&head, (u32[]){ 1, 5, 7 }, 3));
+    TEST_CHECK(list_test_equals(&removed, (u32[]){ 3 }, 1));
+
+    // Удаление всех узлов.
+    list_foreach_safe(&head, node)
+    {
+        list_remove(node);
+    }
+    TEST_CHECK(list_empty(&head));
+
+    // Обход пустого списка.
+    list_foreach_safe(&head, node)
+    {
+        TEST_CHECK(false);
+    }
+
+    return true;
+}
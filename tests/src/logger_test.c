@@ -0,0 +1,57 @@
+#include "test.h"
+
+#include <core/logger.h>
+#include <platform/memory.h>
+
+// Размер буфера перехваченного сообщения.
+#define LOGGER_TEST_BUFFER_SIZE 256
+
+typedef struct logger_test_capture {
+    // Текст последнего перехваченного сообщения.
+    char message[LOGGER_TEST_BUFFER_SIZE];
+    // Длина последнего перехваченного сообщения.
+    u32 length;
+    // Количество перехваченных сообщений.
+    u32 count;
+} logger_test_capture;
+
+static void logger_test_handler(const log_message_t* message)
+{
+    // NOTE: Платформенный слой памяти может быть не инициализирован, поэтому копирование без mcopy.
+    logger_test_capture* capture = (logger_test_capture*)message->user_data;
+    u32 length = MIN(message->message_length, LOGGER_TEST_BUFFER_SIZE - 1);
+    __builtin_memcpy(capture->message, message->message, length);
+    capture->message[length] = '\0';
+    capture->length = message->message_length;
+    capture->count++;
+}
+
+// Сравнивает перехваченное сообщение с ожидаемой строкой.
+static bool logger_test_equal(const logger_test_capture* capture, const char* expected)
+{
+    u32 length = (u32)__builtin_strlen(expected);
+    return capture->length == length && __builtin_memcmp(capture->message, expected, length) == 0;
+}
+
+bool test_logger_without_memory()
+{
+    logger_test_capture capture = { 0 };
+    log_set_handler(logger_test_handler, &capture);
+
+    // Состояние до инициализации и после завершения подсистемы памяти: форматирование (в том числе
+    // выравнивание по ширине и вещественные числа) не обращается к платформенному слою памяти.
+    // NOTE: Проверки выполняются после повторной инициализации, чтобы не выйти из проверки без памяти.
+    platform_memory_shutdown();
+    LOG_WARN("memory: %d %5s|%-4u|%08.3f|%x", -42, "ab", 7u, 3.14159, 0xBEEFu);
+    bool formatted = logger_test_equal(&capture, "memory: -42    ab|7   |0003.142|beef");
+    LOG_INFO("filtered");
+    bool reinitialized = platform_memory_initialize();
+    log_reset_default_handler();
+
+    TEST_CHECK(reinitialized);
+    TEST_CHECK(formatted);
+    // Сообщения ниже установленного уровня не передаются обработчику.
+    TEST_CHECK(capture.count == 1);
+
+    return true;
+}
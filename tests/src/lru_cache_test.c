@@ -0,0 +1,220 @@
+#include "test.h"
+
+#include <core/containers/lru_cache.h>
+#include <core/memory.h>
+
+// Записывает ключи и значения вытесненных пар.
+typedef struct lru_cache_test_log {
+    u32 count;
+    u64 keys[16];
+    u64 values[16];
+} lru_cache_test_log;
+
+static void lru_cache_test_evict(const void* key, void* value, void* user)
+{
+    lru_cache_test_log* log = user;
+    if(log->count < ARRAY_SIZE(log->keys))
+    {
+        log->keys[log->count] = *(const u64*)key;
+        log->values[log->count] = *(u64*)value;
+    }
+    log->count++;
+}
+
+// Проверяет порядок пар от давно неиспользуемой к недавно использованной без изменения порядка.
+static bool lru_cache_test_order(lru_cache* cache, const u64* keys, u32 count)
+{
+    if(lrucache_length(*cache) != count)
+    {
+        return false;
+    }
+
+    // Запись начинается с узла списка, за ним следует ключ (см. lru_cache.c).
+    u32 index = 0;
+    list_foreach_reverse(&cache->order, node)
+    {
+        if(*(u64*)((u8*)node + sizeof(list_node)) != keys[index++])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool test_lru_cache_put_get()
+{
+    lru_cache cache;
+    TEST_CHECK(lrucache_create(cache, u64, u64, 4, nullptr, nullptr));
+    TEST_CHECK(lrucache_length(cache) == 0);
+    TEST_CHECK(lrucache_get(cache, 1ULL) == nullptr);
+    TEST_CHECK(!lru_cache_oldest(&cache, nullptr, nullptr));
+
+    for(u64 key = 1; key <= 4; ++key)
+    {
+        u64* value = lrucache_put(cache, key, key * 10);
+        TEST_CHECK(value != nullptr && *value == key * 10);
+    }
+    TEST_CHECK(lrucache_length(cache) == 4);
+
+    for(u64 key = 1; key <= 4; ++key)
+    {
+        u64* value = lrucache_get(cache, key);
+        TEST_CHECK(value != nullptr && *value == key * 10);
+    }
+    TEST_CHECK(lrucache_get(cache, 5ULL) == nullptr);
+
+    // Значение можно изменить через указатель, nullptr при вставке обнуляет значение.
+    *(u64*)lrucache_get(cache, 2ULL) = 200;
+    TEST_CHECK(*(u64*)lrucache_peek(cache, 2ULL) == 200);
+
+    u64 key = 3;
+    u64* zeroed = lru_cache_put(&cache, &key, nullptr);
+    TEST_CHECK(zeroed != nullptr && *zeroed == 0);
+
+    lrucache_clear(cache);
+    TEST_CHECK(lrucache_length(cache) == 0);
+    TEST_CHECK(lrucache_get(cache, 1ULL) == nullptr);
+    TEST_CHECK(lrucache_put(cache, 9ULL, 90ULL) != nullptr);
+    TEST_CHECK(*(u64*)lrucache_get(cache, 9ULL) == 90);
+
+    lrucache_destroy(cache);
+    return true;
+}
+
+bool test_lru_cache_evict_order()
+{
+    lru_cache_test_log log = { 0 };
+    lru_cache cache;
+    TEST_CHECK(lrucache_create(cache, u64, u64, 3, lru_cache_test_evict, &log));
+
+    lrucache_put(cache, 1ULL, 10ULL);
+    lrucache_put(cache, 2ULL, 20ULL);
+    lrucache_put(cache, 3ULL, 30ULL);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 1, 2, 3 }, 3));
+
+    // Получение отмечает пару как недавно использованную, просмотр порядок не меняет.
+    lrucache_get(cache, 1ULL);
+    lrucache_peek(cache, 2ULL);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 2, 3, 1 }, 3));
+
+    void* oldest_key = nullptr;
+    void* oldest_value = nullptr;
+    TEST_CHECK(lru_cache_oldest(&cache, &oldest_key, &oldest_value));
+    TEST_CHECK(*(u64*)oldest_key == 2 && *(u64*)oldest_value == 20);
+
+    // Вытесняется давно неиспользуемая пара, функция обратного вызова получает ее ключ и значение.
+    lrucache_put(cache, 4ULL, 40ULL);
+    TEST_CHECK(log.count == 1 && log.keys[0] == 2 && log.values[0] == 20);
+    TEST_CHECK(lrucache_peek(cache, 2ULL) == nullptr);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 3, 1, 4 }, 3));
+
+    lrucache_put(cache, 5ULL, 50ULL);
+    lrucache_put(cache, 6ULL, 60ULL);
+    TEST_CHECK(log.count == 3 && log.keys[1] == 3 && log.keys[2] == 1);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 4, 5, 6 }, 3));
+
+    // При уничтожении функция вызывается для оставшихся пар.
+    lrucache_destroy(cache);
+    TEST_CHECK(log.count == 6);
+
+    return true;
+}
+
+bool test_lru_cache_replace_evicts()
+{
+    lru_cache_test_log log = { 0 };
+    lru_cache cache;
+    TEST_CHECK(lrucache_create(cache, u64, u64, 2, lru_cache_test_evict, &log));
+
+    lrucache_put(cache, 1ULL, 10ULL);
+    lrucache_put(cache, 2ULL, 20ULL);
+
+    // Замена значения вызывает функцию для прежнего значения и не вытесняет другие пары.
+    u64* value = lrucache_put(cache, 1ULL, 11ULL);
+    TEST_CHECK(value != nullptr && *value == 11);
+    TEST_CHECK(log.count == 1 && log.keys[0] == 1 && log.values[0] == 10);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 2, 1 }, 2));
+    TEST_CHECK(*(u64*)lrucache_peek(cache, 2ULL) == 20);
+
+    // Замена отмечает пару как недавно использованную: следующей вытесняется другая пара.
+    lrucache_put(cache, 3ULL, 30ULL);
+    TEST_CHECK(log.count == 2 && log.keys[1] == 2 && log.values[1] == 20);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 1, 3 }, 2));
+
+    lrucache_destroy(cache);
+    return true;
+}
+
+bool test_lru_cache_remove()
+{
+    lru_cache_test_log log = { 0 };
+    lru_cache cache;
+    TEST_CHECK(lrucache_create(cache, u64, u64, 3, lru_cache_test_evict, &log));
+
+    lrucache_put(cache, 1ULL, 10ULL);
+    lrucache_put(cache, 2ULL, 20ULL);
+    lrucache_put(cache, 3ULL, 30ULL);
+
+    // Удаление возвращает значение и не вызывает функцию обратного вызова.
+    u64 removed = 0;
+    TEST_CHECK(lrucache_remove(cache, 2ULL, &removed));
+    TEST_CHECK(removed == 20 && log.count == 0);
+    TEST_CHECK(!lrucache_remove(cache, 2ULL, &removed));
+    TEST_CHECK(lrucache_get(cache, 2ULL) == nullptr);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 1, 3 }, 2));
+
+    // Освободившаяся запись используется без вытеснения.
+    lrucache_put(cache, 4ULL, 40ULL);
+    TEST_CHECK(log.count == 0);
+    TEST_CHECK(lru_cache_test_order(&cache, (u64[]){ 1, 3, 4 }, 3));
+
+    TEST_CHECK(lrucache_remove(cache, 1ULL, nullptr));
+    TEST_CHECK(lrucache_remove(cache, 3ULL, nullptr));
+    TEST_CHECK(lrucache_remove(cache, 4ULL, nullptr));
+    TEST_CHECK(lrucache_length(cache) == 0);
+    TEST_CHECK(!lru_cache_oldest(&cache, nullptr, nullptr));
+
+    lrucache_destroy(cache);
+    TEST_CHECK(log.count == 0);
+    return true;
+}
+
+bool test_lru_cache_churn()
+{
+    lru_cache_test_log log = { 0 };
+    lru_cache cache;
+    TEST_CHECK(lrucache_create(cache, u64, u64, 64, lru_cache_test_evict, &log));
+
+    memory_tag_usage before[MEMORY_TAG_COUNT];
+    memory_system_tag_usage(before);
+
+    // Поток новых ключей оставляет в таблице удаленные ячейки: после создания память не выделяется,
+    // в кеше остаются последние 64 неудаленных ключа.
+    const u64 total = 100000;
+    for(u64 key = 0; key < total; ++key)
+    {
+        u64* value = lrucache_put(cache, key, key + 1);
+        TEST_CHECK(value != nullptr && *value == key + 1);
+
+        if(key % 7 == 0)
+        {
+            lrucache_remove(cache, key, nullptr);
+        }
+    }
+
+    memory_tag_usage after[MEMORY_TAG_COUNT];
+    memory_system_tag_usage(after);
+    TEST_CHECK(after[MEMORY_TAG_HASHMAP].current == before[MEMORY_TAG_HASHMAP].current);
+    TEST_CHECK(after[MEMORY_TAG_HASHMAP].peak == before[MEMORY_TAG_HASHMAP].peak);
+
+    TEST_CHECK(lrucache_length(cache) == 64);
+    for(u64 key = total - 64; key < total; ++key)
+    {
+        u64* value = lrucache_peek(cache, key);
+        TEST_CHECK(key % 7 == 0 ? value == nullptr : (value != nullptr && *value == key + 1));
+    }
+
+    lrucache_destroy(cache);
+    return true;
+}
@@ -0,0 +1,156 @@
+#include "test.h"
+
+#include <core/logger.h>
+#include <core/memory.h>
+#include <core/string.h>
+#include <core/string_builder.h>
+#include <platform/console.h>
+#include <platform/memory.h>
+#include <platform/thread.h>
+#include <platform/time.h>
+
+#include <stdio.h>
+
+typedef struct test_case {
+    // Имя проверки (аргумент командной строки - префикс имени).
+    const char* name;
+    // Функция проверки.
+    test_fn run;
+} test_case;
+
+static const test_case tests[] = {
+    { "list_insert_remove",       test_list_insert_remove },
+    { "list_splice",              test_list_splice },
+    { "list_foreach_safe",        test_list_foreach_safe },
+    { "lru_cache_put_get",        test_lru_cache_put_get },
+    { "lru_cache_evict_order",    test_lru_cache_evict_order },
+    { "lru_cache_replace_evicts", test_lru_cache_replace_evicts },
+    { "lru_cache_remove",         test_lru_cache_remove },
+    { "lru_cache_churn",          test_lru_cache_churn },
+    { "darray_virtual_grow",      test_darray_virtual_grow },
+    { "darray_tagged",            test_darray_tagged },
+    { "darray_push_n",            test_darray_push_n },
+    { "darray_insert_range",      test_darray_insert_range },
+    { "darray_remove_swap",       test_darray_remove_swap },
+    { "darray_reserve_growth",    test_darray_reserve_growth },
+    { "hashmap_insert_get_remove", test_hashmap_insert_get_remove },
+    { "hashmap_emplace",          test_hashmap_emplace },
+    { "hashmap_string_keys",      test_hashmap_string_keys },
+    { "hashmap_churn",            test_hashmap_churn },
+    { "spsc_queue_fifo",          test_spsc_queue_fifo },
+    { "spsc_queue_threads",       test_spsc_queue_threads },
+    { "mpmc_queue_fifo",          test_mpmc_queue_fifo },
+    { "mpmc_queue_threads",       test_mpmc_queue_threads },
+    { "radix_sort_u32",           test_radix_sort_u32 },
+    { "radix_sort_u64",           test_radix_sort_u64 },
+    { "radix_sort_parallel",      test_radix_sort_parallel },
+    { "radix_sort_darray",        test_radix_sort_darray },
+    { "sort_key_order",           test_sort_key_order },
+    { "mutex_lock",               test_mutex_lock },
+    { "condition_handoff",        test_condition_handoff },
+    { "semaphore_count",          test_semaphore_count },
+    { "cpu_topology",             test_cpu_topology },
+    { "job_fiber_nested_wait",    test_job_fiber_nested_wait },
+    { "job_fiber_nested_parallel_for", test_job_fiber_nested_parallel_for },
+    { "job_steal_contention",     test_job_steal_contention },
+    { "job_counters",             test_job_counters },
+    { "parallel_for_ranges",      test_parallel_for_ranges },
+    { "parallel_for_darray",      test_parallel_for_darray },
+    { "string_builder_integers",  test_string_builder_integers },
+    { "string_builder_strings",   test_string_builder_strings },
+    { "string_builder_floats",    test_string_builder_floats },
+    { "string_builder_growth",    test_string_builder_growth },
+    { "logger_without_memory",    test_logger_without_memory },
+    { "memory_thread_stats",      test_memory_thread_stats },
+    { "memory_pool_cache",        test_memory_pool_cache },
+    { "memory_frame_peak",        test_memory_frame_peak },
+    { "memory_large_block",       test_memory_large_block },
+    { "event_register_send",      test_event_register_send },
+    { "event_register_during_send", test_event_register_during_send },
+};
+
+void test_print(const char* format, ...)
+{
+    char buffer[1024];
+    string_builder builder;
+    string_builder_create_buffer(buffer, sizeof(buffer), &builder);
+
+    __builtin_va_list args;
+    __builtin_va_start(args, format);
+    string_builder_append_format_va(&builder, format, args);
+    __builtin_va_end(args);
+
+    // NOTE: Вывод идет напрямую в stdout без цветов, чтобы результаты можно было перенаправить в файл.
+    fputs(string_builder_cstr(&builder), stdout);
+    fflush(stdout);
+}
+
+// Проверяет, выбрана ли проверка аргументами командной строки (без аргументов выбраны все).
+static bool test_selected(const char* name, i32 argc, char** argv)
+{
+    if(argc < 2)
+    {
+        return true;
+    }
+
+    for(i32 a = 1; a < argc; ++a)
+    {
+        if(string_nequal(name, argv[a], string_length(argv[a])))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    platform_console_initialize();
+
+    if(!platform_memory_initialize() || !platform_time_initialize() || !platform_thread_initialize())
+    {
+        LOG_ERROR("Failed to initialize platform subsystems.");
+        return 1;
+    }
+
+    // Сообщения систем при запуске и остановке не смешиваются с результатами.
+    log_set_level(LOG_LEVEL_WARN);
+
+    if(!memory_system_initialize(nullptr))
+    {
+        LOG_ERROR("Failed to initialize memory system.");
+        return 1;
+    }
+
+    u32 passed = 0;
+    u32 failed = 0;
+
+    for(u32 i = 0; i < ARRAY_SIZE(tests); ++i)
+    {
+        if(!test_selected(tests[i].name, argc, argv))
+        {
+            continue;
+        }
+
+        if(tests[i].run())
+        {
+            test_print("[ OK ] %s\n", tests[i].name);
+            passed++;
+        }
+        else
+        {
+            test_print("[FAIL] %s\n", tests[i].name);
+            failed++;
+        }
+    }
+
+    test_print("%u passed, %u failed\n", passed, failed);
+
+    memory_system_shutdown();
+    platform_thread_shutdown();
+    platform_time_shutdown();
+    platform_memory_shutdown();
+    platform_console_shutdown();
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+#include "test.h"
+
+#include <core/memory.h>
+#include <platform/memory.h>
+#include <platform/thread.h>
+
+// Количество потоков в многопоточных проверках.
+#define MEMORY_TEST_THREADS 4
+// Количество блоков, выделяемых каждым потоком.
+#define MEMORY_TEST_BLOCKS 1000
+// Размер блока (обслуживается пулом размерного класса).
+#define MEMORY_TEST_BLOCK_SIZE 64
+// Количество раундов выделения и освобождения блоков пулов.
+#define MEMORY_TEST_POOL_ROUNDS 16
+
+typedef struct memory_test_thread {
+    void* blocks[MEMORY_TEST_BLOCKS];
+} memory_test_thread;
+
+static u32 memory_test_allocate_run(void* data)
+{
+    memory_test_thread* thread = data;
+    for(u32 i = 0; i < MEMORY_TEST_BLOCKS; ++i)
+    {
+        thread->blocks[i] = memory_allocate(MEMORY_TEST_BLOCK_SIZE, 16, MEMORY_TAG_APPLICATION);
+    }
+    return 0;
+}
+
+static u32 memory_test_free_run(void* data)
+{
+    memory_test_thread* thread = data;
+    for(u32 i = 0; i < MEMORY_TEST_BLOCKS; ++i)
+    {
+        memory_free(thread->blocks[i], MEMORY_TEST_BLOCK_SIZE, MEMORY_TAG_APPLICATION);
+    }
+    return 0;
+}
+
+static u32 memory_test_spike_run(void* data)
+{
+    memory_test_allocate_run(data);
+    memory_test_free_run(data);
+    return 0;
+}
+
+// Возвращает размер i-го блока проверки пулов (блоки распределяются по всем размерным классам).
+static u64 memory_test_pool_size(u32 i)
+{
+    return sizeof(u32) << (i % 9);
+}
+
+static u32 memory_test_pool_allocate_run(void* data)
+{
+    memory_test_thread* thread = data;
+    for(u32 i = 0; i < MEMORY_TEST_BLOCKS; ++i)
+    {
+        u32* block = memory_allocate(memory_test_pool_size(i), 16, MEMORY_TAG_APPLICATION);
+        *block = i;
+        thread->blocks[i] = block;
+    }
+    return 0;
+}
+
+static u32 memory_test_pool_free_run(void* data)
+{
+    memory_test_thread* thread = data;
+    for(u32 i = 0; i < MEMORY_TEST_BLOCKS; ++i)
+    {
+        memory_free(thread->blocks[i], memory_test_pool_size(i), MEMORY_TAG_APPLICATION);
+    }
+    return 0;
+}
+
+// Выполняет функцию во всех потоках и дожидается их завершения.
+static void memory_test_run_threads(platform_thread_start_fn func, memory_test_thread* data)
+{
+    platform_thread threads[MEMORY_TEST_THREADS];
+    for(u32 i = 0; i < MEMORY_TEST_THREADS; ++i)
+    {
+        platform_thread_create(func, &data[i], "memory_test", &threads[i]);
+    }
+
+    for(u32 i = 0; i < MEMORY_TEST_THREADS; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+}
+
+// Возвращает использование памяти тегом по итогам кадра.
+static memory_tag_usage memory_test_frame_usage(memory_tag tag)
+{
+    memory_tag_usage usage[MEMORY_TAG_COUNT];
+    memory_system_frame_end();
+    memory_system_tag_usage(usage);
+    return usage[tag];
+}
+
+bool test_memory_pool_cache()
+{
+    memory_test_thread* data = memory_allocate(sizeof(memory_test_thread) * MEMORY_TEST_THREADS, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(data != nullptr);
+
+    u64 base = memory_test_frame_usage(MEMORY_TAG_APPLICATION).current;
+
+    // Блоки освобождаются не теми потоками, что выделили их, и переходят между кэшами потоков через пулы.
+    for(u32 round = 0; round < MEMORY_TEST_POOL_ROUNDS; ++round)
+    {
+        memory_test_run_threads(memory_test_pool_allocate_run, data);
+
+        // Блок, выданный дважды, был бы перезаписан другим номером.
+        for(u32 t = 0; t < MEMORY_TEST_THREADS; ++t)
+        {
+            for(u32 i = 0; i < MEMORY_TEST_BLOCKS; ++i)
+            {
+                TEST_CHECK(*(u32*)data[t].blocks[i] == i);
+            }
+        }
+
+        memory_test_run_threads(memory_test_pool_free_run, data);
+    }
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base);
+
+    memory_free(data, sizeof(memory_test_thread) * MEMORY_TEST_THREADS, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_memory_thread_stats()
+{
+    memory_test_thread* data = memory_allocate(sizeof(memory_test_thread) * MEMORY_TEST_THREADS, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(data != nullptr);
+
+    u64 base = memory_test_frame_usage(MEMORY_TAG_APPLICATION).current;
+    u64 expected = (u64)MEMORY_TEST_THREADS * MEMORY_TEST_BLOCKS * MEMORY_TEST_BLOCK_SIZE;
+
+    // Выделения в рабочих потоках учитываются в общей статистике.
+    memory_test_run_threads(memory_test_allocate_run, data);
+    memory_tag_usage usage = memory_test_frame_usage(MEMORY_TAG_APPLICATION);
+    TEST_CHECK(usage.current == base + expected);
+    TEST_CHECK(usage.peak >= base + expected);
+
+    // Освобождение в другом потоке возвращает статистику к исходному значению.
+    for(u32 t = 0; t < MEMORY_TEST_THREADS; ++t)
+    {
+        memory_test_free_run(&data[t]);
+    }
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base);
+
+    // Блоки основного потока, освобожденные рабочими потоками.
+    for(u32 t = 0; t < MEMORY_TEST_THREADS; ++t)
+    {
+        memory_test_allocate_run(&data[t]);
+    }
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base + expected);
+
+    memory_test_run_threads(memory_test_free_run, data);
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base);
+
+    memory_free(data, sizeof(memory_test_thread) * MEMORY_TEST_THREADS, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_memory_frame_peak()
+{
+    memory_test_thread* data = memory_allocate(sizeof(memory_test_thread) * MEMORY_TEST_THREADS, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(data != nullptr);
+
+    u64 base = memory_test_frame_usage(MEMORY_TAG_APPLICATION).current;
+    u64 spike = (u64)MEMORY_TEST_BLOCKS * MEMORY_TEST_BLOCK_SIZE;
+
+    // Память выделяется и освобождается внутри кадра без запросов статистики: пик учитывается при выделениях.
+    memory_test_spike_run(&data[0]);
+    memory_tag_usage usage = memory_test_frame_usage(MEMORY_TAG_APPLICATION);
+    TEST_CHECK(usage.current == base);
+    TEST_CHECK(usage.peak >= base + spike);
+
+    // То же в рабочих потоках (в том числе с общими счетчиками, если собственные закончились).
+    memory_test_run_threads(memory_test_spike_run, data);
+    usage = memory_test_frame_usage(MEMORY_TAG_APPLICATION);
+    TEST_CHECK(usage.current == base);
+    TEST_CHECK(usage.peak >= base + spike);
+
+    // Кадр без выделений: пик совпадает с текущим использованием.
+    usage = memory_test_frame_usage(MEMORY_TAG_APPLICATION);
+    TEST_CHECK(usage.peak == base);
+
+    memory_free(data, sizeof(memory_test_thread) * MEMORY_TEST_THREADS, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_memory_large_block()
+{
+    // Размеры меньше, равные и больше большой страницы (блок памяти системы содержит еще и заголовок).
+    u64 sizes[] = {
+        PLATFORM_MEMORY_HUGE_PAGE_SIZE / 2 + 1, PLATFORM_MEMORY_HUGE_PAGE_SIZE, PLATFORM_MEMORY_HUGE_PAGE_SIZE + 16,
+        PLATFORM_MEMORY_HUGE_PAGE_SIZE * 2 + platform_memory_page_size() - 1
+    };
+
+    for(u32 i = 0; i < ARRAY_SIZE(sizes); ++i)
+    {
+        bool huge_pages = false;
+        u8* block = platform_memory_allocate_large(sizes[i], &huge_pages);
+        TEST_CHECK(block != nullptr);
+        TEST_CHECK((usize)block % platform_memory_page_size() == 0);
+
+        // Рекомендация больших страниц возможна только для выровненного блока не меньше большой страницы.
+        TEST_CHECK(!huge_pages || (sizes[i] >= PLATFORM_MEMORY_HUGE_PAGE_SIZE && (usize)block % PLATFORM_MEMORY_HUGE_PAGE_SIZE == 0));
+
+        // Память доступна по всему запрошенному размеру и заполнена нулями.
+        TEST_CHECK(block[0] == 0 && block[sizes[i] - 1] == 0);
+        block[0] = 1;
+        block[sizes[i] - 1] = 1;
+        platform_memory_free_large(block, sizes[i]);
+    }
+
+    // Блок системы памяти от порога больших выделений учитывается в статистике тега.
+    u64 base = memory_test_frame_usage(MEMORY_TAG_APPLICATION).current;
+    u8* block = memory_allocate(PLATFORM_MEMORY_HUGE_PAGE_SIZE, 64, MEMORY_TAG_APPLICATION);
+    TEST_CHECK(block != nullptr && (usize)block % 64 == 0);
+    block[PLATFORM_MEMORY_HUGE_PAGE_SIZE - 1] = 1;
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base + PLATFORM_MEMORY_HUGE_PAGE_SIZE);
+    memory_free(block, PLATFORM_MEMORY_HUGE_PAGE_SIZE, MEMORY_TAG_APPLICATION);
+    TEST_CHECK(memory_test_frame_usage(MEMORY_TAG_APPLICATION).current == base);
+
+    return true;
+}
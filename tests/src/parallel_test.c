@@ -0,0 +1,168 @@
+#include "test.h"
+
+#include <core/containers/darray.h>
+#include <core/job.h>
+#include <core/memory.h>
+#include <core/parallel.h>
+#include <platform/thread.h>
+
+// Количество рабочих потоков в проверках.
+#define PARALLEL_TEST_WORKERS 4
+// Наибольшее количество индексов в проверках.
+#define PARALLEL_TEST_MAX_COUNT 100003
+
+typedef struct parallel_test_context {
+    // Количество обработок каждого индекса.
+    u32* marks;
+    // Количество вызовов функции пакета.
+    u32 calls;
+    // Количество пакетов с неверными границами.
+    u32 failures;
+    // Ожидаемый размер пакета.
+    u64 batch_size;
+    // Количество индексов.
+    u64 count;
+} parallel_test_context;
+
+typedef struct parallel_test_item {
+    u32 index;
+    u32 marks;
+    // Заполнение, чтобы размер элемента не был степенью двойки.
+    u32 padding;
+} parallel_test_item;
+
+// Проверяет границы пакета: пакет не пуст, начинается с кратного размеру пакета индекса и не выходит за диапазон.
+static void parallel_test_batch(parallel_test_context* context, u64 begin, u64 end)
+{
+    platform_atomic_fetch_add_u32(&context->calls, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+
+    bool valid = begin < end && end <= context->count && begin % context->batch_size == 0
+              && (end - begin == context->batch_size || end == context->count);
+    if(!valid)
+    {
+        platform_atomic_fetch_add_u32(&context->failures, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+static void parallel_test_range(u64 begin, u64 end, void* user)
+{
+    parallel_test_context* context = user;
+    parallel_test_batch(context, begin, end);
+
+    for(u64 i = begin; i < end && i < context->count; ++i)
+    {
+        platform_atomic_fetch_add_u32(&context->marks[i], 1, PLATFORM_MEMORY_ORDER_RELAXED);
+    }
+}
+
+static void parallel_test_array(void* elements, u64 begin, u64 end, void* user)
+{
+    parallel_test_context* context = user;
+    parallel_test_batch(context, begin, end);
+
+    // Указатель пакета указывает на элемент с индексом begin.
+    parallel_test_item* items = elements;
+    for(u64 i = 0; i < end - begin; ++i)
+    {
+        if(items[i].index != begin + i)
+        {
+            platform_atomic_fetch_add_u32(&context->failures, 1, PLATFORM_MEMORY_ORDER_RELAXED);
+        }
+        items[i].marks++;
+    }
+}
+
+// Выполняет parallel_for для диапазонов разной длины и проверяет, что каждый индекс обработан ровно один раз.
+static bool parallel_test_ranges(u32* marks)
+{
+    u64 counts[] = { 0, 1, 2, 3, 7, 64, 1000, PARALLEL_TEST_MAX_COUNT };
+    u64 min_batches[] = { 0, 1, 5, 64, PARALLEL_TEST_MAX_COUNT * 2 };
+
+    for(u32 c = 0; c < ARRAY_SIZE(counts); ++c)
+    {
+        for(u32 b = 0; b < ARRAY_SIZE(min_batches); ++b)
+        {
+            u64 count = counts[c];
+            mzero(marks, sizeof(u32) * PARALLEL_TEST_MAX_COUNT);
+
+            parallel_test_context context = {
+                .marks = marks, .count = count, .batch_size = parallel_for_batch_size(count, min_batches[b])
+            };
+            parallel_for(count, min_batches[b], parallel_test_range, &context);
+
+            // Пустой диапазон не вызывает функцию, иначе количество вызовов равно количеству пакетов.
+            u64 batches = count > 0 ? (count + context.batch_size - 1) / context.batch_size : 0;
+            TEST_CHECK(context.failures == 0 && context.calls == batches);
+            TEST_CHECK(count > 0 || context.batch_size == 0);
+            TEST_CHECK(count == 0 || context.batch_size >= MAX(min_batches[b], 1ULL));
+
+            for(u64 i = 0; i < PARALLEL_TEST_MAX_COUNT; ++i)
+            {
+                TEST_CHECK(marks[i] == (i < count ? 1 : 0));
+            }
+        }
+    }
+
+    return true;
+}
+
+bool test_parallel_for_ranges()
+{
+    u32* marks = memory_allocate(sizeof(u32) * PARALLEL_TEST_MAX_COUNT, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(marks != nullptr);
+
+    // Без системы задач диапазон обрабатывается в вызывающем потоке.
+    TEST_CHECK(!job_system_is_initialized());
+    bool inline_valid = parallel_test_ranges(marks);
+
+    // С рабочими потоками пакеты обрабатываются всеми потоками системы.
+    job_system_config config = { .worker_count = PARALLEL_TEST_WORKERS };
+    TEST_CHECK(job_system_initialize(&config));
+    bool workers_valid = parallel_test_ranges(marks);
+    job_system_shutdown();
+
+    memory_free(marks, sizeof(u32) * PARALLEL_TEST_MAX_COUNT, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(inline_valid);
+    TEST_CHECK(workers_valid);
+    return true;
+}
+
+bool test_parallel_for_darray()
+{
+    parallel_test_item* items = darray_create(parallel_test_item);
+    TEST_CHECK(items != nullptr);
+
+    job_system_config config = { .worker_count = PARALLEL_TEST_WORKERS };
+    TEST_CHECK(job_system_initialize(&config));
+
+    // Пустой массив, один элемент и массив из нескольких пакетов.
+    u32 lengths[] = { 0, 1, 2, 517, 20000 };
+    bool valid = true;
+    for(u32 l = 0; l < ARRAY_SIZE(lengths) && valid; ++l)
+    {
+        while(darray_length(items) < lengths[l])
+        {
+            darray_push(items, ((parallel_test_item){ .index = (u32)darray_length(items) }));
+        }
+        for(u32 i = 0; i < lengths[l]; ++i)
+        {
+            items[i].marks = 0;
+        }
+
+        parallel_test_context context = {
+            .count = lengths[l], .batch_size = parallel_for_batch_size(lengths[l], 16)
+        };
+        darray_parallel_for(items, 16, parallel_test_array, &context);
+
+        valid = context.failures == 0 && (lengths[l] > 0 || context.calls == 0);
+        for(u32 i = 0; i < lengths[l]; ++i)
+        {
+            valid = valid && items[i].marks == 1;
+        }
+    }
+
+    job_system_shutdown();
+    darray_destroy(items);
+    TEST_CHECK(valid);
+    return true;
+}
@@ -0,0 +1,241 @@
+#include "test.h"
+
+#include <core/containers/mpmc_queue.h>
+#include <core/containers/spsc_queue.h>
+#include <core/memory.h>
+#include <platform/thread.h>
+
+// Емкость очередей в проверках (меньше количества элементов, поэтому очереди многократно заполняются).
+#define QUEUE_TEST_CAPACITY 64
+// Количество элементов, передаваемых каждым производителем.
+#define QUEUE_TEST_ITEMS 20000
+// Количество производителей и потребителей в проверке очереди нескольких производителей и потребителей.
+#define QUEUE_TEST_THREADS 4
+
+// Возвращает элемент проверки (старшие 32 бита - номер производителя, младшие - порядковый номер).
+static u64 queue_test_item(u32 producer, u32 sequence)
+{
+    return ((u64)producer << 32) | sequence;
+}
+
+static u32 queue_test_spsc_produce(void* data)
+{
+    spsc_queue* queue = data;
+    for(u32 i = 0; i < QUEUE_TEST_ITEMS; ++i)
+    {
+        u64 item = queue_test_item(0, i);
+        while(!spsc_queue_push(queue, &item))
+        {
+            platform_thread_yield();
+        }
+    }
+    return 0;
+}
+
+typedef struct queue_test_mpmc_thread {
+    // Очередь проверки.
+    mpmc_queue* queue;
+    // Номер производителя.
+    u32 producer;
+    // Количество извлечений каждого элемента (общее для потребителей).
+    u32* seen;
+    // Количество извлеченных элементов (общее для потребителей).
+    u64* consumed;
+} queue_test_mpmc_thread;
+
+static u32 queue_test_mpmc_produce(void* data)
+{
+    queue_test_mpmc_thread* thread = data;
+    for(u32 i = 0; i < QUEUE_TEST_ITEMS; ++i)
+    {
+        u64 item = queue_test_item(thread->producer, i);
+        while(!mpmc_queue_push(thread->queue, &item))
+        {
+            platform_thread_yield();
+        }
+    }
+    return 0;
+}
+
+// Возвращает количество нарушений: повторных или лишних элементов и элементов производителя не по порядку.
+static u32 queue_test_mpmc_consume(void* data)
+{
+    queue_test_mpmc_thread* thread = data;
+    u64 total = (u64)QUEUE_TEST_THREADS * QUEUE_TEST_ITEMS;
+    u32 next[QUEUE_TEST_THREADS] = { 0 };
+    u32 errors = 0;
+
+    while(platform_atomic_load_u64(thread->consumed, PLATFORM_MEMORY_ORDER_ACQUIRE) < total)
+    {
+        u64 item = 0;
+        if(!mpmc_queue_pop(thread->queue, &item))
+        {
+            platform_thread_yield();
+            continue;
+        }
+
+        u32 producer = (u32)(item >> 32);
+        u32 sequence = (u32)item;
+        if(producer >= QUEUE_TEST_THREADS || sequence >= QUEUE_TEST_ITEMS)
+        {
+            errors++;
+            continue;
+        }
+
+        // Элементы одного производителя извлекаются в порядке добавления.
+        errors += sequence < next[producer];
+        next[producer] = sequence + 1;
+
+        errors += platform_atomic_fetch_add_u32(&thread->seen[producer * QUEUE_TEST_ITEMS + sequence], 1, PLATFORM_MEMORY_ORDER_RELAXED) != 0;
+        platform_atomic_fetch_add_u64(thread->consumed, 1, PLATFORM_MEMORY_ORDER_RELEASE);
+    }
+
+    return errors;
+}
+
+bool test_spsc_queue_fifo()
+{
+    spsc_queue queue;
+    TEST_CHECK(spscqueue_create(queue, u64, QUEUE_TEST_CAPACITY - 1));
+    TEST_CHECK(spsc_queue_capacity(&queue) == QUEUE_TEST_CAPACITY);
+
+    // Очередь многократно заполняется до отказа и опустошается, индексы переходят через границу буфера.
+    u64 next_push = 0;
+    u64 next_pop = 0;
+    for(u32 round = 0; round < 8; ++round)
+    {
+        while(spscqueue_push(queue, next_push))
+        {
+            next_push++;
+        }
+        TEST_CHECK(spscqueue_length(queue) == QUEUE_TEST_CAPACITY);
+
+        // Извлечение половины смещает начало очереди относительно буфера.
+        for(u32 i = 0; i < QUEUE_TEST_CAPACITY / 2 + round; ++i)
+        {
+            u64 value = 0;
+            TEST_CHECK(spscqueue_pop(queue, &value));
+            TEST_CHECK(value == next_pop++);
+        }
+    }
+
+    u64 value = 0;
+    while(spscqueue_pop(queue, &value))
+    {
+        TEST_CHECK(value == next_pop++);
+    }
+    TEST_CHECK(next_pop == next_push);
+    TEST_CHECK(spscqueue_length(queue) == 0);
+
+    spscqueue_destroy(queue);
+    return true;
+}
+
+bool test_spsc_queue_threads()
+{
+    spsc_queue queue;
+    TEST_CHECK(spscqueue_create(queue, u64, QUEUE_TEST_CAPACITY));
+
+    platform_thread producer;
+    TEST_CHECK(platform_thread_create(queue_test_spsc_produce, &queue, "queue_test", &producer));
+
+    // Потребитель получает все элементы ровно в порядке добавления.
+    bool ordered = true;
+    for(u32 i = 0; i < QUEUE_TEST_ITEMS; ++i)
+    {
+        u64 value = 0;
+        while(!spscqueue_pop(queue, &value))
+        {
+            platform_thread_yield();
+        }
+        ordered = ordered && value == queue_test_item(0, i);
+    }
+
+    platform_thread_join(&producer, nullptr);
+    TEST_CHECK(ordered);
+    TEST_CHECK(spscqueue_length(queue) == 0);
+
+    spscqueue_destroy(queue);
+    return true;
+}
+
+bool test_mpmc_queue_fifo()
+{
+    mpmc_queue queue;
+    TEST_CHECK(mpmcqueue_create(queue, u64, QUEUE_TEST_CAPACITY - 1));
+    TEST_CHECK(mpmc_queue_capacity(&queue) == QUEUE_TEST_CAPACITY);
+
+    u64 next_push = 0;
+    u64 next_pop = 0;
+    for(u32 round = 0; round < 8; ++round)
+    {
+        while(mpmcqueue_push(queue, next_push))
+        {
+            next_push++;
+        }
+        TEST_CHECK(mpmcqueue_length(queue) == QUEUE_TEST_CAPACITY);
+
+        for(u32 i = 0; i < QUEUE_TEST_CAPACITY / 2 + round; ++i)
+        {
+            u64 value = 0;
+            TEST_CHECK(mpmcqueue_pop(queue, &value));
+            TEST_CHECK(value == next_pop++);
+        }
+    }
+
+    u64 value = 0;
+    while(mpmcqueue_pop(queue, &value))
+    {
+        TEST_CHECK(value == next_pop++);
+    }
+    TEST_CHECK(next_pop == next_push);
+    TEST_CHECK(mpmcqueue_length(queue) == 0);
+
+    mpmcqueue_destroy(queue);
+    return true;
+}
+
+bool test_mpmc_queue_threads()
+{
+    mpmc_queue queue;
+    TEST_CHECK(mpmcqueue_create(queue, u64, QUEUE_TEST_CAPACITY));
+
+    u64 seen_size = sizeof(u32) * QUEUE_TEST_THREADS * QUEUE_TEST_ITEMS;
+    u32* seen = memory_allocate(seen_size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(seen != nullptr);
+    mzero(seen, seen_size);
+
+    u64 consumed = 0;
+    queue_test_mpmc_thread data[QUEUE_TEST_THREADS];
+    platform_thread producers[QUEUE_TEST_THREADS];
+    platform_thread consumers[QUEUE_TEST_THREADS];
+
+    for(u32 i = 0; i < QUEUE_TEST_THREADS; ++i)
+    {
+        data[i] = (queue_test_mpmc_thread){ .queue = &queue, .producer = i, .seen = seen, .consumed = &consumed };
+        TEST_CHECK(platform_thread_create(queue_test_mpmc_consume, &data[i], "queue_test", &consumers[i]));
+        TEST_CHECK(platform_thread_create(queue_test_mpmc_produce, &data[i], "queue_test", &producers[i]));
+    }
+
+    u32 errors = 0;
+    for(u32 i = 0; i < QUEUE_TEST_THREADS; ++i)
+    {
+        u32 result = 0;
+        platform_thread_join(&producers[i], nullptr);
+        platform_thread_join(&consumers[i], &result);
+        errors += result;
+    }
+    TEST_CHECK(errors == 0);
+
+    // Каждый элемент извлечен ровно один раз.
+    TEST_CHECK(consumed == (u64)QUEUE_TEST_THREADS * QUEUE_TEST_ITEMS);
+    for(u32 i = 0; i < QUEUE_TEST_THREADS * QUEUE_TEST_ITEMS; ++i)
+    {
+        TEST_CHECK(seen[i] == 1);
+    }
+    TEST_CHECK(mpmcqueue_length(queue) == 0);
+
+    memory_free(seen, seen_size, MEMORY_TAG_UNKNOWN);
+    mpmcqueue_destroy(queue);
+    return true;
+}
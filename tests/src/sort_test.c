@@ -0,0 +1,224 @@
+#include "test.h"
+
+#include <core/containers/darray.h>
+#include <core/memory.h>
+#include <core/sort.h>
+
+// Количество пар в проверках последовательной сортировки.
+#define SORT_TEST_COUNT 5000
+// Количество пар в проверке параллельной сортировки (несколько пакетов даже без рабочих потоков).
+#define SORT_TEST_PARALLEL_COUNT 100000
+
+// Возвращает следующее псевдослучайное число (xorshift64).
+static u64 sort_test_random(u64* state)
+{
+    u64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+// Проверяет, что пары упорядочены по ключу, равные ключи сохранили исходный порядок и каждый индекс встречается один раз.
+#define SORT_TEST_CHECK_SORTED(items, count)                                                                   \
+    do                                                                                                         \
+    {                                                                                                          \
+        u8* seen = memory_allocate(count, 16, MEMORY_TAG_UNKNOWN);                                             \
+        TEST_CHECK(seen != nullptr);                                                                           \
+        mzero(seen, count);                                                                                    \
+        bool valid = true;                                                                                     \
+        for(u64 i = 0; i < (count); ++i)                                                                       \
+        {                                                                                                      \
+            valid = valid && (items)[i].index < (count) && seen[(items)[i].index]++ == 0;                      \
+            if(i > 0)                                                                                          \
+            {                                                                                                  \
+                bool ordered = (items)[i - 1].key < (items)[i].key;                                            \
+                bool stable = (items)[i - 1].key == (items)[i].key && (items)[i - 1].index < (items)[i].index; \
+                valid = valid && (ordered || stable);                                                          \
+            }                                                                                                  \
+        }                                                                                                      \
+        memory_free(seen, count, MEMORY_TAG_UNKNOWN);                                                          \
+        TEST_CHECK(valid);                                                                                     \
+    } while(0)
+
+bool test_radix_sort_u32()
+{
+    u64 size = sizeof(sort_key32) * SORT_TEST_COUNT;
+    sort_key32* items = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(items != nullptr);
+
+    // Пустой массив и одна пара не требуют буфера.
+    TEST_CHECK(radix_sort_u32(items, 0, nullptr));
+    items[0] = (sort_key32){ .key = 7, .index = 0 };
+    TEST_CHECK(radix_sort_u32(items, 1, nullptr));
+    TEST_CHECK(items[0].key == 7 && items[0].index == 0);
+
+    // Ключи во всем диапазоне и ключи с множеством повторов (пропускаются проходы старших разрядов).
+    u64 masks[] = { U32_MAX, 0xFF, 0xFF00 };
+    u64 state = 0x2545F4914F6CDD1DULL;
+    for(u32 m = 0; m < ARRAY_SIZE(masks); ++m)
+    {
+        for(u32 i = 0; i < SORT_TEST_COUNT; ++i)
+        {
+            items[i] = (sort_key32){ .key = (u32)(sort_test_random(&state) & masks[m]), .index = i };
+        }
+
+        TEST_CHECK(radix_sort_u32(items, SORT_TEST_COUNT, nullptr));
+        SORT_TEST_CHECK_SORTED(items, SORT_TEST_COUNT);
+    }
+
+    // Буфер вызывающей стороны, уже отсортированные данные.
+    sort_key32* scratch = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(scratch != nullptr);
+    for(u32 i = 0; i < SORT_TEST_COUNT; ++i)
+    {
+        items[i] = (sort_key32){ .key = i * 3, .index = i };
+    }
+    TEST_CHECK(radix_sort_u32(items, SORT_TEST_COUNT, scratch));
+    SORT_TEST_CHECK_SORTED(items, SORT_TEST_COUNT);
+
+    memory_free(scratch, size, MEMORY_TAG_UNKNOWN);
+    memory_free(items, size, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_radix_sort_u64()
+{
+    u64 size = sizeof(sort_key64) * SORT_TEST_COUNT;
+    sort_key64* items = memory_allocate(size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(items != nullptr);
+
+    // Различия только в младших, только в старших и во всех разрядах ключа.
+    u64 masks[] = { U64_MAX, 0xFFULL, 0xFF00000000000000ULL, 0x0000FFFF00000000ULL };
+    u64 state = 0x9E3779B97F4A7C15ULL;
+    for(u32 m = 0; m < ARRAY_SIZE(masks); ++m)
+    {
+        for(u32 i = 0; i < SORT_TEST_COUNT; ++i)
+        {
+            items[i] = (sort_key64){ .key = sort_test_random(&state) & masks[m], .index = i };
+        }
+
+        TEST_CHECK(radix_sort_u64(items, SORT_TEST_COUNT, nullptr));
+        SORT_TEST_CHECK_SORTED(items, SORT_TEST_COUNT);
+    }
+
+    // Все ключи равны: порядок пар не меняется.
+    for(u32 i = 0; i < SORT_TEST_COUNT; ++i)
+    {
+        items[i] = (sort_key64){ .key = 42, .index = i };
+    }
+    TEST_CHECK(radix_sort_u64(items, SORT_TEST_COUNT, nullptr));
+    SORT_TEST_CHECK_SORTED(items, SORT_TEST_COUNT);
+
+    memory_free(items, size, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_radix_sort_parallel()
+{
+    u64 size32 = sizeof(sort_key32) * SORT_TEST_PARALLEL_COUNT;
+    u64 size64 = sizeof(sort_key64) * SORT_TEST_PARALLEL_COUNT;
+    sort_key32* items32 = memory_allocate(size32, 16, MEMORY_TAG_UNKNOWN);
+    sort_key32* expected32 = memory_allocate(size32, 16, MEMORY_TAG_UNKNOWN);
+    sort_key64* items64 = memory_allocate(size64, 16, MEMORY_TAG_UNKNOWN);
+    sort_key64* expected64 = memory_allocate(size64, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(items32 && expected32 && items64 && expected64);
+
+    // Ключи с повторами: устойчивость между пакетами дает результат, совпадающий с последовательной сортировкой.
+    u64 state = 0xD1B54A32D192ED03ULL;
+    for(u32 i = 0; i < SORT_TEST_PARALLEL_COUNT; ++i)
+    {
+        u64 key = sort_test_random(&state);
+        items32[i] = expected32[i] = (sort_key32){ .key = (u32)key & 0xFFFFF, .index = i };
+        items64[i] = expected64[i] = (sort_key64){ .key = key & 0xFFFFF0000000FFFFULL, .index = i };
+    }
+
+    TEST_CHECK(radix_sort_u32(expected32, SORT_TEST_PARALLEL_COUNT, nullptr));
+    TEST_CHECK(radix_sort_u32_parallel(items32, SORT_TEST_PARALLEL_COUNT, nullptr));
+    SORT_TEST_CHECK_SORTED(items32, SORT_TEST_PARALLEL_COUNT);
+    for(u32 i = 0; i < SORT_TEST_PARALLEL_COUNT; ++i)
+    {
+        TEST_CHECK(items32[i].key == expected32[i].key && items32[i].index == expected32[i].index);
+    }
+
+    TEST_CHECK(radix_sort_u64(expected64, SORT_TEST_PARALLEL_COUNT, nullptr));
+    TEST_CHECK(radix_sort_u64_parallel(items64, SORT_TEST_PARALLEL_COUNT, nullptr));
+    SORT_TEST_CHECK_SORTED(items64, SORT_TEST_PARALLEL_COUNT);
+    for(u32 i = 0; i < SORT_TEST_PARALLEL_COUNT; ++i)
+    {
+        TEST_CHECK(items64[i].key == expected64[i].key && items64[i].index == expected64[i].index);
+    }
+
+    memory_free(expected64, size64, MEMORY_TAG_UNKNOWN);
+    memory_free(items64, size64, MEMORY_TAG_UNKNOWN);
+    memory_free(expected32, size32, MEMORY_TAG_UNKNOWN);
+    memory_free(items32, size32, MEMORY_TAG_UNKNOWN);
+    return true;
+}
+
+bool test_sort_key_order()
+{
+    // Значения перечислены по возрастанию, ключи должны строго возрастать.
+    i32 ints32[] = { I32_MIN, -100000, -1, 0, 1, 100000, I32_MAX };
+    for(u32 i = 1; i < ARRAY_SIZE(ints32); ++i)
+    {
+        TEST_CHECK(sort_key_from_i32(ints32[i - 1]) < sort_key_from_i32(ints32[i]));
+    }
+
+    i64 ints64[] = { I64_MIN, -(1LL << 40), -1, 0, 1, 1LL << 40, I64_MAX };
+    for(u32 i = 1; i < ARRAY_SIZE(ints64); ++i)
+    {
+        TEST_CHECK(sort_key_from_i64(ints64[i - 1]) < sort_key_from_i64(ints64[i]));
+    }
+
+    f32 floats32[] = { -__builtin_inff(), -1e30f, -1.5f, -1e-40f, -0.0f, 0.0f, 1e-40f, 1.5f, 1e30f, __builtin_inff() };
+    for(u32 i = 1; i < ARRAY_SIZE(floats32); ++i)
+    {
+        TEST_CHECK(sort_key_from_f32(floats32[i - 1]) < sort_key_from_f32(floats32[i]));
+    }
+
+    f64 floats64[] = { -__builtin_inf(), -1e300, -1.5, -1e-310, -0.0, 0.0, 1e-310, 1.5, 1e300, __builtin_inf() };
+    for(u32 i = 1; i < ARRAY_SIZE(floats64); ++i)
+    {
+        TEST_CHECK(sort_key_from_f64(floats64[i - 1]) < sort_key_from_f64(floats64[i]));
+    }
+
+    return true;
+}
+
+bool test_radix_sort_darray()
+{
+    sort_key32* array32 = darray_create(sort_key32);
+    sort_key64* array64 = darray_create(sort_key64);
+    TEST_CHECK(array32 != nullptr && array64 != nullptr);
+
+    // Вещественные и знаковые значения сортируются через ключи.
+    f32 values[] = { 3.5f, -2.0f, 0.0f, -7.25f, 3.5f, 1.0f };
+    i64 offsets[] = { 5, -3, 0, -9, 5, 1 };
+    for(u32 i = 0; i < ARRAY_SIZE(values); ++i)
+    {
+        darray_push(array32, ((sort_key32){ .key = sort_key_from_f32(values[i]), .index = i }));
+        darray_push(array64, ((sort_key64){ .key = sort_key_from_i64(offsets[i]), .index = i }));
+    }
+
+    u32 expected[] = { 3, 1, 2, 5, 0, 4 };
+    TEST_CHECK(darray_radix_sort_u32(array32));
+    TEST_CHECK(darray_radix_sort_u64(array64));
+    for(u32 i = 0; i < ARRAY_SIZE(expected); ++i)
+    {
+        TEST_CHECK(array32[i].index == expected[i]);
+        TEST_CHECK(array64[i].index == expected[i]);
+    }
+
+    TEST_CHECK(darray_radix_sort_u32_parallel(array32));
+    TEST_CHECK(darray_radix_sort_u64_parallel(array64));
+    for(u32 i = 0; i < ARRAY_SIZE(expected); ++i)
+    {
+        TEST_CHECK(array32[i].index == expected[i] && array64[i].index == expected[i]);
+    }
+
+    darray_destroy(array64);
+    darray_destroy(array32);
+    return true;
+}
@@ -0,0 +1,192 @@
+#include "test.h"
+
+#include <core/allocators/linear_allocator.h>
+#include <core/memory.h>
+#include <core/string.h>
+#include <core/string_builder.h>
+
+#include <stdio.h>
+
+// Размер буфера для сравнения одной строки формата.
+#define STRING_BUILDER_TEST_BUFFER_SIZE 512
+// Количество случайных значений в проверке чисел с плавающей точкой.
+#define STRING_BUILDER_TEST_FLOATS 20000
+
+// Сравнивает результат построителя с результатом snprintf для одной строки формата.
+#define STRING_BUILDER_TEST_FORMAT(format, ...)                                                            \
+    do                                                                                                     \
+    {                                                                                                      \
+        char expected[STRING_BUILDER_TEST_BUFFER_SIZE];                                                    \
+        char actual[STRING_BUILDER_TEST_BUFFER_SIZE];                                                      \
+        string_builder builder;                                                                            \
+        string_builder_create_buffer(actual, sizeof(actual), &builder);                                    \
+        i32 length = snprintf(expected, sizeof(expected), format, __VA_ARGS__);                            \
+        string_builder_append_format(&builder, format, __VA_ARGS__);                                       \
+        if(builder.required != (u64)length || !string_equal(expected, actual))                             \
+        {                                                                                                  \
+            test_print("    %s:%u: \"%s\": expected \"%s\", got \"%s\"\n", __FILE__, __LINE__, format,     \
+                expected, actual                                                                           \
+            );                                                                                             \
+            return false;                                                                                  \
+        }                                                                                                  \
+    } while(0)
+
+// Возвращает следующее псевдослучайное число (xorshift64).
+static u64 string_builder_test_random(u64* state)
+{
+    u64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+bool test_string_builder_integers()
+{
+    STRING_BUILDER_TEST_FORMAT("%d %i %d %d", 0, -1, I32_MAX, I32_MIN);
+    STRING_BUILDER_TEST_FORMAT("%u %u %x %X", 0u, U32_MAX, 0xDEADBEEFu, 0xDEADBEEFu);
+    STRING_BUILDER_TEST_FORMAT("%lld %llu %llx", (long long)I64_MIN, (unsigned long long)U64_MAX, 0x123456789ABCDEFULL);
+    STRING_BUILDER_TEST_FORMAT("%hhd %hhu %hd %hu", -5, 300, -70000, 70000);
+    STRING_BUILDER_TEST_FORMAT("%zu %zd %ld", (usize)123456789, (isize)-42, -1234567L);
+
+    // Флаги, ширина и точность.
+    STRING_BUILDER_TEST_FORMAT("[%5d] [%-5d] [%05d] [%+d] [% d] [%+5d]", 42, 42, -42, 42, 42, -42);
+    STRING_BUILDER_TEST_FORMAT("[%.3d] [%8.3d] [%-8.3d] [%.0d] [%.0u]", 7, -7, 7, 0, 0u);
+    STRING_BUILDER_TEST_FORMAT("[%#x] [%#X] [%#x] [%#010x] [%08X] [%-8x]", 255u, 255u, 0u, 255u, 0xABCu, 0xABCu);
+    STRING_BUILDER_TEST_FORMAT("[%*d] [%-*d] [%*d] [%.*d]", 6, 1, 6, 1, -6, 1, 4, 1);
+    STRING_BUILDER_TEST_FORMAT("[%c] [%3c] [%-3c] [%%]", 'a', 'b', 'c');
+
+    // Каждое значение по степеням десяти и вблизи них (переходы двухцифровых шагов).
+    u64 value = 1;
+    for(u32 i = 0; i < 20; ++i, value *= 10)
+    {
+        STRING_BUILDER_TEST_FORMAT("%llu %llu %llu", (unsigned long long)value, (unsigned long long)(value - 1),
+            (unsigned long long)(value + 1)
+        );
+        STRING_BUILDER_TEST_FORMAT("%lld %llx", -(long long)value, (unsigned long long)value);
+    }
+
+    i32 local = 0;
+    STRING_BUILDER_TEST_FORMAT("%p %20p %-20p|", (void*)&local, (void*)&local, (void*)&local);
+
+    return true;
+}
+
+bool test_string_builder_strings()
+{
+    STRING_BUILDER_TEST_FORMAT("%s|%s", "text", "");
+    STRING_BUILDER_TEST_FORMAT("[%10s] [%-10s] [%.2s] [%10.2s] [%-10.2s]", "abc", "abc", "abc", "abc", "abc");
+    STRING_BUILDER_TEST_FORMAT("[%*s] [%-*s] [%.*s]", 8, "ab", 8, "ab", 1, "ab");
+
+    // С точностью строка может быть не завершена нуль-символом.
+    char unterminated[4] = { 'w', 'x', 'y', 'z' };
+    STRING_BUILDER_TEST_FORMAT("[%.4s] [%.3s]", unterminated, unterminated);
+
+    // Текст без спецификаторов и незавершенный спецификатор в конце строки.
+    char buffer[64];
+    string_builder builder;
+    string_builder_create_buffer(buffer, sizeof(buffer), &builder);
+    string_builder_append_format(&builder, "plain text");
+    TEST_CHECK(string_equal(buffer, "plain text"));
+    string_builder_append_format(&builder, " %-5");
+    TEST_CHECK(string_equal(buffer, "plain text %-5"));
+
+    return true;
+}
+
+bool test_string_builder_floats()
+{
+    STRING_BUILDER_TEST_FORMAT("%f %f %f %f", 0.0, -0.0, 1.0, -1.5);
+    STRING_BUILDER_TEST_FORMAT("%.0f %.0f %.0f %.0f %.0f", 0.5, 1.5, 2.5, 3.5, -0.5);
+    STRING_BUILDER_TEST_FORMAT("%.1f %.2f %.3f %.2f", 0.05, 0.125, 0.0005, 2.675);
+    STRING_BUILDER_TEST_FORMAT("%.9f %.9f %.9f", 1.0 / 3.0, 0.999999999, 123456.000000001);
+    STRING_BUILDER_TEST_FORMAT("%F %f %F %f", __builtin_inf(), -__builtin_inf(), __builtin_nan(""), __builtin_nan(""));
+
+    // Флаги, ширина и точность.
+    STRING_BUILDER_TEST_FORMAT("[%10.3f] [%-10.3f] [%010.3f] [%+.2f] [% .2f] [%+010.2f]", 3.14159, 3.14159, -3.14159,
+        2.5, 2.5, -2.5
+    );
+    STRING_BUILDER_TEST_FORMAT("[%*.*f] [%-*.*f] [%08f]", 12, 4, 2.0, 12, 4, 2.0, __builtin_inf());
+    STRING_BUILDER_TEST_FORMAT("[%#.0f] [%#.0f] [%#8.0f] [%#.2f] [%#.0e]", 3.0, -0.4, 7.0, 1.0, 3.0);
+
+    // Большие значения и высокая точность форматируются платформенной функцией.
+    STRING_BUILDER_TEST_FORMAT("%f %.2f %.12f %.15f", 1e20, -1.8446744073709552e19, 1.0 / 7.0, 0.1);
+    STRING_BUILDER_TEST_FORMAT("%Lf %.3Lf %12.2Lf", 1.25L, -2.0005L, 3.5L);
+
+    // Экспоненциальная и общая форма передаются платформенному форматированию.
+    STRING_BUILDER_TEST_FORMAT("%e %.3e %E %12.2e %-12.2e|", 12345.678, 0.000123, 1e300, -5.5, 5.5);
+    STRING_BUILDER_TEST_FORMAT("%g %g %.3g %G %o %#o", 100000.0, 1e-5, 3.14159, 1e20, 8u, 8u);
+
+    // Случайные значения разных порядков с каждой точностью быстрого пути.
+    u64 state = 0x2545F4914F6CDD1DULL;
+    for(u32 i = 0; i < STRING_BUILDER_TEST_FLOATS; ++i)
+    {
+        f64 mantissa = (f64)(string_builder_test_random(&state) >> 11) / (f64)(1ULL << 53);
+        u32 exponent = (u32)(string_builder_test_random(&state) % 24);
+        f64 value = mantissa;
+        for(u32 e = 0; e < exponent; ++e)
+        {
+            value *= 10.0;
+        }
+        value *= 1e-6;
+
+        i32 precision = (i32)(i % 10);
+        STRING_BUILDER_TEST_FORMAT("%.*f", precision, (i & 1) ? -value : value);
+    }
+
+    return true;
+}
+
+bool test_string_builder_growth()
+{
+    // Буфер вызывающей стороны не растет: строка усекается, а required учитывает полную длину.
+    char small[8];
+    string_builder builder;
+    string_builder_create_buffer(small, sizeof(small), &builder);
+    string_builder_append_format(&builder, "%s-%d", "abcdef", 12345);
+    TEST_CHECK(string_builder_truncated(&builder));
+    TEST_CHECK(builder.length == sizeof(small) - 1 && builder.required == 12);
+    TEST_CHECK(string_equal(small, "abcdef-"));
+
+    // Усеченная строка не продолжается последующими добавлениями.
+    string_builder_append_char(&builder, 'x', 3);
+    TEST_CHECK(builder.length == sizeof(small) - 1 && builder.required == 15);
+
+    string_builder_reset(&builder);
+    TEST_CHECK(builder.length == 0 && !string_builder_truncated(&builder) && small[0] == '\0');
+
+    // Буфер в линейном распределителе растет на месте и с копированием.
+    u64 arena_size = 4096;
+    void* arena_memory = memory_allocate(arena_size, 16, MEMORY_TAG_UNKNOWN);
+    TEST_CHECK(arena_memory != nullptr);
+    linear_allocator arena;
+    linear_allocator_create(arena_size, arena_memory, &arena);
+
+    TEST_CHECK(string_builder_create_arena(&arena, 4, &builder));
+    for(u32 i = 0; i < 100; ++i)
+    {
+        string_builder_append_u64(&builder, i % 10);
+    }
+    TEST_CHECK(builder.length == 100 && !string_builder_truncated(&builder));
+
+    // Выделение после буфера вынуждает копирование при следующем росте.
+    TEST_CHECK(linear_allocator_allocate(&arena, 16, 1) != nullptr);
+    string_builder_append_char(&builder, '-', 200);
+    TEST_CHECK(builder.length == 300 && !string_builder_truncated(&builder));
+    for(u32 i = 0; i < 100; ++i)
+    {
+        TEST_CHECK(builder.data[i] == (char)('0' + i % 10));
+    }
+    TEST_CHECK(builder.data[299] == '-' && builder.data[300] == '\0');
+
+    linear_allocator_destroy(&arena);
+    memory_free(arena_memory, arena_size, MEMORY_TAG_UNKNOWN);
+
+    // Покадровый буфер.
+    TEST_CHECK(string_builder_create_frame(0, &builder));
+    string_builder_append_char(&builder, 'f', STRING_BUILDER_DEFAULT_CAPACITY * 3);
+    TEST_CHECK(builder.length == STRING_BUILDER_DEFAULT_CAPACITY * 3 && !string_builder_truncated(&builder));
+
+    return true;
+}
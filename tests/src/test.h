@@ -0,0 +1,126 @@
+/*
+    @file test.h
+    @brief Общие функции программы проверки систем движка.
+    @author Дмитрий Скляр.
+    @version 1.0
+    @date 16-10-2026
+
+    @license Лицензия Apache, версия 2.0 («Лицензия»);
+          Вы не имеете права использовать этот файл без соблюдения условий Лицензии.
+          Копию Лицензии можно получить по адресу http://www.apache.org/licenses/LICENSE-2.0
+          Если иное не предусмотрено действующим законодательством или не согласовано в письменной форме,
+          программное обеспечение, распространяемое по Лицензии, распространяется на условиях «КАК ЕСТЬ»,
+          БЕЗ КАКИХ-ЛИБО ГАРАНТИЙ ИЛИ УСЛОВИЙ, явных или подразумеваемых. См. Лицензию для получения
+          информации о конкретных языках, регулирующих разрешения и ограничения по Лицензии.
+
+    @note Предоставляет:
+            - Проверку условий с выводом места и текста непрошедшей проверки
+            - Объявления проверок (проверки одной системы находятся в отдельном файле)
+
+    @note Особенности реализации:
+            - Платформенные подсистемы и система памяти инициализируются один раз в main()
+            - Проверка завершается на первом непрошедшем условии, остальные проверки выполняются
+            - Программа возвращает 1, если хотя бы одна проверка не прошла
+*/
+
+#pragma once
+
+#include <core/defines.h>
+
+// @brief Функция проверки.
+typedef bool (*test_fn)();
+
+/*
+    @brief Выводит форматируемую строку в стандартный поток вывода.
+    @param format Строка формата (см. string_builder_append_format()).
+    @param ... Аргументы строки формата.
+*/
+void test_print(const char* format, ...);
+
+/*
+    @brief Проверяет условие и завершает проверку с ошибкой, если оно ложно.
+    @param condition Проверяемое условие.
+*/
+#define TEST_CHECK(condition)                                                            \
+    do                                                                                   \
+    {                                                                                    \
+        if(!(condition))                                                                 \
+        {                                                                                \
+            test_print("    %s:%u: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            return false;                                                                \
+        }                                                                                \
+    } while(0)
+
+// Проверки списка.
+bool test_list_insert_remove();
+bool test_list_splice();
+bool test_list_foreach_safe();
+
+// Проверки LRU-кеша.
+bool test_lru_cache_put_get();
+bool test_lru_cache_evict_order();
+bool test_lru_cache_replace_evicts();
+bool test_lru_cache_remove();
+bool test_lru_cache_churn();
+
+// Проверки динамического массива.
+bool test_darray_virtual_grow();
+bool test_darray_tagged();
+bool test_darray_push_n();
+bool test_darray_insert_range();
+bool test_darray_remove_swap();
+bool test_darray_reserve_growth();
+
+// Проверки хеш-таблицы.
+bool test_hashmap_insert_get_remove();
+bool test_hashmap_emplace();
+bool test_hashmap_string_keys();
+bool test_hashmap_churn();
+
+// Проверки очередей.
+bool test_spsc_queue_fifo();
+bool test_spsc_queue_threads();
+bool test_mpmc_queue_fifo();
+bool test_mpmc_queue_threads();
+
+// Проверки поразрядной сортировки.
+bool test_radix_sort_u32();
+bool test_radix_sort_u64();
+bool test_radix_sort_parallel();
+bool test_radix_sort_darray();
+bool test_sort_key_order();
+
+// Проверки примитивов синхронизации потоков.
+bool test_mutex_lock();
+bool test_condition_handoff();
+bool test_semaphore_count();
+
+// Проверки топологии процессора.
+bool test_cpu_topology();
+
+// Проверки системы задач и параллельных циклов.
+bool test_job_fiber_nested_wait();
+bool test_job_fiber_nested_parallel_for();
+bool test_job_steal_contention();
+bool test_job_counters();
+bool test_parallel_for_ranges();
+bool test_parallel_for_darray();
+
+// Проверки построителя строк.
+bool test_string_builder_integers();
+bool test_string_builder_strings();
+bool test_string_builder_floats();
+bool test_string_builder_growth();
+
+// Проверки системы логирования.
+bool test_logger_without_memory();
+
+// Проверки системы памяти.
+bool test_memory_thread_stats();
+bool test_memory_pool_cache();
+bool test_memory_frame_peak();
+bool test_memory_large_block();
+
+// Проверки системы событий.
+bool test_event_register_send();
+bool test_event_register_during_send();
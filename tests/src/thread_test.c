@@ -0,0 +1,181 @@
+#include "test.h"
+
+#include <platform/thread.h>
+
+// Количество потоков в проверках.
+#define THREAD_TEST_THREADS 4
+// Количество захватов мьютекса каждым потоком.
+#define THREAD_TEST_LOCKS 50000
+// Количество передач хода между потоками через условную переменную.
+#define THREAD_TEST_HANDOFFS 2000
+// Количество ожиданий семафора каждым потоком.
+#define THREAD_TEST_WAITS 1000
+// Время ожидания в проверках истечения времени (мс).
+#define THREAD_TEST_TIMEOUT_MS 5
+
+typedef struct thread_test_shared {
+    platform_mutex mutex;
+    platform_condition condition;
+    platform_semaphore semaphore;
+    // Счетчик, защищенный мьютексом (изменяется неатомарно).
+    u64 counter;
+    // Поток, которому передан ход (0 - основной, 1 - рабочий).
+    u32 turn;
+} thread_test_shared;
+
+static u32 thread_test_lock_run(void* data)
+{
+    thread_test_shared* shared = data;
+    for(u32 i = 0; i < THREAD_TEST_LOCKS; ++i)
+    {
+        platform_mutex_lock(&shared->mutex);
+        shared->counter++;
+        platform_mutex_unlock(&shared->mutex);
+    }
+    return 0;
+}
+
+static u32 thread_test_handoff_run(void* data)
+{
+    thread_test_shared* shared = data;
+    for(u32 i = 0; i < THREAD_TEST_HANDOFFS; ++i)
+    {
+        platform_mutex_lock(&shared->mutex);
+        while(shared->turn != 1)
+        {
+            platform_condition_wait(&shared->condition, &shared->mutex, PLATFORM_WAIT_INFINITE);
+        }
+        shared->counter++;
+        shared->turn = 0;
+        platform_condition_broadcast(&shared->condition);
+        platform_mutex_unlock(&shared->mutex);
+    }
+    return 0;
+}
+
+static u32 thread_test_semaphore_run(void* data)
+{
+    thread_test_shared* shared = data;
+    u32 failures = 0;
+    for(u32 i = 0; i < THREAD_TEST_WAITS; ++i)
+    {
+        failures += !platform_semaphore_wait(&shared->semaphore, PLATFORM_WAIT_INFINITE);
+    }
+    return failures;
+}
+
+// Выполняет функцию во всех потоках и дожидается их завершения.
+static void thread_test_run_threads(platform_thread_start_fn func, thread_test_shared* shared)
+{
+    platform_thread threads[THREAD_TEST_THREADS];
+    for(u32 i = 0; i < THREAD_TEST_THREADS; ++i)
+    {
+        platform_thread_create(func, shared, "thread_test", &threads[i]);
+    }
+
+    for(u32 i = 0; i < THREAD_TEST_THREADS; ++i)
+    {
+        platform_thread_join(&threads[i], nullptr);
+    }
+}
+
+bool test_mutex_lock()
+{
+    thread_test_shared shared = { 0 };
+    platform_mutex_create(&shared.mutex);
+
+    // Мьютекс не рекурсивный: повторный захват без ожидания не удается.
+    TEST_CHECK(platform_mutex_try_lock(&shared.mutex));
+    TEST_CHECK(!platform_mutex_try_lock(&shared.mutex));
+    platform_mutex_unlock(&shared.mutex);
+    TEST_CHECK(platform_mutex_try_lock(&shared.mutex));
+    platform_mutex_unlock(&shared.mutex);
+
+    // Неатомарные увеличения под мьютексом не теряются.
+    thread_test_run_threads(thread_test_lock_run, &shared);
+    TEST_CHECK(shared.counter == (u64)THREAD_TEST_THREADS * THREAD_TEST_LOCKS);
+    TEST_CHECK(shared.mutex.state == 0);
+
+    return true;
+}
+
+bool test_condition_handoff()
+{
+    thread_test_shared shared = { 0 };
+    platform_mutex_create(&shared.mutex);
+    platform_condition_create(&shared.condition);
+
+    // Без сигнала ожидание завершается по времени (ложные пробуждения допустимы, но не постоянно).
+    platform_mutex_lock(&shared.mutex);
+    bool timed_out = false;
+    for(u32 i = 0; i < 3 && !timed_out; ++i)
+    {
+        timed_out = !platform_condition_wait(&shared.condition, &shared.mutex, THREAD_TEST_TIMEOUT_MS);
+    }
+    TEST_CHECK(timed_out);
+    // После ожидания мьютекс снова захвачен текущим потоком.
+    TEST_CHECK(!platform_mutex_try_lock(&shared.mutex));
+    platform_mutex_unlock(&shared.mutex);
+
+    // Ход передается между потоками, ни один сигнал не теряется.
+    platform_thread thread;
+    TEST_CHECK(platform_thread_create(thread_test_handoff_run, &shared, "thread_test", &thread));
+    for(u32 i = 0; i < THREAD_TEST_HANDOFFS; ++i)
+    {
+        platform_mutex_lock(&shared.mutex);
+        shared.turn = 1;
+        platform_condition_signal(&shared.condition);
+        while(shared.turn != 0)
+        {
+            platform_condition_wait(&shared.condition, &shared.mutex, PLATFORM_WAIT_INFINITE);
+        }
+        platform_mutex_unlock(&shared.mutex);
+    }
+    platform_thread_join(&thread, nullptr);
+    TEST_CHECK(shared.counter == THREAD_TEST_HANDOFFS);
+
+    return true;
+}
+
+bool test_semaphore_count()
+{
+    thread_test_shared shared = { 0 };
+    platform_semaphore_create(&shared.semaphore, 2);
+
+    TEST_CHECK(platform_semaphore_try_wait(&shared.semaphore));
+    TEST_CHECK(platform_semaphore_try_wait(&shared.semaphore));
+    TEST_CHECK(!platform_semaphore_try_wait(&shared.semaphore));
+    TEST_CHECK(!platform_semaphore_wait(&shared.semaphore, THREAD_TEST_TIMEOUT_MS));
+
+    platform_semaphore_post(&shared.semaphore, 1);
+    TEST_CHECK(platform_semaphore_wait(&shared.semaphore, THREAD_TEST_TIMEOUT_MS));
+
+    // Каждое увеличение счетчика пробуждает ровно одно ожидание.
+    platform_thread threads[THREAD_TEST_THREADS];
+    for(u32 i = 0; i < THREAD_TEST_THREADS; ++i)
+    {
+        TEST_CHECK(platform_thread_create(thread_test_semaphore_run, &shared, "thread_test", &threads[i]));
+    }
+
+    // Счетчик увеличивается по 4 за раз, поочередно одним вызовом и двумя (на 1 и на 3).
+    for(u32 i = 0; i < THREAD_TEST_THREADS * THREAD_TEST_WAITS; i += 4)
+    {
+        platform_semaphore_post(&shared.semaphore, i % 8 == 0 ? 4 : 1);
+        if(i % 8 != 0)
+        {
+            platform_semaphore_post(&shared.semaphore, 3);
+        }
+    }
+
+    u32 failures = 0;
+    for(u32 i = 0; i < THREAD_TEST_THREADS; ++i)
+    {
+        u32 result = 0;
+        platform_thread_join(&threads[i], &result);
+        failures += result;
+    }
+    TEST_CHECK(failures == 0);
+    TEST_CHECK(!platform_semaphore_try_wait(&shared.semaphore));
+
+    return true;
+}